@@ -2,7 +2,9 @@
 precision mediump float;
 layout(location = 0) in vec3 aPos;
 layout(location = 1) in vec3 aColor;
-uniform mat4 uMVP;
+layout(std140) uniform FrameUniforms {
+    mat4 uMVP;
+};
 out vec3 vColor;
 void main() {
     vColor = aColor;
@@ -5,12 +5,42 @@
 #include <memory>
 #include <vector>
 #include <cstring>
+#include <cmath>
 
 #define XR_USE_PLATFORM_ANDROID
 #define XR_USE_GRAPHICS_API_OPENGL_ES
 #include <openxr/openxr.h>
 #include <openxr/openxr_platform.h>
 
+#include "frame_pipeline.h"
+#include "dynamic_buffer.h"
+#include "frame_arena.h"
+#include "gpu_timer.h"
+#include "idle_looper.h"
+#include "upload_thread.h"
+#include "session_lifecycle.h"
+#include "trace.h"
+#include "xr_events.h"
+
+// =================================================================================================
+// --- Pipelined Frame Loop Switch ---
+// Define this to run xrWaitFrame/xrBeginFrame on a separate wait thread (frame_pipeline.h) so the
+// wait for the next frame overlaps rendering of the current one. This thread keeps the GL context
+// and calls xrEndFrame.
+//#define PIPELINED_FRAME_LOOP
+// =================================================================================================
+
+// How long renderFrame waits for the pipeline to hand over a frame before going back to polling.
+#define FRAME_ACQUIRE_TIMEOUT_MS 100
+
+// Per-frame uniform data streamed through AppState::frameData.
+#define FRAME_UNIFORMS_BINDING 0
+#define FRAME_DATA_BYTES (64 * 1024)
+// Transient per-frame CPU data (projection views) comes from AppState::frameArena.
+#define FRAME_ARENA_BYTES (16 * 1024)
+// GPU time per eye and pass (AppState::gpuTimer) is logged every this many frames.
+#define GPU_TIMER_LOG_FRAMES 300
+
 #define TAG "OverlayAppBlue"
 #define LOGI(...) __android_log_print(ANDROID_LOG_INFO, TAG, __VA_ARGS__)
 #define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
@@ -66,9 +96,9 @@ struct AppState {
     XrInstance instance = XR_NULL_HANDLE;
     XrSystemId systemId = XR_NULL_SYSTEM_ID;
     XrSession session = XR_NULL_HANDLE;
-    XrSessionState sessionState = XR_SESSION_STATE_UNKNOWN;
+    // State machine and transition timestamps, see session_lifecycle.h.
+    SessionLifecycle lifecycle;
     XrSpace appSpace = XR_NULL_HANDLE;
-    bool sessionRunning = false;
     XrViewConfigurationType viewConfigType;
     XrEnvironmentBlendMode blendMode = XR_ENVIRONMENT_BLEND_MODE_OPAQUE;
 
@@ -92,13 +122,48 @@ struct AppState {
 
     // 🔹 Add these for your 3D overlay
     GLuint shaderProg = 0;
-    GLuint vao = 0;
+    GLuint vao = 0; // built once both cube uploads are ready
+
+    // Streams mesh/texture data on a shared context so loads never stall a frame.
+    UploadThread uploader;
+    UploadRequest cubeVertexUpload;
+    UploadRequest cubeIndexUpload;
+
+    // Ring for per-frame vertex/instance/uniform data (dynamic_buffer.h).
+    DynamicBuffer frameData;
+
+    // Reset every frame; keeps the frame path free of heap allocations.
+    FrameArena frameArena;
+
+    // Per eye: the clear and the cube (opaque) pass, read back a few frames late.
+    GpuTimer gpuTimer;
 
+#if defined(PIPELINED_FRAME_LOOP)
+    FramePipeline pipeline;
+#endif
+
+
+    // Main loop pacing; other threads can wake it with idleLooperWake.
+    IdleLooper idleLooper;
+
+    // OpenXR event handlers, see xr_events.h.
+    XrEventDispatcher events;
 };
 
-void pollEvents(AppState* appState);
+static void onSessionStateChanged(AppState* appState, const XrEventDataSessionStateChanged& event);
+static void onInstanceLossPending(AppState* appState, const XrEventDataInstanceLossPending& event);
+#if defined(PIPELINED_FRAME_LOOP)
+static void onSessionBegun(void* user);
+static void onSessionStopped(void* user);
+#endif
 void renderFrame(AppState* appState);
 
+// MainActivity.onCreate: base's FOCUSED time from the launch intent, 0 if base didn't launch us.
+extern "C" JNIEXPORT void JNICALL
+Java_com_example_addr2_MainActivity_setLaunchReference(JNIEnv* env, jclass clazz, jlong baseFocusedNs) {
+    sessionLifecycleSetLaunchReference(static_cast<uint64_t>(baseFocusedNs));
+}
+
 
 
 GLuint compileShader(GLenum type, const char* src) {
@@ -164,17 +229,36 @@ uint16_t cubeIndices[] = {
 
 void android_main(struct android_app* app) {
     LOGI("Blue Overlay app starting up.");
+    // Left open by the early returns below, which end the app anyway.
+    TRACE_BEGIN("startup");
 
     EGLDisplay display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
     eglInitialize(display, nullptr, nullptr);
-    EGLConfig config;
+    EGLConfig config = nullptr;
+    // Rendering goes to swapchain images, so the config needs no window surfaces, only pbuffers
+    // (the default is window surfaces, which surfaceless EGL has none of).
     const EGLint configAttribs[] = {
             EGL_RENDERABLE_TYPE, EGL_OPENGL_ES3_BIT,
+            EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
             EGL_ALPHA_SIZE, 8,
             EGL_NONE
     };
-    EGLint numConfigs;
+    EGLint numConfigs = 0;
     eglChooseConfig(display, configAttribs, &config, 1, &numConfigs);
+    if (numConfigs == 0) {
+        // The swapchain images carry the alpha, not this config; any GLES3 config will do.
+        const EGLint anyConfigAttribs[] = {
+                EGL_RENDERABLE_TYPE, EGL_OPENGL_ES3_BIT,
+                EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+                EGL_NONE
+        };
+        LOGI("No EGL config with 8-bit alpha, taking any GLES3 config");
+        eglChooseConfig(display, anyConfigAttribs, &config, 1, &numConfigs);
+    }
+    if (numConfigs == 0) {
+        LOGE("No GLES3 EGL config: 0x%X", eglGetError());
+        return;
+    }
     const EGLint contextAttribs[] = {EGL_CONTEXT_CLIENT_VERSION, 3, EGL_NONE};
     EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
     eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context);
@@ -200,29 +284,25 @@ void android_main(struct android_app* app) {
 
     GLuint shaderProgram = createProgram(vertexSrc.c_str(), fragmentSrc.c_str());
     appState.shaderProg = shaderProgram;
+    glUniformBlockBinding(shaderProgram, glGetUniformBlockIndex(shaderProgram, "FrameUniforms"),
+                          FRAME_UNIFORMS_BINDING);
+    if (!dynamicBufferInit(&appState.frameData, FRAME_DATA_BYTES, 3)) {
+        LOGE("Failed to create the per-frame data ring!");
+    }
 
-    // ✅ Now initialize buffers (this part you asked about)
-    GLuint vao, vbo, ebo;
-    glGenVertexArrays(1, &vao);
-    glGenBuffers(1, &vbo);
-    glGenBuffers(1, &ebo);
-
-    glBindVertexArray(vao);
-
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(cubeVertices), cubeVertices, GL_STATIC_DRAW);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(cubeIndices), cubeIndices, GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-
-    glBindVertexArray(0);
-
-    appState.vao = vao;
+    // Cube VBO/EBO are uploaded on the upload thread; renderFrame builds the VAO once both
+    // fences have signalled and skips the cube until then.
+    if (!uploadThreadStart(&appState.uploader, display, config, context)) {
+        LOGE("Failed to start the upload thread!");
+    }
+    appState.cubeVertexUpload.target = GL_ARRAY_BUFFER;
+    appState.cubeVertexUpload.data = cubeVertices;
+    appState.cubeVertexUpload.size = sizeof(cubeVertices);
+    uploadThreadSubmit(&appState.uploader, &appState.cubeVertexUpload);
+    appState.cubeIndexUpload.target = GL_ELEMENT_ARRAY_BUFFER;
+    appState.cubeIndexUpload.data = cubeIndices;
+    appState.cubeIndexUpload.size = sizeof(cubeIndices);
+    uploadThreadSubmit(&appState.uploader, &appState.cubeIndexUpload);
 
     PFN_xrInitializeLoaderKHR xrInitializeLoaderKHR;
     xrGetInstanceProcAddr(XR_NULL_HANDLE, "xrInitializeLoaderKHR", (PFN_xrVoidFunction*)&xrInitializeLoaderKHR);
@@ -425,68 +505,121 @@ void android_main(struct android_app* app) {
     glDepthFunc(GL_LEQUAL);
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    gpuTimerInit(&appState.gpuTimer);
 
-
+    TRACE_END();
     LOGI("Blue Overlay App initialized successfully");
 
+    // Blocks on the looper while nothing is rendered instead of spinning (idle_looper.h).
+    frameArenaInit(&appState.frameArena, FRAME_ARENA_BYTES);
+    idleLooperInit(&appState.idleLooper, app->looper);
+    SessionCallbacks sessionCallbacks;
+#if defined(PIPELINED_FRAME_LOOP)
+    sessionCallbacks.user = &appState;
+    sessionCallbacks.begun = onSessionBegun;
+    sessionCallbacks.stopped = onSessionStopped;
+#endif
+    sessionLifecycleInit(&appState.lifecycle, appState.session, appState.viewConfigType, SESSION_END_ON_STOPPING,
+                         sessionCallbacks, TAG);
+    xrEventsInit(&appState.events, &appState);
+    xrEventsOn<onSessionStateChanged>(&appState.events);
+    xrEventsOn<onInstanceLossPending>(&appState.events);
     while (!app->destroyRequested) {
-        struct android_poll_source* source;
-        while (ALooper_pollOnce(0, nullptr, nullptr, (void**)&source) >= 0) {
-            if (source) source->process(app, source);
-        }
-        pollEvents(&appState);
+        const bool rendering = appState.lifecycle.running && appState.resumed;
+        idleLooperPump(&appState.idleLooper, app, idleLooperTimeoutMs(appState.lifecycle.state, rendering));
+        xrEventsPoll(&appState.events, appState.instance);
         renderFrame(&appState);
     }
+    idleLooperDestroy(&appState.idleLooper);
+    gpuTimerDestroy(&appState.gpuTimer);
+    uploadThreadStop(&appState.uploader);
+    dynamicBufferDestroy(&appState.frameData);
+    frameArenaDestroy(&appState.frameArena);
 }
 
-void pollEvents(AppState* appState) {
-    XrEventDataBuffer eventData = {XR_TYPE_EVENT_DATA_BUFFER};
-    while (xrPollEvent(appState->instance, &eventData) == XR_SUCCESS) {
-        if (eventData.type == XR_TYPE_EVENT_DATA_SESSION_STATE_CHANGED) {
-            auto stateEvent = *reinterpret_cast<const XrEventDataSessionStateChanged*>(&eventData);
-            appState->sessionState = stateEvent.state;
-            LOGI("Blue Overlay session state changed to: %d", appState->sessionState);
-
-            if (appState->sessionState == XR_SESSION_STATE_READY) {
-                XrSessionBeginInfo beginInfo = {XR_TYPE_SESSION_BEGIN_INFO};
-                beginInfo.primaryViewConfigurationType = appState->viewConfigType;
-                if (XR_SUCCEEDED(xrBeginSession(appState->session, &beginInfo))) {
-                    appState->sessionRunning = true;
-                    LOGI("Blue Overlay session started successfully");
-                }
-            } else if (appState->sessionState == XR_SESSION_STATE_STOPPING) {
-                appState->sessionRunning = false;
-                xrEndSession(appState->session);
-                LOGI("Blue Overlay session ended");
-            }
-        }
-        eventData = {XR_TYPE_EVENT_DATA_BUFFER};
+#if defined(PIPELINED_FRAME_LOOP)
+static void onSessionBegun(void* user) {
+    auto* appState = static_cast<AppState*>(user);
+    framePipelineStart(&appState->pipeline, appState->session, appState->blendMode);
+}
+
+static void onSessionStopped(void* user) {
+    framePipelineStop(&static_cast<AppState*>(user)->pipeline);
+}
+#endif
+
+static void onSessionStateChanged(AppState* appState, const XrEventDataSessionStateChanged& event) {
+    sessionLifecycleHandleState(&appState->lifecycle, event);
+}
+
+static void onInstanceLossPending(AppState* appState, const XrEventDataInstanceLossPending&) {
+    LOGE("Blue Overlay instance is about to be lost, exiting");
+    sessionLifecycleStop(&appState->lifecycle, false);
+    ANativeActivity_finish(appState->app->activity);
+}
+
+// VAOs aren't shared between contexts, so the cube's is built here from the uploaded buffers.
+static bool cubeReady(AppState* appState) {
+    if (appState->vao != 0) {
+        return true;
     }
+    if (!uploadRequestReady(&appState->cubeVertexUpload) || !uploadRequestReady(&appState->cubeIndexUpload)) {
+        return false;
+    }
+    glGenVertexArrays(1, &appState->vao);
+    glBindVertexArray(appState->vao);
+
+    glBindBuffer(GL_ARRAY_BUFFER, appState->cubeVertexUpload.name);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, appState->cubeIndexUpload.name);
+
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+
+    glBindVertexArray(0);
+    LOGI("Cube buffers uploaded, VAO %u ready", appState->vao);
+    return true;
 }
 
 void renderFrame(AppState* appState) {
-    if (!appState->sessionRunning || !appState->resumed) return;
+    if (!appState->lifecycle.running || !appState->resumed) return;
+    TRACE_SCOPE("renderFrame");
 
     XrFrameState frameState = {XR_TYPE_FRAME_STATE};
+#if defined(PIPELINED_FRAME_LOOP)
+    // Already waited and begun on the wait thread.
+    uint64_t frameId = 0;
+    if (!framePipelineAcquire(&appState->pipeline, &frameState, &frameId, FRAME_ACQUIRE_TIMEOUT_MS)) {
+        return;
+    }
+    XrResult r;
+#else
+    TRACE_BEGIN("xrWaitFrame");
     XrResult r = xrWaitFrame(appState->session, nullptr, &frameState);
+    TRACE_END();
     if (XR_FAILED(r)) {
         LOGE("xrWaitFrame failed: 0x%X", r);
         return;
     }
 
+    TRACE_BEGIN("xrBeginFrame");
     r = xrBeginFrame(appState->session, nullptr);
+    TRACE_END();
     if (XR_FAILED(r)) {
         LOGE("xrBeginFrame failed: 0x%X", r);
         return;
     }
+#endif
 
     bool haveLayer = false;
     static XrCompositionLayerProjection projectionLayer = {XR_TYPE_COMPOSITION_LAYER_PROJECTION};
-    std::vector<XrCompositionLayerProjectionView> projectionLayerViews(appState->viewCount,
-                                                                       {XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW});
+    frameArenaReset(&appState->frameArena);
+    XrCompositionLayerProjectionView* projectionLayerViews = frameArenaArray(
+            &appState->frameArena, appState->viewCount, XrCompositionLayerProjectionView{XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW});
     std::vector<XrView>& views = appState->views;
 
-    if (frameState.shouldRender) {
+    if (frameState.shouldRender && projectionLayerViews != nullptr) {
         // Locate views
         XrViewLocateInfo viewLocateInfo = {XR_TYPE_VIEW_LOCATE_INFO};
         viewLocateInfo.viewConfigurationType = appState->viewConfigType;
@@ -501,18 +634,44 @@ void renderFrame(AppState* appState) {
             LOGE("xrLocateViews failed: 0x%X", r);
             // Continue but don't present a layer
         } else {
+            // Per-frame uniforms go through the ring: written once, bound per draw below.
+            DynamicAllocation frameUniforms;
+            if (dynamicBufferBeginFrame(&appState->frameData)) {
+                // Simple MVP rotation matrix
+                float t = (float)(frameState.predictedDisplayTime % 1000000000LL) / 1e9f;
+                float angle = t * 1.5f; // rotation speed
+
+                float mvp[16] = {
+                        std::cos(angle), 0,  std::sin(angle), 0,
+                        0,               1,  0,               0,
+                        -std::sin(angle), 0,  std::cos(angle), -2.5f,
+                        0,               0,  0,               1
+                };
+                frameUniforms = dynamicBufferAlloc(&appState->frameData, sizeof(mvp), 0);
+                if (frameUniforms.data) {
+                    memcpy(frameUniforms.data, mvp, sizeof(mvp));
+                }
+                dynamicBufferEndFrame(&appState->frameData);
+            }
+
             // Render each eye
+            gpuTimerBeginFrame(&appState->gpuTimer);
             for (uint32_t eye = 0; eye < appState->viewCount; ++eye) {
+                TRACE_SCOPE(traceViewSection(eye));
                 EyeSwapchain &eyeSc = appState->eyeSwapchains[eye];
                 uint32_t imageIndex = 0;
+                TRACE_BEGIN("xrAcquireSwapchainImage");
                 r = xrAcquireSwapchainImage(eyeSc.swapchain, nullptr, &imageIndex);
+                TRACE_END();
                 if (XR_FAILED(r)) {
                     LOGE("xrAcquireSwapchainImage failed for eye %u: 0x%X", eye, r);
                     continue;
                 }
 
                 XrSwapchainImageWaitInfo waitInfo = {XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO, nullptr, XR_INFINITE_DURATION};
+                TRACE_BEGIN("xrWaitSwapchainImage");
                 r = xrWaitSwapchainImage(eyeSc.swapchain, &waitInfo);
+                TRACE_END();
                 if (XR_FAILED(r)) {
                     LOGE("xrWaitSwapchainImage failed for eye %u: 0x%X", eye, r);
                     // still try to release to be safe
@@ -523,36 +682,33 @@ void renderFrame(AppState* appState) {
                 // Bind GL framebuffer that uses runtime-provided texture
                 glBindFramebuffer(GL_FRAMEBUFFER, eyeSc.framebuffers[imageIndex]);
                 glViewport(0, 0, eyeSc.width, eyeSc.height);
+                gpuTimerSetView(&appState->gpuTimer, eye);
+                gpuTimerBeginPass(&appState->gpuTimer, GPU_TIMER_PASS_CLEAR);
                 glClearColor(0.0f, 0.0f, 0.5f, 0.1f);
                 glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+                gpuTimerEndPass(&appState->gpuTimer);
 
                 glEnable(GL_BLEND);
                 glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-                glUseProgram(appState->shaderProg);
-                glBindVertexArray(appState->vao);
-
-            // Simple MVP rotation matrix
-                float t = (float)(frameState.predictedDisplayTime % 1000000000LL) / 1e9f;
-                float angle = t * 1.5f; // rotation speed
-
-                float mvp[16] = {
-                        cos(angle), 0,  sin(angle), 0,
-                        0,          1,  0,          0,
-                        -sin(angle), 0,  cos(angle), -2.5f,
-                        0,          0,  0,          1
-                };
-
-
-                GLint loc = glGetUniformLocation(appState->shaderProg, "uMVP");
-                glUniformMatrix4fv(loc, 1, GL_FALSE, mvp);
+                // Clear only until the cube's buffers have arrived.
+                if (cubeReady(appState) && frameUniforms.size > 0) {
+                    gpuTimerBeginPass(&appState->gpuTimer, GPU_TIMER_PASS_OPAQUE);
+                    glUseProgram(appState->shaderProg);
+                    glBindVertexArray(appState->vao);
+                    glBindBufferRange(GL_UNIFORM_BUFFER, FRAME_UNIFORMS_BINDING, appState->frameData.buffer,
+                                      frameUniforms.offset, frameUniforms.size);
 
-                glDrawElements(GL_TRIANGLES, sizeof(cubeIndices)/sizeof(cubeIndices[0]), GL_UNSIGNED_SHORT, 0);
+                    glDrawElements(GL_TRIANGLES, sizeof(cubeIndices)/sizeof(cubeIndices[0]), GL_UNSIGNED_SHORT, 0);
+                    gpuTimerEndPass(&appState->gpuTimer);
+                }
 
                 // TODO: convert xr pose/fov to GL matrices and draw your scene here.
 
                 // Release swapchain image
+                TRACE_BEGIN("xrReleaseSwapchainImage");
                 r = xrReleaseSwapchainImage(eyeSc.swapchain, nullptr);
+                TRACE_END();
                 if (XR_FAILED(r)) {
                     LOGE("xrReleaseSwapchainImage failed for eye %u: 0x%X", eye, r);
                 }
@@ -566,10 +722,15 @@ void renderFrame(AppState* appState) {
                 projectionLayerViews[eye].subImage.imageRect.extent = { (int32_t)eyeSc.width, (int32_t)eyeSc.height };
             }
 
+            gpuTimerEndFrame(&appState->gpuTimer);
+            if (appState->gpuTimer.frame % GPU_TIMER_LOG_FRAMES == 0) {
+                gpuTimerLogAndReset(&appState->gpuTimer, TAG);
+            }
+
             // Only set up the projection layer if at least one view had a valid swapchain
             projectionLayer.space = appState->appSpace;
-            projectionLayer.viewCount = (uint32_t)projectionLayerViews.size();
-            projectionLayer.views = projectionLayerViews.data();
+            projectionLayer.viewCount = appState->viewCount;
+            projectionLayer.views = projectionLayerViews;
             haveLayer = true;
         }
     }
@@ -580,10 +741,11 @@ void renderFrame(AppState* appState) {
     endInfo.environmentBlendMode = appState->blendMode;
 
 
+    // Must outlive the end-frame call below.
+    const XrCompositionLayerBaseHeader* layers[] = {
+            reinterpret_cast<const XrCompositionLayerBaseHeader*>(&projectionLayer)
+    };
     if (haveLayer) {
-        const XrCompositionLayerBaseHeader* layers[] = {
-                reinterpret_cast<const XrCompositionLayerBaseHeader*>(&projectionLayer)
-        };
         endInfo.layerCount = 1;
         endInfo.layers = layers;
     } else {
@@ -591,9 +753,17 @@ void renderFrame(AppState* appState) {
         endInfo.layers = nullptr;
     }
 
+#if defined(PIPELINED_FRAME_LOOP)
+    r = framePipelineEndFrame(&appState->pipeline, frameId, &endInfo);
+#else
+    TRACE_BEGIN("xrEndFrame");
     r = xrEndFrame(appState->session, &endInfo);
+    TRACE_END();
+#endif
     if (XR_FAILED(r)) {
         LOGE("xrEndFrame failed: 0x%X", r);
+    } else {
+        sessionLifecycleFrameEnded(&appState->lifecycle, endInfo.layerCount);
     }
 }
 
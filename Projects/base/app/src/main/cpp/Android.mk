@@ -3,13 +3,24 @@ LOCAL_PATH := $(call my-dir)
 include $(CLEAR_VARS)
 
 LOCAL_MODULE := openxr_overlay_app
-LOCAL_SRC_FILES := main.cpp
+COMMON_DIR := ../../../../../common/cpp
+LOCAL_SRC_FILES := main.cpp $(COMMON_DIR)/demo_scene.cpp $(COMMON_DIR)/render_backend.cpp \
+        $(COMMON_DIR)/gl_capture.cpp $(COMMON_DIR)/gpu_timer.cpp
 LOCAL_CPPFLAGS := -std=c++17 -fexceptions -frtti
 LOCAL_CFLAGS := -DANDROID -DXR_USE_PLATFORM_ANDROID
+# ndk-build GL_CAPTURE=1: record the render path for host/gl_replay (common/cpp/gl_capture.h)
+ifeq ($(GL_CAPTURE),1)
+LOCAL_CFLAGS += -DGL_CAPTURE
+endif
+# ndk-build TRACE_MARKERS=0: without the frame loop's ATrace sections (common/cpp/trace.h)
+ifeq ($(TRACE_MARKERS),0)
+LOCAL_CFLAGS += -DTRACE_MARKERS=0
+endif
 LOCAL_LDLIBS := -llog -landroid -lEGL -lGLESv3
 
 # OpenXR
 LOCAL_C_INCLUDES += $(LOCAL_PATH)/openxr/include
+LOCAL_C_INCLUDES += $(LOCAL_PATH)/$(COMMON_DIR)
 LOCAL_LDLIBS += -L$(LOCAL_PATH)/openxr/libs/arm64-v8a -lopenxr_loader
 
 # Android Native App Glue
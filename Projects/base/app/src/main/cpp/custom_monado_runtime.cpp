@@ -5,27 +5,41 @@
 #include <memory>
 #include <vector>
 #include <cstring>
+#include <cstdio>
 #include <jni.h>
 
 #define XR_USE_PLATFORM_ANDROID
 #define XR_USE_GRAPHICS_API_OPENGL_ES
 #include <openxr/openxr.h>
 #include <openxr/openxr_platform.h>
-#include <chrono>
 
-// =======================
-// FPS Globals
-// =======================
-
-// Frame counter
-static int g_frameCount = 0;
-
-// Frames per second value
-static float g_fps = 0.0f;
-
-// Last recorded time point (for FPS calculation)
-static std::chrono::time_point<std::chrono::high_resolution_clock> g_lastTimePoint =
-        std::chrono::high_resolution_clock::now();
+#include "alloc_counter.h"
+#include "frame_arena.h"
+#include "frame_pacing.h"
+#include "frame_pipeline.h"
+#include "frame_stats.h"
+#include "idle_looper.h"
+#include "session_lifecycle.h"
+#include "state_channel.h"
+#include "trace.h"
+#include "xr_events.h"
+
+// =================================================================================================
+// --- Pipelined Frame Loop Switch ---
+// Define this to run xrWaitFrame/xrBeginFrame on a separate wait thread (frame_pipeline.h) so the
+// wait for the next frame overlaps rendering of the current one. This thread keeps the GL context
+// and calls xrEndFrame.
+//#define PIPELINED_FRAME_LOOP
+// =================================================================================================
+
+// How long renderFrame waits for the pipeline to hand over a frame before going back to polling.
+#define FRAME_ACQUIRE_TIMEOUT_MS 100
+
+// Transient per-frame data (views, projection views) comes from AppState::frameArena.
+#define FRAME_ARENA_BYTES (16 * 1024)
+
+// The frame stats summary is logged this often.
+#define FRAME_STATS_LOG_INTERVAL_NS 1000000000ull
 
 #define TAG "BaseApp"
 #define LOGI(...) __android_log_print(ANDROID_LOG_INFO, TAG, __VA_ARGS__)
@@ -37,9 +51,9 @@ struct AppState {
     XrInstance instance = XR_NULL_HANDLE;
     XrSystemId systemId = XR_NULL_SYSTEM_ID;
     XrSession session = XR_NULL_HANDLE;
-    XrSessionState sessionState = XR_SESSION_STATE_UNKNOWN;
+    // State machine and transition timestamps, see session_lifecycle.h.
+    SessionLifecycle lifecycle;
     XrSpace appSpace = XR_NULL_HANDLE;
-    bool sessionRunning = false;
     XrViewConfigurationType viewConfigType;
     XrEnvironmentBlendMode blendMode;
 
@@ -48,6 +62,36 @@ struct AppState {
     std::vector<GLuint> framebuffers;
     uint32_t width = 1024;
     uint32_t height = 1024;
+
+#if defined(PIPELINED_FRAME_LOOP)
+    FramePipeline pipeline;
+#endif
+
+    // Missed frames and wait/frame-time histograms, see getFramePacingReport.
+    FramePacing pacing;
+
+    // Per-frame timing records, written by the render thread only; see getFrameStats.
+    FrameStatsRing frameStats;
+    uint64_t frameStatsLogNs = 0;
+    uint64_t frameStatsLogHead = 0;
+    AllocCounts allocsAtLog; // FRAME_ALLOC_COUNTER builds only
+
+    // Reset every frame; keeps the frame path free of heap allocations.
+    FrameArena frameArena;
+
+    // Main loop pacing; other threads can wake it with idleLooperWake.
+    IdleLooper idleLooper;
+
+    // OpenXR event handlers, see xr_events.h.
+    XrEventDispatcher events;
+
+    // Live state for the overlays (state_channel.h): published every frame, served from the looper.
+    StateChannel stateChannel;
+    StateSnapshot state;
+
+    // This thread's JNIEnv for calls into MainActivity, null without a VM (host builds).
+    JNIEnv* jni = nullptr;
+    jmethodID onSessionFocusedMethod = nullptr; // MainActivity.onSessionFocused(long)
 };
 
 // Global pointer to the application state
@@ -59,106 +103,227 @@ Java_com_example_androidsamsung_MainActivity_isSessionFocused(JNIEnv* env, jobje
     if (g_appState == nullptr) {
         return false;
     }
-    return g_appState->sessionState == XR_SESSION_STATE_FOCUSED;
+    return g_appState->lifecycle.state == XR_SESSION_STATE_FOCUSED;
 }
 
+// Frame pacing report for MainActivity.dump (adb shell dumpsys activity ...)
+extern "C" JNIEXPORT jstring JNICALL
+Java_com_example_androidsamsung_MainActivity_getFramePacingReport(JNIEnv* env, jobject thiz) {
+    if (g_appState == nullptr) {
+        return env->NewStringUTF("no session");
+    }
+    FramePacingStats stats;
+    framePacingSnapshot(&g_appState->pacing, &stats);
+    char report[2048];
+    framePacingFormat(&stats, report, sizeof(report));
+    return env->NewStringUTF(report);
+}
 
-void pollEvents(AppState* appState) {
-    XrEventDataBuffer eventData = {XR_TYPE_EVENT_DATA_BUFFER};
-    while (xrPollEvent(appState->instance, &eventData) == XR_SUCCESS) {
-        if (eventData.type == XR_TYPE_EVENT_DATA_SESSION_STATE_CHANGED) {
-            auto stateEvent = *reinterpret_cast<const XrEventDataSessionStateChanged*>(&eventData);
-            appState->sessionState = stateEvent.state;
-            LOGI("BaseApp session state changed to: %d", stateEvent.state);
-
-            switch (appState->sessionState) {
-                case XR_SESSION_STATE_READY: {
-                    XrSessionBeginInfo beginInfo = {XR_TYPE_SESSION_BEGIN_INFO};
-                    beginInfo.primaryViewConfigurationType = appState->viewConfigType;
-                    if (XR_SUCCEEDED(xrBeginSession(appState->session, &beginInfo))) {
-                        appState->sessionRunning = true;
-                        LOGI("Base session has begun (is running)");
-                    } else {
-                        LOGE("Failed to begin base session!");
-                    }
-                    break;
-                }
-                case XR_SESSION_STATE_STOPPING: {
-                    appState->sessionRunning = false;
-                    LOGI("Base session is stopping (focus lost). NOT calling xrEndSession.");
-                    break;
-                }
-                case XR_SESSION_STATE_FOCUSED: {
-                    LOGI("Base session is FOCUSED. Ready for overlay.");
-                    break;
-                }
-                case XR_SESSION_STATE_VISIBLE: {
-                    LOGI("Base session is VISIBLE.");
-                    break;
-                }
-                case XR_SESSION_STATE_SYNCHRONIZED: {
-                    LOGI("Base session is SYNCHRONIZED.");
-                    break;
-                }
-                case XR_SESSION_STATE_IDLE: {
-                    LOGI("Base session is IDLE.");
-                    break;
-                }
-                case XR_SESSION_STATE_EXITING: {
-                    LOGI("Base session is EXITING. Calling xrEndSession.");
-                    appState->sessionRunning = false;
-                    xrEndSession(appState->session);
-                    // Also finish the activity to ensure a clean exit
-                    ANativeActivity_finish(appState->app->activity);
-                    break;
-                }
-                default:
-                    break;
-            }
+// Session milestones of the current run (SessionMilestone order, CLOCK_MONOTONIC ns as
+// System.nanoTime, 0 = not reached), e.g. to time an overlay's VISIBLE against base's FOCUSED.
+extern "C" JNIEXPORT jlongArray JNICALL
+Java_com_example_androidsamsung_MainActivity_getSessionMilestones(JNIEnv* env, jobject thiz) {
+    jlong values[SESSION_MILESTONE_COUNT] = {};
+    if (g_appState != nullptr) {
+        for (uint32_t i = 0; i < SESSION_MILESTONE_COUNT; ++i) {
+            values[i] = (jlong)g_appState->lifecycle.milestoneNs[i].load(std::memory_order_relaxed);
         }
-        eventData = {XR_TYPE_EVENT_DATA_BUFFER};
     }
+    jlongArray result = env->NewLongArray(SESSION_MILESTONE_COUNT);
+    if (result != nullptr) {
+        env->SetLongArrayRegion(result, 0, SESSION_MILESTONE_COUNT, values);
+    }
+    return result;
+}
+
+extern "C" JNIEXPORT jstring JNICALL
+Java_com_example_androidsamsung_MainActivity_getSessionLifecycleReport(JNIEnv* env, jobject thiz) {
+    if (g_appState == nullptr) {
+        return env->NewStringUTF("no session");
+    }
+    char report[512];
+    sessionLifecycleFormat(&g_appState->lifecycle, report, sizeof(report));
+    return env->NewStringUTF(report);
+}
+
+// Frame time summary over the last `windowFrames` frames (0 = all kept), for MainActivity or a
+// HUD. Layout is mirrored by the FRAME_STATS_* indices in MainActivity.
+extern "C" JNIEXPORT jfloatArray JNICALL
+Java_com_example_androidsamsung_MainActivity_getFrameStats(JNIEnv* env, jobject thiz, jint windowFrames) {
+    FrameStatsSummary summary = {};
+    if (g_appState != nullptr) {
+        frameStatsSummarize(&g_appState->frameStats, windowFrames > 0 ? (uint32_t)windowFrames : 0, 0, &summary);
+    }
+    const jfloat values[] = {
+            (jfloat)summary.count,
+            summary.fps,
+            summary.intervalP50Us / 1000.0f,
+            summary.intervalP90Us / 1000.0f,
+            summary.intervalP99Us / 1000.0f,
+            summary.cpuP50Us / 1000.0f,
+            summary.cpuP90Us / 1000.0f,
+            summary.cpuP99Us / 1000.0f,
+            summary.budgetUs / 1000.0f,
+            (jfloat)summary.overBudget,
+            (jfloat)summary.late,
+    };
+    const jsize length = sizeof(values) / sizeof(values[0]);
+    jfloatArray result = env->NewFloatArray(length);
+    if (result != nullptr) {
+        env->SetFloatArrayRegion(result, 0, length, values);
+    }
+    return result;
+}
+
+// --- Calls into Java ---
+
+// The native app thread isn't attached to the VM by the glue.
+static void attachJava(AppState* appState) {
+    JavaVM* vm = appState->app->activity->vm;
+    if (vm == nullptr) {
+        return;
+    }
+    JNIEnv* env = nullptr;
+    if (vm->AttachCurrentThread(&env, nullptr) != JNI_OK) {
+        LOGE("Cannot attach the app thread to the VM");
+        return;
+    }
+    jclass activityClass = env->GetObjectClass(appState->app->activity->clazz);
+    appState->onSessionFocusedMethod = env->GetMethodID(activityClass, "onSessionFocused", "(J)V");
+    env->DeleteLocalRef(activityClass);
+    if (appState->onSessionFocusedMethod == nullptr) {
+        env->ExceptionClear();
+        LOGE("MainActivity.onSessionFocused(long) not found");
+    }
+    appState->jni = env;
+}
+
+static void detachJava(AppState* appState) {
+    if (appState->jni != nullptr) {
+        appState->app->activity->vm->DetachCurrentThread();
+        appState->jni = nullptr;
+    }
+}
+
+// --- Session lifecycle (session_lifecycle.h) ---
+
+static void onSessionBegun(void* user) {
+    auto* appState = static_cast<AppState*>(user);
+    framePacingRestart(&appState->pacing);
+    frameStatsRestart(&appState->frameStats);
+    appState->frameStatsLogNs = 0;
+    appState->frameStatsLogHead = appState->frameStats.head.load(std::memory_order_relaxed);
+#if defined(PIPELINED_FRAME_LOOP)
+    appState->pipeline.pacing = &appState->pacing;
+    framePipelineStart(&appState->pipeline, appState->session, appState->blendMode);
+#endif
+}
+
+static void onSessionStopped(void* user) {
+    auto* appState = static_cast<AppState*>(user);
+#if defined(PIPELINED_FRAME_LOOP)
+    framePipelineStop(&appState->pipeline);
+#endif
+    framePacingLog(&appState->pacing, TAG);
+}
+
+// Hands MainActivity the FOCUSED time so it launches the overlays right away.
+static void onSessionFocused(void* user) {
+    auto* appState = static_cast<AppState*>(user);
+    if (appState->jni == nullptr || appState->onSessionFocusedMethod == nullptr) {
+        return;
+    }
+    const uint64_t focusedNs = appState->lifecycle.milestoneNs[SESSION_MILESTONE_FOCUSED].load(std::memory_order_relaxed);
+    appState->jni->CallVoidMethod(appState->app->activity->clazz, appState->onSessionFocusedMethod, (jlong)focusedNs);
+    if (appState->jni->ExceptionCheck()) {
+        appState->jni->ExceptionDescribe();
+        appState->jni->ExceptionClear();
+    }
+}
+
+static void onSessionExiting(void* user) {
+    // Also finish the activity to ensure a clean exit
+    ANativeActivity_finish(static_cast<AppState*>(user)->app->activity);
+}
+
+static void onSessionStateChanged(AppState* appState, const XrEventDataSessionStateChanged& event) {
+    sessionLifecycleHandleState(&appState->lifecycle, event);
+}
+
+static void onInstanceLossPending(AppState* appState, const XrEventDataInstanceLossPending&) {
+    LOGE("Base instance is about to be lost, exiting");
+    sessionLifecycleStop(&appState->lifecycle, false);
+    ANativeActivity_finish(appState->app->activity);
 }
 
 void renderFrame(AppState* appState) {
-    if (!appState->sessionRunning) {
+    if (!appState->lifecycle.running) {
         return;
     }
+    TRACE_SCOPE("renderFrame");
 
     XrFrameState frameState = {XR_TYPE_FRAME_STATE};
+#if defined(PIPELINED_FRAME_LOOP)
+    // Already waited and begun on the wait thread.
+    uint64_t frameId = 0;
+    if (!framePipelineAcquire(&appState->pipeline, &frameState, &frameId, FRAME_ACQUIRE_TIMEOUT_MS)) {
+        return;
+    }
+    // Begun on the wait thread; the CPU time recorded below is this thread's share.
+    const uint64_t frameBeginNs = frameStatsNowNs();
+#else
     XrFrameWaitInfo frameWaitInfo = {XR_TYPE_FRAME_WAIT_INFO};
-    if (XR_FAILED(xrWaitFrame(appState->session, &frameWaitInfo, &frameState))) {
+    framePacingWaitStart(&appState->pacing);
+    TRACE_BEGIN("xrWaitFrame");
+    const XrResult waitResult = xrWaitFrame(appState->session, &frameWaitInfo, &frameState);
+    TRACE_END();
+    if (XR_FAILED(waitResult)) {
         LOGI("xrWaitFrame failed, likely because session is not focused.");
         return;
     }
+    framePacingWaitDone(&appState->pacing, &frameState);
 
     XrFrameBeginInfo frameBeginInfo = {XR_TYPE_FRAME_BEGIN_INFO};
-    if (XR_FAILED(xrBeginFrame(appState->session, &frameBeginInfo))) {
+    TRACE_BEGIN("xrBeginFrame");
+    const XrResult beginResult = xrBeginFrame(appState->session, &frameBeginInfo);
+    TRACE_END();
+    if (XR_FAILED(beginResult)) {
         LOGE("xrBeginFrame failed");
         return;
     }
+    framePacingFrameBegun(&appState->pacing);
+    const uint64_t frameBeginNs = frameStatsNowNs();
+#endif
+
+    frameArenaReset(&appState->frameArena);
 
     const XrCompositionLayerBaseHeader* layerPtr = nullptr;
     XrCompositionLayerProjection projectionLayer = {XR_TYPE_COMPOSITION_LAYER_PROJECTION};
-    std::vector<XrCompositionLayerProjectionView> projectionViews;
 
     if (frameState.shouldRender) {
         uint32_t imageIndex;
+        TRACE_BEGIN("xrAcquireSwapchainImage");
         XrSwapchainImageAcquireInfo acquireInfo = {XR_TYPE_SWAPCHAIN_IMAGE_ACQUIRE_INFO};
         xrAcquireSwapchainImage(appState->swapchain, &acquireInfo, &imageIndex);
 
         XrSwapchainImageWaitInfo waitInfo = {XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO};
         waitInfo.timeout = XR_INFINITE_DURATION;
         xrWaitSwapchainImage(appState->swapchain, &waitInfo);
+        TRACE_END();
 
+        // One image shared by both views.
+        TRACE_BEGIN("render");
         glBindFramebuffer(GL_FRAMEBUFFER, appState->framebuffers[imageIndex]);
         glViewport(0, 0, appState->width, appState->height);
         // Changed from dark green to cyan
         glClearColor(0.0f, 0.4f, 0.4f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT);
+        TRACE_END();
 
+        TRACE_BEGIN("xrReleaseSwapchainImage");
         XrSwapchainImageReleaseInfo releaseInfo = {XR_TYPE_SWAPCHAIN_IMAGE_RELEASE_INFO};
         xrReleaseSwapchainImage(appState->swapchain, &releaseInfo);
+        TRACE_END();
 
         XrViewLocateInfo viewLocateInfo = {XR_TYPE_VIEW_LOCATE_INFO};
         viewLocateInfo.viewConfigurationType = appState->viewConfigType;
@@ -166,13 +331,16 @@ void renderFrame(AppState* appState) {
         viewLocateInfo.space = appState->appSpace;
 
         uint32_t viewCount = 2;
-        std::vector<XrView> views(viewCount, {XR_TYPE_VIEW});
+        XrView* views = frameArenaArray(&appState->frameArena, viewCount, XrView{XR_TYPE_VIEW});
+        XrCompositionLayerProjectionView* projectionViews = frameArenaArray(
+                &appState->frameArena, viewCount, XrCompositionLayerProjectionView{XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW});
         XrViewState viewState = {XR_TYPE_VIEW_STATE};
-        xrLocateViews(appState->session, &viewLocateInfo, &viewState, viewCount, &viewCount, views.data());
+        if (views == nullptr || projectionViews == nullptr ||
+            XR_FAILED(xrLocateViews(appState->session, &viewLocateInfo, &viewState, viewCount, &viewCount, views))) {
+            viewCount = 0;
+        }
 
-        projectionViews.resize(viewCount);
         for(uint32_t i = 0; i < viewCount; ++i) {
-            projectionViews[i] = {XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW};
             projectionViews[i].pose = views[i].pose;
             projectionViews[i].fov = views[i].fov;
             projectionViews[i].subImage.swapchain = appState->swapchain;
@@ -182,8 +350,19 @@ void renderFrame(AppState* appState) {
 
         projectionLayer.space = appState->appSpace;
         projectionLayer.viewCount = viewCount;
-        projectionLayer.views = projectionViews.data();
-        layerPtr = reinterpret_cast<const XrCompositionLayerBaseHeader*>(&projectionLayer);
+        projectionLayer.views = projectionViews;
+        if (viewCount > 0) {
+            layerPtr = reinterpret_cast<const XrCompositionLayerBaseHeader*>(&projectionLayer);
+            // Head between the eyes, looking where the first one does.
+            const XrPosef& first = views[0].pose;
+            const XrPosef& last = views[viewCount - 1].pose;
+            StateSnapshot& state = appState->state;
+            state.headPosition[0] = (first.position.x + last.position.x) * 0.5f;
+            state.headPosition[1] = (first.position.y + last.position.y) * 0.5f;
+            state.headPosition[2] = (first.position.z + last.position.z) * 0.5f;
+            memcpy(state.headOrientation, &first.orientation, sizeof(state.headOrientation));
+            state.flags |= STATE_SNAPSHOT_HEAD_VALID;
+        }
     }
 
     XrFrameEndInfo endInfo = {XR_TYPE_FRAME_END_INFO};
@@ -191,20 +370,52 @@ void renderFrame(AppState* appState) {
     endInfo.environmentBlendMode = appState->blendMode;
     endInfo.layerCount = (layerPtr ? 1 : 0);
     endInfo.layers = &layerPtr;
+#if defined(PIPELINED_FRAME_LOOP)
+    framePipelineEndFrame(&appState->pipeline, frameId, &endInfo);
+#else
+    framePacingFrameEnded(&appState->pacing);
+    TRACE_BEGIN("xrEndFrame");
     xrEndFrame(appState->session, &endInfo);
-
-    // --- FPS calculation (only count actual rendered frames) ---
-    g_frameCount++;
-    auto now = std::chrono::high_resolution_clock::now();
-    double elapsedSeconds = std::chrono::duration_cast<std::chrono::duration<double>>(now - g_lastTimePoint).count();
-
-    if (elapsedSeconds >= 1.0) {
-        g_fps = static_cast<float>(g_frameCount) / elapsedSeconds;
-        g_frameCount = 0;
-        g_lastTimePoint = now;
-        LOGI("FPS: %.2f", g_fps);   // now will be ~60, 72, 90, depending on HMD refresh
+    TRACE_END();
+#endif
+    sessionLifecycleFrameEnded(&appState->lifecycle, endInfo.layerCount);
+
+    // --- Frame stats (only actual submitted frames) ---
+    const uint64_t frameEndNs = frameStatsNowNs();
+    frameStatsPush(&appState->frameStats, frameBeginNs, frameEndNs, frameState.predictedDisplayPeriod);
+
+    appState->state.frame = appState->frameStats.head.load(std::memory_order_relaxed);
+    appState->state.displayTime = frameState.predictedDisplayTime;
+
+    if (appState->frameStatsLogNs == 0) {
+        appState->frameStatsLogNs = frameEndNs;
+    } else if (frameEndNs - appState->frameStatsLogNs >= FRAME_STATS_LOG_INTERVAL_NS) {
+        const uint64_t head = appState->frameStats.head.load(std::memory_order_relaxed);
+        FrameStatsSummary summary;
+        frameStatsSummarize(&appState->frameStats, (uint32_t)(head - appState->frameStatsLogHead), 0, &summary);
+        // FPS will be ~60, 72, 90, depending on HMD refresh
+        LOGI("FPS: %.2f frame p50/p90/p99 %.2f/%.2f/%.2f ms, cpu p99 %.2f ms, over budget %u/%u, late %u",
+             summary.fps, summary.intervalP50Us / 1000.0f, summary.intervalP90Us / 1000.0f,
+             summary.intervalP99Us / 1000.0f, summary.cpuP99Us / 1000.0f, summary.overBudget, summary.count,
+             summary.late);
+        snprintf(appState->state.text, sizeof(appState->state.text), "%.1f fps, p99 %.2f ms", summary.fps,
+                 summary.intervalP99Us / 1000.0f);
+        stateChannelPushText(&appState->stateChannel, STATE_KEY_FRAME_STATS, appState->state.text);
+        stateChannelPushCounter(&appState->stateChannel, STATE_KEY_LATE_FRAMES, summary.late);
+#if defined(FRAME_ALLOC_COUNTER)
+        // Everything on this thread since the last log: loop, events and frames.
+        const AllocCounts allocs = allocCounterThread();
+        LOGI("Render thread heap allocations: %.2f new + %.2f malloc per frame",
+             (double)(allocs.news - appState->allocsAtLog.news) / summary.count,
+             (double)(allocs.mallocs - appState->allocsAtLog.mallocs) / summary.count);
+        appState->allocsAtLog = allocs;
+#endif
+        appState->frameStatsLogNs = frameEndNs;
+        appState->frameStatsLogHead = head;
     }
-    // --- End FPS calculation ---
+    // --- End frame stats ---
+
+    stateChannelPublish(&appState->stateChannel, appState->state);
 }
 
 void android_main(struct android_app* app) {
@@ -237,12 +448,21 @@ void android_main(struct android_app* app) {
         }
     };
 
+    // Left open by the early returns below, which end the app anyway.
+    TRACE_BEGIN("startup");
     EGLDisplay display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
     eglInitialize(display, nullptr, nullptr);
-    EGLConfig config;
-    const EGLint configAttribs[] = { EGL_RENDERABLE_TYPE, EGL_OPENGL_ES3_BIT, EGL_NONE };
-    EGLint numConfigs;
+    EGLConfig config = nullptr;
+    // Rendering goes to swapchain images, so the config needs no window surfaces, only pbuffers
+    // (the default is window surfaces, which surfaceless EGL has none of).
+    const EGLint configAttribs[] = { EGL_RENDERABLE_TYPE, EGL_OPENGL_ES3_BIT, EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+                                     EGL_NONE };
+    EGLint numConfigs = 0;
     eglChooseConfig(display, configAttribs, &config, 1, &numConfigs);
+    if (numConfigs == 0) {
+        LOGE("No GLES3 EGL config: 0x%X", eglGetError());
+        return;
+    }
     const EGLint contextAttribs[] = {EGL_CONTEXT_CLIENT_VERSION, 3, EGL_NONE};
     EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
     eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context);
@@ -340,16 +560,38 @@ void android_main(struct android_app* app) {
         glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, images[i].image, 0);
     }
 
+    TRACE_END();
     LOGI("Base App initialized successfully");
 
+    // Blocks on the looper while nothing is rendered instead of spinning (idle_looper.h).
+    frameArenaInit(&appState.frameArena, FRAME_ARENA_BYTES);
+    idleLooperInit(&appState.idleLooper, app->looper);
+    if (stateChannelCreate(&appState.stateChannel)) {
+        stateChannelServe(&appState.stateChannel, app->looper, STATE_CHANNEL_SOCKET);
+    }
+    attachJava(&appState);
+    // Base keeps its session across STOPPING (no xrEndSession until EXITING).
+    SessionCallbacks sessionCallbacks;
+    sessionCallbacks.user = &appState;
+    sessionCallbacks.begun = onSessionBegun;
+    sessionCallbacks.stopped = onSessionStopped;
+    sessionCallbacks.exiting = onSessionExiting;
+    sessionCallbacks.focused = onSessionFocused;
+    sessionLifecycleInit(&appState.lifecycle, appState.session, appState.viewConfigType, SESSION_END_ON_EXITING,
+                         sessionCallbacks, TAG);
+    xrEventsInit(&appState.events, &appState);
+    xrEventsOn<onSessionStateChanged>(&appState.events);
+    xrEventsOn<onInstanceLossPending>(&appState.events);
     while (!app->destroyRequested) {
-        struct android_poll_source* source;
-        while (ALooper_pollOnce(0, nullptr, nullptr, (void**)&source) >= 0) {
-            if (source) source->process(app, source);
-        }
-        pollEvents(&appState);
+        const bool rendering = appState.lifecycle.running;
+        idleLooperPump(&appState.idleLooper, app, idleLooperTimeoutMs(appState.lifecycle.state, rendering));
+        xrEventsPoll(&appState.events, appState.instance);
         renderFrame(&appState);
     }
+    detachJava(&appState);
+    stateChannelDestroy(&appState.stateChannel);
+    idleLooperDestroy(&appState.idleLooper);
+    frameArenaDestroy(&appState.frameArena);
 
     g_appState = nullptr;
 }
\ No newline at end of file
@@ -6,16 +6,23 @@ import android.os.Bundle;
 import android.os.Handler;
 import android.os.Looper;
 import android.util.Log;
-import java.util.HashSet;
+import java.io.FileDescriptor;
+import java.io.PrintWriter;
+import java.util.Locale;
 import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
 
 public class MainActivity extends NativeActivity {
     private static final String TAG = "BaseApp";
-    // *** This array now includes all three overlay apps ***
+    // The flat panels (magenta, green, blue and the future ones below) are rendered by the
+    // overlay host in a single overlay session instead of one APK each.
     private static final String[] OVERLAY_PACKAGE_NAMES = {
-            "com.example.addr",     // Magenta Overlay
-            "com.example.addr1",    // Green Overlay
-            "com.example.addr2",     // Blue Overlay
+            "com.example.overlayhost", // Magenta, Green and Blue panels
+            //"com.example.addr",     // Magenta Overlay
+            //"com.example.addr1",    // Green Overlay
+            //"com.example.addr2",     // Blue Overlay
             "com.example.addr3"      //3D Overlay
             //"com.example.addr4",     //Yellow Overlay
             //"com.example.addr5",     //Cyan Overlay
@@ -24,10 +31,43 @@ public class MainActivity extends NativeActivity {
             //"com.example.addr8",       //Purple Overlay
             //"com.example.addr9"         //Tael Overlay
     };
+    // Indices into getFrameStats(); times in milliseconds.
+    public static final int FRAME_STATS_COUNT = 0;
+    public static final int FRAME_STATS_FPS = 1;
+    public static final int FRAME_STATS_FRAME_P50 = 2;
+    public static final int FRAME_STATS_FRAME_P90 = 3;
+    public static final int FRAME_STATS_FRAME_P99 = 4;
+    public static final int FRAME_STATS_CPU_P50 = 5;
+    public static final int FRAME_STATS_CPU_P90 = 6;
+    public static final int FRAME_STATS_CPU_P99 = 7;
+    public static final int FRAME_STATS_BUDGET = 8;
+    public static final int FRAME_STATS_OVER_BUDGET = 9;
+    public static final int FRAME_STATS_LATE = 10;
+
+    // getSessionMilestones() indices, mirroring SessionMilestone in session_lifecycle.h.
+    public static final int SESSION_MILESTONE_IDLE = 0;
+    public static final int SESSION_MILESTONE_READY = 1;
+    public static final int SESSION_MILESTONE_BEGUN = 2;
+    public static final int SESSION_MILESTONE_FIRST_FRAME = 3;
+    public static final int SESSION_MILESTONE_SYNCHRONIZED = 4;
+    public static final int SESSION_MILESTONE_VISIBLE = 5;
+    public static final int SESSION_MILESTONE_FOCUSED = 6;
+    public static final int SESSION_MILESTONE_STOPPING = 7;
+
+    // Base's FOCUSED (System.nanoTime) handed to the overlays it launches.
+    public static final String EXTRA_BASE_FOCUSED_NS = "com.example.androidsamsung.BASE_FOCUSED_NS";
+
     private Handler handler;
-    private Set<String> launchedOverlays = new HashSet<>();
+    private final Set<String> launchedOverlays = ConcurrentHashMap.newKeySet();
+    private final ExecutorService launchExecutor = Executors.newFixedThreadPool(OVERLAY_PACKAGE_NAMES.length);
 
     public native boolean isSessionFocused();
+    public native String getFramePacingReport();
+    // Summary of the last windowFrames frames (0 = all kept); never blocks the render thread.
+    public native float[] getFrameStats(int windowFrames);
+    // System.nanoTime of each session milestone in the current run, 0 if not reached.
+    public native long[] getSessionMilestones();
+    public native String getSessionLifecycleReport();
 
     static {
         System.loadLibrary("base_app_cpp");
@@ -44,41 +84,72 @@ public class MainActivity extends NativeActivity {
     protected void onResume() {
         super.onResume();
         Log.d(TAG, "BaseApp onResume");
-        handler.post(this::tryLaunchOverlays);
+        // Normally onSessionFocused launches them; this covers a resume after the session focused.
+        handler.post(() -> {
+            if (isSessionFocused()) {
+                launchOverlays(getSessionMilestones()[SESSION_MILESTONE_FOCUSED]);
+            }
+        });
     }
 
-    private void tryLaunchOverlays() {
-        if (launchedOverlays.size() >= OVERLAY_PACKAGE_NAMES.length) {
-            return;
-        }
+    // Called by the native app thread each time the base session enters FOCUSED, with the
+    // System.nanoTime it got there. Only the first entry launches anything unless a launch failed.
+    @SuppressWarnings("unused")
+    private void onSessionFocused(long focusedNs) {
+        handler.post(() -> launchOverlays(focusedNs));
+    }
 
-        if (isSessionFocused()) {
-            Log.i(TAG, "Base session is focused. Checking for overlays to launch.");
+    // Sends every overlay not launched yet at once rather than one after the other; each gets
+    // focusedNs so its session report can give its time to visible from it. A package stays in
+    // launchedOverlays once its intent is sent, so an overlay that exits later is not relaunched:
+    // with FLAG_ACTIVITY_MULTIPLE_TASK a second intent would start another instance next to it.
+    private void launchOverlays(long focusedNs) {
+        for (String packageName : OVERLAY_PACKAGE_NAMES) {
+            if (!launchedOverlays.add(packageName)) {
+                continue;
+            }
+            launchExecutor.execute(() -> launchOverlay(packageName, focusedNs));
+        }
+    }
 
-            for (String packageName : OVERLAY_PACKAGE_NAMES) {
-                if (!launchedOverlays.contains(packageName)) {
-                    try {
-                        Log.i(TAG, "Attempting to launch: " + packageName);
-                        Intent launchIntent = getPackageManager().getLaunchIntentForPackage(packageName);
-                        if (launchIntent != null) {
-                            launchIntent.addFlags(Intent.FLAG_ACTIVITY_NEW_TASK |
-                                    Intent.FLAG_ACTIVITY_MULTIPLE_TASK |
-                                    Intent.FLAG_ACTIVITY_NO_HISTORY);
-                            startActivity(launchIntent);
-                            launchedOverlays.add(packageName);
-                            Log.i(TAG, "Launch intent sent for: " + packageName);
-                        } else {
-                            Log.e(TAG, "Package not found: " + packageName);
-                        }
-                    } catch (Exception e) {
-                        Log.e(TAG, "Failed to launch " + packageName + ": " + e.getMessage(), e);
-                    }
-                }
+    private void launchOverlay(String packageName, long focusedNs) {
+        try {
+            Intent launchIntent = getPackageManager().getLaunchIntentForPackage(packageName);
+            if (launchIntent == null) {
+                Log.e(TAG, "Package not found: " + packageName);
+                launchedOverlays.remove(packageName);
+                return;
             }
-        } else {
-            Log.d(TAG, "Session not focused yet, retrying in 1 second...");
-            handler.postDelayed(this::tryLaunchOverlays, 1000);
+            launchIntent.addFlags(Intent.FLAG_ACTIVITY_NEW_TASK |
+                    Intent.FLAG_ACTIVITY_MULTIPLE_TASK |
+                    Intent.FLAG_ACTIVITY_NO_HISTORY);
+            launchIntent.putExtra(EXTRA_BASE_FOCUSED_NS, focusedNs);
+            startActivity(launchIntent);
+            Log.i(TAG, String.format(Locale.US, "Launch intent sent for %s %.1fms after focused",
+                    packageName, (System.nanoTime() - focusedNs) / 1e6));
+        } catch (Exception e) {
+            launchedOverlays.remove(packageName);
+            Log.e(TAG, "Failed to launch " + packageName + ": " + e.getMessage(), e);
+        }
+    }
+
+    // adb shell dumpsys activity com.example.androidsamsung/.MainActivity
+    @Override
+    public void dump(String prefix, FileDescriptor fd, PrintWriter writer, String[] args) {
+        super.dump(prefix, fd, writer, args);
+        writer.println(prefix + "Session: " + getSessionLifecycleReport());
+        writer.println(prefix + "Frame pacing:");
+        for (String line : getFramePacingReport().split("\n")) {
+            writer.println(prefix + "  " + line);
         }
+        float[] stats = getFrameStats(0);
+        writer.println(prefix + String.format(Locale.US,
+                "Frame stats: n=%.0f fps=%.2f frame p50/p90/p99=%.2f/%.2f/%.2fms"
+                        + " cpu p50/p90/p99=%.2f/%.2f/%.2fms budget=%.2fms over budget=%.0f late=%.0f",
+                stats[FRAME_STATS_COUNT], stats[FRAME_STATS_FPS],
+                stats[FRAME_STATS_FRAME_P50], stats[FRAME_STATS_FRAME_P90], stats[FRAME_STATS_FRAME_P99],
+                stats[FRAME_STATS_CPU_P50], stats[FRAME_STATS_CPU_P90], stats[FRAME_STATS_CPU_P99],
+                stats[FRAME_STATS_BUDGET], stats[FRAME_STATS_OVER_BUDGET], stats[FRAME_STATS_LATE]));
     }
 
     @Override
@@ -86,4 +157,11 @@ public class MainActivity extends NativeActivity {
         super.onPause();
         Log.d(TAG, "BaseApp onPause");
     }
+
+    @Override
+    protected void onDestroy() {
+        // Launches still queued are for an activity that is going away.
+        launchExecutor.shutdownNow();
+        super.onDestroy();
+    }
 }
\ No newline at end of file
@@ -0,0 +1,111 @@
+#include "alloc_counter.h"
+
+#if defined(FRAME_ALLOC_COUNTER)
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Plain thread_local PODs: no constructor, so touching them can't allocate.
+static thread_local uint64_t tlsNews = 0;
+static thread_local uint64_t tlsMallocs = 0;
+static thread_local uint64_t tlsOwnMallocs = 0;
+static std::atomic<uint64_t> totalNews{0};
+static std::atomic<uint64_t> totalMallocs{0};
+static std::atomic<uint64_t> totalOwnMallocs{0};
+
+#if defined(__GLIBC__)
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* pointer, size_t size);
+
+// Start and end of the executable's code, from the linker.
+extern char __executable_start;
+extern char etext;
+
+static void countMalloc(const void* caller) {
+    tlsMallocs++;
+    totalMallocs.fetch_add(1, std::memory_order_relaxed);
+    if (caller >= &__executable_start && caller < &etext) {
+        tlsOwnMallocs++;
+        totalOwnMallocs.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void* malloc(size_t size) {
+    countMalloc(__builtin_return_address(0));
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+    countMalloc(__builtin_return_address(0));
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* pointer, size_t size) {
+    countMalloc(__builtin_return_address(0));
+    return __libc_realloc(pointer, size);
+}
+}
+// operator new goes straight to the allocator so it isn't counted twice.
+#define RAW_MALLOC __libc_malloc
+#else
+#define RAW_MALLOC malloc
+#endif
+
+// The other new variants (arrays, nothrow) forward to these two; the default deletes free().
+void* operator new(size_t size) {
+    tlsNews++;
+    totalNews.fetch_add(1, std::memory_order_relaxed);
+    if (void* pointer = RAW_MALLOC(size ? size : 1)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    tlsNews++;
+    totalNews.fetch_add(1, std::memory_order_relaxed);
+    void* pointer = nullptr;
+    if (posix_memalign(&pointer, static_cast<size_t>(alignment), size ? size : 1) != 0) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+bool allocCounterEnabled() {
+    return true;
+}
+
+AllocCounts allocCounterThread() {
+    AllocCounts counts;
+    counts.news = tlsNews;
+    counts.mallocs = tlsMallocs;
+    counts.ownMallocs = tlsOwnMallocs;
+    return counts;
+}
+
+AllocCounts allocCounterTotal() {
+    AllocCounts counts;
+    counts.news = totalNews.load(std::memory_order_relaxed);
+    counts.mallocs = totalMallocs.load(std::memory_order_relaxed);
+    counts.ownMallocs = totalOwnMallocs.load(std::memory_order_relaxed);
+    return counts;
+}
+
+#else
+
+bool allocCounterEnabled() {
+    return false;
+}
+
+AllocCounts allocCounterThread() {
+    return AllocCounts();
+}
+
+AllocCounts allocCounterTotal() {
+    return AllocCounts();
+}
+
+#endif
@@ -0,0 +1,34 @@
+//
+// Debug heap allocation counter.
+//
+// With FRAME_ALLOC_COUNTER defined (CMake option of the same name), alloc_counter.cpp replaces
+// the global operator new. On glibc (the host build) it also interposes malloc, calloc and
+// realloc. Each allocation is counted both per thread and in total, so a render loop can
+// check it doesn't allocate: take allocCounterThread() before and after a frame. Bionic has no
+// __libc_malloc to forward to, so on the device only C++ allocations are counted.
+//
+// Mallocs are also told apart by caller: the GL driver allocates inside GL calls, which is its
+// business, while the app and the common code are linked into the executable, so `ownMallocs`
+// counts only the calls made from the executable's own code.
+//
+// Without the define nothing is replaced and every count is zero.
+//
+
+#ifndef ANDROIDSAMSUNG_ALLOCCOUNTER_H
+#define ANDROIDSAMSUNG_ALLOCCOUNTER_H
+
+#include <cstdint>
+
+struct AllocCounts {
+    uint64_t news = 0;       // operator new / new[]
+    uint64_t mallocs = 0;    // malloc / calloc / realloc (glibc only)
+    uint64_t ownMallocs = 0; // of those, called from the executable rather than a shared library
+};
+
+bool allocCounterEnabled();
+// Allocations made by the calling thread so far.
+AllocCounts allocCounterThread();
+// Allocations made by all threads so far.
+AllocCounts allocCounterTotal();
+
+#endif //ANDROIDSAMSUNG_ALLOCCOUNTER_H
@@ -0,0 +1,291 @@
+#include "demo_scene.h"
+
+#include <android/log.h>
+#include <cmath>
+
+// Last: with GL_CAPTURE the GL calls below are recorded.
+#include "gl_capture.h"
+
+#define TAG "DemoScene"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+const DemoQuad kDemoQuads[DEMO_SCENE_QUAD_COUNT] = {
+        {"Blue", 0.0f, 0.0f, -3.0f, 0.2f, 0.3f, 0.8f, 1.0f},
+        {"Red", 0.3f, 0.2f, -1.5f, 1.0f, 0.2f, 0.2f, 0.7f},
+        {"Green", -0.3f, -0.2f, -2.0f, 0.2f, 1.0f, 0.2f, 0.6f},
+};
+
+// Simple vertex shader
+static const char* vertexShaderSource = R"(#version 300 es
+layout (location = 0) in vec3 aPos;
+uniform mat4 mvp;
+void main() {
+    gl_Position = mvp * vec4(aPos, 1.0);
+}
+)";
+
+// Simple fragment shader for background
+static const char* fragmentShaderSource = R"(#version 300 es
+precision mediump float;
+uniform vec3 color;
+out vec4 FragColor;
+void main() {
+    FragColor = vec4(color, 1.0);
+}
+)";
+
+// Fragment shader for overlay (with transparency)
+static const char* overlayFragmentShaderSource = R"(#version 300 es
+precision mediump float;
+uniform vec3 color;
+uniform float alpha;
+out vec4 FragColor;
+void main() {
+    FragColor = vec4(color, alpha);
+}
+)";
+
+// --- Matrix Math ---
+
+void matrix_identity(float* m) {
+    m[0] = 1; m[4] = 0; m[8] = 0;  m[12] = 0;
+    m[1] = 0; m[5] = 1; m[9] = 0;  m[13] = 0;
+    m[2] = 0; m[6] = 0; m[10] = 1; m[14] = 0;
+    m[3] = 0; m[7] = 0; m[11] = 0; m[15] = 1;
+}
+
+void matrix_multiply(const float* a, const float* b, float* r) {
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            r[i * 4 + j] = 0;
+            for (int k = 0; k < 4; ++k) {
+                r[i * 4 + j] += a[k * 4 + j] * b[i * 4 + k];
+            }
+        }
+    }
+}
+
+void matrix_translate(float x, float y, float z, float* m) {
+    matrix_identity(m);
+    m[12] = x;
+    m[13] = y;
+    m[14] = z;
+}
+
+void matrix_scale(float sx, float sy, float sz, float* m) {
+    matrix_identity(m);
+    m[0] = sx;
+    m[5] = sy;
+    m[10] = sz;
+}
+
+void matrix_create_projection_from_fov(const XrFovf& fov, float nearZ, float farZ, float* m) {
+    const float tan_left = tanf(fov.angleLeft);
+    const float tan_right = tanf(fov.angleRight);
+    const float tan_down = tanf(fov.angleDown);
+    const float tan_up = tanf(fov.angleUp);
+    const float tan_width = tan_right - tan_left;
+    const float tan_height = tan_up - tan_down;
+    m[0] = 2.0f / tan_width;
+    m[1] = 0.0f;
+    m[2] = 0.0f;
+    m[3] = 0.0f;
+    m[4] = 0.0f;
+    m[5] = 2.0f / tan_height;
+    m[6] = 0.0f;
+    m[7] = 0.0f;
+    m[8] = (tan_right + tan_left) / tan_width;
+    m[9] = (tan_up + tan_down) / tan_height;
+    m[10] = -(farZ + nearZ) / (farZ - nearZ);
+    m[11] = -1.0f;
+    m[12] = 0.0f;
+    m[13] = 0.0f;
+    m[14] = -2.0f * farZ * nearZ / (farZ - nearZ);
+    m[15] = 0.0f;
+}
+
+void matrix_create_view_from_pose(const XrPosef& pose, float* m) {
+    const XrQuaternionf& q = pose.orientation;
+    const XrVector3f& p = pose.position;
+    float x2 = q.x + q.x, y2 = q.y + q.y, z2 = q.z + q.z;
+    float xx = q.x * x2, xy = q.x * y2, xz = q.x * z2;
+    float yy = q.y * y2, yz = q.y * z2, zz = q.z * z2;
+    float wx = q.w * x2, wy = q.w * y2, wz = q.w * z2;
+    m[0] = 1 - (yy + zz); m[4] = xy - wz;     m[8] = xz + wy;      m[12] = -(m[0] * p.x + m[4] * p.y + m[8] * p.z);
+    m[1] = xy + wz;      m[5] = 1 - (xx + zz); m[9] = yz - wx;      m[13] = -(m[1] * p.x + m[5] * p.y + m[9] * p.z);
+    m[2] = xz - wy;      m[6] = yz + wx;      m[10] = 1 - (xx + yy); m[14] = -(m[2] * p.x + m[6] * p.y + m[10] * p.z);
+    m[3] = 0;            m[7] = 0;            m[11] = 0;             m[15] = 1;
+}
+
+// --- Scene ---
+
+// Ends the pass being timed, if any, and starts timing `next`.
+static void timePass(GpuTimer* timer, GpuTimerPass next) {
+    if (timer) {
+        gpuTimerEndPass(timer);
+        gpuTimerBeginPass(timer, next);
+    }
+}
+
+static GLuint compileShader(GLenum type, const char* source) {
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+    GLint success;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if (!success) {
+        GLchar infoLog[512];
+        glGetShaderInfoLog(shader, 512, nullptr, infoLog);
+        LOGE("Shader compilation failed: %s", infoLog);
+        glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+static GLuint linkProgram(const char* fragmentSource) {
+    GLuint vertexShader = compileShader(GL_VERTEX_SHADER, vertexShaderSource);
+    GLuint fragmentShader = compileShader(GL_FRAGMENT_SHADER, fragmentSource);
+    if (!vertexShader || !fragmentShader) {
+        glDeleteShader(vertexShader);
+        glDeleteShader(fragmentShader);
+        return 0;
+    }
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+    GLint linked = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    if (!linked) {
+        LOGE("Program link failed");
+        glDeleteProgram(program);
+        return 0;
+    }
+    return program;
+}
+
+bool demoSceneInit(DemoScene* scene) {
+    scene->shaderProgram = linkProgram(fragmentShaderSource);
+    scene->overlayShaderProgram = linkProgram(overlayFragmentShaderSource);
+    if (!scene->shaderProgram || !scene->overlayShaderProgram) {
+        demoSceneDestroy(scene);
+        return false;
+    }
+    // Looked up once here instead of by name for every draw.
+    const GLuint programs[2] = {scene->shaderProgram, scene->overlayShaderProgram};
+    for (int i = 0; i < 2; ++i) {
+        scene->mvpLocation[i] = glGetUniformLocation(programs[i], "mvp");
+        scene->colorLocation[i] = glGetUniformLocation(programs[i], "color");
+    }
+    scene->alphaLocation = glGetUniformLocation(scene->overlayShaderProgram, "alpha");
+
+    float vertices[] = {
+            -0.5f, -0.5f, 0.0f, 0.5f, -0.5f, 0.0f, 0.5f,  0.5f, 0.0f, -0.5f,  0.5f, 0.0f,
+    };
+    unsigned int indices[] = { 0, 1, 2, 2, 3, 0 };
+
+    glGenVertexArrays(1, &scene->vao);
+    glGenBuffers(1, &scene->vbo);
+    glGenBuffers(1, &scene->ebo);
+
+    glBindVertexArray(scene->vao);
+    glBindBuffer(GL_ARRAY_BUFFER, scene->vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, scene->ebo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glBindVertexArray(0);
+
+    LOGI("Demo scene initialized");
+    return true;
+}
+
+void demoSceneDestroy(DemoScene* scene) {
+    if (scene->vao) glDeleteVertexArrays(1, &scene->vao);
+    if (scene->vbo) glDeleteBuffers(1, &scene->vbo);
+    if (scene->ebo) glDeleteBuffers(1, &scene->ebo);
+    if (scene->shaderProgram) glDeleteProgram(scene->shaderProgram);
+    if (scene->overlayShaderProgram) glDeleteProgram(scene->overlayShaderProgram);
+    *scene = DemoScene();
+}
+
+void demoSceneDraw(const DemoScene* scene, const float* viewProj) {
+    timePass(scene->gpuTimer, GPU_TIMER_PASS_CLEAR);
+    glClearColor(scene->clearColor[0], scene->clearColor[1], scene->clearColor[2], scene->clearColor[3]);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    timePass(scene->gpuTimer, GPU_TIMER_PASS_OPAQUE);
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GL_LESS);
+    glBindVertexArray(scene->vao);
+    bool blending = false;
+    for (const DemoQuad& quad : kDemoQuads) {
+        const bool translucent = quad.alpha < 1.0f;
+        if (translucent && !blending) {
+            timePass(scene->gpuTimer, GPU_TIMER_PASS_OVERLAY);
+            glEnable(GL_BLEND);
+            glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+            glDepthMask(GL_FALSE);
+            glUseProgram(scene->overlayShaderProgram);
+            blending = true;
+        } else if (!translucent) {
+            glUseProgram(scene->shaderProgram);
+        }
+        const int program = translucent ? 1 : 0;
+        float modelMatrix[16], mvp[16];
+        matrix_translate(quad.x, quad.y, quad.z, modelMatrix);
+        matrix_multiply(viewProj, modelMatrix, mvp);
+        glUniformMatrix4fv(scene->mvpLocation[program], 1, GL_FALSE, mvp);
+        glUniform3f(scene->colorLocation[program], quad.r, quad.g, quad.b);
+        if (translucent) {
+            glUniform1f(scene->alphaLocation, quad.alpha);
+        }
+        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+    }
+
+    glDepthMask(GL_TRUE);
+    glDisable(GL_BLEND);
+    glDisable(GL_DEPTH_TEST);
+    if (scene->gpuTimer) {
+        gpuTimerEndPass(scene->gpuTimer);
+    }
+}
+
+const DemoQuad* demoScenePick(const float* viewProj, float ndcX, float ndcY) {
+    const DemoQuad* picked = nullptr;
+    for (const DemoQuad& quad : kDemoQuads) {
+        if (picked && quad.z < picked->z) {
+            continue;
+        }
+        float modelMatrix[16], mvp[16];
+        matrix_translate(quad.x, quad.y, quad.z, modelMatrix);
+        matrix_multiply(viewProj, modelMatrix, mvp);
+        // The quads face the viewer, so the projected corners bound them.
+        float minX = INFINITY, maxX = -INFINITY, minY = INFINITY, maxY = -INFINITY;
+        bool behind = false;
+        for (int corner = 0; corner < 4; ++corner) {
+            const float x = (corner & 1) ? 0.5f : -0.5f;
+            const float y = (corner & 2) ? 0.5f : -0.5f;
+            const float w = mvp[3] * x + mvp[7] * y + mvp[15];
+            if (w <= 0.0f) {
+                behind = true;
+                break;
+            }
+            const float px = (mvp[0] * x + mvp[4] * y + mvp[12]) / w;
+            const float py = (mvp[1] * x + mvp[5] * y + mvp[13]) / w;
+            minX = fminf(minX, px);
+            maxX = fmaxf(maxX, px);
+            minY = fminf(minY, py);
+            maxY = fmaxf(maxY, py);
+        }
+        if (!behind && ndcX > minX && ndcX < maxX && ndcY > minY && ndcY < maxY) {
+            picked = &quad;
+        }
+    }
+    return picked;
+}
@@ -0,0 +1,60 @@
+//
+// The overlay demo scene (main.cpp): a blue quad 3 m ahead with a translucent red and green
+// quad in front of it, drawn with one view-projection per view so every render backend
+// (render_backend.h) shares it. Also the column-major 4x4 matrix helpers it is built from.
+//
+
+#ifndef ANDROIDSAMSUNG_DEMOSCENE_H
+#define ANDROIDSAMSUNG_DEMOSCENE_H
+
+#include <GLES3/gl3.h>
+#include <cstdint>
+
+#include <openxr/openxr.h>
+
+#include "gpu_timer.h"
+
+#define DEMO_SCENE_QUAD_COUNT 3
+
+struct DemoQuad {
+    const char* name;
+    float x, y, z;
+    float r, g, b;
+    float alpha; // 1: opaque, drawn first with depth writes
+};
+
+struct DemoScene {
+    GLuint shaderProgram = 0;
+    GLuint overlayShaderProgram = 0;
+    GLuint vao = 0;
+    GLuint vbo = 0;
+    GLuint ebo = 0;
+    GLint mvpLocation[2] = {-1, -1};
+    GLint colorLocation[2] = {-1, -1};
+    GLint alphaLocation = -1;
+    float clearColor[4] = {0.1f, 0.2f, 0.3f, 1.0f};
+    // Optional: the clear, opaque and overlay (translucent) passes are timed into it.
+    GpuTimer* gpuTimer = nullptr;
+};
+
+extern const DemoQuad kDemoQuads[DEMO_SCENE_QUAD_COUNT];
+
+// Needs a current GLES3 context.
+bool demoSceneInit(DemoScene* scene);
+void demoSceneDestroy(DemoScene* scene);
+
+// Clears and draws into the bound framebuffer and viewport.
+void demoSceneDraw(const DemoScene* scene, const float* viewProj);
+
+// The front-most quad under (ndcX, ndcY), or nullptr for the background.
+const DemoQuad* demoScenePick(const float* viewProj, float ndcX, float ndcY);
+
+// --- Matrix Math ---
+void matrix_identity(float* m);
+void matrix_multiply(const float* a, const float* b, float* r);
+void matrix_translate(float x, float y, float z, float* m);
+void matrix_scale(float sx, float sy, float sz, float* m);
+void matrix_create_projection_from_fov(const XrFovf& fov, float nearZ, float farZ, float* m);
+void matrix_create_view_from_pose(const XrPosef& pose, float* m);
+
+#endif //ANDROIDSAMSUNG_DEMOSCENE_H
@@ -0,0 +1,177 @@
+#include "dynamic_buffer.h"
+
+#include <EGL/egl.h>
+#include <GLES2/gl2ext.h>
+#include <android/log.h>
+#include <cstring>
+
+#define TAG "DynamicBuffer"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+// Upper bound on waiting for a slice; the GPU being a whole ring behind means something hung.
+#define DYNAMIC_BUFFER_FENCE_TIMEOUT_NS 100000000ull
+
+static bool hasExtension(const char* name) {
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (GLint i = 0; i < count; ++i) {
+        const char* extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+        if (extension && strcmp(extension, name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool dynamicBufferInit(DynamicBuffer* ring, GLsizeiptr frameSize, uint32_t frameCount) {
+    if (frameCount == 0 || frameCount > DYNAMIC_BUFFER_MAX_FRAMES) {
+        frameCount = DYNAMIC_BUFFER_MAX_FRAMES;
+    }
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &ring->uniformAlignment);
+    // Slices start aligned so allocation offsets are valid buffer offsets too.
+    frameSize = (frameSize + ring->uniformAlignment - 1) & ~static_cast<GLsizeiptr>(ring->uniformAlignment - 1);
+    ring->frameCount = frameCount;
+    ring->frameSize = frameSize;
+    const GLsizeiptr total = frameSize * frameCount;
+
+    glGenBuffers(1, &ring->buffer);
+    glBindBuffer(GL_ARRAY_BUFFER, ring->buffer);
+
+    auto bufferStorage = hasExtension("GL_EXT_buffer_storage")
+            ? reinterpret_cast<PFNGLBUFFERSTORAGEEXTPROC>(eglGetProcAddress("glBufferStorageEXT"))
+            : nullptr;
+    if (bufferStorage != nullptr) {
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT_EXT | GL_MAP_COHERENT_BIT_EXT;
+        bufferStorage(GL_ARRAY_BUFFER, total, nullptr, flags);
+        ring->persistentData = static_cast<uint8_t*>(glMapBufferRange(GL_ARRAY_BUFFER, 0, total, flags));
+        ring->persistent = ring->persistentData != nullptr;
+        if (!ring->persistent) {
+            // Immutable storage can't be respecified; start over with a plain buffer.
+            LOGE("Persistent map failed: 0x%X", glGetError());
+            glDeleteBuffers(1, &ring->buffer);
+            glGenBuffers(1, &ring->buffer);
+            glBindBuffer(GL_ARRAY_BUFFER, ring->buffer);
+        }
+    }
+    if (!ring->persistent) {
+        glBufferData(GL_ARRAY_BUFFER, total, nullptr, GL_STREAM_DRAW);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    const GLenum error = glGetError();
+    if (error != GL_NO_ERROR) {
+        LOGE("Dynamic buffer creation failed: 0x%X", error);
+        dynamicBufferDestroy(ring);
+        return false;
+    }
+    LOGI("Dynamic buffer: %u x %lld bytes, %s", frameCount, (long long)frameSize,
+         ring->persistent ? "persistently mapped" : "mapped per frame");
+    return true;
+}
+
+void dynamicBufferDestroy(DynamicBuffer* ring) {
+    for (GLsync& fence : ring->fences) {
+        if (fence != nullptr) {
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+    ring->unfencedFrame = -1;
+    if (ring->buffer != 0) {
+        if (ring->persistent) {
+            glBindBuffer(GL_ARRAY_BUFFER, ring->buffer);
+            glUnmapBuffer(GL_ARRAY_BUFFER);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+        }
+        glDeleteBuffers(1, &ring->buffer);
+        ring->buffer = 0;
+    }
+    ring->persistent = false;
+    ring->persistentData = nullptr;
+    ring->frameData = nullptr;
+}
+
+bool dynamicBufferBeginFrame(DynamicBuffer* ring) {
+    if (ring->buffer == 0 || ring->frameData != nullptr) {
+        return false;
+    }
+    // The previous slice's draws have all been issued by now, so its fence covers them.
+    if (ring->unfencedFrame >= 0) {
+        ring->fences[ring->unfencedFrame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        ring->unfencedFrame = -1;
+    }
+
+    GLsync& fence = ring->fences[ring->frame];
+    if (fence != nullptr) {
+        GLenum result = glClientWaitSync(fence, 0, 0);
+        if (result == GL_TIMEOUT_EXPIRED) {
+            ring->stalls++;
+            result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, DYNAMIC_BUFFER_FENCE_TIMEOUT_NS);
+        }
+        if (result == GL_TIMEOUT_EXPIRED || result == GL_WAIT_FAILED) {
+            LOGE("Slice %u still in use by the GPU (0x%X)", ring->frame, result);
+            return false;
+        }
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+
+    const GLintptr sliceOffset = ring->frameSize * ring->frame;
+    if (ring->persistent) {
+        ring->frameData = ring->persistentData + sliceOffset;
+    } else {
+        glBindBuffer(GL_ARRAY_BUFFER, ring->buffer);
+        ring->frameData = static_cast<uint8_t*>(glMapBufferRange(
+                GL_ARRAY_BUFFER, sliceOffset, ring->frameSize,
+                GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_FLUSH_EXPLICIT_BIT));
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        if (ring->frameData == nullptr) {
+            LOGE("glMapBufferRange failed: 0x%X", glGetError());
+            return false;
+        }
+    }
+    ring->used = 0;
+    return true;
+}
+
+DynamicAllocation dynamicBufferAlloc(DynamicBuffer* ring, GLsizeiptr size, GLsizeiptr alignment) {
+    DynamicAllocation allocation;
+    if (ring->frameData == nullptr) {
+        return allocation;
+    }
+    if (alignment == 0) {
+        alignment = ring->uniformAlignment;
+    }
+    const GLsizeiptr start = (ring->used + alignment - 1) & ~(alignment - 1);
+    if (start + size > ring->frameSize) {
+        ring->overflows++;
+        return allocation;
+    }
+    ring->used = start + size;
+    allocation.data = ring->frameData + start;
+    allocation.offset = ring->frameSize * ring->frame + start;
+    allocation.size = size;
+    return allocation;
+}
+
+void dynamicBufferEndFrame(DynamicBuffer* ring) {
+    if (ring->frameData == nullptr) {
+        return;
+    }
+    if (!ring->persistent) {
+        glBindBuffer(GL_ARRAY_BUFFER, ring->buffer);
+        if (ring->used > 0) {
+            glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, ring->used);
+        }
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+    ring->unfencedFrame = static_cast<int32_t>(ring->frame);
+    if (ring->used > ring->peakUsed) {
+        ring->peakUsed = ring->used;
+    }
+    ring->frameData = nullptr;
+    ring->frame = (ring->frame + 1) % ring->frameCount;
+    ring->frames++;
+}
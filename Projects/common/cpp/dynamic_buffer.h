@@ -0,0 +1,70 @@
+//
+// Streaming ring for per-frame vertex, instance and uniform data.
+//
+// One GL buffer split into `frameCount` slices. Each frame writes into the next slice, bump
+// allocating linearly. The slice is fenced at the start of the next frame, by which time every
+// draw reading it has been issued. A slice is only reused once that fence has signalled, so
+// the CPU never writes memory the GPU may still read and the driver never has to copy or sync.
+//
+// With GL_EXT_buffer_storage the whole buffer is mapped once, persistently and coherently.
+// Without it, each frame maps its own slice with
+// GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_FLUSH_EXPLICIT_BIT, and the
+// fences provide the synchronization the driver is told to skip.
+//
+// Per frame: dynamicBufferBeginFrame, any number of dynamicBufferAlloc writes, then
+// dynamicBufferEndFrame before the draws that read them (an ES 3.0 buffer can't be drawn from
+// while it has a non-persistent mapping), then the draws. All of a frame's draws must be issued
+// before the next dynamicBufferBeginFrame.
+//
+
+#ifndef ANDROIDSAMSUNG_DYNAMICBUFFER_H
+#define ANDROIDSAMSUNG_DYNAMICBUFFER_H
+
+#include <GLES3/gl3.h>
+#include <cstddef>
+#include <cstdint>
+
+#define DYNAMIC_BUFFER_MAX_FRAMES 4
+
+struct DynamicAllocation {
+    void* data = nullptr; // write-only; null when the frame's slice is full
+    GLintptr offset = 0;  // byte offset in `buffer`, for glBindBufferRange / attribute pointers
+    GLsizeiptr size = 0;
+};
+
+struct DynamicBuffer {
+    GLuint buffer = 0;
+    uint32_t frameCount = 0;
+    GLsizeiptr frameSize = 0;
+    GLint uniformAlignment = 256; // GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+
+    bool persistent = false;
+    uint8_t* persistentData = nullptr;
+
+    // Current frame.
+    uint32_t frame = 0;
+    uint8_t* frameData = nullptr; // start of the current slice while a frame is open
+    GLsizeiptr used = 0;
+    GLsync fences[DYNAMIC_BUFFER_MAX_FRAMES] = {};
+    int32_t unfencedFrame = -1; // closed slice whose draws may still be being issued
+
+    // Stats.
+    uint64_t frames = 0;
+    uint64_t stalls = 0;    // frames that had to wait for their slice's fence
+    uint64_t overflows = 0; // allocations that didn't fit
+    GLsizeiptr peakUsed = 0;
+};
+
+// Call with a current GL context. `frameCount` is clamped to DYNAMIC_BUFFER_MAX_FRAMES; 3 covers
+// the frame being written, the one the GPU renders and the one the compositor samples.
+bool dynamicBufferInit(DynamicBuffer* ring, GLsizeiptr frameSize, uint32_t frameCount);
+void dynamicBufferDestroy(DynamicBuffer* ring);
+
+// Waits for the next slice to be free and opens it for writing.
+bool dynamicBufferBeginFrame(DynamicBuffer* ring);
+// Sub-allocates `size` bytes at `alignment` (power of two; 0 = uniform buffer alignment).
+DynamicAllocation dynamicBufferAlloc(DynamicBuffer* ring, GLsizeiptr size, GLsizeiptr alignment);
+// Flushes and closes the slice; the allocations may be drawn from afterwards.
+void dynamicBufferEndFrame(DynamicBuffer* ring);
+
+#endif //ANDROIDSAMSUNG_DYNAMICBUFFER_H
@@ -0,0 +1,50 @@
+#include "frame_arena.h"
+
+#include <android/log.h>
+#include <cstdlib>
+
+#define TAG "FrameArena"
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+bool frameArenaInit(FrameArena* arena, size_t capacity) {
+    arena->base = static_cast<uint8_t*>(malloc(capacity));
+    if (arena->base == nullptr) {
+        LOGE("Failed to allocate %zu bytes", capacity);
+        return false;
+    }
+    arena->capacity = capacity;
+    arena->used = 0;
+    arena->peak = 0;
+    arena->failures = 0;
+    return true;
+}
+
+void frameArenaDestroy(FrameArena* arena) {
+    free(arena->base);
+    arena->base = nullptr;
+    arena->capacity = 0;
+    arena->used = 0;
+}
+
+void frameArenaReset(FrameArena* arena) {
+    if (arena->used > arena->peak) {
+        arena->peak = arena->used;
+    }
+    arena->used = 0;
+    arena->exhausted = false;
+}
+
+void* frameArenaAlloc(FrameArena* arena, size_t size, size_t alignment) {
+    const size_t start = (arena->used + alignment - 1) & ~(alignment - 1);
+    if (arena->base == nullptr || start + size > arena->capacity) {
+        // Logged once per frame; the caller drops whatever needed the memory.
+        if (!arena->exhausted) {
+            LOGE("Out of frame memory: %zu + %zu > %zu", start, size, arena->capacity);
+            arena->exhausted = true;
+        }
+        arena->failures++;
+        return nullptr;
+    }
+    arena->used = start + size;
+    return arena->base + start;
+}
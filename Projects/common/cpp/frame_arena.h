@@ -0,0 +1,42 @@
+//
+// Per-frame linear arena for transient frame data (views, projection views, layer lists).
+//
+// One block is allocated up front. Allocations bump a pointer, and frameArenaReset at the start
+// of each frame releases everything at once, so the render loop does no heap allocation in the
+// steady state. Running out returns null (and counts it) rather than falling back to the heap;
+// size the arena from `peak`.
+//
+
+#ifndef ANDROIDSAMSUNG_FRAMEARENA_H
+#define ANDROIDSAMSUNG_FRAMEARENA_H
+
+#include <cstddef>
+#include <cstdint>
+
+struct FrameArena {
+    uint8_t* base = nullptr;
+    size_t capacity = 0;
+    size_t used = 0;
+    size_t peak = 0;
+    uint64_t failures = 0;
+    bool exhausted = false; // this frame already ran out
+};
+
+bool frameArenaInit(FrameArena* arena, size_t capacity);
+void frameArenaDestroy(FrameArena* arena);
+void frameArenaReset(FrameArena* arena);
+void* frameArenaAlloc(FrameArena* arena, size_t size, size_t alignment);
+
+// `count` copies of `init`, e.g. frameArenaArray(arena, n, XrView{XR_TYPE_VIEW}).
+template <typename T>
+T* frameArenaArray(FrameArena* arena, uint32_t count, const T& init) {
+    T* items = static_cast<T*>(frameArenaAlloc(arena, sizeof(T) * count, alignof(T)));
+    if (items != nullptr) {
+        for (uint32_t i = 0; i < count; ++i) {
+            items[i] = init;
+        }
+    }
+    return items;
+}
+
+#endif //ANDROIDSAMSUNG_FRAMEARENA_H
@@ -0,0 +1,214 @@
+#include "frame_pacing.h"
+
+#include <android/log.h>
+#include <cstdarg>
+#include <cstdio>
+#include <ctime>
+
+#define TAG "FramePacing"
+
+static uint64_t monotonicNs() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+static void histogramAdd(FramePacingHistogram* histogram, uint64_t durationNs) {
+    const uint64_t us = durationNs / 1000;
+    uint64_t bucket = us / FRAME_PACING_BUCKET_US;
+    if (bucket >= FRAME_PACING_BUCKETS) {
+        bucket = FRAME_PACING_BUCKETS - 1;
+    }
+    histogram->buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    histogram->count.fetch_add(1, std::memory_order_relaxed);
+    histogram->sumUs.fetch_add(us, std::memory_order_relaxed);
+    const uint32_t clamped = us > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(us);
+    uint32_t max = histogram->maxUs.load(std::memory_order_relaxed);
+    while (clamped > max && !histogram->maxUs.compare_exchange_weak(max, clamped, std::memory_order_relaxed)) {
+    }
+}
+
+static void histogramReset(FramePacingHistogram* histogram) {
+    for (auto& bucket : histogram->buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    histogram->count.store(0, std::memory_order_relaxed);
+    histogram->sumUs.store(0, std::memory_order_relaxed);
+    histogram->maxUs.store(0, std::memory_order_relaxed);
+}
+
+static void histogramCopy(const FramePacingHistogram* histogram, FramePacingStats::Histogram* out) {
+    for (uint32_t i = 0; i < FRAME_PACING_BUCKETS; ++i) {
+        out->buckets[i] = histogram->buckets[i].load(std::memory_order_relaxed);
+    }
+    out->count = histogram->count.load(std::memory_order_relaxed);
+    out->sumUs = histogram->sumUs.load(std::memory_order_relaxed);
+    out->maxUs = histogram->maxUs.load(std::memory_order_relaxed);
+}
+
+// --- Hooks ---
+
+void framePacingWaitStart(FramePacing* pacing) {
+    pacing->waitStartNs = monotonicNs();
+}
+
+void framePacingWaitDone(FramePacing* pacing, const XrFrameState* frameState) {
+    histogramAdd(&pacing->wait, monotonicNs() - pacing->waitStartNs);
+
+    const XrDuration period = frameState->predictedDisplayPeriod;
+    if (period > 0) {
+        pacing->displayPeriodNs.store(period, std::memory_order_relaxed);
+    }
+    if (pacing->lastDisplayTime != 0 && period > 0 && frameState->predictedDisplayTime > pacing->lastDisplayTime) {
+        // Rounded so that jitter in the prediction doesn't read as a skip.
+        const XrDuration delta = frameState->predictedDisplayTime - pacing->lastDisplayTime;
+        const int64_t periods = (delta + period / 2) / period;
+        const uint64_t skipped = periods > 1 ? static_cast<uint64_t>(periods - 1) : 0;
+        pacing->skipped[skipped < FRAME_PACING_MAX_SKIPPED ? skipped : FRAME_PACING_MAX_SKIPPED]
+                .fetch_add(1, std::memory_order_relaxed);
+        if (skipped > 0) {
+            pacing->missedFrames.fetch_add(1, std::memory_order_relaxed);
+            pacing->skippedPeriods.fetch_add(skipped, std::memory_order_relaxed);
+        }
+    }
+    pacing->lastDisplayTime = frameState->predictedDisplayTime;
+    pacing->frames.fetch_add(1, std::memory_order_relaxed);
+}
+
+void framePacingFrameBegun(FramePacing* pacing) {
+    pacing->frameBegunNs.store(monotonicNs(), std::memory_order_relaxed);
+}
+
+void framePacingFrameEnded(FramePacing* pacing) {
+    const uint64_t begun = pacing->frameBegunNs.load(std::memory_order_relaxed);
+    if (begun != 0) {
+        histogramAdd(&pacing->frameCpu, monotonicNs() - begun);
+    }
+}
+
+void framePacingRestart(FramePacing* pacing) {
+    pacing->lastDisplayTime = 0;
+    pacing->frameBegunNs.store(0, std::memory_order_relaxed);
+}
+
+void framePacingReset(FramePacing* pacing) {
+    framePacingRestart(pacing);
+    pacing->frames.store(0, std::memory_order_relaxed);
+    pacing->missedFrames.store(0, std::memory_order_relaxed);
+    pacing->skippedPeriods.store(0, std::memory_order_relaxed);
+    for (auto& bin : pacing->skipped) {
+        bin.store(0, std::memory_order_relaxed);
+    }
+    histogramReset(&pacing->wait);
+    histogramReset(&pacing->frameCpu);
+}
+
+// --- Queries ---
+
+void framePacingSnapshot(const FramePacing* pacing, FramePacingStats* stats) {
+    stats->displayPeriodNs = pacing->displayPeriodNs.load(std::memory_order_relaxed);
+    stats->frames = pacing->frames.load(std::memory_order_relaxed);
+    stats->missedFrames = pacing->missedFrames.load(std::memory_order_relaxed);
+    stats->skippedPeriods = pacing->skippedPeriods.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i <= FRAME_PACING_MAX_SKIPPED; ++i) {
+        stats->skipped[i] = pacing->skipped[i].load(std::memory_order_relaxed);
+    }
+    histogramCopy(&pacing->wait, &stats->wait);
+    histogramCopy(&pacing->frameCpu, &stats->frameCpu);
+}
+
+uint32_t framePacingPercentileUs(const FramePacingStats::Histogram* histogram, double percentile) {
+    if (histogram->count == 0) {
+        return 0;
+    }
+    const double target = histogram->count * percentile / 100.0;
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i < FRAME_PACING_BUCKETS - 1; ++i) {
+        seen += histogram->buckets[i];
+        if (seen >= target) {
+            return (i + 1) * FRAME_PACING_BUCKET_US;
+        }
+    }
+    return histogram->maxUs;
+}
+
+struct ReportWriter {
+    char* buffer;
+    size_t capacity;
+    size_t length;
+};
+
+__attribute__((format(printf, 2, 3)))
+static void append(ReportWriter* writer, const char* fmt, ...) {
+    if (writer->length + 1 >= writer->capacity) {
+        return;
+    }
+    va_list args;
+    va_start(args, fmt);
+    const int written = vsnprintf(writer->buffer + writer->length, writer->capacity - writer->length, fmt, args);
+    va_end(args);
+    if (written > 0) {
+        writer->length += static_cast<size_t>(written);
+        if (writer->length >= writer->capacity) {
+            writer->length = writer->capacity - 1;
+        }
+    }
+}
+
+static void appendHistogram(ReportWriter* writer, const char* name, const FramePacingStats::Histogram* histogram) {
+    const double meanMs = histogram->count ? histogram->sumUs / 1000.0 / histogram->count : 0.0;
+    append(writer, "%s: n=%u mean=%.2fms p50<%.1fms p90<%.1fms p99<%.1fms max=%.2fms\n", name, histogram->count,
+           meanMs, framePacingPercentileUs(histogram, 50) / 1000.0, framePacingPercentileUs(histogram, 90) / 1000.0,
+           framePacingPercentileUs(histogram, 99) / 1000.0, histogram->maxUs / 1000.0);
+    append(writer, "  ms:");
+    uint32_t last = 0;
+    for (uint32_t i = 0; i < FRAME_PACING_BUCKETS; ++i) {
+        if (histogram->buckets[i]) {
+            last = i + 1;
+        }
+    }
+    for (uint32_t i = 0; i < last; ++i) {
+        append(writer, " %u%s=%u", i * FRAME_PACING_BUCKET_US / 1000, i == FRAME_PACING_BUCKETS - 1 ? "+" : "",
+               histogram->buckets[i]);
+    }
+    append(writer, "\n");
+}
+
+size_t framePacingFormat(const FramePacingStats* stats, char* buffer, size_t capacity) {
+    if (capacity == 0) {
+        return 0;
+    }
+    buffer[0] = '\0';
+    ReportWriter writer = {buffer, capacity, 0};
+    append(&writer, "frames=%llu period=%.2fms missed=%llu (%.2f%%) skipped periods=%llu\n",
+           (unsigned long long)stats->frames, stats->displayPeriodNs / 1e6, (unsigned long long)stats->missedFrames,
+           stats->frames ? 100.0 * stats->missedFrames / stats->frames : 0.0,
+           (unsigned long long)stats->skippedPeriods);
+    append(&writer, "skips/frame:");
+    for (uint32_t i = 0; i <= FRAME_PACING_MAX_SKIPPED; ++i) {
+        append(&writer, " %u%s=%u", i, i == FRAME_PACING_MAX_SKIPPED ? "+" : "", stats->skipped[i]);
+    }
+    append(&writer, "\n");
+    appendHistogram(&writer, "xrWaitFrame", &stats->wait);
+    appendHistogram(&writer, "begin->end", &stats->frameCpu);
+    return writer.length;
+}
+
+void framePacingLog(const FramePacing* pacing, const char* tag) {
+    FramePacingStats stats;
+    framePacingSnapshot(pacing, &stats);
+    char report[2048];
+    framePacingFormat(&stats, report, sizeof(report));
+    // logcat truncates long messages, so one line per entry.
+    char* line = report;
+    while (*line) {
+        char* end = line;
+        while (*end && *end != '\n') {
+            ++end;
+        }
+        const bool more = *end != '\0';
+        *end = '\0';
+        __android_log_print(ANDROID_LOG_INFO, tag ? tag : TAG, "%s", line);
+        line = more ? end + 1 : end;
+    }
+}
@@ -0,0 +1,90 @@
+//
+// Frame pacing monitor.
+//
+// Built on XrFrameState::predictedDisplayTime/predictedDisplayPeriod: every frame whose
+// display time is more than one period after the previous frame's skipped the periods in
+// between. Alongside that it measures how long xrWaitFrame blocked and the CPU side of the
+// frame (xrBeginFrame returning to xrEndFrame being called), each in a fixed-bucket histogram.
+//
+// All counters are relaxed atomics: the wait/begin hooks and the end hook may run on different
+// threads (frame_pipeline.h), and snapshots can be taken from any thread (e.g. JNI) while
+// frames are running.
+//
+
+#ifndef ANDROIDSAMSUNG_FRAMEPACING_H
+#define ANDROIDSAMSUNG_FRAMEPACING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <openxr/openxr.h>
+
+// Histogram bucket i holds samples in [i, i+1) * FRAME_PACING_BUCKET_US; the last bucket is
+// open-ended.
+#define FRAME_PACING_BUCKETS 32
+#define FRAME_PACING_BUCKET_US 1000
+// Frames are also binned by how many display periods were skipped before them; the last bin
+// collects everything from FRAME_PACING_MAX_SKIPPED up.
+#define FRAME_PACING_MAX_SKIPPED 8
+
+struct FramePacingHistogram {
+    std::atomic<uint32_t> buckets[FRAME_PACING_BUCKETS] = {};
+    std::atomic<uint32_t> count{0};
+    std::atomic<uint64_t> sumUs{0};
+    std::atomic<uint32_t> maxUs{0};
+};
+
+struct FramePacing {
+    // Wait/begin side.
+    uint64_t waitStartNs = 0;
+    XrTime lastDisplayTime = 0;
+    std::atomic<uint64_t> frameBegunNs{0};
+
+    std::atomic<int64_t> displayPeriodNs{0};
+    std::atomic<uint64_t> frames{0};
+    std::atomic<uint64_t> missedFrames{0};   // frames that followed at least one skipped period
+    std::atomic<uint64_t> skippedPeriods{0}; // total periods skipped
+    std::atomic<uint32_t> skipped[FRAME_PACING_MAX_SKIPPED + 1] = {};
+
+    FramePacingHistogram wait;     // time blocked in xrWaitFrame
+    FramePacingHistogram frameCpu; // xrBeginFrame returned -> xrEndFrame called
+};
+
+// Plain copy of a FramePacing, safe to inspect at leisure.
+struct FramePacingStats {
+    int64_t displayPeriodNs;
+    uint64_t frames;
+    uint64_t missedFrames;
+    uint64_t skippedPeriods;
+    uint32_t skipped[FRAME_PACING_MAX_SKIPPED + 1];
+
+    struct Histogram {
+        uint32_t buckets[FRAME_PACING_BUCKETS];
+        uint32_t count;
+        uint64_t sumUs;
+        uint32_t maxUs;
+    } wait, frameCpu;
+};
+
+// --- Hooks, in frame order ---
+void framePacingWaitStart(FramePacing* pacing);
+void framePacingWaitDone(FramePacing* pacing, const XrFrameState* frameState);
+void framePacingFrameBegun(FramePacing* pacing);
+void framePacingFrameEnded(FramePacing* pacing);
+
+// Forgets the previous display time, e.g. when a session (re)starts, so the gap doesn't count
+// as missed frames. Counters are kept; use framePacingReset to clear them too.
+void framePacingRestart(FramePacing* pacing);
+void framePacingReset(FramePacing* pacing);
+
+// --- Queries ---
+void framePacingSnapshot(const FramePacing* pacing, FramePacingStats* stats);
+// Upper edge in microseconds of the bucket holding the `percentile` (0..100) sample.
+uint32_t framePacingPercentileUs(const FramePacingStats::Histogram* histogram, double percentile);
+// Multi-line text report. Returns the length written (truncated to `capacity` - 1).
+size_t framePacingFormat(const FramePacingStats* stats, char* buffer, size_t capacity);
+// Writes the report to logcat under `tag`.
+void framePacingLog(const FramePacing* pacing, const char* tag);
+
+#endif //ANDROIDSAMSUNG_FRAMEPACING_H
@@ -0,0 +1,162 @@
+#include "frame_pipeline.h"
+
+#include <android/log.h>
+#include <chrono>
+
+#include "trace.h"
+
+#define TAG "FramePipeline"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+// Back-off after a failed xrWaitFrame so a stopping session doesn't spin the wait thread.
+#define WAIT_FRAME_RETRY_MS 2
+
+static void waitThreadMain(FramePipeline* pipeline) {
+    uint64_t nextFrameId = 1;
+    for (;;) {
+        {
+            std::lock_guard<std::mutex> lock(pipeline->mutex);
+            if (pipeline->stopRequested) {
+                return;
+            }
+        }
+
+        // Overlaps with the render thread working on the previous frame.
+        XrFrameState frameState = {XR_TYPE_FRAME_STATE};
+        if (pipeline->pacing) {
+            framePacingWaitStart(pipeline->pacing);
+        }
+        XrResult r;
+        {
+            TRACE_SCOPE("xrWaitFrame");
+            r = xrWaitFrame(pipeline->session, nullptr, &frameState);
+        }
+        if (XR_FAILED(r)) {
+            LOGE("xrWaitFrame failed: 0x%X", r);
+            std::this_thread::sleep_for(std::chrono::milliseconds(WAIT_FRAME_RETRY_MS));
+            continue;
+        }
+        if (pipeline->pacing) {
+            framePacingWaitDone(pipeline->pacing, &frameState);
+        }
+
+        std::unique_lock<std::mutex> lock(pipeline->mutex);
+        pipeline->cond.wait(lock, [pipeline] { return !pipeline->frameBegun || pipeline->stopRequested; });
+        if (pipeline->stopRequested) {
+            // The runtime still counts this frame as waited for; framePipelineStop begins and ends it.
+            pipeline->frameWaited = true;
+            pipeline->waitedState = frameState;
+            return;
+        }
+        {
+            TRACE_SCOPE("xrBeginFrame");
+            r = xrBeginFrame(pipeline->session, nullptr);
+        }
+        if (XR_FAILED(r)) {
+            LOGE("xrBeginFrame failed: 0x%X", r);
+            continue;
+        }
+        if (pipeline->pacing) {
+            framePacingFrameBegun(pipeline->pacing);
+        }
+        pipeline->frameBegun = true;
+        pipeline->frameReady = true;
+        pipeline->frameId = nextFrameId++;
+        pipeline->frameState = frameState;
+        pipeline->cond.notify_all();
+    }
+}
+
+bool framePipelineStart(FramePipeline* pipeline, XrSession session, XrEnvironmentBlendMode blendMode) {
+    if (pipeline->running) {
+        return true;
+    }
+    pipeline->session = session;
+    pipeline->blendMode = blendMode;
+    pipeline->stopRequested = false;
+    pipeline->frameBegun = false;
+    pipeline->frameReady = false;
+    pipeline->frameId = 0;
+    pipeline->frameWaited = false;
+    pipeline->waitThread = std::thread(waitThreadMain, pipeline);
+    pipeline->running = true;
+    LOGI("Frame pipeline started");
+    return true;
+}
+
+bool framePipelineAcquire(FramePipeline* pipeline, XrFrameState* frameState, uint64_t* frameId,
+                          uint32_t timeoutMs) {
+    TRACE_SCOPE("framePipelineAcquire");
+    std::unique_lock<std::mutex> lock(pipeline->mutex);
+    const bool ready = pipeline->cond.wait_for(lock, std::chrono::milliseconds(timeoutMs), [pipeline] {
+        return pipeline->frameReady || pipeline->stopRequested;
+    });
+    if (!ready || pipeline->stopRequested) {
+        return false;
+    }
+    pipeline->frameReady = false;
+    *frameState = pipeline->frameState;
+    *frameId = pipeline->frameId;
+    return true;
+}
+
+XrResult framePipelineEndFrame(FramePipeline* pipeline, uint64_t frameId, const XrFrameEndInfo* endInfo) {
+    TRACE_SCOPE("xrEndFrame");
+    std::lock_guard<std::mutex> lock(pipeline->mutex);
+    if (!pipeline->frameBegun || pipeline->frameReady || frameId != pipeline->frameId) {
+        LOGE("Frame %llu ended out of order (begun frame is %llu)",
+             (unsigned long long)frameId, (unsigned long long)pipeline->frameId);
+        return XR_ERROR_CALL_ORDER_INVALID;
+    }
+    if (pipeline->pacing) {
+        framePacingFrameEnded(pipeline->pacing);
+    }
+    XrResult r = xrEndFrame(pipeline->session, endInfo);
+    pipeline->frameBegun = false;
+    pipeline->cond.notify_all();
+    return r;
+}
+
+// Submits a frame with no layers.
+static void endEmptyFrame(FramePipeline* pipeline, XrTime displayTime) {
+    XrFrameEndInfo endInfo = {XR_TYPE_FRAME_END_INFO};
+    endInfo.displayTime = displayTime;
+    endInfo.environmentBlendMode = pipeline->blendMode;
+    const XrResult r = xrEndFrame(pipeline->session, &endInfo);
+    if (XR_FAILED(r)) {
+        LOGE("xrEndFrame failed while stopping: 0x%X", r);
+    }
+}
+
+void framePipelineStop(FramePipeline* pipeline) {
+    if (!pipeline->running) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(pipeline->mutex);
+        pipeline->stopRequested = true;
+        pipeline->cond.notify_all();
+    }
+    pipeline->waitThread.join();
+    pipeline->running = false;
+
+    // A frame begun but never rendered still has to be ended before the session stops.
+    if (pipeline->frameBegun) {
+        endEmptyFrame(pipeline, pipeline->frameState.predictedDisplayTime);
+        pipeline->frameBegun = false;
+        pipeline->frameReady = false;
+    }
+    // So does one the wait thread waited for: until it is begun the runtime holds the next
+    // xrWaitFrame, which would block a restarted pipeline for good.
+    if (pipeline->frameWaited) {
+        const XrResult r = xrBeginFrame(pipeline->session, nullptr);
+        if (XR_SUCCEEDED(r)) {
+            endEmptyFrame(pipeline, pipeline->waitedState.predictedDisplayTime);
+        } else {
+            LOGE("xrBeginFrame failed while stopping: 0x%X", r);
+        }
+        pipeline->frameWaited = false;
+    }
+    LOGI("Frame pipeline stopped after %llu frames", (unsigned long long)pipeline->frameId);
+}
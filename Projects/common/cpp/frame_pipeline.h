@@ -0,0 +1,67 @@
+//
+// Two-thread frame loop.
+//
+// The serial loop runs xrWaitFrame -> xrBeginFrame -> render -> xrEndFrame on one thread,
+// so the wait for frame N+1 can't start until frame N is submitted. With the pipeline a
+// wait thread owns the xrWaitFrame/xrBeginFrame cadence and hands each begun frame to the
+// render thread (the one holding the GL context), which renders and calls xrEndFrame:
+//
+//   wait thread:    wait(N+1) ......... begin(N+1) -> hand off   wait(N+2) ...
+//   render thread:  render(N) -> end(N)              render(N+1) -> end(N+1)
+//
+// xrBeginFrame(N+1) is only issued after xrEndFrame(N), so frames reach the runtime in order
+// and at most one frame is begun at any time.
+//
+
+#ifndef ANDROIDSAMSUNG_FRAMEPIPELINE_H
+#define ANDROIDSAMSUNG_FRAMEPIPELINE_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include <openxr/openxr.h>
+
+#include "frame_pacing.h"
+
+struct FramePipeline {
+    XrSession session = XR_NULL_HANDLE;
+    XrEnvironmentBlendMode blendMode = XR_ENVIRONMENT_BLEND_MODE_OPAQUE;
+    // Optional; fed from both threads while the pipeline runs.
+    FramePacing* pacing = nullptr;
+    std::thread waitThread;
+
+    std::mutex mutex;
+    std::condition_variable cond;
+    bool running = false;
+    bool stopRequested = false;
+
+    // The begun frame: handed off when `frameReady`, owned by the render thread until ended.
+    bool frameBegun = false;
+    bool frameReady = false;
+    uint64_t frameId = 0;
+    XrFrameState frameState = {XR_TYPE_FRAME_STATE};
+
+    // A frame the wait thread had waited for but not begun when it stopped.
+    bool frameWaited = false;
+    XrFrameState waitedState = {XR_TYPE_FRAME_STATE};
+};
+
+// Starts the wait thread for a running session (call right after xrBeginSession).
+// `blendMode` is used to end a frame that is still open when the pipeline stops.
+bool framePipelineStart(FramePipeline* pipeline, XrSession session, XrEnvironmentBlendMode blendMode);
+
+// Render thread: waits up to `timeoutMs` for the next begun frame. Returns false on timeout
+// or when the pipeline is stopping; the caller then skips rendering this iteration.
+bool framePipelineAcquire(FramePipeline* pipeline, XrFrameState* frameState, uint64_t* frameId,
+                          uint32_t timeoutMs);
+
+// Render thread: submits the acquired frame and lets the wait thread begin the next one.
+XrResult framePipelineEndFrame(FramePipeline* pipeline, uint64_t frameId, const XrFrameEndInfo* endInfo);
+
+// Joins the wait thread and ends any frame it left open, begun or only waited for (call before
+// xrEndSession, or before starting the pipeline again).
+void framePipelineStop(FramePipeline* pipeline);
+
+#endif //ANDROIDSAMSUNG_FRAMEPIPELINE_H
@@ -0,0 +1,128 @@
+#include "frame_stats.h"
+
+#include <algorithm>
+#include <ctime>
+
+static_assert((FRAME_STATS_CAPACITY & (FRAME_STATS_CAPACITY - 1)) == 0, "capacity must be a power of two");
+
+static uint32_t toUs(uint64_t ns) {
+    const uint64_t us = ns / 1000;
+    return us > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(us);
+}
+
+uint64_t frameStatsNowNs() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+// --- Producer ---
+
+void frameStatsPush(FrameStatsRing* ring, uint64_t beginNs, uint64_t endNs, int64_t displayPeriodNs) {
+    const uint64_t index = ring->head.load(std::memory_order_relaxed);
+    FrameStatsSlot& slot = ring->slots[index & (FRAME_STATS_CAPACITY - 1)];
+    // Pairs with the reader's acquire fence: a reader that sees any of the stores below also
+    // sees the head that makes this slot's previous record stale.
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.endNs.store(endNs, std::memory_order_relaxed);
+    slot.intervalUs.store(ring->lastEndNs && endNs > ring->lastEndNs ? toUs(endNs - ring->lastEndNs) : 0,
+                          std::memory_order_relaxed);
+    slot.cpuUs.store(endNs > beginNs ? toUs(endNs - beginNs) : 0, std::memory_order_relaxed);
+    slot.periodUs.store(displayPeriodNs > 0 ? toUs(static_cast<uint64_t>(displayPeriodNs)) : 0,
+                        std::memory_order_relaxed);
+    ring->head.store(index + 1, std::memory_order_release);
+    ring->lastEndNs = endNs;
+}
+
+void frameStatsRestart(FrameStatsRing* ring) {
+    ring->lastEndNs = 0;
+}
+
+// --- Readers ---
+
+uint32_t frameStatsCopyRecent(const FrameStatsRing* ring, FrameStatsRecord* records, uint32_t maxRecords) {
+    const uint64_t head = ring->head.load(std::memory_order_acquire);
+    uint64_t first = head > maxRecords ? head - maxRecords : 0;
+    if (head - first > FRAME_STATS_CAPACITY) {
+        first = head - FRAME_STATS_CAPACITY;
+    }
+
+    for (uint64_t i = first; i < head; ++i) {
+        const FrameStatsSlot& slot = ring->slots[i & (FRAME_STATS_CAPACITY - 1)];
+        FrameStatsRecord& record = records[i - first];
+        record.endNs = slot.endNs.load(std::memory_order_relaxed);
+        record.intervalUs = slot.intervalUs.load(std::memory_order_relaxed);
+        record.cpuUs = slot.cpuUs.load(std::memory_order_relaxed);
+        record.periodUs = slot.periodUs.load(std::memory_order_relaxed);
+    }
+
+    // Drop whatever the producer may have started rewriting during the copy. It may already be
+    // writing record headAfter, whose slot held record headAfter - capacity.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t headAfter = ring->head.load(std::memory_order_relaxed);
+    const uint64_t valid = headAfter + 1 > FRAME_STATS_CAPACITY ? headAfter + 1 - FRAME_STATS_CAPACITY : 0;
+    if (valid <= first) {
+        return static_cast<uint32_t>(head - first);
+    }
+    if (valid >= head) {
+        return 0;
+    }
+    const uint64_t torn = valid - first;
+    std::copy(records + torn, records + (head - first), records);
+    return static_cast<uint32_t>(head - valid);
+}
+
+// Nearest-rank percentile of a sorted array.
+static uint32_t percentile(const uint32_t* sorted, uint32_t count, uint32_t pct) {
+    if (count == 0) {
+        return 0;
+    }
+    uint32_t rank = (count * pct + 99) / 100;
+    return sorted[rank ? rank - 1 : 0];
+}
+
+void frameStatsSummarize(const FrameStatsRing* ring, uint32_t windowFrames, uint32_t budgetUs,
+                         FrameStatsSummary* summary) {
+    *summary = {};
+    if (windowFrames == 0 || windowFrames > FRAME_STATS_CAPACITY) {
+        windowFrames = FRAME_STATS_CAPACITY;
+    }
+    FrameStatsRecord records[FRAME_STATS_CAPACITY];
+    const uint32_t count = frameStatsCopyRecent(ring, records, windowFrames);
+    if (count == 0) {
+        return;
+    }
+    if (budgetUs == 0) {
+        budgetUs = records[count - 1].periodUs;
+    }
+
+    uint32_t intervals[FRAME_STATS_CAPACITY];
+    uint32_t cpu[FRAME_STATS_CAPACITY];
+    uint32_t intervalCount = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        cpu[i] = records[i].cpuUs;
+        if (budgetUs && records[i].cpuUs > budgetUs) {
+            summary->overBudget++;
+        }
+        // The first frame after a (re)start has no interval.
+        if (records[i].intervalUs) {
+            intervals[intervalCount++] = records[i].intervalUs;
+            if (budgetUs && records[i].intervalUs > budgetUs + budgetUs / 2) {
+                summary->late++;
+            }
+        }
+    }
+    std::sort(intervals, intervals + intervalCount);
+    std::sort(cpu, cpu + count);
+
+    summary->count = count;
+    summary->budgetUs = budgetUs;
+    const uint64_t spanNs = records[count - 1].endNs - records[0].endNs;
+    summary->fps = count > 1 && spanNs ? static_cast<float>((count - 1) * 1e9 / spanNs) : 0.0f;
+    summary->intervalP50Us = percentile(intervals, intervalCount, 50);
+    summary->intervalP90Us = percentile(intervals, intervalCount, 90);
+    summary->intervalP99Us = percentile(intervals, intervalCount, 99);
+    summary->cpuP50Us = percentile(cpu, count, 50);
+    summary->cpuP90Us = percentile(cpu, count, 90);
+    summary->cpuP99Us = percentile(cpu, count, 99);
+}
@@ -0,0 +1,72 @@
+//
+// Per-frame timing records in a single-producer lock-free ring.
+//
+// The render thread pushes one record per submitted frame; any other thread (JNI, a HUD, the
+// once-a-second log) snapshots the most recent records without taking a lock or making the
+// producer wait. The producer publishes each record by bumping `head` with release order. A
+// reader copies the slots it wants and then re-reads `head`. Any slot the producer may have
+// lapped in the meantime is dropped, so a snapshot only ever holds whole records.
+//
+
+#ifndef ANDROIDSAMSUNG_FRAMESTATS_H
+#define ANDROIDSAMSUNG_FRAMESTATS_H
+
+#include <atomic>
+#include <cstdint>
+
+// Power of two; ~5.6 s of history at 90 Hz.
+#define FRAME_STATS_CAPACITY 512
+
+struct FrameStatsSlot {
+    std::atomic<uint64_t> endNs{0};       // xrEndFrame returned (CLOCK_MONOTONIC)
+    std::atomic<uint32_t> intervalUs{0};  // since the previous frame's end; 0 for the first frame
+    std::atomic<uint32_t> cpuUs{0};       // frame begun -> xrEndFrame returned
+    std::atomic<uint32_t> periodUs{0};    // predictedDisplayPeriod of the frame
+};
+
+struct FrameStatsRing {
+    // Producer only.
+    uint64_t lastEndNs = 0;
+
+    // Number of records ever pushed; record i lives in slots[i % FRAME_STATS_CAPACITY].
+    std::atomic<uint64_t> head{0};
+    FrameStatsSlot slots[FRAME_STATS_CAPACITY];
+};
+
+struct FrameStatsRecord {
+    uint64_t endNs;
+    uint32_t intervalUs;
+    uint32_t cpuUs;
+    uint32_t periodUs;
+};
+
+struct FrameStatsSummary {
+    uint32_t count;         // records the summary is built from
+    uint32_t budgetUs;      // budget used for overBudget/late
+    float fps;              // count over the time the records span
+    uint32_t intervalP50Us; // frame-to-frame time
+    uint32_t intervalP90Us;
+    uint32_t intervalP99Us;
+    uint32_t cpuP50Us;      // begin -> end
+    uint32_t cpuP90Us;
+    uint32_t cpuP99Us;
+    uint32_t overBudget;    // frames whose CPU time exceeded the budget
+    uint32_t late;          // frames that arrived more than half a budget after the expected time
+};
+
+uint64_t frameStatsNowNs();
+
+// --- Producer (the render thread) ---
+void frameStatsPush(FrameStatsRing* ring, uint64_t beginNs, uint64_t endNs, int64_t displayPeriodNs);
+// Forgets the previous end time so the gap across a session restart isn't recorded as a frame.
+void frameStatsRestart(FrameStatsRing* ring);
+
+// --- Readers (any thread) ---
+// Copies up to `maxRecords` of the most recent records, oldest first. Returns the number copied.
+uint32_t frameStatsCopyRecent(const FrameStatsRing* ring, FrameStatsRecord* records, uint32_t maxRecords);
+// Summarizes the last `windowFrames` records (0 = everything in the ring). A `budgetUs` of 0
+// takes the display period of the newest record.
+void frameStatsSummarize(const FrameStatsRing* ring, uint32_t windowFrames, uint32_t budgetUs,
+                         FrameStatsSummary* summary);
+
+#endif //ANDROIDSAMSUNG_FRAMESTATS_H
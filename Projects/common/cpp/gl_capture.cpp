@@ -0,0 +1,672 @@
+#define GL_CAPTURE_IMPLEMENTATION
+#include "gl_capture.h"
+
+#include <android/log.h>
+#include <time.h>
+#include <cstdio>
+#include <cstring>
+#include <initializer_list>
+#include <string>
+
+#define XR_USE_PLATFORM_ANDROID
+#define XR_USE_GRAPHICS_API_OPENGL_ES
+#include <jni.h>
+#include <EGL/egl.h>
+#include <openxr/openxr_platform.h>
+
+#define TAG "GlCapture"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+#define GL_CAPTURE_MAX_SWAPCHAINS 8
+
+static const char* const kOpNames[GL_CAPTURE_OP_COUNT] = {
+        "?",
+        "frame begin",
+        "frame end",
+        "glGenBuffers",
+        "glGenVertexArrays",
+        "glGenTextures",
+        "glGenFramebuffers",
+        "glGenRenderbuffers",
+        "glDeleteBuffers",
+        "glDeleteVertexArrays",
+        "glDeleteTextures",
+        "glDeleteFramebuffers",
+        "glDeleteRenderbuffers",
+        "glCreateShader",
+        "glShaderSource",
+        "glCompileShader",
+        "glDeleteShader",
+        "glCreateProgram",
+        "glAttachShader",
+        "glLinkProgram",
+        "glDeleteProgram",
+        "glGetUniformLocation",
+        "glBufferData",
+        "glBufferSubData",
+        "glTexStorage3D",
+        "glRenderbufferStorage",
+        "glVertexAttribPointer",
+        "glEnableVertexAttribArray",
+        "glBindBuffer",
+        "glBindVertexArray",
+        "glBindTexture",
+        "glBindFramebuffer",
+        "glBindRenderbuffer",
+        "glFramebufferTextureLayer",
+        "glFramebufferRenderbuffer",
+        "glUseProgram",
+        "glViewport",
+        "glClearColor",
+        "glClear",
+        "glEnable",
+        "glDisable",
+        "glDepthFunc",
+        "glDepthMask",
+        "glBlendFunc",
+        "glUniform1f",
+        "glUniform3f",
+        "glUniformMatrix4fv",
+        "glDrawElements",
+        "glFlush",
+        "glFinish",
+        "swapchain image",
+        "xrWaitFrame",
+        "xrBeginFrame",
+        "xrAcquireSwapchainImage",
+        "xrWaitSwapchainImage",
+        "xrLocateViews",
+        "xrReleaseSwapchainImage",
+        "xrEndFrame",
+};
+
+const char* glCaptureOpName(uint16_t op) {
+    return op < GL_CAPTURE_OP_COUNT ? kOpNames[op] : kOpNames[0];
+}
+
+// --- Recording ---
+
+struct CapturedSwapchain {
+    XrSwapchain handle;
+    XrSwapchainCreateInfo info;
+};
+
+// The render thread's; capture is not thread-safe.
+struct GlCaptureState {
+    bool active = false;
+    std::string path;
+    uint32_t skipFrames = 0;
+    uint32_t frameCount = 0;
+    uint32_t framesSeen = 0;
+    uint32_t framesRecorded = 0;
+    bool inFrame = false;
+    bool recordingFrame = false;
+    uint64_t frameBeginNs = 0;
+    uint32_t recordCount = 0;
+    std::vector<uint8_t> bytes;
+    CapturedSwapchain swapchains[GL_CAPTURE_MAX_SWAPCHAINS];
+    uint32_t swapchainCount = 0;
+};
+
+static GlCaptureState g_capture;
+
+static uint64_t nowNs() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + ts.tv_nsec;
+}
+
+static bool recording() {
+    return g_capture.active && (!g_capture.inFrame || g_capture.recordingFrame);
+}
+
+static uint32_t bits(float value) {
+    uint32_t word;
+    memcpy(&word, &value, sizeof(word));
+    return word;
+}
+
+static void append(const void* data, size_t size) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    g_capture.bytes.insert(g_capture.bytes.end(), bytes, bytes + size);
+}
+
+static void record(GlCaptureOp op, uint64_t startNs, const uint32_t* words, size_t wordCount,
+                   const void* blob = nullptr, size_t blobBytes = 0) {
+    GlCaptureRecord header;
+    header.op = op;
+    header.words = static_cast<uint16_t>(wordCount);
+    header.blobBytes = blob ? static_cast<uint32_t>(blobBytes) : 0;
+    const uint64_t duration = nowNs() - startNs;
+    header.durationNs = duration > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(duration);
+    append(&header, sizeof(header));
+    append(words, wordCount * sizeof(uint32_t));
+    if (header.blobBytes) {
+        append(blob, header.blobBytes);
+        static const uint8_t kPad[3] = {};
+        append(kPad, (4 - header.blobBytes % 4) % 4);
+    }
+    ++g_capture.recordCount;
+}
+
+static void record(GlCaptureOp op, uint64_t startNs, std::initializer_list<uint32_t> words,
+                   const void* blob = nullptr, size_t blobBytes = 0) {
+    record(op, startNs, words.begin(), words.size(), blob, blobBytes);
+}
+
+// Starts timing a call if it is to be recorded; 0 otherwise.
+static uint64_t begin() {
+    return recording() ? nowNs() : 0;
+}
+
+bool glCaptureStart(const char* path, uint32_t skipFrames, uint32_t frameCount) {
+#if defined(GL_CAPTURE)
+    if (g_capture.active || frameCount == 0) {
+        return false;
+    }
+    g_capture = GlCaptureState();
+    g_capture.active = true;
+    g_capture.path = path;
+    g_capture.skipFrames = skipFrames;
+    g_capture.frameCount = frameCount;
+    LOGI("Capturing frames %u-%u to %s", skipFrames, skipFrames + frameCount - 1, path);
+    return true;
+#else
+    (void)path;
+    (void)skipFrames;
+    (void)frameCount;
+    LOGE("Built without GL_CAPTURE");
+    return false;
+#endif
+}
+
+void glCaptureStop() {
+    if (!g_capture.active) {
+        return;
+    }
+    g_capture.active = false;
+    GlCaptureHeader header;
+    header.frameCount = g_capture.framesRecorded;
+    header.recordCount = g_capture.recordCount;
+    FILE* file = fopen(g_capture.path.c_str(), "wb");
+    if (!file) {
+        LOGE("Could not write %s", g_capture.path.c_str());
+    } else {
+        fwrite(&header, sizeof(header), 1, file);
+        fwrite(g_capture.bytes.data(), 1, g_capture.bytes.size(), file);
+        fclose(file);
+        LOGI("Wrote %u frame(s), %u calls, %zu bytes to %s", header.frameCount, header.recordCount,
+             g_capture.bytes.size() + sizeof(header), g_capture.path.c_str());
+    }
+    g_capture.bytes = std::vector<uint8_t>();
+}
+
+bool glCaptureActive() {
+    return g_capture.active;
+}
+
+void glCaptureFrameBegin() {
+    if (!g_capture.active) {
+        return;
+    }
+    g_capture.inFrame = true;
+    g_capture.recordingFrame = g_capture.framesSeen++ >= g_capture.skipFrames;
+    g_capture.frameBeginNs = nowNs();
+    if (g_capture.recordingFrame) {
+        record(GL_CAPTURE_OP_FRAME_BEGIN, g_capture.frameBeginNs, {g_capture.framesRecorded});
+    }
+}
+
+void glCaptureFrameEnd() {
+    if (!g_capture.active || !g_capture.inFrame) {
+        return;
+    }
+    const bool recorded = g_capture.recordingFrame;
+    if (recorded) {
+        record(GL_CAPTURE_OP_FRAME_END, g_capture.frameBeginNs, {g_capture.framesRecorded});
+        ++g_capture.framesRecorded;
+    }
+    g_capture.inFrame = false;
+    g_capture.recordingFrame = false;
+    if (recorded && g_capture.framesRecorded == g_capture.frameCount) {
+        glCaptureStop();
+    }
+}
+
+// --- Reading ---
+
+bool glCaptureLoad(const char* path, GlCaptureStream* stream) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        LOGE("Could not open %s", path);
+        return false;
+    }
+    const bool headerRead = fread(&stream->header, sizeof(stream->header), 1, file) == 1;
+    stream->bytes.clear();
+    uint8_t chunk[65536];
+    size_t read;
+    while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        stream->bytes.insert(stream->bytes.end(), chunk, chunk + read);
+    }
+    fclose(file);
+    if (!headerRead || stream->header.magic != GL_CAPTURE_MAGIC || stream->header.version != GL_CAPTURE_VERSION) {
+        LOGE("%s is not a version %d capture", path, GL_CAPTURE_VERSION);
+        return false;
+    }
+
+    stream->calls.clear();
+    stream->calls.reserve(stream->header.recordCount);
+    size_t offset = 0;
+    while (offset + sizeof(GlCaptureRecord) <= stream->bytes.size()) {
+        GlCaptureCall call;
+        memcpy(&call.record, stream->bytes.data() + offset, sizeof(call.record));
+        offset += sizeof(call.record);
+        const size_t wordBytes = call.record.words * sizeof(uint32_t);
+        const size_t blobBytes = (call.record.blobBytes + 3u) & ~size_t(3);
+        if (offset + wordBytes + blobBytes > stream->bytes.size()) {
+            break;
+        }
+        call.args = reinterpret_cast<const uint32_t*>(stream->bytes.data() + offset);
+        call.blob = call.record.blobBytes ? stream->bytes.data() + offset + wordBytes : nullptr;
+        offset += wordBytes + blobBytes;
+        stream->calls.push_back(call);
+    }
+    if (stream->calls.size() != stream->header.recordCount || offset != stream->bytes.size()) {
+        LOGE("%s is truncated: %zu of %u calls", path, stream->calls.size(), stream->header.recordCount);
+        return false;
+    }
+    return true;
+}
+
+// --- Wrappers ---
+
+static void recordNames(GlCaptureOp op, uint64_t start, GLsizei n, const GLuint* names) {
+    record(op, start, names, static_cast<size_t>(n));
+}
+
+#define CAPTURE_NAMES(function, op)                                   \
+    void glCapture##function(GLsizei n, GLuint* names) {              \
+        const uint64_t start = begin();                               \
+        gl##function(n, names);                                       \
+        if (start) recordNames(op, start, n, names);                  \
+    }
+CAPTURE_NAMES(GenBuffers, GL_CAPTURE_OP_GEN_BUFFERS)
+CAPTURE_NAMES(GenVertexArrays, GL_CAPTURE_OP_GEN_VERTEX_ARRAYS)
+CAPTURE_NAMES(GenTextures, GL_CAPTURE_OP_GEN_TEXTURES)
+CAPTURE_NAMES(GenFramebuffers, GL_CAPTURE_OP_GEN_FRAMEBUFFERS)
+CAPTURE_NAMES(GenRenderbuffers, GL_CAPTURE_OP_GEN_RENDERBUFFERS)
+#undef CAPTURE_NAMES
+
+#define CAPTURE_DELETE(function, op)                                  \
+    void glCapture##function(GLsizei n, const GLuint* names) {        \
+        const uint64_t start = begin();                               \
+        gl##function(n, names);                                       \
+        if (start) recordNames(op, start, n, names);                  \
+    }
+CAPTURE_DELETE(DeleteBuffers, GL_CAPTURE_OP_DELETE_BUFFERS)
+CAPTURE_DELETE(DeleteVertexArrays, GL_CAPTURE_OP_DELETE_VERTEX_ARRAYS)
+CAPTURE_DELETE(DeleteTextures, GL_CAPTURE_OP_DELETE_TEXTURES)
+CAPTURE_DELETE(DeleteFramebuffers, GL_CAPTURE_OP_DELETE_FRAMEBUFFERS)
+CAPTURE_DELETE(DeleteRenderbuffers, GL_CAPTURE_OP_DELETE_RENDERBUFFERS)
+#undef CAPTURE_DELETE
+
+GLuint glCaptureCreateShader(GLenum type) {
+    const uint64_t start = begin();
+    const GLuint shader = glCreateShader(type);
+    if (start) record(GL_CAPTURE_OP_CREATE_SHADER, start, {type, shader});
+    return shader;
+}
+
+// The strings are joined into one source, which is what the compiler sees anyway.
+void glCaptureShaderSource(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length) {
+    const uint64_t start = begin();
+    glShaderSource(shader, count, string, length);
+    if (start) {
+        std::string source;
+        for (GLsizei i = 0; i < count; ++i) {
+            if (length && length[i] >= 0) {
+                source.append(string[i], length[i]);
+            } else {
+                source.append(string[i]);
+            }
+        }
+        record(GL_CAPTURE_OP_SHADER_SOURCE, start, {shader}, source.data(), source.size());
+    }
+}
+
+void glCaptureCompileShader(GLuint shader) {
+    const uint64_t start = begin();
+    glCompileShader(shader);
+    if (start) record(GL_CAPTURE_OP_COMPILE_SHADER, start, {shader});
+}
+
+void glCaptureDeleteShader(GLuint shader) {
+    const uint64_t start = begin();
+    glDeleteShader(shader);
+    if (start) record(GL_CAPTURE_OP_DELETE_SHADER, start, {shader});
+}
+
+GLuint glCaptureCreateProgram() {
+    const uint64_t start = begin();
+    const GLuint program = glCreateProgram();
+    if (start) record(GL_CAPTURE_OP_CREATE_PROGRAM, start, {program});
+    return program;
+}
+
+void glCaptureAttachShader(GLuint program, GLuint shader) {
+    const uint64_t start = begin();
+    glAttachShader(program, shader);
+    if (start) record(GL_CAPTURE_OP_ATTACH_SHADER, start, {program, shader});
+}
+
+void glCaptureLinkProgram(GLuint program) {
+    const uint64_t start = begin();
+    glLinkProgram(program);
+    if (start) record(GL_CAPTURE_OP_LINK_PROGRAM, start, {program});
+}
+
+void glCaptureDeleteProgram(GLuint program) {
+    const uint64_t start = begin();
+    glDeleteProgram(program);
+    if (start) record(GL_CAPTURE_OP_DELETE_PROGRAM, start, {program});
+}
+
+GLint glCaptureGetUniformLocation(GLuint program, const GLchar* name) {
+    const uint64_t start = begin();
+    const GLint location = glGetUniformLocation(program, name);
+    if (start) {
+        record(GL_CAPTURE_OP_GET_UNIFORM_LOCATION, start, {program, static_cast<uint32_t>(location)}, name,
+               strlen(name) + 1);
+    }
+    return location;
+}
+
+void glCaptureBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage) {
+    const uint64_t start = begin();
+    glBufferData(target, size, data, usage);
+    if (start) {
+        record(GL_CAPTURE_OP_BUFFER_DATA, start, {target, static_cast<uint32_t>(size), usage}, data,
+               static_cast<size_t>(size));
+    }
+}
+
+void glCaptureBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data) {
+    const uint64_t start = begin();
+    glBufferSubData(target, offset, size, data);
+    if (start) {
+        record(GL_CAPTURE_OP_BUFFER_SUB_DATA, start, {target, static_cast<uint32_t>(offset), static_cast<uint32_t>(size)},
+               data, static_cast<size_t>(size));
+    }
+}
+
+void glCaptureTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height,
+                           GLsizei depth) {
+    const uint64_t start = begin();
+    glTexStorage3D(target, levels, internalformat, width, height, depth);
+    if (start) {
+        record(GL_CAPTURE_OP_TEX_STORAGE_3D, start,
+               {target, static_cast<uint32_t>(levels), internalformat, static_cast<uint32_t>(width),
+                static_cast<uint32_t>(height), static_cast<uint32_t>(depth)});
+    }
+}
+
+void glCaptureRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+    const uint64_t start = begin();
+    glRenderbufferStorage(target, internalformat, width, height);
+    if (start) {
+        record(GL_CAPTURE_OP_RENDERBUFFER_STORAGE, start,
+               {target, internalformat, static_cast<uint32_t>(width), static_cast<uint32_t>(height)});
+    }
+}
+
+// `pointer` is an offset into the bound GL_ARRAY_BUFFER; client-side arrays aren't captured.
+void glCaptureVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride,
+                                  const void* pointer) {
+    const uint64_t start = begin();
+    glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+    if (start) {
+        record(GL_CAPTURE_OP_VERTEX_ATTRIB_POINTER, start,
+               {index, static_cast<uint32_t>(size), type, normalized, static_cast<uint32_t>(stride),
+                static_cast<uint32_t>(reinterpret_cast<uintptr_t>(pointer))});
+    }
+}
+
+void glCaptureEnableVertexAttribArray(GLuint index) {
+    const uint64_t start = begin();
+    glEnableVertexAttribArray(index);
+    if (start) record(GL_CAPTURE_OP_ENABLE_VERTEX_ATTRIB_ARRAY, start, {index});
+}
+
+void glCaptureBindBuffer(GLenum target, GLuint buffer) {
+    const uint64_t start = begin();
+    glBindBuffer(target, buffer);
+    if (start) record(GL_CAPTURE_OP_BIND_BUFFER, start, {target, buffer});
+}
+
+void glCaptureBindVertexArray(GLuint array) {
+    const uint64_t start = begin();
+    glBindVertexArray(array);
+    if (start) record(GL_CAPTURE_OP_BIND_VERTEX_ARRAY, start, {array});
+}
+
+void glCaptureBindTexture(GLenum target, GLuint texture) {
+    const uint64_t start = begin();
+    glBindTexture(target, texture);
+    if (start) record(GL_CAPTURE_OP_BIND_TEXTURE, start, {target, texture});
+}
+
+void glCaptureBindFramebuffer(GLenum target, GLuint framebuffer) {
+    const uint64_t start = begin();
+    glBindFramebuffer(target, framebuffer);
+    if (start) record(GL_CAPTURE_OP_BIND_FRAMEBUFFER, start, {target, framebuffer});
+}
+
+void glCaptureBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+    const uint64_t start = begin();
+    glBindRenderbuffer(target, renderbuffer);
+    if (start) record(GL_CAPTURE_OP_BIND_RENDERBUFFER, start, {target, renderbuffer});
+}
+
+void glCaptureFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    const uint64_t start = begin();
+    glFramebufferTextureLayer(target, attachment, texture, level, layer);
+    if (start) {
+        record(GL_CAPTURE_OP_FRAMEBUFFER_TEXTURE_LAYER, start,
+               {target, attachment, texture, static_cast<uint32_t>(level), static_cast<uint32_t>(layer)});
+    }
+}
+
+void glCaptureFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget,
+                                      GLuint renderbuffer) {
+    const uint64_t start = begin();
+    glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+    if (start) record(GL_CAPTURE_OP_FRAMEBUFFER_RENDERBUFFER, start, {target, attachment, renderbuffertarget, renderbuffer});
+}
+
+void glCaptureUseProgram(GLuint program) {
+    const uint64_t start = begin();
+    glUseProgram(program);
+    if (start) record(GL_CAPTURE_OP_USE_PROGRAM, start, {program});
+}
+
+void glCaptureViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    const uint64_t start = begin();
+    glViewport(x, y, width, height);
+    if (start) {
+        record(GL_CAPTURE_OP_VIEWPORT, start,
+               {static_cast<uint32_t>(x), static_cast<uint32_t>(y), static_cast<uint32_t>(width),
+                static_cast<uint32_t>(height)});
+    }
+}
+
+void glCaptureClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    const uint64_t start = begin();
+    glClearColor(red, green, blue, alpha);
+    if (start) record(GL_CAPTURE_OP_CLEAR_COLOR, start, {bits(red), bits(green), bits(blue), bits(alpha)});
+}
+
+void glCaptureClear(GLbitfield mask) {
+    const uint64_t start = begin();
+    glClear(mask);
+    if (start) record(GL_CAPTURE_OP_CLEAR, start, {mask});
+}
+
+void glCaptureEnable(GLenum cap) {
+    const uint64_t start = begin();
+    glEnable(cap);
+    if (start) record(GL_CAPTURE_OP_ENABLE, start, {cap});
+}
+
+void glCaptureDisable(GLenum cap) {
+    const uint64_t start = begin();
+    glDisable(cap);
+    if (start) record(GL_CAPTURE_OP_DISABLE, start, {cap});
+}
+
+void glCaptureDepthFunc(GLenum func) {
+    const uint64_t start = begin();
+    glDepthFunc(func);
+    if (start) record(GL_CAPTURE_OP_DEPTH_FUNC, start, {func});
+}
+
+void glCaptureDepthMask(GLboolean flag) {
+    const uint64_t start = begin();
+    glDepthMask(flag);
+    if (start) record(GL_CAPTURE_OP_DEPTH_MASK, start, {flag});
+}
+
+void glCaptureBlendFunc(GLenum sfactor, GLenum dfactor) {
+    const uint64_t start = begin();
+    glBlendFunc(sfactor, dfactor);
+    if (start) record(GL_CAPTURE_OP_BLEND_FUNC, start, {sfactor, dfactor});
+}
+
+void glCaptureUniform1f(GLint location, GLfloat v0) {
+    const uint64_t start = begin();
+    glUniform1f(location, v0);
+    if (start) record(GL_CAPTURE_OP_UNIFORM_1F, start, {static_cast<uint32_t>(location), bits(v0)});
+}
+
+void glCaptureUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    const uint64_t start = begin();
+    glUniform3f(location, v0, v1, v2);
+    if (start) record(GL_CAPTURE_OP_UNIFORM_3F, start, {static_cast<uint32_t>(location), bits(v0), bits(v1), bits(v2)});
+}
+
+void glCaptureUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value) {
+    const uint64_t start = begin();
+    glUniformMatrix4fv(location, count, transpose, value);
+    if (start) {
+        record(GL_CAPTURE_OP_UNIFORM_MATRIX_4FV, start, {static_cast<uint32_t>(location), static_cast<uint32_t>(count), transpose},
+               value, static_cast<size_t>(count) * 16 * sizeof(GLfloat));
+    }
+}
+
+// `indices` is an offset into the bound GL_ELEMENT_ARRAY_BUFFER.
+void glCaptureDrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices) {
+    const uint64_t start = begin();
+    glDrawElements(mode, count, type, indices);
+    if (start) {
+        record(GL_CAPTURE_OP_DRAW_ELEMENTS, start,
+               {mode, static_cast<uint32_t>(count), type, static_cast<uint32_t>(reinterpret_cast<uintptr_t>(indices))});
+    }
+}
+
+void glCaptureFlush() {
+    const uint64_t start = begin();
+    glFlush();
+    if (start) record(GL_CAPTURE_OP_FLUSH, start, {});
+}
+
+void glCaptureFinish() {
+    const uint64_t start = begin();
+    glFinish();
+    if (start) record(GL_CAPTURE_OP_FINISH, start, {});
+}
+
+// --- OpenXR ---
+
+XrResult xrCaptureCreateSwapchain(XrSession session, const XrSwapchainCreateInfo* createInfo, XrSwapchain* swapchain) {
+    const XrResult result = xrCreateSwapchain(session, createInfo, swapchain);
+    // Remembered whether or not capturing yet: the images are only enumerated later.
+    if (XR_SUCCEEDED(result) && g_capture.swapchainCount < GL_CAPTURE_MAX_SWAPCHAINS) {
+        g_capture.swapchains[g_capture.swapchainCount++] = {*swapchain, *createInfo};
+    }
+    return result;
+}
+
+// The runtime's images turn into textures of the same shape in the stream.
+XrResult xrCaptureEnumerateSwapchainImages(XrSwapchain swapchain, uint32_t imageCapacityInput,
+                                           uint32_t* imageCountOutput, XrSwapchainImageBaseHeader* images) {
+    const uint64_t start = begin();
+    const XrResult result = xrEnumerateSwapchainImages(swapchain, imageCapacityInput, imageCountOutput, images);
+    if (!start || XR_FAILED(result) || imageCapacityInput == 0 || images->type != XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_ES_KHR) {
+        return result;
+    }
+    for (uint32_t i = 0; i < g_capture.swapchainCount; ++i) {
+        if (g_capture.swapchains[i].handle != swapchain) {
+            continue;
+        }
+        const XrSwapchainCreateInfo& info = g_capture.swapchains[i].info;
+        const auto* glImages = reinterpret_cast<const XrSwapchainImageOpenGLESKHR*>(images);
+        for (uint32_t image = 0; image < *imageCountOutput; ++image) {
+            record(GL_CAPTURE_OP_XR_SWAPCHAIN_IMAGE, start,
+                   {info.arraySize > 1 ? GLenum(GL_TEXTURE_2D_ARRAY) : GLenum(GL_TEXTURE_2D), glImages[image].image,
+                    static_cast<uint32_t>(info.format), info.width, info.height, info.arraySize});
+        }
+    }
+    return result;
+}
+
+XrResult xrCaptureWaitFrame(XrSession session, const XrFrameWaitInfo* frameWaitInfo, XrFrameState* frameState) {
+    const uint64_t start = begin();
+    const XrResult result = xrWaitFrame(session, frameWaitInfo, frameState);
+    if (start) record(GL_CAPTURE_OP_XR_WAIT_FRAME, start, {static_cast<uint32_t>(frameState->shouldRender)});
+    return result;
+}
+
+XrResult xrCaptureBeginFrame(XrSession session, const XrFrameBeginInfo* frameBeginInfo) {
+    const uint64_t start = begin();
+    const XrResult result = xrBeginFrame(session, frameBeginInfo);
+    if (start) record(GL_CAPTURE_OP_XR_BEGIN_FRAME, start, {});
+    return result;
+}
+
+XrResult xrCaptureAcquireSwapchainImage(XrSwapchain swapchain, const XrSwapchainImageAcquireInfo* acquireInfo,
+                                        uint32_t* index) {
+    const uint64_t start = begin();
+    const XrResult result = xrAcquireSwapchainImage(swapchain, acquireInfo, index);
+    if (start) record(GL_CAPTURE_OP_XR_ACQUIRE_SWAPCHAIN_IMAGE, start, {*index});
+    return result;
+}
+
+XrResult xrCaptureWaitSwapchainImage(XrSwapchain swapchain, const XrSwapchainImageWaitInfo* waitInfo) {
+    const uint64_t start = begin();
+    const XrResult result = xrWaitSwapchainImage(swapchain, waitInfo);
+    if (start) record(GL_CAPTURE_OP_XR_WAIT_SWAPCHAIN_IMAGE, start, {});
+    return result;
+}
+
+XrResult xrCaptureLocateViews(XrSession session, const XrViewLocateInfo* viewLocateInfo, XrViewState* viewState,
+                              uint32_t viewCapacityInput, uint32_t* viewCountOutput, XrView* views) {
+    const uint64_t start = begin();
+    const XrResult result =
+            xrLocateViews(session, viewLocateInfo, viewState, viewCapacityInput, viewCountOutput, views);
+    if (start) record(GL_CAPTURE_OP_XR_LOCATE_VIEWS, start, {*viewCountOutput});
+    return result;
+}
+
+XrResult xrCaptureReleaseSwapchainImage(XrSwapchain swapchain, const XrSwapchainImageReleaseInfo* releaseInfo) {
+    const uint64_t start = begin();
+    const XrResult result = xrReleaseSwapchainImage(swapchain, releaseInfo);
+    if (start) record(GL_CAPTURE_OP_XR_RELEASE_SWAPCHAIN_IMAGE, start, {});
+    return result;
+}
+
+XrResult xrCaptureEndFrame(XrSession session, const XrFrameEndInfo* frameEndInfo) {
+    const uint64_t start = begin();
+    const XrResult result = xrEndFrame(session, frameEndInfo);
+    if (start) record(GL_CAPTURE_OP_XR_END_FRAME, start, {frameEndInfo->layerCount});
+    return result;
+}
@@ -0,0 +1,270 @@
+//
+// GL and OpenXR call capture for offline replay (host/gl_replay).
+//
+// With GL_CAPTURE defined (CMake option / ndk-build variable of the same name), the files that
+// include this header last have their GL and OpenXR frame calls redirected to recording
+// wrappers: demo_scene.cpp and render_backend.cpp, i.e. everything main.cpp's renderFrame
+// issues. Without the define nothing is redirected and glCaptureStart fails.
+//
+// Capturing starts with glCaptureStart, before the GL objects are created. From then on every
+// call made outside a frame (glCaptureFrameBegin / glCaptureFrameEnd) is recorded, so the
+// stream holds the setup the frames depend on; of the frames, `skipFrames` are left out and the
+// next `frameCount` recorded. Skipped frames must leave the GL state as they found it, which
+// the demo scene does. The stream is kept in memory and written when the window closes (or at
+// glCaptureStop), so no file I/O lands in a recorded frame.
+//
+// Format, little-endian: GlCaptureHeader, then records of GlCaptureRecord, `words` 32-bit
+// arguments (floats by bit pattern, GL names as the capturing context saw them) and a
+// `blobBytes` blob (buffer contents, shader source, uniform names) padded to 4 bytes. Each
+// record carries the call's duration on the capturing device. OpenXR calls are recorded with
+// what replay needs to stand in for them: swapchain images become plain textures, and the
+// frame calls keep only their device timing.
+//
+
+#ifndef ANDROIDSAMSUNG_GLCAPTURE_H
+#define ANDROIDSAMSUNG_GLCAPTURE_H
+
+#include <GLES3/gl3.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <openxr/openxr.h>
+
+#define GL_CAPTURE_MAGIC 0x50434c47u // "GLCP"
+#define GL_CAPTURE_VERSION 1
+
+enum GlCaptureOp : uint16_t {
+    GL_CAPTURE_OP_FRAME_BEGIN = 1,
+    GL_CAPTURE_OP_FRAME_END,
+    // Objects: words are the captured names, so replay can map them to its own.
+    GL_CAPTURE_OP_GEN_BUFFERS,
+    GL_CAPTURE_OP_GEN_VERTEX_ARRAYS,
+    GL_CAPTURE_OP_GEN_TEXTURES,
+    GL_CAPTURE_OP_GEN_FRAMEBUFFERS,
+    GL_CAPTURE_OP_GEN_RENDERBUFFERS,
+    GL_CAPTURE_OP_DELETE_BUFFERS,
+    GL_CAPTURE_OP_DELETE_VERTEX_ARRAYS,
+    GL_CAPTURE_OP_DELETE_TEXTURES,
+    GL_CAPTURE_OP_DELETE_FRAMEBUFFERS,
+    GL_CAPTURE_OP_DELETE_RENDERBUFFERS,
+    GL_CAPTURE_OP_CREATE_SHADER,
+    GL_CAPTURE_OP_SHADER_SOURCE,
+    GL_CAPTURE_OP_COMPILE_SHADER,
+    GL_CAPTURE_OP_DELETE_SHADER,
+    GL_CAPTURE_OP_CREATE_PROGRAM,
+    GL_CAPTURE_OP_ATTACH_SHADER,
+    GL_CAPTURE_OP_LINK_PROGRAM,
+    GL_CAPTURE_OP_DELETE_PROGRAM,
+    GL_CAPTURE_OP_GET_UNIFORM_LOCATION,
+    // Data
+    GL_CAPTURE_OP_BUFFER_DATA,
+    GL_CAPTURE_OP_BUFFER_SUB_DATA,
+    GL_CAPTURE_OP_TEX_STORAGE_3D,
+    GL_CAPTURE_OP_RENDERBUFFER_STORAGE,
+    GL_CAPTURE_OP_VERTEX_ATTRIB_POINTER,
+    GL_CAPTURE_OP_ENABLE_VERTEX_ATTRIB_ARRAY,
+    // Bindings
+    GL_CAPTURE_OP_BIND_BUFFER,
+    GL_CAPTURE_OP_BIND_VERTEX_ARRAY,
+    GL_CAPTURE_OP_BIND_TEXTURE,
+    GL_CAPTURE_OP_BIND_FRAMEBUFFER,
+    GL_CAPTURE_OP_BIND_RENDERBUFFER,
+    GL_CAPTURE_OP_FRAMEBUFFER_TEXTURE_LAYER,
+    GL_CAPTURE_OP_FRAMEBUFFER_RENDERBUFFER,
+    GL_CAPTURE_OP_USE_PROGRAM,
+    // State and draws
+    GL_CAPTURE_OP_VIEWPORT,
+    GL_CAPTURE_OP_CLEAR_COLOR,
+    GL_CAPTURE_OP_CLEAR,
+    GL_CAPTURE_OP_ENABLE,
+    GL_CAPTURE_OP_DISABLE,
+    GL_CAPTURE_OP_DEPTH_FUNC,
+    GL_CAPTURE_OP_DEPTH_MASK,
+    GL_CAPTURE_OP_BLEND_FUNC,
+    GL_CAPTURE_OP_UNIFORM_1F,
+    GL_CAPTURE_OP_UNIFORM_3F,
+    GL_CAPTURE_OP_UNIFORM_MATRIX_4FV,
+    GL_CAPTURE_OP_DRAW_ELEMENTS,
+    GL_CAPTURE_OP_FLUSH,
+    GL_CAPTURE_OP_FINISH,
+    // OpenXR
+    GL_CAPTURE_OP_XR_SWAPCHAIN_IMAGE, // target, name, format, width, height, layers
+    GL_CAPTURE_OP_XR_WAIT_FRAME,
+    GL_CAPTURE_OP_XR_BEGIN_FRAME,
+    GL_CAPTURE_OP_XR_ACQUIRE_SWAPCHAIN_IMAGE,
+    GL_CAPTURE_OP_XR_WAIT_SWAPCHAIN_IMAGE,
+    GL_CAPTURE_OP_XR_LOCATE_VIEWS,
+    GL_CAPTURE_OP_XR_RELEASE_SWAPCHAIN_IMAGE,
+    GL_CAPTURE_OP_XR_END_FRAME, // layer count
+    GL_CAPTURE_OP_COUNT,
+};
+
+struct GlCaptureHeader {
+    uint32_t magic = GL_CAPTURE_MAGIC;
+    uint32_t version = GL_CAPTURE_VERSION;
+    uint32_t frameCount = 0;
+    uint32_t recordCount = 0;
+};
+
+struct GlCaptureRecord {
+    uint16_t op;
+    uint16_t words;
+    uint32_t blobBytes;
+    uint32_t durationNs; // on the capturing device
+};
+
+const char* glCaptureOpName(uint16_t op);
+
+// --- Recording ---
+
+// Records to `path` from now on; see above. False without GL_CAPTURE or while capturing.
+bool glCaptureStart(const char* path, uint32_t skipFrames, uint32_t frameCount);
+// Writes what has been recorded and stops. Safe to call when not capturing.
+void glCaptureStop();
+bool glCaptureActive();
+void glCaptureFrameBegin();
+void glCaptureFrameEnd();
+
+// --- Reading ---
+
+struct GlCaptureCall {
+    GlCaptureRecord record;
+    const uint32_t* args;
+    const uint8_t* blob;
+};
+
+struct GlCaptureStream {
+    GlCaptureHeader header;
+    std::vector<uint8_t> bytes;
+    std::vector<GlCaptureCall> calls; // point into bytes
+};
+
+bool glCaptureLoad(const char* path, GlCaptureStream* stream);
+
+// --- Wrappers ---
+
+void glCaptureGenBuffers(GLsizei n, GLuint* buffers);
+void glCaptureGenVertexArrays(GLsizei n, GLuint* arrays);
+void glCaptureGenTextures(GLsizei n, GLuint* textures);
+void glCaptureGenFramebuffers(GLsizei n, GLuint* framebuffers);
+void glCaptureGenRenderbuffers(GLsizei n, GLuint* renderbuffers);
+void glCaptureDeleteBuffers(GLsizei n, const GLuint* buffers);
+void glCaptureDeleteVertexArrays(GLsizei n, const GLuint* arrays);
+void glCaptureDeleteTextures(GLsizei n, const GLuint* textures);
+void glCaptureDeleteFramebuffers(GLsizei n, const GLuint* framebuffers);
+void glCaptureDeleteRenderbuffers(GLsizei n, const GLuint* renderbuffers);
+GLuint glCaptureCreateShader(GLenum type);
+void glCaptureShaderSource(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length);
+void glCaptureCompileShader(GLuint shader);
+void glCaptureDeleteShader(GLuint shader);
+GLuint glCaptureCreateProgram();
+void glCaptureAttachShader(GLuint program, GLuint shader);
+void glCaptureLinkProgram(GLuint program);
+void glCaptureDeleteProgram(GLuint program);
+GLint glCaptureGetUniformLocation(GLuint program, const GLchar* name);
+void glCaptureBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage);
+void glCaptureBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data);
+void glCaptureTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height,
+                           GLsizei depth);
+void glCaptureRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height);
+void glCaptureVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride,
+                                  const void* pointer);
+void glCaptureEnableVertexAttribArray(GLuint index);
+void glCaptureBindBuffer(GLenum target, GLuint buffer);
+void glCaptureBindVertexArray(GLuint array);
+void glCaptureBindTexture(GLenum target, GLuint texture);
+void glCaptureBindFramebuffer(GLenum target, GLuint framebuffer);
+void glCaptureBindRenderbuffer(GLenum target, GLuint renderbuffer);
+void glCaptureFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer);
+void glCaptureFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget,
+                                      GLuint renderbuffer);
+void glCaptureUseProgram(GLuint program);
+void glCaptureViewport(GLint x, GLint y, GLsizei width, GLsizei height);
+void glCaptureClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+void glCaptureClear(GLbitfield mask);
+void glCaptureEnable(GLenum cap);
+void glCaptureDisable(GLenum cap);
+void glCaptureDepthFunc(GLenum func);
+void glCaptureDepthMask(GLboolean flag);
+void glCaptureBlendFunc(GLenum sfactor, GLenum dfactor);
+void glCaptureUniform1f(GLint location, GLfloat v0);
+void glCaptureUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2);
+void glCaptureUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value);
+void glCaptureDrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices);
+void glCaptureFlush();
+void glCaptureFinish();
+
+XrResult xrCaptureCreateSwapchain(XrSession session, const XrSwapchainCreateInfo* createInfo, XrSwapchain* swapchain);
+XrResult xrCaptureEnumerateSwapchainImages(XrSwapchain swapchain, uint32_t imageCapacityInput,
+                                           uint32_t* imageCountOutput, XrSwapchainImageBaseHeader* images);
+XrResult xrCaptureWaitFrame(XrSession session, const XrFrameWaitInfo* frameWaitInfo, XrFrameState* frameState);
+XrResult xrCaptureBeginFrame(XrSession session, const XrFrameBeginInfo* frameBeginInfo);
+XrResult xrCaptureAcquireSwapchainImage(XrSwapchain swapchain, const XrSwapchainImageAcquireInfo* acquireInfo,
+                                        uint32_t* index);
+XrResult xrCaptureWaitSwapchainImage(XrSwapchain swapchain, const XrSwapchainImageWaitInfo* waitInfo);
+XrResult xrCaptureLocateViews(XrSession session, const XrViewLocateInfo* viewLocateInfo, XrViewState* viewState,
+                              uint32_t viewCapacityInput, uint32_t* viewCountOutput, XrView* views);
+XrResult xrCaptureReleaseSwapchainImage(XrSwapchain swapchain, const XrSwapchainImageReleaseInfo* releaseInfo);
+XrResult xrCaptureEndFrame(XrSession session, const XrFrameEndInfo* frameEndInfo);
+
+#if defined(GL_CAPTURE) && !defined(GL_CAPTURE_IMPLEMENTATION)
+#define glGenBuffers glCaptureGenBuffers
+#define glGenVertexArrays glCaptureGenVertexArrays
+#define glGenTextures glCaptureGenTextures
+#define glGenFramebuffers glCaptureGenFramebuffers
+#define glGenRenderbuffers glCaptureGenRenderbuffers
+#define glDeleteBuffers glCaptureDeleteBuffers
+#define glDeleteVertexArrays glCaptureDeleteVertexArrays
+#define glDeleteTextures glCaptureDeleteTextures
+#define glDeleteFramebuffers glCaptureDeleteFramebuffers
+#define glDeleteRenderbuffers glCaptureDeleteRenderbuffers
+#define glCreateShader glCaptureCreateShader
+#define glShaderSource glCaptureShaderSource
+#define glCompileShader glCaptureCompileShader
+#define glDeleteShader glCaptureDeleteShader
+#define glCreateProgram glCaptureCreateProgram
+#define glAttachShader glCaptureAttachShader
+#define glLinkProgram glCaptureLinkProgram
+#define glDeleteProgram glCaptureDeleteProgram
+#define glGetUniformLocation glCaptureGetUniformLocation
+#define glBufferData glCaptureBufferData
+#define glBufferSubData glCaptureBufferSubData
+#define glTexStorage3D glCaptureTexStorage3D
+#define glRenderbufferStorage glCaptureRenderbufferStorage
+#define glVertexAttribPointer glCaptureVertexAttribPointer
+#define glEnableVertexAttribArray glCaptureEnableVertexAttribArray
+#define glBindBuffer glCaptureBindBuffer
+#define glBindVertexArray glCaptureBindVertexArray
+#define glBindTexture glCaptureBindTexture
+#define glBindFramebuffer glCaptureBindFramebuffer
+#define glBindRenderbuffer glCaptureBindRenderbuffer
+#define glFramebufferTextureLayer glCaptureFramebufferTextureLayer
+#define glFramebufferRenderbuffer glCaptureFramebufferRenderbuffer
+#define glUseProgram glCaptureUseProgram
+#define glViewport glCaptureViewport
+#define glClearColor glCaptureClearColor
+#define glClear glCaptureClear
+#define glEnable glCaptureEnable
+#define glDisable glCaptureDisable
+#define glDepthFunc glCaptureDepthFunc
+#define glDepthMask glCaptureDepthMask
+#define glBlendFunc glCaptureBlendFunc
+#define glUniform1f glCaptureUniform1f
+#define glUniform3f glCaptureUniform3f
+#define glUniformMatrix4fv glCaptureUniformMatrix4fv
+#define glDrawElements glCaptureDrawElements
+#define glFlush glCaptureFlush
+#define glFinish glCaptureFinish
+#define xrCreateSwapchain xrCaptureCreateSwapchain
+#define xrEnumerateSwapchainImages xrCaptureEnumerateSwapchainImages
+#define xrWaitFrame xrCaptureWaitFrame
+#define xrBeginFrame xrCaptureBeginFrame
+#define xrAcquireSwapchainImage xrCaptureAcquireSwapchainImage
+#define xrWaitSwapchainImage xrCaptureWaitSwapchainImage
+#define xrLocateViews xrCaptureLocateViews
+#define xrReleaseSwapchainImage xrCaptureReleaseSwapchainImage
+#define xrEndFrame xrCaptureEndFrame
+#endif
+
+#endif //ANDROIDSAMSUNG_GLCAPTURE_H
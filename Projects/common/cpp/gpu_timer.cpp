@@ -0,0 +1,238 @@
+#include "gpu_timer.h"
+
+#include <EGL/egl.h>
+#include <android/log.h>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+#define TAG "GpuTimer"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, TAG, __VA_ARGS__)
+
+// EXT_disjoint_timer_query; the query objects themselves are core GLES3.
+#define GL_TIME_ELAPSED_EXT 0x88BF
+#define GL_GPU_DISJOINT_EXT 0x8FBB
+
+static const char* const kPassNames[GPU_TIMER_PASS_COUNT] = {"clear", "opaque", "overlay"};
+
+const char* gpuTimerPassName(GpuTimerPass pass) {
+    return pass < GPU_TIMER_PASS_COUNT ? kPassNames[pass] : "?";
+}
+
+static bool hasExtension(const char* name) {
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (GLint i = 0; i < count; ++i) {
+        const char* extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+        if (extension && strcmp(extension, name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool gpuTimerInit(GpuTimer* timer) {
+    *timer = GpuTimer();
+    if (!hasExtension("GL_EXT_disjoint_timer_query")) {
+        LOGI("No GL_EXT_disjoint_timer_query; GPU timing off");
+        return false;
+    }
+    timer->getQueryObjectui64v =
+            reinterpret_cast<GpuTimerGetQueryObjectui64v>(eglGetProcAddress("glGetQueryObjectui64vEXT"));
+    if (!timer->getQueryObjectui64v) {
+        LOGI("No glGetQueryObjectui64vEXT; GPU timing off");
+        return false;
+    }
+    for (GpuTimerSlot& slot : timer->slots) {
+        glGenQueries(GPU_TIMER_MAX_VIEWS * GPU_TIMER_PASS_COUNT, &slot.queries[0][0]);
+    }
+    // Reading the flag clears it; whatever happened before now doesn't concern these queries.
+    GLint disjoint = 0;
+    glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+    timer->supported = true;
+    return true;
+}
+
+void gpuTimerDestroy(GpuTimer* timer) {
+    if (timer->supported) {
+        if (timer->passActive) {
+            glEndQuery(GL_TIME_ELAPSED_EXT);
+        }
+        for (GpuTimerSlot& slot : timer->slots) {
+            glDeleteQueries(GPU_TIMER_MAX_VIEWS * GPU_TIMER_PASS_COUNT, &slot.queries[0][0]);
+        }
+    }
+    *timer = GpuTimer();
+}
+
+// --- Read back ---
+
+static bool slotReady(const GpuTimerSlot& slot) {
+    GLuint available = GL_FALSE;
+    glGetQueryObjectuiv(slot.lastQuery, GL_QUERY_RESULT_AVAILABLE, &available);
+    return available == GL_TRUE;
+}
+
+static void collect(GpuTimer* timer, GpuTimerSlot* slot) {
+    slot->pending = false;
+    uint64_t results[GPU_TIMER_MAX_VIEWS][GPU_TIMER_PASS_COUNT] = {};
+    for (uint32_t view = 0; view < GPU_TIMER_MAX_VIEWS; ++view) {
+        for (uint32_t pass = 0; pass < GPU_TIMER_PASS_COUNT; ++pass) {
+            if (!(slot->used[view] & (1u << pass))) {
+                continue;
+            }
+            timer->getQueryObjectui64v(slot->queries[view][pass], GL_QUERY_RESULT, &results[view][pass]);
+        }
+    }
+    // Unflagged garbage (llvmpipe's first query on a context) or a hang: out of the stats, but
+    // not out of sight.
+    uint64_t longestNs = 0;
+    for (const auto& view : results) {
+        for (uint64_t ns : view) {
+            longestNs = ns > longestNs ? ns : longestNs;
+        }
+    }
+    if (longestNs > GPU_TIMER_MAX_PASS_NS) {
+        ++timer->framesInvalid;
+        if (longestNs > timer->maxInvalidNs) {
+            timer->maxInvalidNs = longestNs;
+        }
+        return;
+    }
+    for (uint32_t view = 0; view < GPU_TIMER_MAX_VIEWS; ++view) {
+        for (uint32_t pass = 0; pass < GPU_TIMER_PASS_COUNT; ++pass) {
+            if (!(slot->used[view] & (1u << pass))) {
+                continue;
+            }
+            const uint64_t ns = results[view][pass];
+            GpuTimerStat& stat = timer->stats[view][pass];
+            ++stat.samples;
+            stat.totalNs += ns;
+            if (ns > stat.maxNs) {
+                stat.maxNs = ns;
+            }
+        }
+    }
+    ++timer->framesMeasured;
+}
+
+// --- Frame ---
+
+void gpuTimerBeginFrame(GpuTimer* timer) {
+    if (!timer->supported || timer->inFrame) {
+        return;
+    }
+    GLint disjoint = 0;
+    glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+    for (; timer->oldestPending < timer->frame; ++timer->oldestPending) {
+        GpuTimerSlot& slot = timer->slots[timer->oldestPending % GPU_TIMER_FRAMES];
+        if (!slot.pending) {
+            continue;
+        }
+        if (disjoint) {
+            slot.pending = false;
+            ++timer->framesDisjoint;
+            continue;
+        }
+        if (!slotReady(slot)) {
+            break;
+        }
+        collect(timer, &slot);
+    }
+
+    // Never wait: results the GPU hasn't delivered by now are given up on.
+    GpuTimerSlot& slot = timer->slots[timer->frame % GPU_TIMER_FRAMES];
+    if (slot.pending) {
+        slot.pending = false;
+        ++timer->framesDropped;
+        timer->oldestPending = timer->frame - GPU_TIMER_FRAMES + 1;
+    }
+    memset(slot.used, 0, sizeof(slot.used));
+    slot.lastQuery = 0;
+    timer->view = 0;
+    timer->inFrame = true;
+}
+
+void gpuTimerSetView(GpuTimer* timer, uint32_t view) {
+    timer->view = view;
+}
+
+void gpuTimerBeginPass(GpuTimer* timer, GpuTimerPass pass) {
+    if (!timer->inFrame || timer->passActive || timer->view >= GPU_TIMER_MAX_VIEWS || pass >= GPU_TIMER_PASS_COUNT) {
+        return;
+    }
+    GpuTimerSlot& slot = timer->slots[timer->frame % GPU_TIMER_FRAMES];
+    const uint32_t bit = 1u << pass;
+    if (slot.used[timer->view] & bit) {
+        return;
+    }
+    const GLuint query = slot.queries[timer->view][pass];
+    glBeginQuery(GL_TIME_ELAPSED_EXT, query);
+    slot.used[timer->view] |= bit;
+    slot.lastQuery = query;
+    timer->passActive = true;
+}
+
+void gpuTimerEndPass(GpuTimer* timer) {
+    if (!timer->passActive) {
+        return;
+    }
+    glEndQuery(GL_TIME_ELAPSED_EXT);
+    timer->passActive = false;
+}
+
+void gpuTimerEndFrame(GpuTimer* timer) {
+    if (!timer->inFrame) {
+        return;
+    }
+    gpuTimerEndPass(timer);
+    GpuTimerSlot& slot = timer->slots[timer->frame % GPU_TIMER_FRAMES];
+    slot.pending = slot.lastQuery != 0;
+    ++timer->frame;
+    timer->inFrame = false;
+}
+
+// --- Report ---
+
+void gpuTimerReset(GpuTimer* timer) {
+    for (auto& view : timer->stats) {
+        for (GpuTimerStat& stat : view) {
+            stat = GpuTimerStat();
+        }
+    }
+    timer->framesMeasured = 0;
+    timer->framesDisjoint = 0;
+    timer->framesDropped = 0;
+    timer->framesInvalid = 0;
+    timer->maxInvalidNs = 0;
+}
+
+void gpuTimerLogAndReset(GpuTimer* timer, const char* tag) {
+    if (!timer->supported) {
+        return;
+    }
+    for (uint32_t view = 0; view < GPU_TIMER_MAX_VIEWS; ++view) {
+        char line[256];
+        int length = 0;
+        for (uint32_t pass = 0; pass < GPU_TIMER_PASS_COUNT; ++pass) {
+            const GpuTimerStat& stat = timer->stats[view][pass];
+            if (stat.samples == 0 || length >= static_cast<int>(sizeof(line))) {
+                continue;
+            }
+            length += snprintf(line + length, sizeof(line) - length, " %s %.3f/%.3f", kPassNames[pass],
+                               stat.totalNs / 1e6 / stat.samples, stat.maxNs / 1e6);
+        }
+        if (length > 0) {
+            __android_log_print(ANDROID_LOG_INFO, tag, "GPU view %u ms (mean/max):%s", view, line);
+        }
+    }
+    __android_log_print(ANDROID_LOG_INFO, tag,
+                        "GPU frames: %" PRIu64 " measured, %" PRIu64 " disjoint, %" PRIu64 " dropped",
+                        timer->framesMeasured, timer->framesDisjoint, timer->framesDropped);
+    if (timer->framesInvalid > 0) {
+        __android_log_print(ANDROID_LOG_WARN, tag,
+                            "GPU frames: %" PRIu64 " with a pass over %.0f ms, the longest %.1f ms",
+                            timer->framesInvalid, GPU_TIMER_MAX_PASS_NS / 1e6, timer->maxInvalidNs / 1e6);
+    }
+    gpuTimerReset(timer);
+}
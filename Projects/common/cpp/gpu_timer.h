@@ -0,0 +1,92 @@
+//
+// GPU time per view and per pass from EXT_disjoint_timer_query.
+//
+// Each pass (clear, opaque, overlay) of each view is bracketed by a GL_TIME_ELAPSED_EXT query.
+// The queries of a frame go into one slot of a GPU_TIMER_FRAMES ring and are read back when
+// the ring comes round, a few frames later, once GL_QUERY_RESULT_AVAILABLE says so: nothing
+// waits on the GPU. A slot whose results still aren't in when it is needed again is dropped
+// rather than waited for. GL_GPU_DISJOINT_EXT (a frequency change, a context switch) makes every
+// result in flight meaningless, so those frames are discarded and counted instead. A pass longer
+// than GPU_TIMER_MAX_PASS_NS is either an unflagged bad result (llvmpipe's first query on a
+// context) or a GPU hang; its frame is kept out of the stats too, but counted on its own and
+// logged with the longest such pass, so a hang still shows.
+//
+// Without the extension every call is a no-op and `supported` is false. Render thread only.
+//
+
+#ifndef ANDROIDSAMSUNG_GPU_TIMER_H
+#define ANDROIDSAMSUNG_GPU_TIMER_H
+
+#include <GLES3/gl3.h>
+#include <cstdint>
+
+// Frames in flight: results arrive GPU_TIMER_FRAMES - 1 frames late at most.
+#define GPU_TIMER_FRAMES 4
+#define GPU_TIMER_MAX_VIEWS 2
+// A pass reported longer than this is not a frame time; see framesInvalid.
+#define GPU_TIMER_MAX_PASS_NS 1000000000ull
+
+enum GpuTimerPass : uint32_t {
+    GPU_TIMER_PASS_CLEAR,
+    GPU_TIMER_PASS_OPAQUE,
+    GPU_TIMER_PASS_OVERLAY,
+    GPU_TIMER_PASS_COUNT,
+};
+
+typedef void (*GpuTimerGetQueryObjectui64v)(GLuint id, GLenum pname, uint64_t* params);
+
+struct GpuTimerStat {
+    uint64_t samples = 0;
+    uint64_t totalNs = 0;
+    uint64_t maxNs = 0;
+};
+
+struct GpuTimerSlot {
+    GLuint queries[GPU_TIMER_MAX_VIEWS][GPU_TIMER_PASS_COUNT] = {};
+    uint32_t used[GPU_TIMER_MAX_VIEWS] = {}; // bit per pass issued this frame
+    GLuint lastQuery = 0;                    // results arrive in order: when it's in, all are
+    bool pending = false;                    // issued, not read back yet
+};
+
+struct GpuTimer {
+    bool supported = false;
+    GpuTimerGetQueryObjectui64v getQueryObjectui64v = nullptr;
+
+    GpuTimerSlot slots[GPU_TIMER_FRAMES];
+    uint64_t frame = 0;       // the slot being issued is frame % GPU_TIMER_FRAMES
+    uint64_t oldestPending = 0;
+    bool inFrame = false;
+    uint32_t view = 0;
+    bool passActive = false;
+
+    // Since the last gpuTimerReset.
+    GpuTimerStat stats[GPU_TIMER_MAX_VIEWS][GPU_TIMER_PASS_COUNT];
+    uint64_t framesMeasured = 0;
+    uint64_t framesDisjoint = 0; // discarded after GL_GPU_DISJOINT_EXT
+    uint64_t framesDropped = 0;  // results not in by the time their slot came round again
+    uint64_t framesInvalid = 0;  // a pass over GPU_TIMER_MAX_PASS_NS: bad result or GPU hang
+    uint64_t maxInvalidNs = 0;   // the longest of those passes
+};
+
+const char* gpuTimerPassName(GpuTimerPass pass);
+
+// Needs a current GLES3 context. Returns `supported`; without the extension the timer stays
+// usable as a no-op.
+bool gpuTimerInit(GpuTimer* timer);
+// On the same context; forgets any results in flight.
+void gpuTimerDestroy(GpuTimer* timer);
+
+// Reads back whatever earlier frames have finished, then starts this frame's slot.
+void gpuTimerBeginFrame(GpuTimer* timer);
+// Passes from here on belong to `view` (< GPU_TIMER_MAX_VIEWS; others aren't timed).
+void gpuTimerSetView(GpuTimer* timer, uint32_t view);
+// One pass at a time, each at most once per view and frame.
+void gpuTimerBeginPass(GpuTimer* timer, GpuTimerPass pass);
+void gpuTimerEndPass(GpuTimer* timer);
+void gpuTimerEndFrame(GpuTimer* timer);
+
+// Logs mean/max per view and pass and the frame counters under `tag`, then resets the stats.
+void gpuTimerLogAndReset(GpuTimer* timer, const char* tag);
+void gpuTimerReset(GpuTimer* timer);
+
+#endif //ANDROIDSAMSUNG_GPU_TIMER_H
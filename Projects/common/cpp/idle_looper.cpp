@@ -0,0 +1,84 @@
+#include "idle_looper.h"
+
+#include <android/log.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#define TAG "IdleLooper"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+bool idleLooperInit(IdleLooper* idle, ALooper* looper) {
+    idle->looper = looper;
+    idle->wakeups = 0;
+    idle->wakeSignals = 0;
+    idle->wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (idle->wakeFd < 0) {
+        LOGE("eventfd failed, the loop can only be woken by the looper");
+        return false;
+    }
+    if (ALooper_addFd(looper, idle->wakeFd, IDLE_LOOPER_ID_WAKE, ALOOPER_EVENT_INPUT, nullptr, nullptr) != 1) {
+        LOGE("ALooper_addFd failed for the wake fd");
+        close(idle->wakeFd);
+        idle->wakeFd = -1;
+        return false;
+    }
+    return true;
+}
+
+void idleLooperDestroy(IdleLooper* idle) {
+    if (idle->wakeFd >= 0) {
+        ALooper_removeFd(idle->looper, idle->wakeFd);
+        close(idle->wakeFd);
+        idle->wakeFd = -1;
+    }
+}
+
+int idleLooperTimeoutMs(XrSessionState state, bool rendering) {
+    if (rendering) {
+        // xrWaitFrame blocks until the next frame, don't add to it.
+        return 0;
+    }
+    switch (state) {
+        case XR_SESSION_STATE_SYNCHRONIZED:
+        case XR_SESSION_STATE_VISIBLE:
+        case XR_SESSION_STATE_FOCUSED:
+            return IDLE_LOOPER_PAUSED_MS;
+        case XR_SESSION_STATE_EXITING:
+        case XR_SESSION_STATE_LOSS_PENDING:
+            return IDLE_LOOPER_ENDING_MS;
+        default:
+            return IDLE_LOOPER_SESSION_IDLE_MS;
+    }
+}
+
+void idleLooperPump(IdleLooper* idle, struct android_app* app, int timeoutMs) {
+    ++idle->wakeups;
+    int ident;
+    int events;
+    struct android_poll_source* source;
+    // Only the first poll may block; after that drain whatever else is ready.
+    while ((ident = ALooper_pollOnce(timeoutMs, nullptr, &events, (void**)&source)) >= 0) {
+        timeoutMs = 0;
+        if (ident == IDLE_LOOPER_ID_WAKE) {
+            uint64_t count;
+            while (read(idle->wakeFd, &count, sizeof(count)) > 0) {
+                ++idle->wakeSignals;
+            }
+            continue;
+        }
+        if (source) {
+            source->process(app, source);
+        }
+    }
+}
+
+void idleLooperWake(IdleLooper* idle) {
+    if (idle->wakeFd < 0) {
+        ALooper_wake(idle->looper);
+        return;
+    }
+    const uint64_t one = 1;
+    ssize_t written = write(idle->wakeFd, &one, sizeof(one));
+    (void)written;
+}
@@ -0,0 +1,55 @@
+//
+// Event-driven main loop pacing.
+//
+// The apps used to call ALooper_pollOnce(0, ...) every iteration, which spins a core even
+// when there is nothing to render. While frames are being rendered xrWaitFrame already paces
+// the loop, so the looper is only polled. Otherwise the loop blocks on the looper until an app
+// command, input, a wake-fd signal or a timeout chosen from the session state. OpenXR events
+// have no fd, so the timeout is what bounds how late an XR state change is noticed.
+//
+
+#ifndef ANDROIDSAMSUNG_IDLELOOPER_H
+#define ANDROIDSAMSUNG_IDLELOOPER_H
+
+#include <cstdint>
+
+#include <openxr/openxr.h>
+
+#include "android_native_app_glue.h"
+
+// Looper ident of the wake fd (the glue reserves everything below LOOPER_ID_USER).
+#define IDLE_LOOPER_ID_WAKE LOOPER_ID_USER
+
+// Session not running yet (or any more): check for READY this often.
+#define IDLE_LOOPER_SESSION_IDLE_MS 100
+// Session running but the app isn't rendering (paused): resume arrives through the looper,
+// so XR events are the only reason to wake.
+#define IDLE_LOOPER_PAUSED_MS 250
+// Session is going away; only an app command is expected.
+#define IDLE_LOOPER_ENDING_MS 500
+
+struct IdleLooper {
+    ALooper* looper = nullptr;
+    int wakeFd = -1;
+
+    // Iterations of the main loop, and how many of them a wake-fd signal caused.
+    uint64_t wakeups = 0;
+    uint64_t wakeSignals = 0;
+};
+
+// Registers the wake fd on `looper` (the app's main looper).
+bool idleLooperInit(IdleLooper* idle, ALooper* looper);
+void idleLooperDestroy(IdleLooper* idle);
+
+// Looper timeout for the next iteration. `rendering` is whether renderFrame will submit a
+// frame this iteration (e.g. session running and app resumed).
+int idleLooperTimeoutMs(XrSessionState state, bool rendering);
+
+// Dispatches every pending looper source, waiting up to `timeoutMs` (-1 = forever) for the
+// first one.
+void idleLooperPump(IdleLooper* idle, struct android_app* app, int timeoutMs);
+
+// Wakes a blocked idleLooperPump from any thread.
+void idleLooperWake(IdleLooper* idle);
+
+#endif //ANDROIDSAMSUNG_IDLELOOPER_H
@@ -0,0 +1,342 @@
+#include "job_system.h"
+
+#include <android/log.h>
+#include <cstdio>
+#include <sched.h>
+
+#define TAG "JobSystem"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+static thread_local JobSystem* tlsSystem = nullptr;
+static thread_local uint32_t tlsWorker = 0;
+
+// --- Big core detection ---
+
+static uint32_t readMaxFrequencies(uint32_t* maxKhz, uint32_t capacity) {
+    uint32_t cpuCount = std::thread::hardware_concurrency();
+    if (cpuCount > capacity) {
+        cpuCount = capacity;
+    }
+    for (uint32_t cpu = 0; cpu < cpuCount; ++cpu) {
+        char path[96];
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cpufreq/cpuinfo_max_freq", cpu);
+        maxKhz[cpu] = 0;
+        if (FILE* file = fopen(path, "r")) {
+            if (fscanf(file, "%u", &maxKhz[cpu]) != 1) {
+                maxKhz[cpu] = 0;
+            }
+            fclose(file);
+        }
+    }
+    return cpuCount;
+}
+
+// Fills `cores` with the ids of the big cores and returns how many there are.
+static uint32_t findBigCores(uint32_t* cores, uint32_t capacity) {
+    uint32_t maxKhz[64];
+    const uint32_t cpuCount = readMaxFrequencies(maxKhz, 64);
+    uint32_t lowest = UINT32_MAX;
+    for (uint32_t cpu = 0; cpu < cpuCount; ++cpu) {
+        if (maxKhz[cpu] && maxKhz[cpu] < lowest) {
+            lowest = maxKhz[cpu];
+        }
+    }
+    uint32_t count = 0;
+    for (uint32_t cpu = 0; cpu < cpuCount && count < capacity; ++cpu) {
+        if (maxKhz[cpu] > lowest) {
+            cores[count++] = cpu;
+        }
+    }
+    if (count == 0) {
+        // Homogeneous (or unreadable): every core counts.
+        for (uint32_t cpu = 0; cpu < cpuCount && count < capacity; ++cpu) {
+            cores[count++] = cpu;
+        }
+    }
+    return count ? count : 1;
+}
+
+uint32_t jobSystemBigCoreCount() {
+    uint32_t cores[64];
+    return findBigCores(cores, 64);
+}
+
+// --- Queues ---
+
+static bool queuePush(JobQueue* queue, Job* job) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    if (queue->count == JOB_SYSTEM_QUEUE_SIZE) {
+        return false;
+    }
+    queue->jobs[(queue->front + queue->count) % JOB_SYSTEM_QUEUE_SIZE] = job;
+    queue->count++;
+    return true;
+}
+
+// Owner end.
+static Job* queuePop(JobQueue* queue) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    if (queue->count == 0) {
+        return nullptr;
+    }
+    queue->count--;
+    return queue->jobs[(queue->front + queue->count) % JOB_SYSTEM_QUEUE_SIZE];
+}
+
+// Thief end.
+static Job* queueSteal(JobQueue* queue) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    if (queue->count == 0) {
+        return nullptr;
+    }
+    Job* job = queue->jobs[queue->front];
+    queue->front = (queue->front + 1) % JOB_SYSTEM_QUEUE_SIZE;
+    queue->count--;
+    return job;
+}
+
+static uint32_t currentWorker(const JobSystem* system) {
+    // Threads outside the system share worker 0's queue.
+    return tlsSystem == system ? tlsWorker : 0;
+}
+
+static void executeJob(JobSystem* system, Job* job);
+
+static void pushJob(JobSystem* system, Job* job) {
+    if (!queuePush(&system->queues[currentWorker(system)], job)) {
+        executeJob(system, job);
+        return;
+    }
+    // Pairs with the sleeper's sleepingWorkers increment: either it sees the job or we see it.
+    system->queuedJobs.fetch_add(1);
+    if (system->sleepingWorkers.load() > 0) {
+        std::lock_guard<std::mutex> lock(system->wakeMutex);
+        system->wakeCond.notify_one();
+    }
+}
+
+static Job* findJob(JobSystem* system, uint32_t worker) {
+    Job* job = queuePop(&system->queues[worker]);
+    if (job == nullptr) {
+        for (uint32_t i = 1; i < system->workerCount && job == nullptr; ++i) {
+            job = queueSteal(&system->queues[(worker + i) % system->workerCount]);
+        }
+        if (job != nullptr) {
+            system->queues[worker].stolen.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    if (job != nullptr) {
+        system->queuedJobs.fetch_sub(1);
+    }
+    return job;
+}
+
+// --- Counters ---
+
+static void signalCounter(JobSystem* system, JobCounter* counter) {
+    // Sequentially consistent, pairing with jobSystemWait's counterWaiters increment.
+    if (counter == nullptr || counter->pending.fetch_sub(1) != 1) {
+        return;
+    }
+    if (system->counterWaiters.load() > 0) {
+        std::lock_guard<std::mutex> lock(system->wakeMutex);
+        system->wakeCond.notify_all();
+    }
+    Job* released;
+    {
+        std::lock_guard<std::mutex> lock(counter->mutex);
+        released = counter->waiting;
+        counter->waiting = nullptr;
+    }
+    while (released != nullptr) {
+        Job* next = released->nextWaiting;
+        released->nextWaiting = nullptr;
+        pushJob(system, released);
+        released = next;
+    }
+}
+
+static void executeJob(JobSystem* system, Job* job) {
+    JobCounter* done = job->done;
+    job->function(job->data, job->begin, job->end);
+    // The slot may be reused from here on.
+    job->inFlight.store(false, std::memory_order_release);
+    system->queues[currentWorker(system)].executed.fetch_add(1, std::memory_order_relaxed);
+    signalCounter(system, done);
+}
+
+// Queues `job` now, or parks it on `after` until that counter reaches zero.
+static void scheduleJob(JobSystem* system, Job* job, JobCounter* after) {
+    if (after != nullptr) {
+        std::lock_guard<std::mutex> lock(after->mutex);
+        if (after->pending.load(std::memory_order_acquire) > 0) {
+            job->nextWaiting = after->waiting;
+            after->waiting = job;
+            return;
+        }
+    }
+    pushJob(system, job);
+}
+
+// Returns null when the ring has come round to a job still in flight.
+static Job* allocateJob(JobSystem* system, JobFunction function, void* data, uint32_t begin, uint32_t end,
+                        JobCounter* done) {
+    Job* job = &system->jobs[system->nextJob.fetch_add(1, std::memory_order_relaxed) % JOB_SYSTEM_MAX_JOBS];
+    bool taken = false;
+    if (!job->inFlight.compare_exchange_strong(taken, true, std::memory_order_acquire)) {
+        if (system->ringFullJobs.fetch_add(1, std::memory_order_relaxed) % JOB_SYSTEM_MAX_JOBS == 0) {
+            LOGE("More than %d jobs in flight; running jobs inline", JOB_SYSTEM_MAX_JOBS);
+        }
+        return nullptr;
+    }
+    job->function = function;
+    job->data = data;
+    job->begin = begin;
+    job->end = end;
+    job->done = done;
+    job->nextWaiting = nullptr;
+    if (done != nullptr) {
+        done->pending.fetch_add(1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+// --- Workers ---
+
+static void workerMain(JobSystem* system, uint32_t worker, const uint32_t* cores, uint32_t coreCount) {
+    tlsSystem = system;
+    tlsWorker = worker;
+    if (coreCount > 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (uint32_t i = 0; i < coreCount; ++i) {
+            CPU_SET(cores[i], &set);
+        }
+        if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+            LOGE("Worker %u: sched_setaffinity failed", worker);
+        }
+    }
+
+    for (;;) {
+        if (Job* job = findJob(system, worker)) {
+            executeJob(system, job);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(system->wakeMutex);
+        if (system->stopRequested.load() && system->queuedJobs.load() == 0) {
+            return;
+        }
+        system->sleepingWorkers.fetch_add(1);
+        system->wakeCond.wait(lock, [system] {
+            return system->queuedJobs.load() > 0 || system->stopRequested.load();
+        });
+        system->sleepingWorkers.fetch_sub(1);
+    }
+}
+
+bool jobSystemInit(JobSystem* system, uint32_t workerCount, bool pinToBigCores) {
+    uint32_t cores[JOB_SYSTEM_MAX_WORKERS];
+    const uint32_t bigCores = findBigCores(cores, JOB_SYSTEM_MAX_WORKERS);
+    if (workerCount == 0) {
+        workerCount = bigCores;
+    }
+    if (workerCount > JOB_SYSTEM_MAX_WORKERS) {
+        workerCount = JOB_SYSTEM_MAX_WORKERS;
+    }
+
+    system->workerCount = workerCount;
+    system->stopRequested = false;
+    tlsSystem = system;
+    tlsWorker = 0;
+    for (uint32_t worker = 1; worker < workerCount; ++worker) {
+        system->threads[worker] = std::thread(workerMain, system, worker, pinToBigCores ? cores : nullptr,
+                                              pinToBigCores ? bigCores : 0);
+    }
+    LOGI("Job system started with %u workers (%u big cores%s)", workerCount, bigCores,
+         pinToBigCores ? ", pinned" : "");
+    return true;
+}
+
+void jobSystemShutdown(JobSystem* system) {
+    if (system->workerCount == 0) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(system->wakeMutex);
+        system->stopRequested = true;
+        system->wakeCond.notify_all();
+    }
+    for (uint32_t worker = 1; worker < system->workerCount; ++worker) {
+        system->threads[worker].join();
+    }
+    // Anything still queued on worker 0 runs here.
+    while (Job* job = findJob(system, 0)) {
+        executeJob(system, job);
+    }
+    if (tlsSystem == system) {
+        tlsSystem = nullptr;
+    }
+    system->workerCount = 0;
+}
+
+// --- Submission ---
+
+// For a job that got no ring slot: it still only starts once `after` has reached zero, and it
+// has finished before `done` could be waited on, so the counter doesn't need to know about it.
+static void runInline(JobSystem* system, JobFunction function, void* data, uint32_t begin, uint32_t end,
+                      JobCounter* after) {
+    if (after != nullptr) {
+        jobSystemWait(system, after);
+    }
+    function(data, begin, end);
+    system->queues[currentWorker(system)].executed.fetch_add(1, std::memory_order_relaxed);
+}
+
+void jobSystemSubmit(JobSystem* system, JobFunction function, void* data, JobCounter* done, JobCounter* after) {
+    if (Job* job = allocateJob(system, function, data, 0, 0, done)) {
+        scheduleJob(system, job, after);
+    } else {
+        runInline(system, function, data, 0, 0, after);
+    }
+}
+
+void jobSystemParallelFor(JobSystem* system, JobFunction function, void* data, uint32_t count, uint32_t grain,
+                          JobCounter* done, JobCounter* after) {
+    if (grain == 0) {
+        grain = 1;
+    }
+    // Held so `done` can't hit zero between two of these jobs and release its dependents early.
+    if (done != nullptr) {
+        done->pending.fetch_add(1, std::memory_order_relaxed);
+    }
+    for (uint32_t begin = 0; begin < count; begin += grain) {
+        const uint32_t end = count - begin > grain ? begin + grain : count;
+        if (Job* job = allocateJob(system, function, data, begin, end, done)) {
+            scheduleJob(system, job, after);
+        } else {
+            runInline(system, function, data, begin, end, after);
+        }
+    }
+    signalCounter(system, done);
+}
+
+void jobSystemWait(JobSystem* system, JobCounter* counter) {
+    const uint32_t worker = currentWorker(system);
+    while (counter->pending.load(std::memory_order_acquire) > 0) {
+        if (Job* job = findJob(system, worker)) {
+            executeJob(system, job);
+            continue;
+        }
+        // The remaining jobs are running elsewhere (or held on a counter that is): sleep like an
+        // idle worker until a job is queued or the counter reaches zero.
+        std::unique_lock<std::mutex> lock(system->wakeMutex);
+        system->sleepingWorkers.fetch_add(1);
+        system->counterWaiters.fetch_add(1);
+        system->wakeCond.wait(lock, [system, counter] {
+            return system->queuedJobs.load() > 0 || counter->pending.load() == 0;
+        });
+        system->counterWaiters.fetch_sub(1);
+        system->sleepingWorkers.fetch_sub(1);
+    }
+}
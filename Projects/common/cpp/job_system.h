@@ -0,0 +1,105 @@
+//
+// Work-stealing job system for per-frame CPU work (culling, animation, text layout, transforms).
+//
+// One worker per big core; the thread that calls jobSystemInit is worker 0 and runs queued jobs
+// in jobSystemWait, sleeping there only when none are left to take. Every worker has its own deque: it pushes and pops at the
+// back (LIFO, cache-warm) and idle workers steal from the front of the others (FIFO, the
+// biggest remaining chunks). Workers with nothing to do sleep on a condition variable rather
+// than spin, so an idle app costs no CPU.
+//
+// Dependencies go through JobCounters: a job can signal a counter when it finishes and can be
+// held back until another counter reaches zero. A counter must not reach zero while jobs are
+// still being added to it, so submit everything for a counter before waiting on it, or from
+// inside a job that itself signals that counter.
+//
+
+#ifndef ANDROIDSAMSUNG_JOBSYSTEM_H
+#define ANDROIDSAMSUNG_JOBSYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#define JOB_SYSTEM_MAX_WORKERS 16
+// Jobs come from a ring of this many. When the next slot still holds a job in flight (queued,
+// held or running), the new job runs inline on the submitting thread instead, once its `after`
+// counter has reached zero, and an error is logged.
+#define JOB_SYSTEM_MAX_JOBS 4096
+// Per-worker deque capacity; a push that doesn't fit runs the job inline instead.
+#define JOB_SYSTEM_QUEUE_SIZE 1024
+
+// Runs items [begin, end) of `data`; single jobs get begin == end == 0.
+typedef void (*JobFunction)(void* data, uint32_t begin, uint32_t end);
+
+struct JobCounter;
+
+struct Job {
+    JobFunction function = nullptr;
+    void* data = nullptr;
+    uint32_t begin = 0;
+    uint32_t end = 0;
+    JobCounter* done = nullptr; // signalled when the job finishes; may be null
+    Job* nextWaiting = nullptr; // link in a counter's list of held jobs
+    std::atomic<bool> inFlight{false}; // the ring slot is taken until the job has run
+};
+
+struct JobCounter {
+    std::atomic<uint32_t> pending{0};
+    std::mutex mutex;
+    Job* waiting = nullptr; // jobs released when `pending` drops to zero
+};
+
+struct JobQueue {
+    std::mutex mutex;
+    Job* jobs[JOB_SYSTEM_QUEUE_SIZE];
+    uint32_t front = 0; // steal end
+    uint32_t count = 0;
+
+    // Stats, read by the benchmark.
+    std::atomic<uint64_t> executed{0};
+    std::atomic<uint64_t> stolen{0};
+};
+
+struct JobSystem {
+    uint32_t workerCount = 0; // including worker 0 (the owning thread)
+    std::thread threads[JOB_SYSTEM_MAX_WORKERS];
+    JobQueue queues[JOB_SYSTEM_MAX_WORKERS];
+
+    Job jobs[JOB_SYSTEM_MAX_JOBS];
+    std::atomic<uint32_t> nextJob{0};
+    // Jobs run inline because their ring slot was still in flight.
+    std::atomic<uint64_t> ringFullJobs{0};
+
+    // Sleep/wake for idle workers, and for threads in jobSystemWait.
+    std::atomic<uint32_t> queuedJobs{0};
+    std::atomic<uint32_t> sleepingWorkers{0};
+    std::atomic<uint32_t> counterWaiters{0};
+    std::mutex wakeMutex;
+    std::condition_variable wakeCond;
+    std::atomic<bool> stopRequested{false};
+};
+
+// Number of big (non-efficiency) cores: those whose max frequency is above the lowest tier.
+// Falls back to all online cores when cpufreq isn't readable or all cores are the same.
+uint32_t jobSystemBigCoreCount();
+
+// Starts `workerCount` - 1 threads (0 = jobSystemBigCoreCount()), pinned to the big cores when
+// `pinToBigCores` is set. The calling thread becomes worker 0.
+bool jobSystemInit(JobSystem* system, uint32_t workerCount, bool pinToBigCores);
+// Finishes queued jobs and joins the workers. Call from the thread that called jobSystemInit.
+void jobSystemShutdown(JobSystem* system);
+
+// Queues `function(data, 0, 0)`. `done` (optional) is signalled when it finishes; the job only
+// starts once `after` (optional) has reached zero.
+void jobSystemSubmit(JobSystem* system, JobFunction function, void* data, JobCounter* done,
+                     JobCounter* after = nullptr);
+// Splits [0, count) into jobs of at most `grain` items, all signalling `done` and held on `after`.
+void jobSystemParallelFor(JobSystem* system, JobFunction function, void* data, uint32_t count, uint32_t grain,
+                          JobCounter* done, JobCounter* after = nullptr);
+// Runs queued jobs on the calling thread until `counter` reaches zero, sleeping while there are
+// none to take and the rest are still running elsewhere.
+void jobSystemWait(JobSystem* system, JobCounter* counter);
+
+#endif //ANDROIDSAMSUNG_JOBSYSTEM_H
@@ -0,0 +1,370 @@
+#include "overlay_layout.h"
+
+#include <android/log.h>
+#include <android/asset_manager.h>
+#include <cstring>
+
+#define TAG "OverlayLayout"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+// Nesting allowed inside values that are skipped.
+#define LAYOUT_MAX_DEPTH 16
+
+// --- Cursor ---
+
+struct LayoutCursor {
+    const char* begin;
+    const char* p;
+    const char* end;
+    const char* error = nullptr;
+};
+
+static bool fail(LayoutCursor* cursor, const char* message) {
+    if (!cursor->error) {
+        cursor->error = message;
+    }
+    return false;
+}
+
+static void skipWhitespace(LayoutCursor* cursor) {
+    while (cursor->p < cursor->end &&
+           (*cursor->p == ' ' || *cursor->p == '\t' || *cursor->p == '\n' || *cursor->p == '\r')) {
+        ++cursor->p;
+    }
+}
+
+static bool peek(LayoutCursor* cursor, char c) {
+    skipWhitespace(cursor);
+    return cursor->p < cursor->end && *cursor->p == c;
+}
+
+// Consumes `c` if it is the next non-blank character.
+static bool accept(LayoutCursor* cursor, char c) {
+    if (!peek(cursor, c)) {
+        return false;
+    }
+    ++cursor->p;
+    return true;
+}
+
+static bool expect(LayoutCursor* cursor, char c) {
+    if (!peek(cursor, c)) {
+        return fail(cursor, "unexpected character");
+    }
+    ++cursor->p;
+    return true;
+}
+
+// --- Values ---
+
+// Copies the string into `out` (truncated to `capacity` - 1). Escapes are kept
+// as the escaped character; \u sequences are not supported.
+static bool parseString(LayoutCursor* cursor, char* out, size_t capacity) {
+    if (!expect(cursor, '"')) {
+        return false;
+    }
+    size_t length = 0;
+    while (cursor->p < cursor->end && *cursor->p != '"') {
+        char c = *cursor->p++;
+        if (c == '\\') {
+            if (cursor->p == cursor->end) {
+                break;
+            }
+            c = *cursor->p++;
+            if (c == 'u') {
+                return fail(cursor, "\\u escapes are not supported");
+            }
+        }
+        if (out && length + 1 < capacity) {
+            out[length++] = c;
+        }
+    }
+    if (cursor->p == cursor->end) {
+        return fail(cursor, "unterminated string");
+    }
+    ++cursor->p;
+    if (out && capacity > 0) {
+        out[length] = '\0';
+    }
+    return true;
+}
+
+static bool isDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+// Parses a JSON number without strtod, which needs a terminated buffer.
+static bool parseNumber(LayoutCursor* cursor, double* out) {
+    skipWhitespace(cursor);
+    const char* start = cursor->p;
+    double sign = 1.0;
+    if (cursor->p < cursor->end && *cursor->p == '-') {
+        sign = -1.0;
+        ++cursor->p;
+    }
+    double value = 0.0;
+    bool digits = false;
+    while (cursor->p < cursor->end && isDigit(*cursor->p)) {
+        value = value * 10.0 + (*cursor->p++ - '0');
+        digits = true;
+    }
+    if (cursor->p < cursor->end && *cursor->p == '.') {
+        ++cursor->p;
+        double scale = 0.1;
+        while (cursor->p < cursor->end && isDigit(*cursor->p)) {
+            value += (*cursor->p++ - '0') * scale;
+            scale *= 0.1;
+            digits = true;
+        }
+    }
+    if (!digits) {
+        cursor->p = start;
+        return fail(cursor, "expected a number");
+    }
+    if (cursor->p < cursor->end && (*cursor->p == 'e' || *cursor->p == 'E')) {
+        ++cursor->p;
+        bool negative = false;
+        if (cursor->p < cursor->end && (*cursor->p == '+' || *cursor->p == '-')) {
+            negative = *cursor->p++ == '-';
+        }
+        int exponent = 0;
+        while (cursor->p < cursor->end && isDigit(*cursor->p) && exponent < 1000) {
+            exponent = exponent * 10 + (*cursor->p++ - '0');
+        }
+        for (int i = 0; i < exponent; ++i) {
+            value = negative ? value * 0.1 : value * 10.0;
+        }
+    }
+    *out = sign * value;
+    return true;
+}
+
+static bool parseLiteral(LayoutCursor* cursor, const char* literal) {
+    skipWhitespace(cursor);
+    const size_t length = strlen(literal);
+    if (static_cast<size_t>(cursor->end - cursor->p) < length || memcmp(cursor->p, literal, length) != 0) {
+        return fail(cursor, "unexpected literal");
+    }
+    cursor->p += length;
+    return true;
+}
+
+static bool parseBool(LayoutCursor* cursor, bool* out) {
+    if (peek(cursor, 't')) {
+        *out = true;
+        return parseLiteral(cursor, "true");
+    }
+    *out = false;
+    return parseLiteral(cursor, "false");
+}
+
+// A panel resolution: a whole number of pixels, 1 to OVERLAY_LAYOUT_MAX_RESOLUTION.
+static bool parseResolution(LayoutCursor* cursor, uint32_t* out) {
+    skipWhitespace(cursor);
+    const char* start = cursor->p;
+    double value = 0.0;
+    if (!parseNumber(cursor, &value)) {
+        return false;
+    }
+    if (value < 1.0 || value > OVERLAY_LAYOUT_MAX_RESOLUTION ||
+        value != static_cast<double>(static_cast<uint32_t>(value))) {
+        cursor->p = start;
+        return fail(cursor, "expected a resolution between 1 and 16384");
+    }
+    *out = static_cast<uint32_t>(value);
+    return true;
+}
+
+// Parses an array of exactly `count` numbers.
+static bool parseFloats(LayoutCursor* cursor, float* out, uint32_t count) {
+    if (!expect(cursor, '[')) {
+        return false;
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+        if (i > 0 && !expect(cursor, ',')) {
+            return false;
+        }
+        double value = 0.0;
+        if (!parseNumber(cursor, &value)) {
+            return false;
+        }
+        out[i] = static_cast<float>(value);
+    }
+    return expect(cursor, ']');
+}
+
+static bool skipValue(LayoutCursor* cursor, uint32_t depth) {
+    if (depth > LAYOUT_MAX_DEPTH) {
+        return fail(cursor, "nested too deep");
+    }
+    skipWhitespace(cursor);
+    if (cursor->p == cursor->end) {
+        return fail(cursor, "unexpected end of layout");
+    }
+    switch (*cursor->p) {
+        case '"':
+            return parseString(cursor, nullptr, 0);
+        case 't':
+            return parseLiteral(cursor, "true");
+        case 'f':
+            return parseLiteral(cursor, "false");
+        case 'n':
+            return parseLiteral(cursor, "null");
+        case '[':
+            ++cursor->p;
+            if (accept(cursor, ']')) {
+                return true;
+            }
+            do {
+                if (!skipValue(cursor, depth + 1)) {
+                    return false;
+                }
+            } while (accept(cursor, ','));
+            return expect(cursor, ']');
+        case '{':
+            ++cursor->p;
+            if (accept(cursor, '}')) {
+                return true;
+            }
+            do {
+                if (!parseString(cursor, nullptr, 0) || !expect(cursor, ':') || !skipValue(cursor, depth + 1)) {
+                    return false;
+                }
+            } while (accept(cursor, ','));
+            return expect(cursor, '}');
+        default: {
+            double ignored;
+            return parseNumber(cursor, &ignored);
+        }
+    }
+}
+
+// --- Layout ---
+
+// Key buffer only needs to hold the longest known key; longer keys are
+// truncated and then simply don't match anything.
+#define LAYOUT_KEY_LENGTH 16
+
+static bool parsePanel(LayoutCursor* cursor, OverlayPanelDesc* panel, bool* enabled) {
+    *panel = OverlayPanelDesc{};
+    *enabled = true;
+    if (!expect(cursor, '{')) {
+        return false;
+    }
+    if (accept(cursor, '}')) {
+        return true;
+    }
+    do {
+        char key[LAYOUT_KEY_LENGTH];
+        if (!parseString(cursor, key, sizeof(key)) || !expect(cursor, ':')) {
+            return false;
+        }
+        bool ok;
+        if (strcmp(key, "name") == 0) {
+            ok = parseString(cursor, panel->name, sizeof(panel->name));
+        } else if (strcmp(key, "width") == 0) {
+            ok = parseResolution(cursor, &panel->width);
+        } else if (strcmp(key, "height") == 0) {
+            ok = parseResolution(cursor, &panel->height);
+        } else if (strcmp(key, "color") == 0) {
+            ok = parseFloats(cursor, panel->color, 4);
+        } else if (strcmp(key, "position") == 0) {
+            ok = parseFloats(cursor, &panel->pose.position.x, 3);
+        } else if (strcmp(key, "orientation") == 0) {
+            ok = parseFloats(cursor, &panel->pose.orientation.x, 4);
+        } else if (strcmp(key, "size") == 0) {
+            ok = parseFloats(cursor, &panel->size.width, 2);
+        } else if (strcmp(key, "enabled") == 0) {
+            ok = parseBool(cursor, enabled);
+        } else {
+            ok = skipValue(cursor, 0);
+        }
+        if (!ok) {
+            return false;
+        }
+    } while (accept(cursor, ','));
+    return expect(cursor, '}');
+}
+
+static bool parsePanels(LayoutCursor* cursor, OverlayLayout* layout) {
+    if (!expect(cursor, '[')) {
+        return false;
+    }
+    if (accept(cursor, ']')) {
+        return true;
+    }
+    do {
+        // Only enabled panels take a slot, so disabled ones don't count against the limit.
+        skipWhitespace(cursor);
+        const char* start = cursor->p;
+        OverlayPanelDesc panel;
+        bool enabled = true;
+        if (!parsePanel(cursor, &panel, &enabled)) {
+            return false;
+        }
+        if (!enabled) {
+            continue;
+        }
+        if (layout->panelCount == OVERLAY_LAYOUT_MAX_PANELS) {
+            cursor->p = start;
+            return fail(cursor, "too many panels");
+        }
+        layout->panels[layout->panelCount++] = panel;
+    } while (accept(cursor, ','));
+    return expect(cursor, ']');
+}
+
+bool overlayLayoutParse(const char* text, size_t length, OverlayLayout* layout) {
+    layout->panelCount = 0;
+    layout->error = nullptr;
+    layout->errorOffset = 0;
+    LayoutCursor cursor = {text, text, text + length};
+
+    bool ok = expect(&cursor, '{');
+    if (ok && !accept(&cursor, '}')) {
+        do {
+            char key[LAYOUT_KEY_LENGTH];
+            ok = parseString(&cursor, key, sizeof(key)) && expect(&cursor, ':');
+            if (ok) {
+                ok = strcmp(key, "panels") == 0 ? parsePanels(&cursor, layout) : skipValue(&cursor, 0);
+            }
+        } while (ok && accept(&cursor, ','));
+        ok = ok && expect(&cursor, '}');
+    }
+    if (ok) {
+        skipWhitespace(&cursor);
+        if (cursor.p != cursor.end) {
+            ok = fail(&cursor, "trailing characters");
+        }
+    }
+
+    if (!ok) {
+        layout->error = cursor.error ? cursor.error : "malformed layout";
+        layout->errorOffset = static_cast<uint32_t>(cursor.p - cursor.begin);
+        LOGE("Layout parse error at byte %u: %s", layout->errorOffset, layout->error);
+        layout->panelCount = 0;
+        return false;
+    }
+    return true;
+}
+
+bool overlayLayoutLoadAsset(AAssetManager* assetManager, const char* path, OverlayLayout* layout) {
+    layout->panelCount = 0;
+    if (!assetManager) {
+        return false;
+    }
+    AAsset* asset = AAssetManager_open(assetManager, path, AASSET_MODE_BUFFER);
+    if (!asset) {
+        LOGE("Layout asset '%s' not found", path);
+        return false;
+    }
+    const char* text = static_cast<const char*>(AAsset_getBuffer(asset));
+    const size_t length = static_cast<size_t>(AAsset_getLength(asset));
+    const bool ok = text && overlayLayoutParse(text, length, layout);
+    AAsset_close(asset);
+    if (ok) {
+        LOGI("Loaded %u panels from '%s'", layout->panelCount, path);
+    }
+    return ok;
+}
@@ -0,0 +1,51 @@
+//
+// Overlay panel layout loaded from an asset instead of compiled-in constants.
+//
+// The layout is a JSON subset, parsed once straight into a fixed OverlayLayout
+// with no heap allocation:
+//
+//   {
+//     "panels": [
+//       { "name": "Green", "width": 512, "height": 512,
+//         "color": [0.1, 0.8, 0.2, 0.8],
+//         "position": [0.2, 0.5, -1.2], "orientation": [0, 0, 0, 1],
+//         "size": [0.5, 0.5], "enabled": true }
+//     ]
+//   }
+//
+// Every panel key is optional and falls back to the OverlayPanelDesc default.
+// Panels with "enabled": false are skipped and take no slot; unknown keys are ignored.
+//
+
+#ifndef ANDROIDSAMSUNG_OVERLAYLAYOUT_H
+#define ANDROIDSAMSUNG_OVERLAYLAYOUT_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "overlay_panel.h"
+
+#define OVERLAY_LAYOUT_MAX_PANELS 32
+// Largest panel "width"/"height"; both must be at least 1.
+#define OVERLAY_LAYOUT_MAX_RESOLUTION 16384
+
+struct AAssetManager;
+
+struct OverlayLayout {
+    uint32_t panelCount = 0;
+    OverlayPanelDesc panels[OVERLAY_LAYOUT_MAX_PANELS];
+
+    // Why and where (byte offset into the text) the last parse failed; null on success.
+    const char* error = nullptr;
+    uint32_t errorOffset = 0;
+};
+
+// Parses `length` bytes of layout text (no terminator needed) into `layout`.
+// On failure logs the byte offset of the error and leaves `layout` empty.
+bool overlayLayoutParse(const char* text, size_t length, OverlayLayout* layout);
+
+// Reads and parses an asset, e.g. "overlay_layout.json". The asset is mapped,
+// not copied. Returns false if it is missing or malformed.
+bool overlayLayoutLoadAsset(AAssetManager* assetManager, const char* path, OverlayLayout* layout);
+
+#endif //ANDROIDSAMSUNG_OVERLAYLAYOUT_H
@@ -0,0 +1,29 @@
+//
+// Description of one flat overlay panel: what used to be a whole overlay APK
+// (overlay1/2/3) reduced to its color, pose, size and resolution.
+//
+
+#ifndef ANDROIDSAMSUNG_OVERLAYPANEL_H
+#define ANDROIDSAMSUNG_OVERLAYPANEL_H
+
+#include <cstdint>
+
+#include <openxr/openxr.h>
+
+#define OVERLAY_PANEL_NAME_LENGTH 32
+
+struct OverlayPanelDesc {
+    char name[OVERLAY_PANEL_NAME_LENGTH] = {};
+
+    // Swapchain resolution of the panel in pixels.
+    uint32_t width = 512;
+    uint32_t height = 512;
+
+    float color[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+
+    // Placement in the app's LOCAL space, size in meters.
+    XrPosef pose = {{0, 0, 0, 1}, {0.0f, 0.0f, -1.0f}};
+    XrExtent2Df size = {0.5f, 0.5f};
+};
+
+#endif //ANDROIDSAMSUNG_OVERLAYPANEL_H
@@ -0,0 +1,321 @@
+#include "quad_atlas.h"
+
+#include <android/log.h>
+#include <EGL/egl.h>
+#include <algorithm>
+#include <climits>
+
+#define XR_USE_GRAPHICS_API_OPENGL_ES
+#include <openxr/openxr_platform.h>
+
+#include "trace.h"
+
+#define TAG "QuadAtlas"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+// --- Rect packer ---
+
+void rectPackerInit(RectPacker* packer, int32_t width, int32_t height, int32_t padding) {
+    packer->width = width;
+    packer->height = height;
+    packer->padding = padding;
+    packer->usedWidth = 0;
+    packer->usedHeight = 0;
+    packer->nodeCount = 1;
+    packer->nodes[0] = {0, 0, width};
+}
+
+// Returns the y the rect would rest at if its left edge sits on node `index`,
+// or -1 if it doesn't fit there.
+static int32_t skylineFit(const RectPacker* packer, uint32_t index, int32_t width, int32_t height) {
+    const RectPacker::Node& node = packer->nodes[index];
+    if (node.x + width > packer->width) {
+        return -1;
+    }
+    int32_t y = 0;
+    int32_t widthLeft = width;
+    for (uint32_t i = index; widthLeft > 0; ++i) {
+        if (i >= packer->nodeCount) {
+            return -1;
+        }
+        y = std::max(y, packer->nodes[i].y);
+        if (y + height > packer->height) {
+            return -1;
+        }
+        widthLeft -= packer->nodes[i].width;
+    }
+    return y;
+}
+
+bool rectPackerInsert(RectPacker* packer, int32_t width, int32_t height, AtlasRect* outRect) {
+    const int32_t paddedWidth = width + packer->padding * 2;
+    const int32_t paddedHeight = height + packer->padding * 2;
+    const uint32_t capacity = sizeof(packer->nodes) / sizeof(packer->nodes[0]);
+    if (width <= 0 || height <= 0 || packer->nodeCount >= capacity) {
+        return false;
+    }
+
+    int32_t bestBottom = INT_MAX;
+    int32_t bestWidth = INT_MAX;
+    int32_t bestIndex = -1;
+    int32_t bestX = 0;
+    int32_t bestY = 0;
+    for (uint32_t i = 0; i < packer->nodeCount; ++i) {
+        int32_t y = skylineFit(packer, i, paddedWidth, paddedHeight);
+        if (y < 0) {
+            continue;
+        }
+        const int32_t bottom = y + paddedHeight;
+        if (bottom < bestBottom || (bottom == bestBottom && packer->nodes[i].width < bestWidth)) {
+            bestBottom = bottom;
+            bestWidth = packer->nodes[i].width;
+            bestIndex = static_cast<int32_t>(i);
+            bestX = packer->nodes[i].x;
+            bestY = y;
+        }
+    }
+    if (bestIndex < 0) {
+        return false;
+    }
+
+    // Insert the new skyline segment and trim whatever it now shadows.
+    for (uint32_t i = packer->nodeCount; i > static_cast<uint32_t>(bestIndex); --i) {
+        packer->nodes[i] = packer->nodes[i - 1];
+    }
+    packer->nodes[bestIndex] = {bestX, bestY + paddedHeight, paddedWidth};
+    packer->nodeCount++;
+
+    uint32_t i = static_cast<uint32_t>(bestIndex) + 1;
+    while (i < packer->nodeCount) {
+        const RectPacker::Node& prev = packer->nodes[i - 1];
+        RectPacker::Node& node = packer->nodes[i];
+        const int32_t prevRight = prev.x + prev.width;
+        if (node.x >= prevRight) {
+            break;
+        }
+        const int32_t shrink = prevRight - node.x;
+        node.x += shrink;
+        node.width -= shrink;
+        if (node.width > 0) {
+            break;
+        }
+        for (uint32_t j = i; j + 1 < packer->nodeCount; ++j) {
+            packer->nodes[j] = packer->nodes[j + 1];
+        }
+        packer->nodeCount--;
+    }
+
+    // Merge neighbours at the same height.
+    for (uint32_t j = 0; j + 1 < packer->nodeCount;) {
+        if (packer->nodes[j].y == packer->nodes[j + 1].y) {
+            packer->nodes[j].width += packer->nodes[j + 1].width;
+            for (uint32_t k = j + 1; k + 1 < packer->nodeCount; ++k) {
+                packer->nodes[k] = packer->nodes[k + 1];
+            }
+            packer->nodeCount--;
+        } else {
+            ++j;
+        }
+    }
+
+    packer->usedWidth = std::max(packer->usedWidth, bestX + paddedWidth);
+    packer->usedHeight = std::max(packer->usedHeight, bestY + paddedHeight);
+
+    outRect->x = bestX + packer->padding;
+    outRect->y = bestY + packer->padding;
+    outRect->width = width;
+    outRect->height = height;
+    return true;
+}
+
+// --- Atlas ---
+
+void quadAtlasInit(QuadAtlas* atlas, uint32_t maxWidth, uint32_t maxHeight, int32_t padding) {
+    rectPackerInit(&atlas->packer, static_cast<int32_t>(maxWidth), static_cast<int32_t>(maxHeight), padding);
+    atlas->panelCount = 0;
+    atlas->width = 0;
+    atlas->height = 0;
+}
+
+int32_t quadAtlasAddPanel(QuadAtlas* atlas, uint32_t pixelWidth, uint32_t pixelHeight) {
+    if (atlas->panelCount >= QUAD_ATLAS_MAX_PANELS) {
+        LOGE("Atlas is full (%d panels)", QUAD_ATLAS_MAX_PANELS);
+        return -1;
+    }
+    AtlasRect rect;
+    if (!rectPackerInsert(&atlas->packer, static_cast<int32_t>(pixelWidth),
+                          static_cast<int32_t>(pixelHeight), &rect)) {
+        LOGE("Panel %ux%u does not fit in the %dx%d atlas", pixelWidth, pixelHeight,
+             atlas->packer.width, atlas->packer.height);
+        return -1;
+    }
+    const uint32_t index = atlas->panelCount++;
+    atlas->panels[index] = AtlasPanel{};
+    atlas->panels[index].rect = rect;
+    atlas->width = static_cast<uint32_t>(atlas->packer.usedWidth);
+    atlas->height = static_cast<uint32_t>(atlas->packer.usedHeight);
+    return static_cast<int32_t>(index);
+}
+
+bool quadAtlasCreateSwapchain(QuadAtlas* atlas, XrSession session, int64_t format) {
+    if (atlas->panelCount == 0) {
+        LOGE("No panels were added before creating the atlas swapchain");
+        return false;
+    }
+
+    XrSwapchainCreateInfo swapchainCreateInfo = {XR_TYPE_SWAPCHAIN_CREATE_INFO};
+    swapchainCreateInfo.usageFlags = XR_SWAPCHAIN_USAGE_COLOR_ATTACHMENT_BIT;
+    swapchainCreateInfo.format = format;
+    swapchainCreateInfo.width = atlas->width;
+    swapchainCreateInfo.height = atlas->height;
+    swapchainCreateInfo.sampleCount = 1;
+    swapchainCreateInfo.faceCount = 1;
+    swapchainCreateInfo.arraySize = 1;
+    swapchainCreateInfo.mipCount = 1;
+    XrResult r = xrCreateSwapchain(session, &swapchainCreateInfo, &atlas->swapchain);
+    if (XR_FAILED(r)) {
+        LOGE("xrCreateSwapchain failed for %ux%u atlas: 0x%X", atlas->width, atlas->height, r);
+        return false;
+    }
+
+    uint32_t imageCount = 0;
+    xrEnumerateSwapchainImages(atlas->swapchain, 0, &imageCount, nullptr);
+    std::vector<XrSwapchainImageOpenGLESKHR> images(imageCount, {XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_ES_KHR});
+    xrEnumerateSwapchainImages(atlas->swapchain, imageCount, &imageCount,
+                               (XrSwapchainImageBaseHeader*)images.data());
+
+    std::vector<GLuint> textures(imageCount);
+    for (uint32_t i = 0; i < imageCount; ++i) {
+        textures[i] = images[i].image;
+    }
+    quadAtlasAttachImages(atlas, textures.data(), imageCount);
+
+    LOGI("Atlas swapchain %ux%u created for %u panels (%u images)",
+         atlas->width, atlas->height, atlas->panelCount, imageCount);
+    return true;
+}
+
+void quadAtlasAttachImages(QuadAtlas* atlas, const GLuint* textures, uint32_t count) {
+    atlas->imageCount = count;
+    atlas->clearedImageMask = 0;
+    atlas->framebuffers.resize(count);
+    glGenFramebuffers(static_cast<GLsizei>(count), atlas->framebuffers.data());
+    for (uint32_t i = 0; i < count; ++i) {
+        glBindFramebuffer(GL_FRAMEBUFFER, atlas->framebuffers[i]);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, textures[i], 0);
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+bool quadAtlasBeginFrame(QuadAtlas* atlas) {
+    if (atlas->imageCount == 0) {
+        return false;
+    }
+    if (atlas->swapchain == XR_NULL_HANDLE) {
+        // Images were attached directly, just rotate through them.
+        atlas->imageIndex = (atlas->imageIndex + 1) % atlas->imageCount;
+        atlas->imageAcquired = true;
+        return true;
+    }
+
+    TRACE_SCOPE("xrAcquireSwapchainImage");
+    XrResult r = xrAcquireSwapchainImage(atlas->swapchain, nullptr, &atlas->imageIndex);
+    if (XR_FAILED(r)) {
+        LOGE("xrAcquireSwapchainImage failed: 0x%X", r);
+        return false;
+    }
+    XrSwapchainImageWaitInfo waitInfo = {XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO, nullptr, XR_INFINITE_DURATION};
+    r = xrWaitSwapchainImage(atlas->swapchain, &waitInfo);
+    if (XR_FAILED(r)) {
+        LOGE("xrWaitSwapchainImage failed: 0x%X", r);
+        xrReleaseSwapchainImage(atlas->swapchain, nullptr);
+        return false;
+    }
+    atlas->imageAcquired = true;
+    return true;
+}
+
+void quadAtlasBindPanel(const QuadAtlas* atlas, uint32_t panel) {
+    const AtlasRect& rect = atlas->panels[panel].rect;
+    glBindFramebuffer(GL_FRAMEBUFFER, atlas->framebuffers[atlas->imageIndex]);
+    glViewport(rect.x, rect.y, rect.width, rect.height);
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(rect.x, rect.y, rect.width, rect.height);
+}
+
+void quadAtlasClearPanels(QuadAtlas* atlas) {
+    TRACE_SCOPE("render panels");
+    // Gutters once per image, then each panel inside its own scissor rect.
+    const uint32_t imageBit = 1u << (atlas->imageIndex % 32);
+    if ((atlas->clearedImageMask & imageBit) == 0) {
+        glBindFramebuffer(GL_FRAMEBUFFER, atlas->framebuffers[atlas->imageIndex]);
+        glDisable(GL_SCISSOR_TEST);
+        glViewport(0, 0, atlas->width, atlas->height);
+        glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        atlas->clearedImageMask |= imageBit;
+    }
+
+    for (uint32_t i = 0; i < atlas->panelCount; ++i) {
+        const AtlasPanel& panel = atlas->panels[i];
+        if (!panel.visible) {
+            continue;
+        }
+        quadAtlasBindPanel(atlas, i);
+        glClearColor(panel.color[0], panel.color[1], panel.color[2], panel.color[3]);
+        glClear(GL_COLOR_BUFFER_BIT);
+    }
+    glDisable(GL_SCISSOR_TEST);
+}
+
+void quadAtlasEndFrame(QuadAtlas* atlas) {
+    if (!atlas->imageAcquired) {
+        return;
+    }
+    glDisable(GL_SCISSOR_TEST);
+    if (atlas->swapchain != XR_NULL_HANDLE) {
+        TRACE_SCOPE("xrReleaseSwapchainImage");
+        XrResult r = xrReleaseSwapchainImage(atlas->swapchain, nullptr);
+        if (XR_FAILED(r)) {
+            LOGE("xrReleaseSwapchainImage failed: 0x%X", r);
+        }
+    }
+    atlas->imageAcquired = false;
+}
+
+uint32_t quadAtlasBuildLayers(QuadAtlas* atlas, XrSpace space, XrCompositionLayerFlags layerFlags) {
+    uint32_t layerCount = 0;
+    for (uint32_t i = 0; i < atlas->panelCount; ++i) {
+        const AtlasPanel& panel = atlas->panels[i];
+        if (!panel.visible) {
+            continue;
+        }
+        XrCompositionLayerQuad& layer = atlas->layers[layerCount];
+        layer = {XR_TYPE_COMPOSITION_LAYER_QUAD};
+        layer.layerFlags = layerFlags;
+        layer.space = space;
+        layer.eyeVisibility = XR_EYE_VISIBILITY_BOTH;
+        layer.subImage.swapchain = atlas->swapchain;
+        layer.subImage.imageRect = {{panel.rect.x, panel.rect.y}, {panel.rect.width, panel.rect.height}};
+        layer.subImage.imageArrayIndex = 0;
+        layer.pose = panel.pose;
+        layer.size = panel.size;
+        atlas->layerPtrs[layerCount] = reinterpret_cast<const XrCompositionLayerBaseHeader*>(&layer);
+        layerCount++;
+    }
+    return layerCount;
+}
+
+void quadAtlasDestroy(QuadAtlas* atlas) {
+    if (!atlas->framebuffers.empty()) {
+        glDeleteFramebuffers(static_cast<GLsizei>(atlas->framebuffers.size()), atlas->framebuffers.data());
+        atlas->framebuffers.clear();
+    }
+    if (atlas->swapchain != XR_NULL_HANDLE) {
+        xrDestroySwapchain(atlas->swapchain);
+        atlas->swapchain = XR_NULL_HANDLE;
+    }
+    atlas->imageCount = 0;
+    atlas->panelCount = 0;
+}
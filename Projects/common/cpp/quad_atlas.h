@@ -0,0 +1,122 @@
+//
+// Quad-layer texture atlas: many overlay panels packed into one swapchain.
+//
+// Every panel gets a sub-rectangle of a single swapchain image and is still
+// submitted as its own XrCompositionLayerQuad through subImage.imageRect, so
+// acquire/wait/release happen once per frame no matter how many panels exist.
+//
+
+#ifndef ANDROIDSAMSUNG_QUADATLAS_H
+#define ANDROIDSAMSUNG_QUADATLAS_H
+
+#include <GLES3/gl3.h>
+#include <cstdint>
+#include <vector>
+
+#include <openxr/openxr.h>
+
+// Upper bound on panels per atlas. Everything per-panel is a fixed array so the
+// frame path never allocates.
+#define QUAD_ATLAS_MAX_PANELS 32
+
+// Transparent gutter (in pixels) kept around every panel so that bilinear
+// sampling by the compositor never bleeds a neighbour into the panel edge.
+#define QUAD_ATLAS_DEFAULT_PADDING 2
+
+struct AtlasRect {
+    int32_t x = 0;
+    int32_t y = 0;
+    int32_t width = 0;
+    int32_t height = 0;
+};
+
+// Skyline bottom-left rectangle packer. Each insert adds at most one skyline
+// node, so the node array is bounded by the panel limit.
+struct RectPacker {
+    struct Node {
+        int32_t x;
+        int32_t y;
+        int32_t width;
+    };
+
+    int32_t width = 0;
+    int32_t height = 0;
+    int32_t padding = 0;
+    int32_t usedWidth = 0;
+    int32_t usedHeight = 0;
+    uint32_t nodeCount = 0;
+    Node nodes[QUAD_ATLAS_MAX_PANELS + 1] = {};
+};
+
+void rectPackerInit(RectPacker* packer, int32_t width, int32_t height, int32_t padding);
+// Places a width x height rect (padding is added internally). Returns false if
+// it doesn't fit.
+bool rectPackerInsert(RectPacker* packer, int32_t width, int32_t height, AtlasRect* outRect);
+
+struct AtlasPanel {
+    AtlasRect rect;
+    XrPosef pose = {{0, 0, 0, 1}, {0, 0, -1.0f}};
+    XrExtent2Df size = {0.5f, 0.5f};
+    float color[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    bool visible = true;
+};
+
+struct QuadAtlas {
+    XrSwapchain swapchain = XR_NULL_HANDLE;
+    uint32_t width = 0;
+    uint32_t height = 0;
+
+    uint32_t imageCount = 0;
+    std::vector<GLuint> framebuffers; // one per swapchain image, created once
+    uint32_t imageIndex = 0;
+    bool imageAcquired = false;
+    // Bit per image whose gutters have been cleared. Panels are scissored, so a
+    // gutter stays transparent once cleared and never needs a full clear again.
+    uint32_t clearedImageMask = 0;
+
+    RectPacker packer;
+    uint32_t panelCount = 0;
+    AtlasPanel panels[QUAD_ATLAS_MAX_PANELS];
+
+    // Submission storage, rebuilt in place every frame.
+    XrCompositionLayerQuad layers[QUAD_ATLAS_MAX_PANELS];
+    const XrCompositionLayerBaseHeader* layerPtrs[QUAD_ATLAS_MAX_PANELS] = {};
+};
+
+// Sets up the packer. Panels must be added before the swapchain is created so
+// the swapchain can be sized to the packed extent rather than the maximum.
+void quadAtlasInit(QuadAtlas* atlas, uint32_t maxWidth, uint32_t maxHeight,
+                   int32_t padding = QUAD_ATLAS_DEFAULT_PADDING);
+
+// Reserves a panel of the given pixel resolution. Returns the panel index or -1
+// if the atlas is full.
+int32_t quadAtlasAddPanel(QuadAtlas* atlas, uint32_t pixelWidth, uint32_t pixelHeight);
+
+// Creates one swapchain covering every packed panel and a framebuffer per image.
+bool quadAtlasCreateSwapchain(QuadAtlas* atlas, XrSession session, int64_t format);
+
+// Builds the per-image framebuffers from already existing GL textures. Called by
+// quadAtlasCreateSwapchain, and usable directly where there is no runtime.
+void quadAtlasAttachImages(QuadAtlas* atlas, const GLuint* textures, uint32_t count);
+
+// Acquires and waits on the shared image once for all panels.
+bool quadAtlasBeginFrame(QuadAtlas* atlas);
+
+// Binds the current image and restricts viewport and scissor to the panel so
+// that clears and draws stay inside its rect.
+void quadAtlasBindPanel(const QuadAtlas* atlas, uint32_t panel);
+
+// Clears every visible panel to its color. Gutters are cleared to transparent
+// the first time each image is used.
+void quadAtlasClearPanels(QuadAtlas* atlas);
+
+// Releases the shared image once for all panels.
+void quadAtlasEndFrame(QuadAtlas* atlas);
+
+// Fills the quad layer array for all visible panels and returns its length.
+// The result points into atlas->layerPtrs.
+uint32_t quadAtlasBuildLayers(QuadAtlas* atlas, XrSpace space, XrCompositionLayerFlags layerFlags);
+
+void quadAtlasDestroy(QuadAtlas* atlas);
+
+#endif //ANDROIDSAMSUNG_QUADATLAS_H
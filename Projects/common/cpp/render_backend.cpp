@@ -0,0 +1,521 @@
+#include "render_backend.h"
+
+#include <android/log.h>
+#include <cmath>
+#include <cstring>
+
+#define XR_USE_PLATFORM_ANDROID
+#define XR_USE_GRAPHICS_API_OPENGL_ES
+#include <jni.h>
+#include <openxr/openxr_platform.h>
+
+#include "demo_scene.h"
+#include "trace.h"
+// Last: with GL_CAPTURE the GL and OpenXR frame calls below are recorded.
+#include "gl_capture.h"
+
+#define TAG "RenderBackend"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+// 90 degrees each way, 63 mm apart: the offscreen views, and the window's vertical FOV.
+#define RENDER_BACKEND_HALF_FOV 0.785398f
+#define RENDER_BACKEND_IPD 0.063f
+
+// --- EGL ---
+
+static bool initEgl(RenderBackend* backend, EGLint surfaceType) {
+    backend->display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if (backend->display == EGL_NO_DISPLAY || !eglInitialize(backend->display, nullptr, nullptr)) {
+        LOGE("eglInitialize failed");
+        return false;
+    }
+    const EGLint configAttribs[] = { EGL_RENDERABLE_TYPE, EGL_OPENGL_ES3_BIT, EGL_SURFACE_TYPE, surfaceType,
+                                     EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8, EGL_ALPHA_SIZE, 8,
+                                     EGL_DEPTH_SIZE, 24, EGL_NONE };
+    EGLint numConfigs = 0;
+    if (!eglChooseConfig(backend->display, configAttribs, &backend->config, 1, &numConfigs) || numConfigs == 0) {
+        LOGE("No GLES3 EGL config");
+        return false;
+    }
+    const EGLint contextAttribs[] = { EGL_CONTEXT_CLIENT_VERSION, 3, EGL_NONE };
+    backend->context = eglCreateContext(backend->display, backend->config, EGL_NO_CONTEXT, contextAttribs);
+    if (backend->context == EGL_NO_CONTEXT) {
+        LOGE("eglCreateContext failed");
+        return false;
+    }
+    return true;
+}
+
+static bool makeCurrent(RenderBackend* backend) {
+    if (!eglMakeCurrent(backend->display, backend->surface, backend->surface, backend->context)) {
+        LOGE("eglMakeCurrent failed: 0x%x", eglGetError());
+        return false;
+    }
+    return true;
+}
+
+// A placeholder pbuffer for the backends that render into FBOs only.
+static bool initPbufferEgl(RenderBackend* backend) {
+    if (!initEgl(backend, EGL_PBUFFER_BIT)) {
+        return false;
+    }
+    const EGLint pbufferAttribs[] = { EGL_WIDTH, 16, EGL_HEIGHT, 16, EGL_NONE };
+    backend->surface = eglCreatePbufferSurface(backend->display, backend->config, pbufferAttribs);
+    return makeCurrent(backend);
+}
+
+static void destroyEgl(RenderBackend* backend) {
+    if (backend->display == EGL_NO_DISPLAY) {
+        return;
+    }
+    eglMakeCurrent(backend->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (backend->surface != EGL_NO_SURFACE) eglDestroySurface(backend->display, backend->surface);
+    if (backend->context != EGL_NO_CONTEXT) eglDestroyContext(backend->display, backend->context);
+    eglTerminate(backend->display);
+}
+
+static void createDepthbuffer(RenderBackend* backend, uint32_t width, uint32_t height) {
+    glGenFramebuffers(1, &backend->framebuffer);
+    glGenRenderbuffers(1, &backend->depthbuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, backend->depthbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height);
+}
+
+static void bindArrayLayer(RenderBackend* backend, GLuint texture, uint32_t view) {
+    glBindFramebuffer(GL_FRAMEBUFFER, backend->framebuffer);
+    glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, texture, 0, view);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, backend->depthbuffer);
+    glViewport(0, 0, backend->views[view].width, backend->views[view].height);
+}
+
+static void setViewProj(RenderView* view, const XrFovf& fov, const XrPosef& pose) {
+    float projMatrix[16];
+    float viewMatrix[16];
+    matrix_create_projection_from_fov(fov, 0.1f, 100.0f, projMatrix);
+    matrix_create_view_from_pose(pose, viewMatrix);
+    matrix_multiply(projMatrix, viewMatrix, view->viewProj);
+}
+
+// --- XR ---
+
+static bool xrInit(RenderBackend* backend, const RenderBackendConfig& config) {
+    if (!initPbufferEgl(backend)) {
+        return false;
+    }
+
+    PFN_xrInitializeLoaderKHR xrInitializeLoaderKHR = nullptr;
+    xrGetInstanceProcAddr(XR_NULL_HANDLE, "xrInitializeLoaderKHR", (PFN_xrVoidFunction*)&xrInitializeLoaderKHR);
+    if (xrInitializeLoaderKHR == nullptr) {
+        LOGE("Failed to get xrInitializeLoaderKHR function pointer!");
+        return false;
+    }
+    XrLoaderInitInfoAndroidKHR loaderInitInfo{XR_TYPE_LOADER_INIT_INFO_ANDROID_KHR};
+    loaderInitInfo.applicationVM = config.vm;
+    loaderInitInfo.applicationContext = config.activity;
+    if (XR_FAILED(xrInitializeLoaderKHR((const XrLoaderInitInfoBaseHeaderKHR*)&loaderInitInfo))) {
+        LOGE("Failed to initialize OpenXR loader!");
+        return false;
+    }
+
+    const char* extensions[] = { XR_KHR_ANDROID_CREATE_INSTANCE_EXTENSION_NAME, XR_KHR_OPENGL_ES_ENABLE_EXTENSION_NAME };
+    XrInstanceCreateInfoAndroidKHR androidInfo{XR_TYPE_INSTANCE_CREATE_INFO_ANDROID_KHR};
+    androidInfo.applicationVM = config.vm;
+    androidInfo.applicationActivity = config.activity;
+
+    XrInstanceCreateInfo createInfo{XR_TYPE_INSTANCE_CREATE_INFO};
+    createInfo.next = &androidInfo;
+    createInfo.enabledExtensionCount = sizeof(extensions) / sizeof(extensions[0]);
+    createInfo.enabledExtensionNames = extensions;
+    strcpy(createInfo.applicationInfo.applicationName, "OpenXR Overlay Demo");
+    createInfo.applicationInfo.applicationVersion = 1;
+    strcpy(createInfo.applicationInfo.engineName, "Custom Engine");
+    createInfo.applicationInfo.engineVersion = 1;
+    createInfo.applicationInfo.apiVersion = XR_CURRENT_API_VERSION;
+
+    if (XR_FAILED(xrCreateInstance(&createInfo, &backend->instance))) {
+        LOGE("Failed to create OpenXR instance");
+        return false;
+    }
+
+    XrSystemGetInfo systemInfo{XR_TYPE_SYSTEM_GET_INFO, nullptr, XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY};
+    if (XR_FAILED(xrGetSystem(backend->instance, &systemInfo, &backend->systemId))) {
+        LOGE("Failed to get OpenXR system");
+        return false;
+    }
+
+    uint32_t viewCount = 0;
+    xrEnumerateViewConfigurationViews(backend->instance, backend->systemId, XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO,
+                                      0, &viewCount, nullptr);
+    if (viewCount == 0 || viewCount > RENDER_BACKEND_MAX_VIEWS) {
+        LOGE("Unsupported view count %u", viewCount);
+        return false;
+    }
+    for (uint32_t i = 0; i < viewCount; ++i) {
+        backend->viewConfigViews[i] = {XR_TYPE_VIEW_CONFIGURATION_VIEW};
+        backend->xrViews[i] = {XR_TYPE_VIEW};
+    }
+    xrEnumerateViewConfigurationViews(backend->instance, backend->systemId, XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO,
+                                      viewCount, &viewCount, backend->viewConfigViews);
+    backend->viewCount = viewCount;
+    for (uint32_t i = 0; i < viewCount; ++i) {
+        backend->views[i].width = backend->viewConfigViews[i].recommendedImageRectWidth;
+        backend->views[i].height = backend->viewConfigViews[i].recommendedImageRectHeight;
+    }
+
+    XrGraphicsBindingOpenGLESAndroidKHR graphicsBinding{XR_TYPE_GRAPHICS_BINDING_OPENGL_ES_ANDROID_KHR};
+    graphicsBinding.display = backend->display;
+    graphicsBinding.config = backend->config;
+    graphicsBinding.context = backend->context;
+
+    XrSessionCreateInfo sessionInfo{XR_TYPE_SESSION_CREATE_INFO, &graphicsBinding, 0, backend->systemId};
+    if (XR_FAILED(xrCreateSession(backend->instance, &sessionInfo, &backend->session))) {
+        LOGE("Failed to create OpenXR session");
+        return false;
+    }
+
+    XrReferenceSpaceCreateInfo spaceInfo{XR_TYPE_REFERENCE_SPACE_CREATE_INFO, nullptr, XR_REFERENCE_SPACE_TYPE_VIEW, {{0,0,0,1},{0,0,0}}};
+    if (XR_FAILED(xrCreateReferenceSpace(backend->session, &spaceInfo, &backend->appSpace))) {
+        LOGE("Failed to create reference space");
+        return false;
+    }
+
+    XrSwapchainCreateInfo swapchainInfo{XR_TYPE_SWAPCHAIN_CREATE_INFO};
+    swapchainInfo.usageFlags = XR_SWAPCHAIN_USAGE_SAMPLED_BIT | XR_SWAPCHAIN_USAGE_COLOR_ATTACHMENT_BIT;
+    swapchainInfo.format = GL_RGBA8;
+    swapchainInfo.sampleCount = 1;
+    swapchainInfo.width = backend->views[0].width;
+    swapchainInfo.height = backend->views[0].height;
+    swapchainInfo.faceCount = 1;
+    swapchainInfo.arraySize = viewCount;
+    swapchainInfo.mipCount = 1;
+
+    if (XR_FAILED(xrCreateSwapchain(backend->session, &swapchainInfo, &backend->swapchain))) {
+        LOGE("Failed to create swapchain");
+        return false;
+    }
+
+    uint32_t imageCount;
+    xrEnumerateSwapchainImages(backend->swapchain, 0, &imageCount, nullptr);
+    std::vector<XrSwapchainImageOpenGLESKHR> images(imageCount, {XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_ES_KHR});
+    xrEnumerateSwapchainImages(backend->swapchain, imageCount, &imageCount,
+                               reinterpret_cast<XrSwapchainImageBaseHeader*>(images.data()));
+    backend->swapchainImages.resize(imageCount);
+    for (uint32_t i = 0; i < imageCount; i++) {
+        backend->swapchainImages[i] = images[i].image;
+    }
+
+    createDepthbuffer(backend, swapchainInfo.width, swapchainInfo.height);
+
+    LOGI("OpenXR initialized successfully");
+    return true;
+}
+
+static void xrDestroy(RenderBackend* backend) {
+    if (backend->sessionRunning) xrEndSession(backend->session);
+    if (backend->swapchain) xrDestroySwapchain(backend->swapchain);
+    if (backend->appSpace) xrDestroySpace(backend->appSpace);
+    if (backend->session) xrDestroySession(backend->session);
+    if (backend->instance) xrDestroyInstance(backend->instance);
+}
+
+static void xrPollEvents(RenderBackend* backend) {
+    if (backend->instance == XR_NULL_HANDLE) return;
+    TRACE_SCOPE("xrPollEvent");
+    XrEventDataBuffer eventData{XR_TYPE_EVENT_DATA_BUFFER};
+    while (xrPollEvent(backend->instance, &eventData) == XR_SUCCESS) {
+        switch (eventData.type) {
+            case XR_TYPE_EVENT_DATA_SESSION_STATE_CHANGED: {
+                auto* stateEvent = reinterpret_cast<XrEventDataSessionStateChanged*>(&eventData);
+                backend->sessionState = stateEvent->state;
+                LOGI("Session state changed to %d", backend->sessionState);
+                if (backend->sessionState == XR_SESSION_STATE_READY) {
+                    XrSessionBeginInfo beginInfo{XR_TYPE_SESSION_BEGIN_INFO, nullptr, XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO};
+                    if (XR_SUCCEEDED(xrBeginSession(backend->session, &beginInfo))) {
+                        backend->sessionRunning = true;
+                        LOGI("Session started successfully");
+                    }
+                } else if (backend->sessionState == XR_SESSION_STATE_STOPPING) {
+                    xrEndSession(backend->session);
+                    backend->sessionRunning = false;
+                }
+                break;
+            }
+            case XR_TYPE_EVENT_DATA_INSTANCE_LOSS_PENDING:
+                LOGI("Instance loss pending. Exiting.");
+                backend->sessionRunning = false;
+                break;
+            default: break;
+        }
+        eventData = {XR_TYPE_EVENT_DATA_BUFFER};
+    }
+}
+
+static uint32_t xrBeginFrameViews(RenderBackend* backend) {
+    if (!backend->sessionRunning) {
+        return 0;
+    }
+    XrFrameWaitInfo waitInfo{XR_TYPE_FRAME_WAIT_INFO};
+    backend->frameState = {XR_TYPE_FRAME_STATE};
+    {
+        TRACE_SCOPE("xrWaitFrame");
+        xrWaitFrame(backend->session, &waitInfo, &backend->frameState);
+    }
+    {
+        TRACE_SCOPE("xrBeginFrame");
+        xrBeginFrame(backend->session, nullptr);
+    }
+    backend->frameBegun = true;
+    if (!backend->frameState.shouldRender) {
+        return 0;
+    }
+
+    // Views first: the image is only acquired for a frame that renders views, since xrEndFrameViews
+    // releases it only then.
+    XrViewState viewState{XR_TYPE_VIEW_STATE};
+    XrViewLocateInfo viewLocateInfo{XR_TYPE_VIEW_LOCATE_INFO, nullptr, XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO,
+                                    backend->frameState.predictedDisplayTime, backend->appSpace};
+    uint32_t viewCountOutput = 0;
+    if (XR_FAILED(xrLocateViews(backend->session, &viewLocateInfo, &viewState, backend->viewCount, &viewCountOutput,
+                                backend->xrViews))) {
+        return 0;
+    }
+    if (viewCountOutput == 0) {
+        return 0;
+    }
+
+    {
+        TRACE_SCOPE("xrAcquireSwapchainImage");
+        xrAcquireSwapchainImage(backend->swapchain, nullptr, &backend->imageIndex);
+        XrSwapchainImageWaitInfo waitImageInfo{XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO, nullptr, XR_INFINITE_DURATION};
+        xrWaitSwapchainImage(backend->swapchain, &waitImageInfo);
+    }
+
+    for (uint32_t eye = 0; eye < viewCountOutput; ++eye) {
+        setViewProj(&backend->views[eye], backend->xrViews[eye].fov, backend->xrViews[eye].pose);
+
+        XrCompositionLayerProjectionView& projectionView = backend->projectionViews[eye];
+        projectionView = {XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW};
+        projectionView.pose = backend->xrViews[eye].pose;
+        projectionView.fov = backend->xrViews[eye].fov;
+        projectionView.subImage.swapchain = backend->swapchain;
+        projectionView.subImage.imageRect.offset = {0, 0};
+        projectionView.subImage.imageRect.extent = {(int32_t)backend->views[eye].width, (int32_t)backend->views[eye].height};
+        projectionView.subImage.imageArrayIndex = eye;
+    }
+    return viewCountOutput;
+}
+
+static void xrBindView(RenderBackend* backend, uint32_t view) {
+    bindArrayLayer(backend, backend->swapchainImages[backend->imageIndex], view);
+}
+
+static void xrEndFrameViews(RenderBackend* backend) {
+    if (!backend->frameBegun) {
+        return;
+    }
+    backend->frameBegun = false;
+
+    // At most the one projection layer; a fixed array keeps the frame free of heap allocations.
+    XrCompositionLayerBaseHeader* layers[1];
+    uint32_t layerCount = 0;
+    XrCompositionLayerProjection layer{XR_TYPE_COMPOSITION_LAYER_PROJECTION};
+    if (backend->frameViewCount > 0) {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        {
+            TRACE_SCOPE("xrReleaseSwapchainImage");
+            xrReleaseSwapchainImage(backend->swapchain, nullptr);
+        }
+        layer.space = backend->appSpace;
+        layer.viewCount = backend->frameViewCount;
+        layer.views = backend->projectionViews;
+        layers[layerCount++] = reinterpret_cast<XrCompositionLayerBaseHeader*>(&layer);
+    }
+
+    XrFrameEndInfo endInfo{XR_TYPE_FRAME_END_INFO};
+    endInfo.displayTime = backend->frameState.predictedDisplayTime;
+    endInfo.environmentBlendMode = XR_ENVIRONMENT_BLEND_MODE_OPAQUE;
+    endInfo.layerCount = layerCount;
+    endInfo.layers = layers;
+    TRACE_SCOPE("xrEndFrame");
+    xrEndFrame(backend->session, &endInfo);
+}
+
+// --- Window ---
+
+static bool windowInit(RenderBackend* backend, const RenderBackendConfig& config) {
+    if (!config.window) {
+        LOGE("No window");
+        return false;
+    }
+    if (!initEgl(backend, EGL_WINDOW_BIT)) {
+        return false;
+    }
+    backend->surface = eglCreateWindowSurface(backend->display, backend->config,
+                                              reinterpret_cast<EGLNativeWindowType>(config.window), nullptr);
+    if (backend->surface == EGL_NO_SURFACE) {
+        LOGE("eglCreateWindowSurface failed: 0x%x", eglGetError());
+        return false;
+    }
+    backend->viewCount = 1;
+    return makeCurrent(backend);
+}
+
+// The window is resized with the activity (rotation), so its size is read every frame.
+static uint32_t windowBeginFrame(RenderBackend* backend) {
+    EGLint width = 0;
+    EGLint height = 0;
+    eglQuerySurface(backend->display, backend->surface, EGL_WIDTH, &width);
+    eglQuerySurface(backend->display, backend->surface, EGL_HEIGHT, &height);
+    if (width <= 0 || height <= 0) {
+        return 0;
+    }
+    RenderView& view = backend->views[0];
+    if (view.width != static_cast<uint32_t>(width) || view.height != static_cast<uint32_t>(height)) {
+        view.width = static_cast<uint32_t>(width);
+        view.height = static_cast<uint32_t>(height);
+        const float tanHalfWidth = tanf(RENDER_BACKEND_HALF_FOV) * width / height;
+        const XrFovf fov = {-atanf(tanHalfWidth), atanf(tanHalfWidth), RENDER_BACKEND_HALF_FOV, -RENDER_BACKEND_HALF_FOV};
+        setViewProj(&view, fov, {{0, 0, 0, 1}, {0, 0, 0}});
+    }
+    return 1;
+}
+
+static void windowBindView(RenderBackend* backend, uint32_t) {
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glViewport(0, 0, backend->views[0].width, backend->views[0].height);
+}
+
+static void windowEndFrame(RenderBackend* backend) {
+    if (backend->frameViewCount > 0) {
+        TRACE_SCOPE("eglSwapBuffers");
+        eglSwapBuffers(backend->display, backend->surface);
+    }
+}
+
+// --- Offscreen ---
+
+static bool offscreenInit(RenderBackend* backend, const RenderBackendConfig& config) {
+    if (config.width == 0 || config.height == 0 || config.viewCount == 0 ||
+        config.viewCount > RENDER_BACKEND_MAX_VIEWS) {
+        LOGE("Bad offscreen size %ux%u x%u", config.width, config.height, config.viewCount);
+        return false;
+    }
+    if (!initPbufferEgl(backend)) {
+        return false;
+    }
+    backend->viewCount = config.viewCount;
+    for (uint32_t i = 0; i < config.viewCount; ++i) {
+        RenderView& view = backend->views[i];
+        view.width = config.width;
+        view.height = config.height;
+        const float x = config.viewCount == 1 ? 0.0f : (i == 0 ? -0.5f : 0.5f) * RENDER_BACKEND_IPD;
+        const XrFovf fov = {-RENDER_BACKEND_HALF_FOV, RENDER_BACKEND_HALF_FOV, RENDER_BACKEND_HALF_FOV, -RENDER_BACKEND_HALF_FOV};
+        setViewProj(&view, fov, {{0, 0, 0, 1}, {x, 0, 0}});
+    }
+    glGenTextures(1, &backend->colorTexture);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, backend->colorTexture);
+    glTexStorage3D(GL_TEXTURE_2D_ARRAY, 1, GL_RGBA8, config.width, config.height, config.viewCount);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    createDepthbuffer(backend, config.width, config.height);
+    LOGI("Offscreen %ux%u x%u", config.width, config.height, config.viewCount);
+    return true;
+}
+
+static void offscreenDestroy(RenderBackend* backend) {
+    if (backend->colorTexture) glDeleteTextures(1, &backend->colorTexture);
+}
+
+static uint32_t offscreenBeginFrame(RenderBackend* backend) {
+    return backend->viewCount;
+}
+
+static void offscreenBindView(RenderBackend* backend, uint32_t view) {
+    bindArrayLayer(backend, backend->colorTexture, view);
+}
+
+// Nothing presents the image; flush so the frame's work is queued like a swap or xrEndFrame.
+static void offscreenEndFrame(RenderBackend*) {
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glFlush();
+}
+
+static void noEvents(RenderBackend*) {}
+static void noDestroy(RenderBackend*) {}
+
+static const RenderBackendOps kBackends[RENDER_BACKEND_COUNT] = {
+        {"xr", xrInit, xrDestroy, xrPollEvents, xrBeginFrameViews, xrBindView, xrEndFrameViews},
+        {"window", windowInit, noDestroy, noEvents, windowBeginFrame, windowBindView, windowEndFrame},
+        {"offscreen", offscreenInit, offscreenDestroy, noEvents, offscreenBeginFrame, offscreenBindView, offscreenEndFrame},
+};
+
+// --- Public ---
+
+const char* renderBackendName(RenderBackendKind kind) {
+    return kind < RENDER_BACKEND_COUNT ? kBackends[kind].name : "unknown";
+}
+
+bool renderBackendParse(const char* name, RenderBackendKind* kind) {
+    for (int i = 0; i < RENDER_BACKEND_COUNT; ++i) {
+        if (name && strcmp(name, kBackends[i].name) == 0) {
+            *kind = static_cast<RenderBackendKind>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool renderBackendInit(RenderBackend* backend, const RenderBackendConfig& config) {
+    if (config.kind >= RENDER_BACKEND_COUNT) {
+        return false;
+    }
+    TRACE_SCOPE("renderBackendInit");
+    backend->ops = &kBackends[config.kind];
+    if (!backend->ops->init(backend, config)) {
+        LOGE("%s backend failed to initialize", backend->ops->name);
+        renderBackendDestroy(backend);
+        return false;
+    }
+    LOGI("%s backend: %u view(s)", backend->ops->name, backend->viewCount);
+    return true;
+}
+
+void renderBackendDestroy(RenderBackend* backend) {
+    if (!backend->ops) {
+        return;
+    }
+    // The GL objects belong to this context, which may not be current after a failed init.
+    if (backend->context != EGL_NO_CONTEXT && eglGetCurrentContext() != backend->context) {
+        eglMakeCurrent(backend->display, backend->surface, backend->surface, backend->context);
+    }
+    if (backend->framebuffer) glDeleteFramebuffers(1, &backend->framebuffer);
+    if (backend->depthbuffer) glDeleteRenderbuffers(1, &backend->depthbuffer);
+    backend->ops->destroy(backend);
+    destroyEgl(backend);
+    *backend = RenderBackend();
+}
+
+void renderBackendPollEvents(RenderBackend* backend) {
+    backend->ops->pollEvents(backend);
+}
+
+bool renderBackendActive(const RenderBackend* backend) {
+    if (!backend->ops) {
+        return false;
+    }
+    return backend->ops != &kBackends[RENDER_BACKEND_XR] || backend->sessionRunning;
+}
+
+uint32_t renderBackendBeginFrame(RenderBackend* backend) {
+    backend->frameViewCount = backend->ops->beginFrame(backend);
+    return backend->frameViewCount;
+}
+
+void renderBackendBindView(RenderBackend* backend, uint32_t view) {
+    backend->ops->bindView(backend, view);
+}
+
+void renderBackendEndFrame(RenderBackend* backend) {
+    backend->ops->endFrame(backend);
+    backend->frameViewCount = 0;
+}
@@ -0,0 +1,112 @@
+//
+// Where the demo scene (demo_scene.h) is rendered, chosen at startup instead of at build time
+// (the old TEST_ON_MOBILE switch):
+//   xr        - OpenXR session, one projection layer from a stereo array swapchain
+//   window    - EGL window surface on the activity's ANativeWindow, one view, swapped
+//   offscreen - no display: a fixed-size FBO per view, for measuring the scene on its own
+// Each backend owns its EGL context. A frame is renderBackendBeginFrame, then for each view it
+// returns renderBackendBindView and a draw with that view's viewProj, then
+// renderBackendEndFrame. A begin that returns 0 views still needs its end (XR submits an empty
+// frame).
+//
+
+#ifndef ANDROIDSAMSUNG_RENDERBACKEND_H
+#define ANDROIDSAMSUNG_RENDERBACKEND_H
+
+#include <EGL/egl.h>
+#include <GLES3/gl3.h>
+#include <cstdint>
+#include <vector>
+
+#include <openxr/openxr.h>
+
+#define RENDER_BACKEND_MAX_VIEWS 2
+
+struct ANativeWindow;
+
+enum RenderBackendKind {
+    RENDER_BACKEND_XR = 0,
+    RENDER_BACKEND_WINDOW,
+    RENDER_BACKEND_OFFSCREEN,
+    RENDER_BACKEND_COUNT,
+};
+
+struct RenderBackendConfig {
+    RenderBackendKind kind = RENDER_BACKEND_XR;
+    void* vm = nullptr;             // xr: JavaVM*
+    void* activity = nullptr;       // xr: the activity's jobject
+    ANativeWindow* window = nullptr; // window
+    uint32_t width = 1024;          // offscreen, per view
+    uint32_t height = 1024;
+    uint32_t viewCount = 2;
+};
+
+struct RenderView {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    float viewProj[16] = {};
+};
+
+struct RenderBackend;
+
+// One implementation per RenderBackendKind.
+struct RenderBackendOps {
+    const char* name;
+    bool (*init)(RenderBackend* backend, const RenderBackendConfig& config);
+    void (*destroy)(RenderBackend* backend);
+    void (*pollEvents)(RenderBackend* backend);
+    uint32_t (*beginFrame)(RenderBackend* backend);
+    void (*bindView)(RenderBackend* backend, uint32_t view);
+    void (*endFrame)(RenderBackend* backend);
+};
+
+struct RenderBackend {
+    const RenderBackendOps* ops = nullptr;
+    EGLDisplay display = EGL_NO_DISPLAY;
+    EGLConfig config = nullptr;
+    EGLContext context = EGL_NO_CONTEXT;
+    EGLSurface surface = EGL_NO_SURFACE;
+
+    RenderView views[RENDER_BACKEND_MAX_VIEWS];
+    uint32_t viewCount = 0;
+    // What renderBackendBeginFrame returned: views to draw this frame.
+    uint32_t frameViewCount = 0;
+    GLuint framebuffer = 0;
+    GLuint depthbuffer = 0;
+    GLuint colorTexture = 0; // offscreen: GL_TEXTURE_2D_ARRAY, one layer per view
+
+    // xr
+    XrInstance instance = XR_NULL_HANDLE;
+    XrSystemId systemId = XR_NULL_SYSTEM_ID;
+    XrSession session = XR_NULL_HANDLE;
+    XrSpace appSpace = XR_NULL_HANDLE;
+    XrSwapchain swapchain = XR_NULL_HANDLE;
+    std::vector<GLuint> swapchainImages;
+    uint32_t imageIndex = 0;
+    bool sessionRunning = false;
+    bool frameBegun = false; // xrBeginFrame called, xrEndFrame owed
+    XrSessionState sessionState = XR_SESSION_STATE_UNKNOWN;
+    XrFrameState frameState = {XR_TYPE_FRAME_STATE};
+    XrViewConfigurationView viewConfigViews[RENDER_BACKEND_MAX_VIEWS];
+    XrView xrViews[RENDER_BACKEND_MAX_VIEWS];
+    XrCompositionLayerProjectionView projectionViews[RENDER_BACKEND_MAX_VIEWS];
+};
+
+const char* renderBackendName(RenderBackendKind kind);
+// Accepts the names above; false leaves `kind` as it was.
+bool renderBackendParse(const char* name, RenderBackendKind* kind);
+
+// Creates the EGL context (current on the calling thread) and the backend's targets.
+bool renderBackendInit(RenderBackend* backend, const RenderBackendConfig& config);
+void renderBackendDestroy(RenderBackend* backend);
+
+// XR session events; nothing for the others.
+void renderBackendPollEvents(RenderBackend* backend);
+// Whether frames should be run at all: XR once the session is running.
+bool renderBackendActive(const RenderBackend* backend);
+
+uint32_t renderBackendBeginFrame(RenderBackend* backend);
+void renderBackendBindView(RenderBackend* backend, uint32_t view);
+void renderBackendEndFrame(RenderBackend* backend);
+
+#endif //ANDROIDSAMSUNG_RENDERBACKEND_H
@@ -0,0 +1,237 @@
+#include "session_lifecycle.h"
+
+#include <android/log.h>
+#include <cstdarg>
+#include <cstdio>
+#include <ctime>
+
+#define TAG "SessionLifecycle"
+
+static std::atomic<uint64_t> g_launchReferenceNs{0};
+
+static uint64_t nowNs() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+static const char* stateName(XrSessionState state) {
+    switch (state) {
+        case XR_SESSION_STATE_IDLE: return "IDLE";
+        case XR_SESSION_STATE_READY: return "READY";
+        case XR_SESSION_STATE_SYNCHRONIZED: return "SYNCHRONIZED";
+        case XR_SESSION_STATE_VISIBLE: return "VISIBLE";
+        case XR_SESSION_STATE_FOCUSED: return "FOCUSED";
+        case XR_SESSION_STATE_STOPPING: return "STOPPING";
+        case XR_SESSION_STATE_LOSS_PENDING: return "LOSS_PENDING";
+        case XR_SESSION_STATE_EXITING: return "EXITING";
+        default: return "UNKNOWN";
+    }
+}
+
+const char* sessionMilestoneName(SessionMilestone milestone) {
+    switch (milestone) {
+        case SESSION_MILESTONE_IDLE: return "idle";
+        case SESSION_MILESTONE_READY: return "ready";
+        case SESSION_MILESTONE_BEGUN: return "begun";
+        case SESSION_MILESTONE_FIRST_FRAME: return "first frame";
+        case SESSION_MILESTONE_SYNCHRONIZED: return "synchronized";
+        case SESSION_MILESTONE_VISIBLE: return "visible";
+        case SESSION_MILESTONE_FOCUSED: return "focused";
+        case SESSION_MILESTONE_STOPPING: return "stopping";
+        default: return "?";
+    }
+}
+
+// First time in this run only.
+static bool stamp(SessionLifecycle* lifecycle, SessionMilestone milestone, uint64_t ns) {
+    if (lifecycle->milestoneNs[milestone].load(std::memory_order_relaxed) != 0) {
+        return false;
+    }
+    lifecycle->milestoneNs[milestone].store(ns, std::memory_order_relaxed);
+    return true;
+}
+
+struct ReportWriter {
+    char* buffer;
+    size_t capacity;
+    size_t length;
+};
+
+__attribute__((format(printf, 2, 3)))
+static void append(ReportWriter* writer, const char* fmt, ...) {
+    if (writer->length + 1 >= writer->capacity) {
+        return;
+    }
+    va_list args;
+    va_start(args, fmt);
+    const int written = vsnprintf(writer->buffer + writer->length, writer->capacity - writer->length, fmt, args);
+    va_end(args);
+    if (written > 0) {
+        writer->length += static_cast<size_t>(written);
+        if (writer->length >= writer->capacity) {
+            writer->length = writer->capacity - 1;
+        }
+    }
+}
+
+static void logRun(const SessionLifecycle* lifecycle) {
+    char report[512];
+    sessionLifecycleFormat(lifecycle, report, sizeof(report));
+    __android_log_print(ANDROID_LOG_INFO, lifecycle->tag, "%s", report);
+}
+
+void sessionLifecycleInit(SessionLifecycle* lifecycle, XrSession session, XrViewConfigurationType viewConfigType,
+                          SessionEndPolicy endPolicy, const SessionCallbacks& callbacks, const char* tag) {
+    lifecycle->session = session;
+    lifecycle->viewConfigType = viewConfigType;
+    lifecycle->endPolicy = endPolicy;
+    lifecycle->callbacks = callbacks;
+    lifecycle->tag = tag ? tag : TAG;
+    lifecycle->state = XR_SESSION_STATE_UNKNOWN;
+    lifecycle->running = false;
+    lifecycle->begun = false;
+    lifecycle->frameSubmitted = false;
+    lifecycle->runs = 0;
+    for (auto& ns : lifecycle->milestoneNs) {
+        ns.store(0, std::memory_order_relaxed);
+    }
+}
+
+void sessionLifecycleStop(SessionLifecycle* lifecycle, bool endSession) {
+    if (lifecycle->running) {
+        lifecycle->running = false;
+        if (lifecycle->callbacks.stopped) {
+            lifecycle->callbacks.stopped(lifecycle->callbacks.user);
+        }
+    }
+    if (endSession && lifecycle->begun) {
+        const XrResult r = xrEndSession(lifecycle->session);
+        if (XR_FAILED(r)) {
+            __android_log_print(ANDROID_LOG_ERROR, lifecycle->tag, "xrEndSession failed: %d", r);
+        }
+        lifecycle->begun = false;
+    }
+}
+
+static void begin(SessionLifecycle* lifecycle) {
+    // A session kept across STOPPING (SESSION_END_ON_EXITING) is still begun.
+    if (!lifecycle->begun) {
+        XrSessionBeginInfo beginInfo = {XR_TYPE_SESSION_BEGIN_INFO};
+        beginInfo.primaryViewConfigurationType = lifecycle->viewConfigType;
+        const XrResult r = xrBeginSession(lifecycle->session, &beginInfo);
+        if (XR_FAILED(r)) {
+            __android_log_print(ANDROID_LOG_ERROR, lifecycle->tag, "xrBeginSession failed: %d", r);
+            return;
+        }
+        lifecycle->begun = true;
+    }
+    lifecycle->running = true;
+    lifecycle->frameSubmitted = false;
+    lifecycle->runs++;
+    stamp(lifecycle, SESSION_MILESTONE_BEGUN, nowNs());
+    if (lifecycle->callbacks.begun) {
+        lifecycle->callbacks.begun(lifecycle->callbacks.user);
+    }
+}
+
+void sessionLifecycleHandleState(SessionLifecycle* lifecycle, const XrEventDataSessionStateChanged& event) {
+    if (event.session != lifecycle->session) {
+        return;
+    }
+    const uint64_t ns = nowNs();
+    const XrSessionState previous = lifecycle->state;
+    lifecycle->state = event.state;
+    __android_log_print(ANDROID_LOG_INFO, lifecycle->tag, "Session %s -> %s", stateName(previous),
+                        stateName(event.state));
+
+    switch (event.state) {
+        case XR_SESSION_STATE_IDLE:
+            // A new run.
+            for (auto& milestone : lifecycle->milestoneNs) {
+                milestone.store(0, std::memory_order_relaxed);
+            }
+            stamp(lifecycle, SESSION_MILESTONE_IDLE, ns);
+            break;
+        case XR_SESSION_STATE_READY:
+            stamp(lifecycle, SESSION_MILESTONE_READY, ns);
+            begin(lifecycle);
+            break;
+        case XR_SESSION_STATE_SYNCHRONIZED:
+            stamp(lifecycle, SESSION_MILESTONE_SYNCHRONIZED, ns);
+            break;
+        case XR_SESSION_STATE_VISIBLE:
+            if (stamp(lifecycle, SESSION_MILESTONE_VISIBLE, ns)) {
+                logRun(lifecycle);
+            }
+            break;
+        case XR_SESSION_STATE_FOCUSED:
+            if (stamp(lifecycle, SESSION_MILESTONE_FOCUSED, ns)) {
+                logRun(lifecycle);
+            }
+            if (lifecycle->callbacks.focused) {
+                lifecycle->callbacks.focused(lifecycle->callbacks.user);
+            }
+            break;
+        case XR_SESSION_STATE_STOPPING:
+            stamp(lifecycle, SESSION_MILESTONE_STOPPING, ns);
+            sessionLifecycleStop(lifecycle, lifecycle->endPolicy == SESSION_END_ON_STOPPING);
+            break;
+        case XR_SESSION_STATE_LOSS_PENDING:
+        case XR_SESSION_STATE_EXITING:
+            sessionLifecycleStop(lifecycle, true);
+            if (lifecycle->callbacks.exiting) {
+                lifecycle->callbacks.exiting(lifecycle->callbacks.user);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void sessionLifecycleFirstFrame(SessionLifecycle* lifecycle) {
+    lifecycle->frameSubmitted = true;
+    stamp(lifecycle, SESSION_MILESTONE_FIRST_FRAME, nowNs());
+}
+
+uint64_t sessionLifecycleLatencyNs(const SessionLifecycle* lifecycle, SessionMilestone from, SessionMilestone to) {
+    const uint64_t fromNs = lifecycle->milestoneNs[from].load(std::memory_order_relaxed);
+    const uint64_t toNs = lifecycle->milestoneNs[to].load(std::memory_order_relaxed);
+    if (fromNs == 0 || toNs == 0 || toNs < fromNs) {
+        return 0;
+    }
+    return toNs - fromNs;
+}
+
+void sessionLifecycleSetLaunchReference(uint64_t baseFocusedNs) {
+    g_launchReferenceNs.store(baseFocusedNs, std::memory_order_relaxed);
+}
+
+size_t sessionLifecycleFormat(const SessionLifecycle* lifecycle, char* buffer, size_t capacity) {
+    if (capacity == 0) {
+        return 0;
+    }
+    buffer[0] = '\0';
+    ReportWriter writer = {buffer, capacity, 0};
+    append(&writer, "run %u:", lifecycle->runs);
+    // Relative to the earliest milestone reached (IDLE unless the run started before Init).
+    uint64_t originNs = 0;
+    for (const auto& milestone : lifecycle->milestoneNs) {
+        const uint64_t ns = milestone.load(std::memory_order_relaxed);
+        if (ns != 0 && (originNs == 0 || ns < originNs)) {
+            originNs = ns;
+        }
+    }
+    for (uint32_t i = 0; i < SESSION_MILESTONE_COUNT; ++i) {
+        const uint64_t ns = lifecycle->milestoneNs[i].load(std::memory_order_relaxed);
+        if (ns != 0) {
+            append(&writer, " %s +%.1fms", sessionMilestoneName(static_cast<SessionMilestone>(i)), (ns - originNs) / 1e6);
+        }
+    }
+    const uint64_t referenceNs = g_launchReferenceNs.load(std::memory_order_relaxed);
+    const uint64_t visibleNs = lifecycle->milestoneNs[SESSION_MILESTONE_VISIBLE].load(std::memory_order_relaxed);
+    if (referenceNs != 0 && visibleNs >= referenceNs) {
+        append(&writer, ", visible %.1fms after base focused", (visibleNs - referenceNs) / 1e6);
+    }
+    return writer.length;
+}
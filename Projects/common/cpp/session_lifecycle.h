@@ -0,0 +1,102 @@
+//
+// Shared OpenXR session lifecycle.
+//
+// One state machine for base and the overlays, driven by XrEventDataSessionStateChanged:
+// READY begins the session, STOPPING stops rendering, EXITING / LOSS_PENDING ends it. The only
+// per-app difference is when xrEndSession is called (SessionEndPolicy): the overlays end the
+// session as soon as it stops, base keeps it until EXITING.
+//
+// Every run is timestamped with CLOCK_MONOTONIC, which is system-wide, so base's FOCUSED can
+// be compared with an overlay's VISIBLE across processes:
+//   IDLE -> READY -> begun -> first frame with a layer -> SYNCHRONIZED -> VISIBLE -> FOCUSED
+// Each milestone is stamped the first time it is reached in a run; entering IDLE starts a new
+// run. The stamps are atomics so they can be read off the session thread (e.g. from JNI).
+//
+// Base launches the overlays when it reaches FOCUSED (the `focused` callback) and hands them that
+// time; an overlay's report then also gives its VISIBLE relative to it, the time to overlay visible.
+//
+
+#ifndef ANDROIDSAMSUNG_SESSIONLIFECYCLE_H
+#define ANDROIDSAMSUNG_SESSIONLIFECYCLE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <openxr/openxr.h>
+
+enum SessionMilestone {
+    SESSION_MILESTONE_IDLE = 0,
+    SESSION_MILESTONE_READY,
+    SESSION_MILESTONE_BEGUN,       // xrBeginSession succeeded
+    SESSION_MILESTONE_FIRST_FRAME, // first xrEndFrame with at least one layer
+    SESSION_MILESTONE_SYNCHRONIZED,
+    SESSION_MILESTONE_VISIBLE,
+    SESSION_MILESTONE_FOCUSED,
+    SESSION_MILESTONE_STOPPING,
+    SESSION_MILESTONE_COUNT,
+};
+
+enum SessionEndPolicy {
+    SESSION_END_ON_STOPPING, // xrEndSession when the runtime stops the session (overlays)
+    SESSION_END_ON_EXITING,  // keep the session across STOPPING, end it on EXITING (base)
+};
+
+// Called on the thread that handles the events; any may be null.
+struct SessionCallbacks {
+    void* user = nullptr;
+    void (*begun)(void* user) = nullptr;   // after xrBeginSession, before the first frame
+    void (*stopped)(void* user) = nullptr; // rendering stops; before any xrEndSession
+    void (*exiting)(void* user) = nullptr; // EXITING or LOSS_PENDING, after xrEndSession
+    void (*focused)(void* user) = nullptr; // every entry to FOCUSED, after its milestone is stamped
+};
+
+struct SessionLifecycle {
+    XrSession session = XR_NULL_HANDLE;
+    XrViewConfigurationType viewConfigType = XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO;
+    SessionEndPolicy endPolicy = SESSION_END_ON_STOPPING;
+    SessionCallbacks callbacks;
+    const char* tag = "Session";
+
+    XrSessionState state = XR_SESSION_STATE_UNKNOWN;
+    bool running = false; // frames may be submitted
+    bool begun = false;   // between xrBeginSession and xrEndSession
+    bool frameSubmitted = false;
+    uint32_t runs = 0;
+
+    std::atomic<uint64_t> milestoneNs[SESSION_MILESTONE_COUNT] = {}; // 0 = not reached this run
+};
+
+void sessionLifecycleInit(SessionLifecycle* lifecycle, XrSession session, XrViewConfigurationType viewConfigType,
+                          SessionEndPolicy endPolicy, const SessionCallbacks& callbacks, const char* tag);
+
+// Feeds a session state change (events for other sessions are ignored).
+void sessionLifecycleHandleState(SessionLifecycle* lifecycle, const XrEventDataSessionStateChanged& event);
+
+// Stops rendering outside the state machine, e.g. on instance loss; `endSession` also calls
+// xrEndSession if the session was begun.
+void sessionLifecycleStop(SessionLifecycle* lifecycle, bool endSession);
+
+void sessionLifecycleFirstFrame(SessionLifecycle* lifecycle);
+
+// Call after every xrEndFrame; only the first frame with layers does any work.
+inline void sessionLifecycleFrameEnded(SessionLifecycle* lifecycle, uint32_t layerCount) {
+    if (!lifecycle->frameSubmitted && layerCount > 0) {
+        sessionLifecycleFirstFrame(lifecycle);
+    }
+}
+
+// Time from `from` to `to` in this run, 0 if either wasn't reached.
+uint64_t sessionLifecycleLatencyNs(const SessionLifecycle* lifecycle, SessionMilestone from, SessionMilestone to);
+
+const char* sessionMilestoneName(SessionMilestone milestone);
+
+// Process-wide: base's FOCUSED (CLOCK_MONOTONIC ns) for an overlay base launched, 0 = not launched
+// by base. May be set from any thread, before or after Init.
+void sessionLifecycleSetLaunchReference(uint64_t baseFocusedNs);
+
+// Milestones of the current run relative to IDLE, for logs and dumpsys; with a launch reference
+// also VISIBLE relative to base's FOCUSED.
+size_t sessionLifecycleFormat(const SessionLifecycle* lifecycle, char* buffer, size_t capacity);
+
+#endif //ANDROIDSAMSUNG_SESSIONLIFECYCLE_H
@@ -0,0 +1,350 @@
+#include "state_channel.h"
+
+#include <android/log.h>
+#include <android/sharedmem.h>
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <new>
+
+#define TAG "StateChannel"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+static_assert((STATE_CHANNEL_RING_CAPACITY & (STATE_CHANNEL_RING_CAPACITY - 1)) == 0,
+              "capacity must be a power of two");
+
+uint64_t stateChannelNowNs() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+// --- Seqlock copies ---
+// The payload moves as relaxed atomic words, so a copy racing the writer is only ever torn (and
+// thrown away), never undefined.
+
+template <size_t N>
+static void storeWords(std::atomic<uint64_t> (&words)[N], const void* source) {
+    uint64_t values[N];
+    memcpy(values, source, sizeof(values));
+    for (size_t i = 0; i < N; ++i) {
+        words[i].store(values[i], std::memory_order_relaxed);
+    }
+}
+
+template <size_t N>
+static void loadWords(const std::atomic<uint64_t> (&words)[N], void* destination) {
+    uint64_t values[N];
+    for (size_t i = 0; i < N; ++i) {
+        values[i] = words[i].load(std::memory_order_relaxed);
+    }
+    memcpy(destination, values, sizeof(values));
+}
+
+// --- Writer ---
+
+bool stateChannelCreate(StateChannel* channel) {
+    *channel = StateChannel();
+    const size_t size = sizeof(StateChannelRegion);
+    const int fd = ASharedMemory_create("overlay_state", size);
+    if (fd < 0) {
+        LOGE("ASharedMemory_create failed: %s", strerror(errno));
+        return false;
+    }
+    void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapping == MAP_FAILED) {
+        LOGE("mmap of the state region failed: %s", strerror(errno));
+        close(fd);
+        return false;
+    }
+    // The mapping above stays writable; every one made from the fd from now on is read-only.
+    if (ASharedMemory_setProt(fd, PROT_READ) != 0) {
+        LOGE("Cannot make the state region read-only for readers");
+    }
+    auto* region = new (mapping) StateChannelRegion();
+    region->magic = STATE_CHANNEL_MAGIC;
+    region->version = STATE_CHANNEL_VERSION;
+    region->ringCapacity = STATE_CHANNEL_RING_CAPACITY;
+    region->snapshotSize = sizeof(StateSnapshot);
+    channel->region = region;
+    channel->size = size;
+    channel->fd = fd;
+    channel->writer = true;
+    return true;
+}
+
+// Sends the region's fd to every pending connection, then hangs up on it.
+static int onReaderConnecting(int listenFd, int events, void* data) {
+    auto* channel = static_cast<StateChannel*>(data);
+    if (events & (ALOOPER_EVENT_ERROR | ALOOPER_EVENT_HANGUP)) {
+        LOGE("State channel socket failed, no more readers");
+        return 0;
+    }
+    for (;;) {
+        const int connection = accept4(listenFd, nullptr, nullptr, SOCK_CLOEXEC);
+        if (connection < 0) {
+            break;
+        }
+        uint32_t version = STATE_CHANNEL_VERSION;
+        iovec iov = {&version, sizeof(version)};
+        alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+        msghdr message = {};
+        message.msg_iov = &iov;
+        message.msg_iovlen = 1;
+        message.msg_control = control;
+        message.msg_controllen = sizeof(control);
+        cmsghdr* header = CMSG_FIRSTHDR(&message);
+        header->cmsg_level = SOL_SOCKET;
+        header->cmsg_type = SCM_RIGHTS;
+        header->cmsg_len = CMSG_LEN(sizeof(int));
+        memcpy(CMSG_DATA(header), &channel->fd, sizeof(int));
+        if (sendmsg(connection, &message, MSG_NOSIGNAL) == static_cast<ssize_t>(sizeof(version))) {
+            ++channel->readersServed;
+            LOGI("State channel handed to reader %llu", static_cast<unsigned long long>(channel->readersServed));
+        } else {
+            LOGE("Cannot send the state channel: %s", strerror(errno));
+        }
+        close(connection);
+    }
+    return 1;
+}
+
+static socklen_t abstractAddress(const char* socketName, sockaddr_un* address) {
+    memset(address, 0, sizeof(*address));
+    address->sun_family = AF_UNIX;
+    // sun_path[0] stays 0: the abstract namespace, nothing on the file system.
+    const size_t length = strnlen(socketName, sizeof(address->sun_path) - 1);
+    memcpy(address->sun_path + 1, socketName, length);
+    return static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + 1 + length);
+}
+
+bool stateChannelServe(StateChannel* channel, ALooper* looper, const char* socketName) {
+    if (!channel->writer || channel->listenFd >= 0) {
+        return false;
+    }
+    const int listenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listenFd < 0) {
+        LOGE("State channel socket failed: %s", strerror(errno));
+        return false;
+    }
+    sockaddr_un address;
+    const socklen_t addressLength = abstractAddress(socketName, &address);
+    if (bind(listenFd, reinterpret_cast<const sockaddr*>(&address), addressLength) != 0 ||
+        listen(listenFd, 8) != 0) {
+        LOGE("Cannot serve the state channel on @%s: %s", socketName, strerror(errno));
+        close(listenFd);
+        return false;
+    }
+    if (ALooper_addFd(looper, listenFd, ALOOPER_POLL_CALLBACK, ALOOPER_EVENT_INPUT, onReaderConnecting, channel) != 1) {
+        LOGE("ALooper_addFd failed for the state channel socket");
+        close(listenFd);
+        return false;
+    }
+    channel->listenFd = listenFd;
+    channel->looper = looper;
+    LOGI("Serving the state channel on @%s", socketName);
+    return true;
+}
+
+void stateChannelPublish(StateChannel* channel, const StateSnapshot& snapshot) {
+    StateChannelRegion* region = channel->region;
+    if (!region) {
+        return;
+    }
+    StateSnapshot stamped = snapshot;
+    stamped.publishedNs = stateChannelNowNs();
+    const uint64_t sequence = region->snapshotSequence.load(std::memory_order_relaxed);
+    region->snapshotSequence.store(sequence + 1, std::memory_order_relaxed);
+    // Keeps the odd sequence ahead of the words: a reader seeing any new word sees it odd or moved on.
+    std::atomic_thread_fence(std::memory_order_release);
+    storeWords(region->snapshotWords, &stamped);
+    region->snapshotSequence.store(sequence + 2, std::memory_order_release);
+}
+
+void stateChannelPush(StateChannel* channel, const StateMessage& message) {
+    StateChannelRegion* region = channel->region;
+    if (!region) {
+        return;
+    }
+    StateMessage stamped = message;
+    stamped.publishedNs = stateChannelNowNs();
+    const uint64_t index = region->head.load(std::memory_order_relaxed);
+    StateChannelSlot& slot = region->slots[index & (STATE_CHANNEL_RING_CAPACITY - 1)];
+    slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    storeWords(slot.words, &stamped);
+    slot.sequence.store(2 * index + 2, std::memory_order_release);
+    region->head.store(index + 1, std::memory_order_release);
+}
+
+void stateChannelPushText(StateChannel* channel, StateKey key, const char* text) {
+    StateMessage message;
+    message.type = STATE_MESSAGE_TEXT;
+    message.key = key;
+    snprintf(message.value.text, sizeof(message.value.text), "%s", text);
+    stateChannelPush(channel, message);
+}
+
+void stateChannelPushCounter(StateChannel* channel, StateKey key, int64_t counter) {
+    StateMessage message;
+    message.type = STATE_MESSAGE_COUNTER;
+    message.key = key;
+    message.value.counter = counter;
+    stateChannelPush(channel, message);
+}
+
+// --- Readers ---
+
+bool stateChannelMap(StateChannel* channel, int fd) {
+    *channel = StateChannel();
+    const size_t size = ASharedMemory_getSize(fd);
+    if (size < sizeof(StateChannelRegion)) {
+        LOGE("State region is %zu bytes, expected %zu", size, sizeof(StateChannelRegion));
+        close(fd);
+        return false;
+    }
+    void* mapping = mmap(nullptr, sizeof(StateChannelRegion), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        LOGE("mmap of the state region failed: %s", strerror(errno));
+        return false;
+    }
+    auto* region = static_cast<StateChannelRegion*>(mapping);
+    if (region->magic != STATE_CHANNEL_MAGIC || region->version != STATE_CHANNEL_VERSION ||
+        region->ringCapacity != STATE_CHANNEL_RING_CAPACITY || region->snapshotSize != sizeof(StateSnapshot)) {
+        LOGE("State region format %08x v%u doesn't match this build's", region->magic, region->version);
+        munmap(mapping, sizeof(StateChannelRegion));
+        return false;
+    }
+    channel->region = region;
+    channel->size = sizeof(StateChannelRegion);
+    channel->next = region->head.load(std::memory_order_acquire);
+    return true;
+}
+
+bool stateChannelConnect(StateChannel* channel, const char* socketName, int timeoutMs) {
+    const int connection = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (connection < 0) {
+        return false;
+    }
+    timeval timeout = {timeoutMs / 1000, (timeoutMs % 1000) * 1000};
+    setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    sockaddr_un address;
+    const socklen_t addressLength = abstractAddress(socketName, &address);
+    if (connect(connection, reinterpret_cast<const sockaddr*>(&address), addressLength) != 0) {
+        LOGI("No state channel on @%s: %s", socketName, strerror(errno));
+        close(connection);
+        return false;
+    }
+    uint32_t version = 0;
+    iovec iov = {&version, sizeof(version)};
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+    msghdr message = {};
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+    const ssize_t received = recvmsg(connection, &message, MSG_CMSG_CLOEXEC);
+    close(connection);
+    int fd = -1;
+    const cmsghdr* header = received > 0 ? CMSG_FIRSTHDR(&message) : nullptr;
+    if (header && header->cmsg_level == SOL_SOCKET && header->cmsg_type == SCM_RIGHTS) {
+        memcpy(&fd, CMSG_DATA(header), sizeof(int));
+    }
+    if (fd < 0) {
+        LOGE("No state channel fd from @%s: %s", socketName, received < 0 ? strerror(errno) : "none sent");
+        return false;
+    }
+    if (received != static_cast<ssize_t>(sizeof(version)) || version != STATE_CHANNEL_VERSION) {
+        LOGE("State channel v%u, expected v%u", version, STATE_CHANNEL_VERSION);
+        close(fd);
+        return false;
+    }
+    return stateChannelMap(channel, fd);
+}
+
+uint64_t stateChannelRead(StateChannel* channel, StateSnapshot* snapshot) {
+    const StateChannelRegion* region = channel->region;
+    if (!region) {
+        return 0;
+    }
+    for (int attempt = 0; attempt < STATE_SNAPSHOT_READ_ATTEMPTS; ++attempt) {
+        const uint64_t before = region->snapshotSequence.load(std::memory_order_acquire);
+        if (before == 0) {
+            return 0;
+        }
+        if (before & 1) {
+            ++channel->tornSnapshots;
+            continue;
+        }
+        StateSnapshot copy;
+        loadWords(region->snapshotWords, &copy);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (region->snapshotSequence.load(std::memory_order_relaxed) == before) {
+            *snapshot = copy;
+            return before / 2;
+        }
+        ++channel->tornSnapshots;
+    }
+    return 0;
+}
+
+// Moves a reader that fell more than the ring behind `head` up to the oldest message it can still get.
+static void skipLapped(StateChannel* channel, uint64_t head) {
+    if (head - channel->next > STATE_CHANNEL_RING_CAPACITY) {
+        channel->lost += head - STATE_CHANNEL_RING_CAPACITY - channel->next;
+        channel->next = head - STATE_CHANNEL_RING_CAPACITY;
+    }
+}
+
+uint32_t stateChannelPoll(StateChannel* channel, StateMessage* messages, uint32_t maxMessages) {
+    const StateChannelRegion* region = channel->region;
+    if (!region) {
+        return 0;
+    }
+    const uint64_t head = region->head.load(std::memory_order_acquire);
+    skipLapped(channel, head);
+    uint32_t count = 0;
+    while (count < maxMessages && channel->next < head) {
+        const uint64_t index = channel->next++;
+        const StateChannelSlot& slot = region->slots[index & (STATE_CHANNEL_RING_CAPACITY - 1)];
+        const uint64_t whole = 2 * index + 2;
+        // Anything else: the writer has moved on to a later message in this slot.
+        bool intact = slot.sequence.load(std::memory_order_acquire) == whole;
+        if (intact) {
+            loadWords(slot.words, &messages[count]);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            intact = slot.sequence.load(std::memory_order_relaxed) == whole;
+        }
+        if (intact) {
+            ++count;
+            continue;
+        }
+        // Lapped mid-poll: the slots after this one are being overwritten too, so skip to the
+        // oldest message still whole rather than failing on each.
+        ++channel->lost;
+        skipLapped(channel, region->head.load(std::memory_order_acquire));
+    }
+    return count;
+}
+
+void stateChannelDestroy(StateChannel* channel) {
+    if (channel->listenFd >= 0) {
+        ALooper_removeFd(channel->looper, channel->listenFd);
+        close(channel->listenFd);
+    }
+    if (channel->fd >= 0) {
+        close(channel->fd);
+    }
+    if (channel->region) {
+        munmap(channel->region, channel->size);
+    }
+    *channel = StateChannel();
+}
@@ -0,0 +1,168 @@
+//
+// Live state from base to the overlays through shared memory.
+//
+// Base creates one region (ASharedMemory: ashmem, or a memfd on the host) and is its only writer.
+// The overlays map it read-only and keep their read positions in their own memory, so any number of
+// them can read without coordinating with base or with each other. The region holds:
+//   - the latest-value slot: a StateSnapshot (frame, display time, head pose, text) behind a
+//     seqlock. The writer makes the sequence odd, copies the snapshot in, then makes it even. A
+//     reader copies the snapshot out and keeps the copy only if the sequence was even and didn't
+//     change. Base publishes one every frame, and readers only care about the newest.
+//   - a message ring: fixed 64-byte StateMessages (counters, poses, text) that every reader
+//     consumes at its own pace. Each slot has a sequence like the snapshot. A reader the writer
+//     has lapped skips ahead and counts what it lost; the writer never waits.
+// Publishing is a handful of stores into the mapping: no system call, no Binder, no allocation.
+//
+// The fd reaches the overlays once. Base serves it on an abstract Unix socket from its looper,
+// and each overlay connects and receives it with SCM_RIGHTS. Whoever connects gets a read-only fd.
+// Where SELinux keeps apps from connecting to each other's sockets, stateChannelConnect fails and
+// the overlay runs without live state. The format is the build's own (native endianness,
+// fixed layout), checked by magic and version when mapping.
+//
+
+#ifndef ANDROIDSAMSUNG_STATECHANNEL_H
+#define ANDROIDSAMSUNG_STATECHANNEL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <android/looper.h>
+
+// Abstract socket base serves the region's fd on.
+#define STATE_CHANNEL_SOCKET "com.example.androidsamsung.state"
+// Power of two; over 2 s of messages at 90 Hz with a few per frame.
+#define STATE_CHANNEL_RING_CAPACITY 1024
+#define STATE_CHANNEL_MAGIC 0x5453564fu // "OVST"
+#define STATE_CHANNEL_VERSION 1u
+// A reader gives up on the snapshot after this many torn copies in one read, rather than
+// spinning on the render thread.
+#define STATE_SNAPSHOT_READ_ATTEMPTS 8
+
+#define STATE_TEXT_MAX 64
+#define STATE_MESSAGE_TEXT_MAX 48
+
+// --- Format ---
+
+enum StateSnapshotFlags : uint32_t {
+    STATE_SNAPSHOT_HEAD_VALID = 1u << 0,
+};
+
+struct StateSnapshot {
+    uint64_t frame = 0;                      // base frames submitted
+    int64_t displayTime = 0;                 // XrTime the frame is predicted to be displayed at
+    uint64_t publishedNs = 0;                // CLOCK_MONOTONIC, stamped by stateChannelPublish
+    float headPosition[3] = {};              // LOCAL space, between the views
+    float headOrientation[4] = {0, 0, 0, 1}; // x, y, z, w
+    uint32_t flags = 0;                      // StateSnapshotFlags
+    char text[STATE_TEXT_MAX] = {};          // NUL-terminated
+};
+
+enum StateMessageType : uint16_t {
+    STATE_MESSAGE_COUNTER = 1, // value.counter
+    STATE_MESSAGE_POSE = 2,    // value.pose
+    STATE_MESSAGE_TEXT = 3,    // value.text, NUL-terminated
+};
+
+// What a message is about; readers skip keys they don't know.
+enum StateKey : uint16_t {
+    STATE_KEY_FRAME_STATS = 1, // TEXT: base's once-a-second frame stats line
+    STATE_KEY_LATE_FRAMES = 2, // COUNTER: base frames late in that second
+};
+
+// text first, so `= {}` zeroes all of it.
+union StateMessageValue {
+    char text[STATE_MESSAGE_TEXT_MAX];
+    int64_t counter;
+    struct {
+        float position[3];
+        float orientation[4];
+    } pose;
+};
+
+struct StateMessage {
+    uint16_t type = 0; // StateMessageType
+    uint16_t key = 0;  // StateKey
+    uint32_t reserved = 0;
+    uint64_t publishedNs = 0; // CLOCK_MONOTONIC, stamped by stateChannelPush
+    StateMessageValue value = {};
+};
+
+#define STATE_SNAPSHOT_WORDS (sizeof(StateSnapshot) / sizeof(uint64_t))
+#define STATE_MESSAGE_WORDS (sizeof(StateMessage) / sizeof(uint64_t))
+
+static_assert(sizeof(StateSnapshot) % sizeof(uint64_t) == 0, "snapshot is copied in words");
+static_assert(sizeof(StateMessage) == 64, "fixed message size");
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "atomics in shared memory must be lock-free");
+
+// Message `index` lives in slots[index % STATE_CHANNEL_RING_CAPACITY]. Its sequence is
+// 2 * index + 1 while it is written and 2 * index + 2 once it is whole.
+struct StateChannelSlot {
+    std::atomic<uint64_t> sequence{0};
+    std::atomic<uint64_t> words[STATE_MESSAGE_WORDS];
+};
+
+struct StateChannelRegion {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t ringCapacity;
+    uint32_t snapshotSize;
+
+    // Twice the snapshots published, odd while one is written; 0 = none yet.
+    alignas(64) std::atomic<uint64_t> snapshotSequence;
+    std::atomic<uint64_t> snapshotWords[STATE_SNAPSHOT_WORDS];
+
+    // Messages ever pushed.
+    alignas(64) std::atomic<uint64_t> head;
+    StateChannelSlot slots[STATE_CHANNEL_RING_CAPACITY];
+};
+
+// --- Channel ---
+
+struct StateChannel {
+    StateChannelRegion* region = nullptr;
+    size_t size = 0;
+    bool writer = false;
+
+    // Writer: the region's fd, read-only for new mappings, and the socket serving it.
+    int fd = -1;
+    int listenFd = -1;
+    ALooper* looper = nullptr;
+    uint64_t readersServed = 0;
+
+    // Reader: next message to read, and what it couldn't.
+    uint64_t next = 0;
+    uint64_t lost = 0;
+    uint64_t tornSnapshots = 0;
+};
+
+uint64_t stateChannelNowNs();
+
+// Without a region (create, map or connect failed) the writer and reader calls below do nothing.
+
+// --- Writer (base) ---
+bool stateChannelCreate(StateChannel* channel);
+// Hands the fd to every reader connecting to `socketName`, from a callback on `looper` (the
+// app's main looper, pumped by the frame loop).
+bool stateChannelServe(StateChannel* channel, ALooper* looper, const char* socketName);
+// Stamps publishedNs on the published copy. Render thread only, like stateChannelPush.
+void stateChannelPublish(StateChannel* channel, const StateSnapshot& snapshot);
+void stateChannelPush(StateChannel* channel, const StateMessage& message);
+// Cut to STATE_MESSAGE_TEXT_MAX - 1 bytes.
+void stateChannelPushText(StateChannel* channel, StateKey key, const char* text);
+void stateChannelPushCounter(StateChannel* channel, StateKey key, int64_t counter);
+
+// --- Readers (overlays) ---
+// Maps `fd` read-only and takes it. Reading starts at the messages pushed after this.
+bool stateChannelMap(StateChannel* channel, int fd);
+// Receives the fd from the writer serving `socketName` and maps it; waits at most `timeoutMs`.
+bool stateChannelConnect(StateChannel* channel, const char* socketName, int timeoutMs);
+// Copies the latest snapshot. Returns how many snapshots had been published when it was (so a
+// caller sees whether it changed), 0 if none has been or no whole copy could be made.
+uint64_t stateChannelRead(StateChannel* channel, StateSnapshot* snapshot);
+// Copies up to `maxMessages` of the messages not read yet, oldest first. Returns the number copied.
+uint32_t stateChannelPoll(StateChannel* channel, StateMessage* messages, uint32_t maxMessages);
+
+void stateChannelDestroy(StateChannel* channel);
+
+#endif //ANDROIDSAMSUNG_STATECHANNEL_H
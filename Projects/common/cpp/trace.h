@@ -0,0 +1,60 @@
+//
+// Trace markers for the frame loop: polling, waiting, beginning, rendering each view, releasing
+// and ending a frame, and startup.
+//
+// On the device they are ATrace sections (<android/trace.h>), the same trace the runtime's
+// compositor writes to, so Perfetto shows our frames against its timeline. They are recorded for
+// the packages a Perfetto config lists in atrace_apps (com.example.androidsamsung for base, ...);
+// while nothing is recording ATrace skips them.
+// On the host the shim of that header (host/shims/android/trace.h) buffers them instead and writes
+// Chrome trace JSON.
+//
+// Built with TRACE_MARKERS=0 (CMake option / ndk-build variable of the same name) the macros
+// expand to nothing and <android/trace.h> isn't included.
+//
+// Sections nest per thread and must end on the thread that began them. Names are copied.
+//
+
+#ifndef ANDROIDSAMSUNG_TRACE_H
+#define ANDROIDSAMSUNG_TRACE_H
+
+#include <cstdint>
+
+#ifndef TRACE_MARKERS
+#define TRACE_MARKERS 1
+#endif
+
+#if TRACE_MARKERS
+
+#include <android/trace.h>
+
+struct TraceScope {
+    explicit TraceScope(const char* name) { ATrace_beginSection(name); }
+    ~TraceScope() { ATrace_endSection(); }
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+};
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+// A section from here to the end of the enclosing block.
+#define TRACE_SCOPE(name) TraceScope TRACE_CONCAT(traceScope, __LINE__)(name)
+// For sections that don't fit a block, such as startup.
+#define TRACE_BEGIN(name) ATrace_beginSection(name)
+#define TRACE_END() ATrace_endSection()
+
+#else
+
+#define TRACE_SCOPE(name) static_cast<void>(0)
+#define TRACE_BEGIN(name) static_cast<void>(0)
+#define TRACE_END() static_cast<void>(0)
+
+#endif
+
+// Section name for rendering `view`, so the eyes tell apart in the trace.
+inline const char* traceViewSection(uint32_t view) {
+    static const char* const kNames[] = {"render view 0", "render view 1"};
+    return view < sizeof(kNames) / sizeof(kNames[0]) ? kNames[view] : "render view";
+}
+
+#endif //ANDROIDSAMSUNG_TRACE_H
@@ -0,0 +1,241 @@
+#include "upload_thread.h"
+
+#include <android/log.h>
+#include <cstring>
+
+#define TAG "UploadThread"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+static uint32_t bytesPerPixel(GLenum format, GLenum type) {
+    uint32_t components = 4;
+    switch (format) {
+        case GL_RED: components = 1; break;
+        case GL_RG: components = 2; break;
+        case GL_RGB: components = 3; break;
+        default: break;
+    }
+    switch (type) {
+        case GL_UNSIGNED_SHORT:
+        case GL_HALF_FLOAT: return components * 2;
+        case GL_FLOAT: return components * 4;
+        case GL_UNSIGNED_SHORT_5_6_5:
+        case GL_UNSIGNED_SHORT_4_4_4_4:
+        case GL_UNSIGNED_SHORT_5_5_5_1: return 2;
+        default: return components;
+    }
+}
+
+// Shared names, so either context may delete them.
+static void deleteName(UploadRequest* request) {
+    if (request->target == GL_TEXTURE_2D) {
+        glDeleteTextures(1, &request->name);
+    } else {
+        glDeleteBuffers(1, &request->name);
+    }
+    request->name = 0;
+}
+
+// --- Upload thread side ---
+
+static bool uploadBuffer(UploadThread* uploader, UploadRequest* request) {
+    glGenBuffers(1, &request->name);
+    glBindBuffer(request->target, request->name);
+    glBufferData(request->target, static_cast<GLsizeiptr>(request->size), nullptr, request->usage);
+    const uint8_t* bytes = static_cast<const uint8_t*>(request->data);
+    for (size_t offset = 0; offset < request->size; offset += UPLOAD_CHUNK_BYTES) {
+        const size_t chunk = request->size - offset > UPLOAD_CHUNK_BYTES ? UPLOAD_CHUNK_BYTES : request->size - offset;
+        glBufferSubData(request->target, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(chunk), bytes + offset);
+        glFlush();
+    }
+    glBindBuffer(request->target, 0);
+    uploader->uploadedBytes.fetch_add(request->size, std::memory_order_relaxed);
+    return true;
+}
+
+static bool uploadTexture(UploadThread* uploader, UploadRequest* request) {
+    GLsizei levels = 1;
+    if (request->mipmaps) {
+        for (uint32_t size = request->width > request->height ? request->width : request->height; size > 1; size >>= 1) {
+            ++levels;
+        }
+    }
+    glGenTextures(1, &request->name);
+    glBindTexture(GL_TEXTURE_2D, request->name);
+    glTexStorage2D(GL_TEXTURE_2D, levels, request->internalFormat, request->width, request->height);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    const uint32_t rowBytes = request->width * bytesPerPixel(request->format, request->type);
+    uint32_t bandRows = rowBytes ? UPLOAD_CHUNK_BYTES / rowBytes : request->height;
+    if (bandRows == 0) {
+        bandRows = 1;
+    }
+    const uint8_t* bytes = static_cast<const uint8_t*>(request->data);
+    for (uint32_t y = 0; y < request->height; y += bandRows) {
+        const uint32_t rows = request->height - y > bandRows ? bandRows : request->height - y;
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, y, request->width, rows, request->format, request->type,
+                        bytes + static_cast<size_t>(y) * rowBytes);
+        glFlush();
+    }
+    if (levels > 1) {
+        glGenerateMipmap(GL_TEXTURE_2D);
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    uploader->uploadedBytes.fetch_add(static_cast<uint64_t>(rowBytes) * request->height, std::memory_order_relaxed);
+    return true;
+}
+
+static void process(UploadThread* uploader, UploadRequest* request) {
+    const bool ok = request->target == GL_TEXTURE_2D ? uploadTexture(uploader, request) : uploadBuffer(uploader, request);
+    if (request->release) {
+        request->release(request->data);
+    }
+    const GLenum error = glGetError();
+    if (!ok || error != GL_NO_ERROR) {
+        LOGE("Upload of %s %u failed: 0x%X", request->target == GL_TEXTURE_2D ? "texture" : "buffer", request->name,
+             error);
+        deleteName(request);
+        request->state.store(UPLOAD_FAILED, std::memory_order_release);
+        return;
+    }
+    // Flushed so the fence can signal without anyone waiting on it from this context.
+    request->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();
+    request->state.store(UPLOAD_FENCED, std::memory_order_release);
+}
+
+static void threadMain(UploadThread* uploader) {
+    if (!eglMakeCurrent(uploader->display, uploader->surface, uploader->surface, uploader->context)) {
+        LOGE("eglMakeCurrent failed on the upload thread: 0x%X", eglGetError());
+        std::lock_guard<std::mutex> lock(uploader->mutex);
+        uploader->stopRequested = true;
+    }
+
+    for (;;) {
+        UploadRequest* request;
+        {
+            std::unique_lock<std::mutex> lock(uploader->mutex);
+            uploader->cond.wait(lock, [uploader] { return uploader->queueCount > 0 || uploader->stopRequested; });
+            if (uploader->stopRequested) {
+                break;
+            }
+            request = uploader->queue[uploader->queueFront];
+            uploader->queueFront = (uploader->queueFront + 1) % UPLOAD_QUEUE_SIZE;
+            uploader->queueCount--;
+        }
+        process(uploader, request);
+    }
+    eglMakeCurrent(uploader->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+}
+
+// --- Render thread side ---
+
+bool uploadThreadStart(UploadThread* uploader, EGLDisplay display, EGLConfig config, EGLContext renderContext) {
+    if (uploader->running) {
+        return true;
+    }
+    const EGLint contextAttribs[] = {EGL_CONTEXT_CLIENT_VERSION, 3, EGL_NONE};
+    uploader->context = eglCreateContext(display, config, renderContext, contextAttribs);
+    if (uploader->context == EGL_NO_CONTEXT) {
+        LOGE("Shared upload context creation failed: 0x%X", eglGetError());
+        return false;
+    }
+    uploader->display = display;
+    uploader->config = config;
+
+    // Surfaceless where EGL_KHR_surfaceless_context is available, otherwise a 1x1 pbuffer.
+    const char* extensions = eglQueryString(display, EGL_EXTENSIONS);
+    if (extensions == nullptr || strstr(extensions, "EGL_KHR_surfaceless_context") == nullptr) {
+        const EGLint pbufferAttribs[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+        uploader->surface = eglCreatePbufferSurface(display, config, pbufferAttribs);
+        if (uploader->surface == EGL_NO_SURFACE) {
+            LOGE("No surfaceless contexts and pbuffer creation failed: 0x%X", eglGetError());
+            eglDestroyContext(display, uploader->context);
+            uploader->context = EGL_NO_CONTEXT;
+            return false;
+        }
+    }
+
+    uploader->queueFront = 0;
+    uploader->queueCount = 0;
+    uploader->stopRequested = false;
+    uploader->thread = std::thread(threadMain, uploader);
+    uploader->running = true;
+    LOGI("Upload thread started (%s)", uploader->surface == EGL_NO_SURFACE ? "surfaceless" : "pbuffer");
+    return true;
+}
+
+void uploadThreadStop(UploadThread* uploader) {
+    if (!uploader->running) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(uploader->mutex);
+        uploader->stopRequested = true;
+        uploader->cond.notify_all();
+    }
+    uploader->thread.join();
+    uploader->running = false;
+
+    for (uint32_t i = 0; i < uploader->queueCount; ++i) {
+        uploader->queue[(uploader->queueFront + i) % UPLOAD_QUEUE_SIZE]->state.store(UPLOAD_FAILED);
+    }
+    uploader->queueCount = 0;
+    if (uploader->surface != EGL_NO_SURFACE) {
+        eglDestroySurface(uploader->display, uploader->surface);
+        uploader->surface = EGL_NO_SURFACE;
+    }
+    eglDestroyContext(uploader->display, uploader->context);
+    uploader->context = EGL_NO_CONTEXT;
+    LOGI("Upload thread stopped after %llu bytes",
+         (unsigned long long)uploader->uploadedBytes.load(std::memory_order_relaxed));
+}
+
+bool uploadThreadSubmit(UploadThread* uploader, UploadRequest* request) {
+    // Once a request has left PENDING the upload thread is done with it.
+    if (request->state.load(std::memory_order_acquire) == UPLOAD_PENDING) {
+        LOGE("Upload of %p is still in flight", request->data);
+        return false;
+    }
+    request->name = 0;
+    request->fence = nullptr;
+    request->state.store(UPLOAD_PENDING, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(uploader->mutex);
+        if (uploader->running && !uploader->stopRequested && uploader->queueCount < UPLOAD_QUEUE_SIZE) {
+            uploader->queue[(uploader->queueFront + uploader->queueCount) % UPLOAD_QUEUE_SIZE] = request;
+            uploader->queueCount++;
+            uploader->cond.notify_one();
+            return true;
+        }
+    }
+    LOGE("Upload queue full or stopped");
+    request->state.store(UPLOAD_FAILED, std::memory_order_relaxed);
+    return false;
+}
+
+bool uploadRequestReady(UploadRequest* request) {
+    const uint32_t state = request->state.load(std::memory_order_acquire);
+    if (state == UPLOAD_READY) {
+        return true;
+    }
+    if (state != UPLOAD_FENCED) {
+        return false;
+    }
+    const GLenum result = glClientWaitSync(request->fence, 0, 0);
+    if (result == GL_TIMEOUT_EXPIRED) {
+        return false;
+    }
+    glDeleteSync(request->fence);
+    request->fence = nullptr;
+    if (result == GL_WAIT_FAILED) {
+        LOGE("glClientWaitSync failed for %u: 0x%X", request->name, glGetError());
+        deleteName(request);
+        request->state.store(UPLOAD_FAILED, std::memory_order_relaxed);
+        return false;
+    }
+    request->state.store(UPLOAD_READY, std::memory_order_relaxed);
+    return true;
+}
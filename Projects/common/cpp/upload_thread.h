@@ -0,0 +1,94 @@
+//
+// Asynchronous GL resource uploads.
+//
+// A worker thread owns an EGL context shared with the render context and streams buffer and
+// texture data into GL objects there, so large loads never run on the render thread. Each
+// finished upload is fenced (glFenceSync + glFlush). The render thread polls the fence without
+// blocking (uploadRequestReady) and only uses the object once the fence has signalled. GL
+// names and sync objects are shared across the share group; container objects such as VAOs
+// and FBOs are not, so those are built on the render thread from the uploaded buffers.
+//
+// Requests are owned by the caller and must stay put until they are ready or failed. Data
+// is read on the upload thread, so it too must outlive the upload. When `release` is set, the
+// upload thread calls it once the data has been copied into GL, for buffers it hands over.
+//
+
+#ifndef ANDROIDSAMSUNG_UPLOADTHREAD_H
+#define ANDROIDSAMSUNG_UPLOADTHREAD_H
+
+#include <EGL/egl.h>
+#include <GLES3/gl3.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#define UPLOAD_QUEUE_SIZE 64
+// Buffers and texture bands are copied in pieces of at most this size with a flush between,
+// so one big resource doesn't monopolize the driver queue the compositor also feeds.
+#define UPLOAD_CHUNK_BYTES (1u << 20)
+
+enum UploadState : uint32_t {
+    UPLOAD_IDLE = 0,    // never submitted
+    UPLOAD_PENDING,     // queued or being copied
+    UPLOAD_FENCED,      // copied; waiting for the fence
+    UPLOAD_READY,       // safe to use on the render thread
+    UPLOAD_FAILED,
+};
+
+struct UploadRequest {
+    // GL_ARRAY_BUFFER / GL_ELEMENT_ARRAY_BUFFER / ... for buffers, GL_TEXTURE_2D for textures.
+    GLenum target = GL_ARRAY_BUFFER;
+    const void* data = nullptr;
+    size_t size = 0;             // buffers: bytes
+    GLenum usage = GL_STATIC_DRAW;
+
+    uint32_t width = 0;          // textures: tightly packed rows of `format`/`type`
+    uint32_t height = 0;
+    GLenum internalFormat = GL_RGBA8;
+    GLenum format = GL_RGBA;
+    GLenum type = GL_UNSIGNED_BYTE;
+    bool mipmaps = false;
+
+    void (*release)(const void* data) = nullptr;
+
+    // Results.
+    GLuint name = 0;
+    GLsync fence = nullptr;
+    std::atomic<uint32_t> state{UPLOAD_IDLE};
+};
+
+struct UploadThread {
+    EGLDisplay display = EGL_NO_DISPLAY;
+    EGLContext context = EGL_NO_CONTEXT; // shared with the render context
+    EGLSurface surface = EGL_NO_SURFACE; // 1x1 pbuffer when surfaceless isn't supported
+    EGLConfig config = nullptr;
+    std::thread thread;
+
+    std::mutex mutex;
+    std::condition_variable cond;
+    UploadRequest* queue[UPLOAD_QUEUE_SIZE];
+    uint32_t queueFront = 0;
+    uint32_t queueCount = 0;
+    bool running = false;
+    bool stopRequested = false;
+
+    std::atomic<uint64_t> uploadedBytes{0};
+};
+
+// Call on the render thread with its context current: creates the shared context and starts
+// the thread.
+bool uploadThreadStart(UploadThread* uploader, EGLDisplay display, EGLConfig config, EGLContext renderContext);
+// Joins the thread. Requests still queued are marked failed; finished ones keep their objects.
+void uploadThreadStop(UploadThread* uploader);
+
+// Queues `request`; false (and the request is marked failed) if the queue is full or stopped.
+// A request that is still pending is left alone: false, and the upload in flight carries on.
+bool uploadThreadSubmit(UploadThread* uploader, UploadRequest* request);
+
+// Render thread: true once the request's object may be used. Never blocks.
+bool uploadRequestReady(UploadRequest* request);
+
+#endif //ANDROIDSAMSUNG_UPLOADTHREAD_H
@@ -0,0 +1,113 @@
+#include "xr_events.h"
+
+#include <android/log.h>
+
+#include "trace.h"
+
+#define TAG "XrEvents"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+// --- Default handlers ---
+
+static void onEventsLost(void*, const XrEventDataEventsLost& event) {
+    LOGE("Runtime dropped %u events", event.lostEventCount);
+}
+
+static void onReferenceSpaceChangePending(void*, const XrEventDataReferenceSpaceChangePending& event) {
+    LOGI("Reference space %d changes at %lld (pose valid: %d)", event.referenceSpaceType,
+         (long long)event.changeTime, event.poseValid);
+}
+
+static void onInteractionProfileChanged(void*, const XrEventDataInteractionProfileChanged&) {
+    LOGI("Interaction profile changed");
+}
+
+void xrEventsInit(XrEventDispatcher* events, void* user) {
+    events->user = user;
+    for (XrEventHandler& handler : events->table) {
+        handler = nullptr;
+    }
+    events->extensionCount = 0;
+    events->dispatched = 0;
+    events->unhandled = 0;
+    events->lastResult = XR_SUCCESS;
+
+    xrEventsOn<onEventsLost>(events);
+    xrEventsOn<onReferenceSpaceChangePending>(events);
+    xrEventsOn<onInteractionProfileChanged>(events);
+}
+
+bool xrEventsSetHandler(XrEventDispatcher* events, XrStructureType type, XrEventHandler handler) {
+    if (type >= 0 && type < XR_EVENTS_TABLE_SIZE) {
+        events->table[type] = handler;
+        return true;
+    }
+    for (uint32_t i = 0; i < events->extensionCount; ++i) {
+        if (events->extensionTypes[i] == type) {
+            events->extensionHandlers[i] = handler;
+            return true;
+        }
+    }
+    if (handler == nullptr) {
+        return true;
+    }
+    if (events->extensionCount == XR_EVENTS_MAX_EXTENSION_HANDLERS) {
+        LOGE("No room for a handler for event type %d", type);
+        return false;
+    }
+    events->extensionTypes[events->extensionCount] = type;
+    events->extensionHandlers[events->extensionCount] = handler;
+    events->extensionCount++;
+    return true;
+}
+
+void xrEventsDispatch(XrEventDispatcher* events, const XrEventDataBuffer* event) {
+    const XrStructureType type = event->type;
+    XrEventHandler handler = nullptr;
+    if (type >= 0 && type < XR_EVENTS_TABLE_SIZE) {
+        handler = events->table[type];
+    } else {
+        for (uint32_t i = 0; i < events->extensionCount; ++i) {
+            if (events->extensionTypes[i] == type) {
+                handler = events->extensionHandlers[i];
+                break;
+            }
+        }
+    }
+    if (handler == nullptr) {
+        events->unhandled++;
+        return;
+    }
+    handler(events->user, event);
+    events->dispatched++;
+}
+
+uint32_t xrEventsPoll(XrEventDispatcher* events, XrInstance instance) {
+    if (instance == XR_NULL_HANDLE) {
+        return 0;
+    }
+    TRACE_SCOPE("xrPollEvent");
+    uint32_t total = 0;
+    for (;;) {
+        // Drain first so handlers (which may call into the runtime) run outside the poll loop.
+        uint32_t count = 0;
+        while (count < XR_EVENTS_BATCH_CAPACITY) {
+            XrEventDataBuffer* event = &events->batch[count];
+            event->type = XR_TYPE_EVENT_DATA_BUFFER;
+            event->next = nullptr;
+            events->lastResult = xrPollEvent(instance, event);
+            if (events->lastResult != XR_SUCCESS) {
+                break;
+            }
+            count++;
+        }
+        for (uint32_t i = 0; i < count; ++i) {
+            xrEventsDispatch(events, &events->batch[i]);
+        }
+        total += count;
+        if (count < XR_EVENTS_BATCH_CAPACITY) {
+            return total;
+        }
+    }
+}
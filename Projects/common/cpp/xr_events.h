@@ -0,0 +1,91 @@
+//
+// Table-driven OpenXR event dispatch.
+//
+// xrEventsPoll drains every pending event into a fixed batch, then routes each one through a
+// handler table indexed by XrStructureType (core event types are all below
+// XR_EVENTS_TABLE_SIZE; extension events go through a short list). Handlers are typed:
+//
+//     static void onSessionStateChanged(AppState* app, const XrEventDataSessionStateChanged& e);
+//     xrEventsOn<onSessionStateChanged>(&appState.events);
+//
+// Nothing is logged per event. Events without a handler are only counted. xrEventsInit
+// installs defaults for the events the apps have no use for beyond a note in the log:
+// interaction profile changes, reference space changes and lost events.
+//
+
+#ifndef ANDROIDSAMSUNG_XREVENTS_H
+#define ANDROIDSAMSUNG_XREVENTS_H
+
+#include <cstdint>
+
+#include <openxr/openxr.h>
+
+// Events drained per xrPollEvent burst before they are dispatched (4 KB each).
+#define XR_EVENTS_BATCH_CAPACITY 8
+// Core XrStructureType values below this get a direct table slot.
+#define XR_EVENTS_TABLE_SIZE 64
+#define XR_EVENTS_MAX_EXTENSION_HANDLERS 8
+
+typedef void (*XrEventHandler)(void* user, const XrEventDataBuffer* event);
+
+struct XrEventDispatcher {
+    void* user = nullptr;
+    XrEventHandler table[XR_EVENTS_TABLE_SIZE] = {};
+    XrStructureType extensionTypes[XR_EVENTS_MAX_EXTENSION_HANDLERS] = {};
+    XrEventHandler extensionHandlers[XR_EVENTS_MAX_EXTENSION_HANDLERS] = {};
+    uint32_t extensionCount = 0;
+
+    XrEventDataBuffer batch[XR_EVENTS_BATCH_CAPACITY];
+
+    uint64_t dispatched = 0;
+    uint64_t unhandled = 0;
+    XrResult lastResult = XR_SUCCESS; // of the last xrPollEvent, XR_EVENT_UNAVAILABLE normally
+};
+
+// `user` is passed to every handler (the app's AppState).
+void xrEventsInit(XrEventDispatcher* events, void* user);
+// Installs (or with nullptr removes) the handler for `type`.
+bool xrEventsSetHandler(XrEventDispatcher* events, XrStructureType type, XrEventHandler handler);
+// Drains and dispatches all pending events; returns how many there were.
+uint32_t xrEventsPoll(XrEventDispatcher* events, XrInstance instance);
+// Dispatches one already polled event.
+void xrEventsDispatch(XrEventDispatcher* events, const XrEventDataBuffer* event);
+
+// --- Typed handlers ---
+
+template <typename T> struct XrEventType;
+template <> struct XrEventType<XrEventDataEventsLost> {
+    static constexpr XrStructureType value = XR_TYPE_EVENT_DATA_EVENTS_LOST;
+};
+template <> struct XrEventType<XrEventDataInstanceLossPending> {
+    static constexpr XrStructureType value = XR_TYPE_EVENT_DATA_INSTANCE_LOSS_PENDING;
+};
+template <> struct XrEventType<XrEventDataSessionStateChanged> {
+    static constexpr XrStructureType value = XR_TYPE_EVENT_DATA_SESSION_STATE_CHANGED;
+};
+template <> struct XrEventType<XrEventDataReferenceSpaceChangePending> {
+    static constexpr XrStructureType value = XR_TYPE_EVENT_DATA_REFERENCE_SPACE_CHANGE_PENDING;
+};
+template <> struct XrEventType<XrEventDataInteractionProfileChanged> {
+    static constexpr XrStructureType value = XR_TYPE_EVENT_DATA_INTERACTION_PROFILE_CHANGED;
+};
+
+template <typename F> struct XrEventHandlerSignature;
+template <typename U, typename T> struct XrEventHandlerSignature<void (*)(U*, const T&)> {
+    using User = U;
+    using Event = T;
+};
+
+// Registers `Handler`, a void(User*, const XrEventData...&), for its event type.
+template <auto Handler>
+bool xrEventsOn(XrEventDispatcher* events) {
+    using Signature = XrEventHandlerSignature<decltype(Handler)>;
+    using User = typename Signature::User;
+    using Event = typename Signature::Event;
+    return xrEventsSetHandler(events, XrEventType<Event>::value,
+                              [](void* user, const XrEventDataBuffer* event) {
+                                  Handler(static_cast<User*>(user), *reinterpret_cast<const Event*>(event));
+                              });
+}
+
+#endif //ANDROIDSAMSUNG_XREVENTS_H
@@ -0,0 +1,572 @@
+#include "xr_timing_layer.h"
+
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <sys/syscall.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include <android/log.h>
+#include <sys/system_properties.h>
+
+#include <openxr/openxr.h>
+#include <openxr/openxr_reflection.h>
+
+#define TAG "XrTimingLayer"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+#define LAYER_EXPORT extern "C" __attribute__((visibility("default")))
+
+// --- Loader interface ---
+// From the loader's loader_interfaces.h, which the vendored headers don't include. The layout is
+// fixed by the loader/layer interface version 1.
+
+enum XrLoaderInterfaceStructs {
+    XR_LOADER_INTERFACE_STRUCT_UNINTIALIZED = 0,
+    XR_LOADER_INTERFACE_STRUCT_LOADER_INFO,
+    XR_LOADER_INTERFACE_STRUCT_API_LAYER_REQUEST,
+    XR_LOADER_INTERFACE_STRUCT_RUNTIME_REQUEST,
+    XR_LOADER_INTERFACE_STRUCT_API_LAYER_CREATE_INFO,
+    XR_LOADER_INTERFACE_STRUCT_API_LAYER_NEXT_INFO,
+};
+
+#define XR_LOADER_INFO_STRUCT_VERSION 1
+#define XR_API_LAYER_INFO_STRUCT_VERSION 1
+#define XR_API_LAYER_NEXT_INFO_STRUCT_VERSION 1
+#define XR_API_LAYER_CREATE_INFO_STRUCT_VERSION 1
+#define XR_API_LAYER_MAX_SETTINGS_PATH_SIZE 512
+#define XR_CURRENT_LOADER_API_LAYER_VERSION 1
+
+struct XrNegotiateLoaderInfo {
+    XrLoaderInterfaceStructs structType;
+    uint32_t structVersion;
+    size_t structSize;
+    uint32_t minInterfaceVersion;
+    uint32_t maxInterfaceVersion;
+    XrVersion minApiVersion;
+    XrVersion maxApiVersion;
+};
+
+struct XrApiLayerCreateInfo;
+typedef XrResult(XRAPI_PTR* PFN_xrCreateApiLayerInstance)(const XrInstanceCreateInfo* info,
+                                                           const XrApiLayerCreateInfo* apiLayerInfo,
+                                                           XrInstance* instance);
+
+struct XrNegotiateApiLayerRequest {
+    XrLoaderInterfaceStructs structType;
+    uint32_t structVersion;
+    size_t structSize;
+    uint32_t layerInterfaceVersion;
+    XrVersion layerApiVersion;
+    PFN_xrGetInstanceProcAddr getInstanceProcAddr;
+    PFN_xrCreateApiLayerInstance createApiLayerInstance;
+};
+
+struct XrApiLayerNextInfo {
+    XrLoaderInterfaceStructs structType;
+    uint32_t structVersion;
+    size_t structSize;
+    char layerName[XR_MAX_API_LAYER_NAME_SIZE];
+    PFN_xrGetInstanceProcAddr nextGetInstanceProcAddr;
+    PFN_xrCreateApiLayerInstance nextCreateApiLayerInstance;
+    XrApiLayerNextInfo* next;
+};
+
+struct XrApiLayerCreateInfo {
+    XrLoaderInterfaceStructs structType;
+    uint32_t structVersion;
+    size_t structSize;
+    void* loaderInstance;
+    char settings_file_location[XR_API_LAYER_MAX_SETTINGS_PATH_SIZE];
+    XrApiLayerNextInfo* nextInfo;
+};
+
+// --- Stats ---
+
+enum TimingCall : uint8_t {
+    TIMING_WAIT_FRAME,
+    TIMING_BEGIN_FRAME,
+    TIMING_ACQUIRE_SWAPCHAIN_IMAGE,
+    TIMING_WAIT_SWAPCHAIN_IMAGE,
+    TIMING_RELEASE_SWAPCHAIN_IMAGE,
+    TIMING_LOCATE_VIEWS,
+    TIMING_END_FRAME,
+    TIMING_CALL_COUNT,
+};
+
+static const char* const kCallNames[TIMING_CALL_COUNT] = {
+        "xrWaitFrame",
+        "xrBeginFrame",
+        "xrAcquireSwapchainImage",
+        "xrWaitSwapchainImage",
+        "xrReleaseSwapchainImage",
+        "xrLocateViews",
+        "xrEndFrame",
+};
+
+#define NO_RESULT INT32_MIN
+
+struct TimingResult {
+    std::atomic<int32_t> result{NO_RESULT};
+    std::atomic<uint64_t> count{0};
+};
+
+struct TimingStats {
+    std::atomic<uint64_t> calls{0};
+    std::atomic<uint64_t> totalNs{0};
+    std::atomic<uint64_t> maxNs{0};
+    std::atomic<uint64_t> buckets[XR_TIMING_LAYER_BUCKETS] = {};
+    TimingResult results[XR_TIMING_LAYER_MAX_RESULTS];
+    std::atomic<uint64_t> otherResults{0}; // once the result slots are taken
+};
+
+struct TimingEvent {
+    uint64_t startNs;
+    uint32_t durationNs;
+    int32_t result;
+    uint32_t tid;
+    TimingCall call;
+};
+
+struct TimingLayer {
+    XrInstance instance = XR_NULL_HANDLE;
+    PFN_xrGetInstanceProcAddr nextGetInstanceProcAddr = nullptr;
+    PFN_xrDestroyInstance nextDestroyInstance = nullptr;
+    PFN_xrWaitFrame nextWaitFrame = nullptr;
+    PFN_xrBeginFrame nextBeginFrame = nullptr;
+    PFN_xrAcquireSwapchainImage nextAcquireSwapchainImage = nullptr;
+    PFN_xrWaitSwapchainImage nextWaitSwapchainImage = nullptr;
+    PFN_xrReleaseSwapchainImage nextReleaseSwapchainImage = nullptr;
+    PFN_xrLocateViews nextLocateViews = nullptr;
+    PFN_xrEndFrame nextEndFrame = nullptr;
+
+    TimingStats stats[TIMING_CALL_COUNT];
+    std::vector<TimingEvent> events; // ring, sized at creation
+    std::atomic<uint64_t> eventCount{0};
+};
+
+// One instance per process, as every app has. Wrapped calls hold a LayerRef while they use it,
+// so xrDestroyInstance can take it away and free it once the calls still inside have returned.
+static std::atomic<TimingLayer*> g_layer{nullptr};
+static std::atomic<uint32_t> g_callsInFlight{0};
+
+struct LayerRef {
+    TimingLayer* layer;
+    // Sequentially consistent with timingDestroyInstance: either it sees this call in flight,
+    // or this call sees the layer gone.
+    LayerRef() {
+        g_callsInFlight.fetch_add(1);
+        layer = g_layer.load();
+    }
+    ~LayerRef() { g_callsInFlight.fetch_sub(1, std::memory_order_release); }
+};
+
+static uint64_t nowNs() {
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static uint32_t threadId() {
+    static thread_local uint32_t tid = static_cast<uint32_t>(syscall(SYS_gettid));
+    return tid;
+}
+
+static uint32_t bucketOf(uint64_t ns) {
+    const uint64_t us = ns / 1000;
+    uint32_t bucket = 0;
+    while (bucket < XR_TIMING_LAYER_BUCKETS - 1 && (us >> bucket) != 0) {
+        ++bucket;
+    }
+    return bucket;
+}
+
+// Exclusive upper bound of a bucket in microseconds.
+static uint64_t bucketLimitUs(uint32_t bucket) {
+    return 1ull << bucket;
+}
+
+static void countResult(TimingStats* stats, XrResult result) {
+    for (TimingResult& slot : stats->results) {
+        int32_t current = slot.result.load(std::memory_order_relaxed);
+        // A free slot is claimed; losing the race leaves `current` with the winner's result.
+        if (current == NO_RESULT && slot.result.compare_exchange_strong(current, result, std::memory_order_relaxed)) {
+            current = result;
+        }
+        if (current == result) {
+            slot.count.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+    stats->otherResults.fetch_add(1, std::memory_order_relaxed);
+}
+
+static void recordCall(TimingLayer* layer, TimingCall call, uint64_t startNs, XrResult result) {
+    const uint64_t durationNs = nowNs() - startNs;
+    TimingStats& stats = layer->stats[call];
+    stats.calls.fetch_add(1, std::memory_order_relaxed);
+    stats.totalNs.fetch_add(durationNs, std::memory_order_relaxed);
+    stats.buckets[bucketOf(durationNs)].fetch_add(1, std::memory_order_relaxed);
+    uint64_t max = stats.maxNs.load(std::memory_order_relaxed);
+    while (durationNs > max && !stats.maxNs.compare_exchange_weak(max, durationNs, std::memory_order_relaxed)) {
+    }
+    countResult(&stats, result);
+
+    const uint64_t index = layer->eventCount.fetch_add(1, std::memory_order_relaxed);
+    TimingEvent& event = layer->events[index % layer->events.size()];
+    event.startNs = startNs;
+    event.durationNs = static_cast<uint32_t>(durationNs > UINT32_MAX ? UINT32_MAX : durationNs);
+    event.result = result;
+    event.tid = threadId();
+    event.call = call;
+}
+
+// --- Report ---
+
+static const char* resultName(int32_t result) {
+    switch (result) {
+#define RESULT_NAME(name, value) \
+        case value:               \
+            return #name;
+        XR_LIST_ENUM_XrResult(RESULT_NAME)
+#undef RESULT_NAME
+        default:
+            return nullptr;
+    }
+}
+
+static void printResult(FILE* out, int32_t result) {
+    const char* name = resultName(result);
+    if (name) {
+        fputs(name, out);
+    } else {
+        fprintf(out, "%d", result);
+    }
+}
+
+// Upper bound of the bucket holding quantile q.
+static uint64_t quantileUs(const TimingStats& stats, double q) {
+    const uint64_t calls = stats.calls.load(std::memory_order_relaxed);
+    const uint64_t rank = static_cast<uint64_t>(q * calls);
+    uint64_t seen = 0;
+    for (uint32_t bucket = 0; bucket < XR_TIMING_LAYER_BUCKETS; ++bucket) {
+        seen += stats.buckets[bucket].load(std::memory_order_relaxed);
+        if (seen > rank) {
+            return bucketLimitUs(bucket);
+        }
+    }
+    return bucketLimitUs(XR_TIMING_LAYER_BUCKETS - 1);
+}
+
+static void logSummary(const TimingLayer* layer) {
+    for (uint32_t call = 0; call < TIMING_CALL_COUNT; ++call) {
+        const TimingStats& stats = layer->stats[call];
+        const uint64_t calls = stats.calls.load(std::memory_order_relaxed);
+        if (calls == 0) {
+            continue;
+        }
+        uint64_t failures = stats.otherResults.load(std::memory_order_relaxed);
+        for (const TimingResult& slot : stats.results) {
+            const int32_t result = slot.result.load(std::memory_order_relaxed);
+            if (result != NO_RESULT && result != XR_SUCCESS) {
+                failures += slot.count.load(std::memory_order_relaxed);
+            }
+        }
+        LOGI("%s: %" PRIu64 " calls, mean %.1f us, p50 < %" PRIu64 " us, p99 < %" PRIu64
+             " us, max %.1f us, %" PRIu64 " not XR_SUCCESS",
+             kCallNames[call], calls, stats.totalNs.load(std::memory_order_relaxed) / 1e3 / calls,
+             quantileUs(stats, 0.5), quantileUs(stats, 0.99), stats.maxNs.load(std::memory_order_relaxed) / 1e3,
+             failures);
+    }
+}
+
+static bool writeTrace(const TimingLayer* layer, const char* path) {
+    FILE* out = fopen(path, "w");
+    if (!out) {
+        return false;
+    }
+    const uint64_t count = layer->eventCount.load(std::memory_order_relaxed);
+    const uint64_t capacity = layer->events.size();
+    const uint64_t first = count > capacity ? count - capacity : 0;
+    const int pid = getpid();
+    fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    for (uint64_t i = first; i < count; ++i) {
+        const TimingEvent& event = layer->events[i % capacity];
+        fprintf(out, "%s\n{\"name\":\"%s\",\"cat\":\"xr\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%u,"
+                     "\"args\":{\"result\":\"",
+                i == first ? "" : ",", kCallNames[event.call], event.startNs / 1e3, event.durationNs / 1e3, pid,
+                event.tid);
+        printResult(out, event.result);
+        fprintf(out, "\"}}");
+    }
+    fprintf(out, "\n],\"xrTiming\":{");
+    bool firstCall = true;
+    for (uint32_t call = 0; call < TIMING_CALL_COUNT; ++call) {
+        const TimingStats& stats = layer->stats[call];
+        const uint64_t calls = stats.calls.load(std::memory_order_relaxed);
+        if (calls == 0) {
+            continue;
+        }
+        fprintf(out, "%s\n\"%s\":{\"calls\":%" PRIu64 ",\"totalUs\":%.3f,\"maxUs\":%.3f,\"bucketLimitsUs\":[",
+                firstCall ? "" : ",", kCallNames[call], calls, stats.totalNs.load(std::memory_order_relaxed) / 1e3,
+                stats.maxNs.load(std::memory_order_relaxed) / 1e3);
+        firstCall = false;
+        for (uint32_t bucket = 0; bucket < XR_TIMING_LAYER_BUCKETS; ++bucket) {
+            fprintf(out, "%s%" PRIu64, bucket ? "," : "", bucketLimitUs(bucket));
+        }
+        fprintf(out, "],\"buckets\":[");
+        for (uint32_t bucket = 0; bucket < XR_TIMING_LAYER_BUCKETS; ++bucket) {
+            fprintf(out, "%s%" PRIu64, bucket ? "," : "", stats.buckets[bucket].load(std::memory_order_relaxed));
+        }
+        fprintf(out, "],\"results\":{");
+        bool firstResult = true;
+        for (const TimingResult& slot : stats.results) {
+            const int32_t result = slot.result.load(std::memory_order_relaxed);
+            if (result == NO_RESULT) {
+                continue;
+            }
+            fprintf(out, "%s\"", firstResult ? "" : ",");
+            printResult(out, result);
+            fprintf(out, "\":%" PRIu64, slot.count.load(std::memory_order_relaxed));
+            firstResult = false;
+        }
+        const uint64_t other = stats.otherResults.load(std::memory_order_relaxed);
+        if (other) {
+            fprintf(out, "%s\"other\":%" PRIu64, firstResult ? "" : ",", other);
+        }
+        fprintf(out, "}}");
+    }
+    fprintf(out, "\n}}\n");
+    return fclose(out) == 0;
+}
+
+// --- Wrapped calls ---
+
+static XrResult XRAPI_CALL timingWaitFrame(XrSession session, const XrFrameWaitInfo* frameWaitInfo,
+                                           XrFrameState* frameState) {
+    const LayerRef ref;
+    if (ref.layer == nullptr) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    const uint64_t start = nowNs();
+    const XrResult result = ref.layer->nextWaitFrame(session, frameWaitInfo, frameState);
+    recordCall(ref.layer, TIMING_WAIT_FRAME, start, result);
+    return result;
+}
+
+static XrResult XRAPI_CALL timingBeginFrame(XrSession session, const XrFrameBeginInfo* frameBeginInfo) {
+    const LayerRef ref;
+    if (ref.layer == nullptr) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    const uint64_t start = nowNs();
+    const XrResult result = ref.layer->nextBeginFrame(session, frameBeginInfo);
+    recordCall(ref.layer, TIMING_BEGIN_FRAME, start, result);
+    return result;
+}
+
+static XrResult XRAPI_CALL timingAcquireSwapchainImage(XrSwapchain swapchain,
+                                                       const XrSwapchainImageAcquireInfo* acquireInfo,
+                                                       uint32_t* index) {
+    const LayerRef ref;
+    if (ref.layer == nullptr) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    const uint64_t start = nowNs();
+    const XrResult result = ref.layer->nextAcquireSwapchainImage(swapchain, acquireInfo, index);
+    recordCall(ref.layer, TIMING_ACQUIRE_SWAPCHAIN_IMAGE, start, result);
+    return result;
+}
+
+static XrResult XRAPI_CALL timingWaitSwapchainImage(XrSwapchain swapchain, const XrSwapchainImageWaitInfo* waitInfo) {
+    const LayerRef ref;
+    if (ref.layer == nullptr) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    const uint64_t start = nowNs();
+    const XrResult result = ref.layer->nextWaitSwapchainImage(swapchain, waitInfo);
+    recordCall(ref.layer, TIMING_WAIT_SWAPCHAIN_IMAGE, start, result);
+    return result;
+}
+
+static XrResult XRAPI_CALL timingReleaseSwapchainImage(XrSwapchain swapchain,
+                                                       const XrSwapchainImageReleaseInfo* releaseInfo) {
+    const LayerRef ref;
+    if (ref.layer == nullptr) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    const uint64_t start = nowNs();
+    const XrResult result = ref.layer->nextReleaseSwapchainImage(swapchain, releaseInfo);
+    recordCall(ref.layer, TIMING_RELEASE_SWAPCHAIN_IMAGE, start, result);
+    return result;
+}
+
+static XrResult XRAPI_CALL timingLocateViews(XrSession session, const XrViewLocateInfo* viewLocateInfo,
+                                             XrViewState* viewState, uint32_t viewCapacityInput,
+                                             uint32_t* viewCountOutput, XrView* views) {
+    const LayerRef ref;
+    if (ref.layer == nullptr) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    const uint64_t start = nowNs();
+    const XrResult result =
+            ref.layer->nextLocateViews(session, viewLocateInfo, viewState, viewCapacityInput, viewCountOutput, views);
+    recordCall(ref.layer, TIMING_LOCATE_VIEWS, start, result);
+    return result;
+}
+
+static XrResult XRAPI_CALL timingEndFrame(XrSession session, const XrFrameEndInfo* frameEndInfo) {
+    const LayerRef ref;
+    if (ref.layer == nullptr) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    const uint64_t start = nowNs();
+    const XrResult result = ref.layer->nextEndFrame(session, frameEndInfo);
+    recordCall(ref.layer, TIMING_END_FRAME, start, result);
+    return result;
+}
+
+static XrResult XRAPI_CALL timingDestroyInstance(XrInstance instance) {
+    TimingLayer* layer = g_layer.load();
+    if (layer == nullptr || instance != layer->instance) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    // Calls that start from here on fail; the ones already inside are waited out, so the
+    // report holds still and nothing touches the layer once it is freed.
+    g_layer.store(nullptr);
+    while (g_callsInFlight.load() != 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    logSummary(layer);
+    char path[PROP_VALUE_MAX] = {};
+    if (__system_property_get(XR_TIMING_LAYER_TRACE_PROPERTY, path) > 0) {
+        if (writeTrace(layer, path)) {
+            LOGI("Wrote %" PRIu64 " calls to %s", layer->eventCount.load(std::memory_order_relaxed), path);
+        } else {
+            LOGE("Cannot write %s", path);
+        }
+    }
+    const XrResult result = layer->nextDestroyInstance(instance);
+    delete layer;
+    return result;
+}
+
+// --- Dispatch ---
+
+static XrResult XRAPI_CALL timingGetInstanceProcAddr(XrInstance instance, const char* name,
+                                                     PFN_xrVoidFunction* function);
+
+struct TimingFunction {
+    const char* name;
+    PFN_xrVoidFunction function;
+};
+
+#define TIMING_FUNCTION(name) {"xr" #name, reinterpret_cast<PFN_xrVoidFunction>(timing##name)}
+
+static const TimingFunction kFunctions[] = {
+        TIMING_FUNCTION(GetInstanceProcAddr),
+        TIMING_FUNCTION(DestroyInstance),
+        TIMING_FUNCTION(WaitFrame),
+        TIMING_FUNCTION(BeginFrame),
+        TIMING_FUNCTION(AcquireSwapchainImage),
+        TIMING_FUNCTION(WaitSwapchainImage),
+        TIMING_FUNCTION(ReleaseSwapchainImage),
+        TIMING_FUNCTION(LocateViews),
+        TIMING_FUNCTION(EndFrame),
+};
+
+static XrResult XRAPI_CALL timingGetInstanceProcAddr(XrInstance instance, const char* name,
+                                                     PFN_xrVoidFunction* function) {
+    if (name == nullptr || function == nullptr) {
+        return XR_ERROR_VALIDATION_FAILURE;
+    }
+    const LayerRef ref;
+    if (ref.layer == nullptr) {
+        *function = nullptr;
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    for (const TimingFunction& entry : kFunctions) {
+        if (strcmp(entry.name, name) == 0) {
+            *function = entry.function;
+            return XR_SUCCESS;
+        }
+    }
+    return ref.layer->nextGetInstanceProcAddr(instance, name, function);
+}
+
+template <typename Function>
+static bool resolve(TimingLayer* layer, const char* name, Function* function) {
+    return XR_SUCCEEDED(layer->nextGetInstanceProcAddr(layer->instance, name,
+                                                       reinterpret_cast<PFN_xrVoidFunction*>(function)));
+}
+
+static XrResult XRAPI_CALL timingCreateApiLayerInstance(const XrInstanceCreateInfo* info,
+                                                        const XrApiLayerCreateInfo* apiLayerInfo,
+                                                        XrInstance* instance) {
+    if (apiLayerInfo == nullptr || apiLayerInfo->nextInfo == nullptr ||
+        strcmp(apiLayerInfo->nextInfo->layerName, XR_TIMING_LAYER_NAME) != 0) {
+        return XR_ERROR_INITIALIZATION_FAILED;
+    }
+    if (g_layer.load() != nullptr) {
+        LOGE("Only one instance at a time is timed");
+        return XR_ERROR_LIMIT_REACHED;
+    }
+    // Down the chain, with this layer's entry taken off.
+    XrApiLayerCreateInfo nextLayerInfo = *apiLayerInfo;
+    nextLayerInfo.nextInfo = apiLayerInfo->nextInfo->next;
+    const XrResult result = apiLayerInfo->nextInfo->nextCreateApiLayerInstance(info, &nextLayerInfo, instance);
+    if (XR_FAILED(result)) {
+        return result;
+    }
+
+    auto* layer = new TimingLayer();
+    layer->instance = *instance;
+    layer->nextGetInstanceProcAddr = apiLayerInfo->nextInfo->nextGetInstanceProcAddr;
+    layer->events.resize(XR_TIMING_LAYER_TRACE_EVENTS);
+    if (!resolve(layer, "xrDestroyInstance", &layer->nextDestroyInstance) ||
+        !resolve(layer, "xrWaitFrame", &layer->nextWaitFrame) ||
+        !resolve(layer, "xrBeginFrame", &layer->nextBeginFrame) ||
+        !resolve(layer, "xrAcquireSwapchainImage", &layer->nextAcquireSwapchainImage) ||
+        !resolve(layer, "xrWaitSwapchainImage", &layer->nextWaitSwapchainImage) ||
+        !resolve(layer, "xrReleaseSwapchainImage", &layer->nextReleaseSwapchainImage) ||
+        !resolve(layer, "xrLocateViews", &layer->nextLocateViews) ||
+        !resolve(layer, "xrEndFrame", &layer->nextEndFrame)) {
+        LOGE("Next in chain is missing frame-loop functions");
+        if (layer->nextDestroyInstance) {
+            layer->nextDestroyInstance(*instance);
+        }
+        delete layer;
+        *instance = XR_NULL_HANDLE;
+        return XR_ERROR_INITIALIZATION_FAILED;
+    }
+    g_layer.store(layer);
+    LOGI("Timing the frame-loop calls");
+    return XR_SUCCESS;
+}
+
+LAYER_EXPORT XrResult xrNegotiateLoaderApiLayerInterface(const XrNegotiateLoaderInfo* loaderInfo,
+                                                         const char* layerName,
+                                                         XrNegotiateApiLayerRequest* apiLayerRequest) {
+    if (loaderInfo == nullptr || apiLayerRequest == nullptr || layerName == nullptr ||
+        strcmp(layerName, XR_TIMING_LAYER_NAME) != 0 ||
+        loaderInfo->structType != XR_LOADER_INTERFACE_STRUCT_LOADER_INFO ||
+        loaderInfo->structVersion != XR_LOADER_INFO_STRUCT_VERSION ||
+        loaderInfo->structSize != sizeof(XrNegotiateLoaderInfo) ||
+        apiLayerRequest->structType != XR_LOADER_INTERFACE_STRUCT_API_LAYER_REQUEST ||
+        apiLayerRequest->structVersion != XR_API_LAYER_INFO_STRUCT_VERSION ||
+        apiLayerRequest->structSize != sizeof(XrNegotiateApiLayerRequest) ||
+        loaderInfo->minInterfaceVersion > XR_CURRENT_LOADER_API_LAYER_VERSION ||
+        loaderInfo->maxInterfaceVersion < XR_CURRENT_LOADER_API_LAYER_VERSION ||
+        loaderInfo->minApiVersion > XR_CURRENT_API_VERSION) {
+        return XR_ERROR_INITIALIZATION_FAILED;
+    }
+    apiLayerRequest->layerInterfaceVersion = XR_CURRENT_LOADER_API_LAYER_VERSION;
+    apiLayerRequest->layerApiVersion = XR_CURRENT_API_VERSION;
+    apiLayerRequest->getInstanceProcAddr = timingGetInstanceProcAddr;
+    apiLayerRequest->createApiLayerInstance = timingCreateApiLayerInstance;
+    return XR_SUCCESS;
+}
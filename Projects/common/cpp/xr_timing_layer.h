@@ -0,0 +1,38 @@
+//
+// OpenXR API layer timing the frame-loop calls: xrWaitFrame, xrBeginFrame,
+// xrAcquireSwapchainImage, xrWaitSwapchainImage, xrReleaseSwapchainImage, xrLocateViews and
+// xrEndFrame. Everything else goes straight to the next layer or the runtime.
+//
+// libXrApiLayer_overlay_timing.so is loaded by the OpenXR loader from its manifest, so it sits
+// in front of whichever runtime the loader picked (Monado, the host mock runtime):
+//   - on the headset the apps' debug builds package the implicit-layer manifest in their assets
+//     under openxr/1/api_layers/implicit.d, next to the library in the APK; release builds leave
+//     the manifest out, so the layer is never loaded there;
+//   - on the build machine XR_API_LAYER_PATH=<build> and XR_ENABLE_API_LAYERS=<layer name>.
+// DISABLE_XR_APILAYER_OVERLAY_TIMING=1 turns the implicit layer off.
+//
+// Per call kind it keeps a log2 latency histogram in microseconds and the count of every result
+// code, with relaxed atomics; the last XR_TIMING_LAYER_TRACE_EVENTS calls also go to a ring of
+// fixed-size events. Nothing allocates or locks after instance creation, so the cost per call
+// is two clock reads and a few atomic adds, one of them on a process-wide count of calls in
+// flight that xrDestroyInstance waits out before freeing the layer.
+//
+// At xrDestroyInstance the per-call summary (count, mean, p50/p99 by bucket, max, non-success
+// results) is logged, and if debug.openxr_overlay.xr_timing names a file the calls are written
+// there as Chrome trace JSON (chrome://tracing, ui.perfetto.dev): one complete event per call
+// with its result, plus the histograms under "xrTiming".
+//   adb shell setprop debug.openxr_overlay.xr_timing /sdcard/Download/xr_timing.json
+//
+
+#ifndef ANDROIDSAMSUNG_XR_TIMING_LAYER_H
+#define ANDROIDSAMSUNG_XR_TIMING_LAYER_H
+
+#define XR_TIMING_LAYER_NAME "XR_APILAYER_OVERLAY_timing"
+#define XR_TIMING_LAYER_TRACE_PROPERTY "debug.openxr_overlay.xr_timing"
+
+// Bucket 0 is under 1 us, bucket b in [2^(b-1), 2^b) us; the last one takes the rest (> 4 s).
+#define XR_TIMING_LAYER_BUCKETS 24
+#define XR_TIMING_LAYER_MAX_RESULTS 8
+#define XR_TIMING_LAYER_TRACE_EVENTS 65536
+
+#endif //ANDROIDSAMSUNG_XR_TIMING_LAYER_H
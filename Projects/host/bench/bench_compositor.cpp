@@ -0,0 +1,136 @@
+//
+// CPU reference compositor cost.
+//
+// Composes what the device is asked to show with every app running: base's projection layer
+// and the three overlay quads at their custom_monado_runtime.cpp poses and swapchain sizes,
+// into two eye images, with the SSE2 and the scalar blend kernels. Prints ms per frame and the
+// per-layer breakdown of the last frame.
+//
+// The overlays clear to straight-alpha colours but submit them without
+// XR_COMPOSITION_LAYER_UNPREMULTIPLIED_ALPHA_BIT, so they are blended as premultiplied (brighter
+// than intended); "--unpremultiplied" sets the bit to see the difference in cost.
+//
+// Usage: bench_compositor [eye size=1024] [frames=100] [--unpremultiplied]
+//
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "mock_runtime/reference_compositor.h"
+
+struct QuadProfile {
+    const char* name;
+    uint32_t width;
+    uint32_t height;
+    float r, g, b, a;
+    XrVector3f position;
+    XrExtent2Df size;
+};
+
+static const QuadProfile kQuads[] = {
+        {"overlay1", 512, 512, 0.9f, 0.0f, 0.9f, 0.8f, {0.0f, 0.0f, -1.0f}, {0.5f, 0.5f}},
+        {"overlay2", 512, 512, 0.0f, 0.9f, 0.0f, 0.8f, {0.2f, 0.5f, -1.2f}, {0.5f, 0.5f}},
+        {"overlay3", 1024, 256, 0.0f, 0.0f, 0.9f, 0.8f, {0.0f, 0.6f, -1.0f}, {1.0f, 0.2f}},
+};
+
+static uint32_t pack(float r, float g, float b, float a) {
+    auto byte = [](float v) { return static_cast<uint32_t>(v * 255.0f + 0.5f); };
+    return byte(r) | (byte(g) << 8) | (byte(b) << 16) | (byte(a) << 24);
+}
+
+static double compose(ReferenceCompositor* compositor, const CompositorLayer* layers, uint32_t layerCount,
+                      uint32_t frames) {
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < frames; ++i) {
+        referenceCompositorCompose(compositor, layers, layerCount, XR_ENVIRONMENT_BLEND_MODE_OPAQUE);
+    }
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / frames;
+}
+
+int main(int argc, char** argv) {
+    uint32_t eyeSize = 1024;
+    uint32_t frames = 100;
+    bool unpremultiplied = false;
+    int positional = 0;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--unpremultiplied") == 0) {
+            unpremultiplied = true;
+        } else if (positional++ == 0) {
+            eyeSize = static_cast<uint32_t>(atoi(argv[i]));
+        } else {
+            frames = static_cast<uint32_t>(atoi(argv[i]));
+        }
+    }
+    if (eyeSize == 0 || frames == 0) {
+        fprintf(stderr, "Usage: %s [eye size] [frames] [--unpremultiplied]\n", argv[0]);
+        return 1;
+    }
+
+    // Base renders both eyes side by side into one swapchain image.
+    CompositorImage projection;
+    projection.width = eyeSize * 2;
+    projection.height = eyeSize;
+    projection.pixels.assign(static_cast<size_t>(projection.width) * projection.height, 0);
+    for (uint32_t y = 0; y < projection.height; ++y) {
+        for (uint32_t x = 0; x < projection.width; ++x) {
+            projection.pixels[static_cast<size_t>(y) * projection.width + x] =
+                    pack((x % eyeSize) / static_cast<float>(eyeSize), y / static_cast<float>(eyeSize), 0.2f, 1.0f);
+        }
+    }
+
+    CompositorLayer layers[4];
+    layers[0].kind = COMPOSITOR_LAYER_PROJECTION;
+    for (uint32_t eye = 0; eye < 2; ++eye) {
+        layers[0].views[eye] = {&projection, {{static_cast<int32_t>(eye * eyeSize), 0},
+                                              {static_cast<int32_t>(eyeSize), static_cast<int32_t>(eyeSize)}}};
+    }
+    CompositorImage quadImages[3];
+    for (uint32_t i = 0; i < 3; ++i) {
+        const QuadProfile& profile = kQuads[i];
+        quadImages[i].width = profile.width;
+        quadImages[i].height = profile.height;
+        quadImages[i].pixels.assign(static_cast<size_t>(profile.width) * profile.height,
+                                    pack(profile.r, profile.g, profile.b, profile.a));
+        CompositorLayer& layer = layers[i + 1];
+        layer.kind = COMPOSITOR_LAYER_QUAD;
+        layer.flags = XR_COMPOSITION_LAYER_BLEND_TEXTURE_SOURCE_ALPHA_BIT |
+                      (unpremultiplied ? XR_COMPOSITION_LAYER_UNPREMULTIPLIED_ALPHA_BIT : 0);
+        layer.views[0] = {&quadImages[i], {{0, 0}, {static_cast<int32_t>(profile.width),
+                                                     static_cast<int32_t>(profile.height)}}};
+        layer.pose.position = profile.position;
+        layer.size = profile.size;
+    }
+
+    CompositorEye eyes[2];
+    for (uint32_t eye = 0; eye < 2; ++eye) {
+        eyes[eye].pose.position = {eye == 0 ? -0.0315f : 0.0315f, 0.0f, 0.0f};
+        eyes[eye].fov = {-0.785398f, 0.785398f, 0.785398f, -0.785398f};
+    }
+
+    printf("%ux%u per eye, %u frames, %s overlays\n", eyeSize, eyeSize, frames,
+           unpremultiplied ? "straight-alpha" : "premultiplied");
+    printf("%-8s %-7s %10s %10s\n", "kernels", "layers", "ms/frame", "Mpix/s");
+    for (int simd = 1; simd >= 0; --simd) {
+        for (uint32_t layerCount : {1u, 4u}) {
+            ReferenceCompositor compositor;
+            referenceCompositorInit(&compositor, eyeSize, eyeSize, eyes);
+            compositor.simd = simd != 0;
+            compose(&compositor, layers, layerCount, 1); // warm up the row buffer and outputs
+            const double ms = compose(&compositor, layers, layerCount, frames);
+            uint64_t pixels = 0;
+            for (uint32_t i = 0; i < compositor.layerCount; ++i) {
+                pixels += compositor.costs[i].pixels;
+            }
+            printf("%-8s %-7u %10.3f %10.1f\n", simd ? "sse2" : "scalar", layerCount, ms, pixels / (ms * 1e3));
+            if (layerCount == 4) {
+                char report[1024];
+                referenceCompositorFormat(&compositor, report, sizeof(report));
+                printf("%s", report);
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,206 @@
+//
+// Frame loops against the simulated display.
+//
+// Runs a base-like loop (main session, heavy frames) and an overlay-like loop (overlay session,
+// light frames) against the mock runtime at 60/72/90/120 Hz, each under a clean display, vsync
+// jitter, periodic compositor stalls and extra compositor latency, and reports what
+// frame_pacing sees (frames following skipped periods) plus the latency from xrWaitFrame
+// returning to the predicted display time.
+//
+// Time is virtual by default, so a run takes no wall time and the same arguments always give
+// the same numbers; the simulated CPU work per frame is drawn from a seeded distribution.
+// --real runs on CLOCK_MONOTONIC instead (and takes frames / rate seconds per cell).
+//
+// Usage: bench_frame_loop [frames=2000] [--real]
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#define XR_USE_PLATFORM_ANDROID
+#define XR_USE_GRAPHICS_API_OPENGL_ES
+#include <jni.h>
+#include <EGL/egl.h>
+#include <openxr/openxr_platform.h>
+
+#include "frame_pacing.h"
+#include "mock_runtime/mock_runtime.h"
+
+#define SEED 7
+
+struct LoopProfile {
+    const char* name;
+    bool overlay;
+    double workMs;     // typical CPU time per frame
+    double spikeEvery; // on average one frame in this many takes spikeFactor x as long
+    double spikeFactor;
+};
+
+struct DisplayProfile {
+    const char* name;
+    XrDuration jitterNs;
+    uint32_t stallInterval;
+    XrDuration stallNs;
+    XrDuration compositorLatencyNs;
+};
+
+static const LoopProfile kLoops[] = {
+        {"base", false, 6.0, 50.0, 2.5},
+        {"overlay", true, 1.5, 50.0, 4.0},
+};
+
+static const DisplayProfile kDisplays[] = {
+        {"clean", 0, 0, 0, 0},
+        {"jitter 1ms", 1000000, 0, 0, 0},
+        {"stall 8ms/90", 0, 90, 8000000, 0},
+        {"latency 4ms", 0, 0, 0, 4000000},
+};
+
+static const double kRates[] = {60.0, 72.0, 90.0, 120.0};
+
+// Same splitmix as the display clock, for the work distribution.
+static uint64_t mix(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ull;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+static double uniform(uint64_t* state) {
+    *state = mix(*state);
+    return static_cast<double>(*state >> 11) / static_cast<double>(1ull << 53);
+}
+
+struct Result {
+    uint64_t frames = 0;
+    uint64_t missedFrames = 0;
+    uint64_t skippedPeriods = 0;
+    double latencyAvgMs = 0.0;
+    double latencyMaxMs = 0.0;
+};
+
+static bool createSession(bool overlay, XrInstance* instance, XrSession* session) {
+    const char* extensions[] = {XR_KHR_OPENGL_ES_ENABLE_EXTENSION_NAME, XR_EXTX_OVERLAY_EXTENSION_NAME};
+    XrInstanceCreateInfo instanceInfo = {XR_TYPE_INSTANCE_CREATE_INFO};
+    strcpy(instanceInfo.applicationInfo.applicationName, "bench_frame_loop");
+    instanceInfo.applicationInfo.apiVersion = XR_MAKE_VERSION(1, 0, 0);
+    instanceInfo.enabledExtensionCount = 2;
+    instanceInfo.enabledExtensionNames = extensions;
+    if (XR_FAILED(xrCreateInstance(&instanceInfo, instance))) {
+        return false;
+    }
+    XrSystemGetInfo systemInfo = {XR_TYPE_SYSTEM_GET_INFO};
+    systemInfo.formFactor = XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY;
+    XrSystemId systemId = XR_NULL_SYSTEM_ID;
+    xrGetSystem(*instance, &systemInfo, &systemId);
+
+    // Frames are never rendered, so no context is needed behind the binding.
+    XrGraphicsBindingOpenGLESAndroidKHR binding = {XR_TYPE_GRAPHICS_BINDING_OPENGL_ES_ANDROID_KHR};
+    XrSessionCreateInfoOverlayEXTX overlayInfo = {XR_TYPE_SESSION_CREATE_INFO_OVERLAY_EXTX};
+    overlayInfo.next = &binding;
+    XrSessionCreateInfo sessionInfo = {XR_TYPE_SESSION_CREATE_INFO};
+    sessionInfo.next = overlay ? static_cast<const void*>(&overlayInfo) : &binding;
+    sessionInfo.systemId = systemId;
+    if (XR_FAILED(xrCreateSession(*instance, &sessionInfo, session))) {
+        return false;
+    }
+    XrSessionBeginInfo beginInfo = {XR_TYPE_SESSION_BEGIN_INFO};
+    beginInfo.primaryViewConfigurationType = XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO;
+    return XR_SUCCEEDED(xrBeginSession(*session, &beginInfo));
+}
+
+static Result run(const LoopProfile& loop, const DisplayProfile& display, double hz, uint32_t frames,
+                  bool virtualTime) {
+    DisplayClockConfig config;
+    config.refreshHz = hz;
+    config.jitterNs = display.jitterNs;
+    config.stallInterval = display.stallInterval;
+    config.stallNs = display.stallNs;
+    config.compositorLatencyNs = display.compositorLatencyNs;
+    config.seed = SEED;
+    config.virtualTime = virtualTime;
+    mockRuntimeSetDisplayClock(&config);
+
+    Result result;
+    XrInstance instance = XR_NULL_HANDLE;
+    XrSession session = XR_NULL_HANDLE;
+    if (!createSession(loop.overlay, &instance, &session)) {
+        fprintf(stderr, "mock session failed\n");
+        return result;
+    }
+
+    static FramePacing pacing;
+    framePacingReset(&pacing);
+    uint64_t workState = SEED;
+    double latencySumMs = 0.0;
+    XrCompositionLayerQuad quad = {XR_TYPE_COMPOSITION_LAYER_QUAD};
+    const XrCompositionLayerBaseHeader* layers[] = {reinterpret_cast<XrCompositionLayerBaseHeader*>(&quad)};
+    for (uint32_t i = 0; i < frames; ++i) {
+        XrFrameState frameState = {XR_TYPE_FRAME_STATE};
+        framePacingWaitStart(&pacing);
+        xrWaitFrame(session, nullptr, &frameState);
+        framePacingWaitDone(&pacing, &frameState);
+        const double latencyMs = (frameState.predictedDisplayTime - mockRuntimeNow(session)) / 1e6;
+        latencySumMs += latencyMs;
+        result.latencyMaxMs = latencyMs > result.latencyMaxMs ? latencyMs : result.latencyMaxMs;
+
+        xrBeginFrame(session, nullptr);
+        framePacingFrameBegun(&pacing);
+        double workMs = loop.workMs * (0.75 + 0.5 * uniform(&workState));
+        if (uniform(&workState) * loop.spikeEvery < 1.0) {
+            workMs *= loop.spikeFactor;
+        }
+        mockRuntimeAdvanceTime(session, static_cast<XrDuration>(workMs * 1e6));
+        framePacingFrameEnded(&pacing);
+
+        XrFrameEndInfo endInfo = {XR_TYPE_FRAME_END_INFO};
+        endInfo.displayTime = frameState.predictedDisplayTime;
+        endInfo.environmentBlendMode = XR_ENVIRONMENT_BLEND_MODE_OPAQUE;
+        endInfo.layerCount = 1;
+        endInfo.layers = layers;
+        xrEndFrame(session, &endInfo);
+    }
+
+    FramePacingStats stats;
+    framePacingSnapshot(&pacing, &stats);
+    result.frames = stats.frames;
+    result.missedFrames = stats.missedFrames;
+    result.skippedPeriods = stats.skippedPeriods;
+    result.latencyAvgMs = frames ? latencySumMs / frames : 0.0;
+
+    xrDestroySession(session);
+    xrDestroyInstance(instance);
+    return result;
+}
+
+int main(int argc, char** argv) {
+    uint32_t frames = 2000;
+    bool virtualTime = true;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--real") == 0) {
+            virtualTime = false;
+        } else {
+            frames = static_cast<uint32_t>(atoi(argv[i]));
+        }
+    }
+    if (frames == 0) {
+        fprintf(stderr, "Usage: %s [frames] [--real]\n", argv[0]);
+        return 1;
+    }
+
+    printf("%u frames per cell, %s time\n", frames, virtualTime ? "virtual" : "real");
+    printf("%-8s %-13s %5s %8s %8s %8s %12s %12s\n", "loop", "display", "Hz", "frames", "missed", "skipped",
+           "latency avg", "latency max");
+    for (const LoopProfile& loop : kLoops) {
+        for (const DisplayProfile& display : kDisplays) {
+            for (double hz : kRates) {
+                const Result result = run(loop, display, hz, frames, virtualTime);
+                printf("%-8s %-13s %5.0f %8llu %8llu %8llu %10.2fms %10.2fms\n", loop.name, display.name, hz,
+                       (unsigned long long) result.frames, (unsigned long long) result.missedFrames,
+                       (unsigned long long) result.skippedPeriods, result.latencyAvgMs, result.latencyMaxMs);
+            }
+        }
+    }
+    return 0;
+}
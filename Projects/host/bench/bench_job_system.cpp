@@ -0,0 +1,244 @@
+//
+// Job system scaling.
+//
+// Runs a synthetic overlay frame - the CPU work a 3D overlay with many objects would do - with
+// 1..maxWorkers workers and reports the frame CPU time (submit to all jobs done):
+//   animate   -> transform -> cull      per object, each stage waits on the previous one
+//   text layout                         per label, independent of the object chain
+// Stages are split with jobSystemParallelFor and chained through JobCounters, so this also
+// covers holding jobs on a counter and stealing. A plain serial loop over the same work is the
+// baseline the 1-worker row is compared against.
+//
+// Usage: bench_job_system [maxWorkers=cores] [objects=20000] [frames=200]
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "job_system.h"
+
+#define LABEL_COUNT 256
+#define GLYPHS_PER_LABEL 64
+#define OBJECT_GRAIN 256
+#define LABEL_GRAIN 8
+
+struct Object {
+    float axis[3];
+    float speed;
+    float angle;
+    float position[3];
+    float radius;
+    float local[12];
+    float world[12];
+    bool visible[2];
+};
+
+struct Label {
+    uint32_t text[GLYPHS_PER_LABEL];
+    float x[GLYPHS_PER_LABEL];
+    float y[GLYPHS_PER_LABEL];
+};
+
+struct Scene {
+    std::vector<Object> objects;
+    std::vector<Label> labels;
+    float time = 0.0f;
+    float root[12];
+    float planes[2][6][4]; // per eye, inward-facing frustum planes
+};
+
+// --- Stages ---
+
+static void animate(void* data, uint32_t begin, uint32_t end) {
+    Scene* scene = static_cast<Scene*>(data);
+    for (uint32_t i = begin; i < end; ++i) {
+        Object& o = scene->objects[i];
+        o.angle = std::fmod(o.angle + o.speed * scene->time, 6.2831853f);
+        // Rotation about `axis` (quaternion -> 3x3) plus translation.
+        const float s = std::sin(o.angle * 0.5f);
+        const float w = std::cos(o.angle * 0.5f);
+        const float x = o.axis[0] * s, y = o.axis[1] * s, z = o.axis[2] * s;
+        float* m = o.local;
+        m[0] = 1 - 2 * (y * y + z * z); m[1] = 2 * (x * y - w * z);     m[2] = 2 * (x * z + w * y);      m[3] = o.position[0];
+        m[4] = 2 * (x * y + w * z);     m[5] = 1 - 2 * (x * x + z * z); m[6] = 2 * (y * z - w * x);      m[7] = o.position[1];
+        m[8] = 2 * (x * z - w * y);     m[9] = 2 * (y * z + w * x);     m[10] = 1 - 2 * (x * x + y * y); m[11] = o.position[2];
+    }
+}
+
+static void transform(void* data, uint32_t begin, uint32_t end) {
+    Scene* scene = static_cast<Scene*>(data);
+    const float* r = scene->root;
+    for (uint32_t i = begin; i < end; ++i) {
+        const float* l = scene->objects[i].local;
+        float* w = scene->objects[i].world;
+        for (int row = 0; row < 3; ++row) {
+            for (int col = 0; col < 4; ++col) {
+                w[row * 4 + col] = r[row * 4] * l[col] + r[row * 4 + 1] * l[4 + col] + r[row * 4 + 2] * l[8 + col] +
+                                   (col == 3 ? r[row * 4 + 3] : 0.0f);
+            }
+        }
+    }
+}
+
+static void cull(void* data, uint32_t begin, uint32_t end) {
+    Scene* scene = static_cast<Scene*>(data);
+    for (uint32_t i = begin; i < end; ++i) {
+        Object& o = scene->objects[i];
+        const float cx = o.world[3], cy = o.world[7], cz = o.world[11];
+        for (int eye = 0; eye < 2; ++eye) {
+            bool inside = true;
+            for (int p = 0; p < 6 && inside; ++p) {
+                const float* plane = scene->planes[eye][p];
+                inside = plane[0] * cx + plane[1] * cy + plane[2] * cz + plane[3] >= -o.radius;
+            }
+            o.visible[eye] = inside;
+        }
+    }
+}
+
+static void layoutText(void* data, uint32_t begin, uint32_t end) {
+    Scene* scene = static_cast<Scene*>(data);
+    for (uint32_t i = begin; i < end; ++i) {
+        Label& label = scene->labels[i];
+        float x = 0.0f, y = 0.0f;
+        for (uint32_t g = 0; g < GLYPHS_PER_LABEL; ++g) {
+            const uint32_t c = label.text[g];
+            if (c == '\n') {
+                x = 0.0f;
+                y -= 1.2f;
+                continue;
+            }
+            // Stand-in for advance + kerning lookups.
+            const float advance = 0.5f + 0.05f * std::sin(static_cast<float>(c));
+            const float kern = g ? 0.01f * std::cos(static_cast<float>(c * 31 + label.text[g - 1])) : 0.0f;
+            x += advance + kern;
+            label.x[g] = x;
+            label.y[g] = y;
+        }
+    }
+}
+
+// --- Frames ---
+
+static void initScene(Scene* scene, uint32_t objectCount) {
+    srand(1);
+    scene->objects.resize(objectCount);
+    for (Object& o : scene->objects) {
+        const float ax = rand() / (float)RAND_MAX - 0.5f, ay = rand() / (float)RAND_MAX - 0.5f, az = 0.3f;
+        const float len = std::sqrt(ax * ax + ay * ay + az * az);
+        o.axis[0] = ax / len;
+        o.axis[1] = ay / len;
+        o.axis[2] = az / len;
+        o.speed = rand() / (float)RAND_MAX * 2.0f;
+        o.angle = 0.0f;
+        o.position[0] = rand() / (float)RAND_MAX * 20.0f - 10.0f;
+        o.position[1] = rand() / (float)RAND_MAX * 20.0f - 10.0f;
+        o.position[2] = -rand() / (float)RAND_MAX * 20.0f;
+        o.radius = 0.5f;
+    }
+    scene->labels.resize(LABEL_COUNT);
+    for (Label& label : scene->labels) {
+        for (uint32_t g = 0; g < GLYPHS_PER_LABEL; ++g) {
+            label.text[g] = g % 17 == 16 ? '\n' : 'a' + rand() % 26;
+        }
+    }
+    const float root[12] = {1, 0, 0, 0, 0, 1, 0, -1.5f, 0, 0, 1, -2.0f};
+    std::copy(root, root + 12, scene->root);
+    for (int eye = 0; eye < 2; ++eye) {
+        const float planes[6][4] = {
+                {0.7f, 0, -0.7f, eye ? -0.03f : 0.03f}, {-0.7f, 0, -0.7f, 0}, {0, 0.7f, -0.7f, 0},
+                {0, -0.7f, -0.7f, 0},                   {0, 0, -1, -0.1f},    {0, 0, 1, 100.0f},
+        };
+        std::copy(&planes[0][0], &planes[0][0] + 24, &scene->planes[eye][0][0]);
+    }
+}
+
+static void serialFrame(Scene* scene) {
+    const uint32_t n = static_cast<uint32_t>(scene->objects.size());
+    animate(scene, 0, n);
+    transform(scene, 0, n);
+    cull(scene, 0, n);
+    layoutText(scene, 0, LABEL_COUNT);
+}
+
+static void jobFrame(JobSystem* system, Scene* scene) {
+    const uint32_t n = static_cast<uint32_t>(scene->objects.size());
+    JobCounter animated, transformed, culled, laidOut;
+    jobSystemParallelFor(system, animate, scene, n, OBJECT_GRAIN, &animated);
+    jobSystemParallelFor(system, layoutText, scene, LABEL_COUNT, LABEL_GRAIN, &laidOut);
+    jobSystemParallelFor(system, transform, scene, n, OBJECT_GRAIN, &transformed, &animated);
+    jobSystemParallelFor(system, cull, scene, n, OBJECT_GRAIN, &culled, &transformed);
+    jobSystemWait(system, &culled);
+    jobSystemWait(system, &laidOut);
+}
+
+struct Timing {
+    double meanMs;
+    double p99Ms;
+    uint32_t visible;
+};
+
+template <typename FrameFn>
+static Timing timeFrames(Scene* scene, uint32_t frames, FrameFn frame) {
+    std::vector<double> ms(frames);
+    for (uint32_t f = 0; f < frames; ++f) {
+        scene->time = f / 90.0f;
+        const auto start = std::chrono::steady_clock::now();
+        frame();
+        ms[f] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+    Timing timing = {};
+    for (double v : ms) {
+        timing.meanMs += v / frames;
+    }
+    std::sort(ms.begin(), ms.end());
+    timing.p99Ms = ms[std::min<size_t>(frames - 1, frames * 99 / 100)];
+    for (const Object& o : scene->objects) {
+        timing.visible += o.visible[0] + o.visible[1];
+    }
+    return timing;
+}
+
+int main(int argc, char** argv) {
+    const uint32_t cores = std::thread::hardware_concurrency();
+    const uint32_t maxWorkers = std::min<uint32_t>(argc > 1 ? atoi(argv[1]) : (cores ? cores : 1),
+                                                   JOB_SYSTEM_MAX_WORKERS);
+    const uint32_t objectCount = argc > 2 ? static_cast<uint32_t>(atoi(argv[2])) : 20000;
+    const uint32_t frames = argc > 3 ? static_cast<uint32_t>(atoi(argv[3])) : 200;
+
+    printf("# %u objects, %u labels, %u frames; %u online cores, %u big\n", objectCount, LABEL_COUNT, frames, cores,
+           jobSystemBigCoreCount());
+
+    Scene scene;
+    initScene(&scene, objectCount);
+    const Timing serial = timeFrames(&scene, frames, [&] { serialFrame(&scene); });
+    printf("%7s | %10s %10s %8s | %8s %8s\n", "workers", "mean", "p99", "speedup", "jobs", "stolen");
+    printf("%7s | %7.3f ms %7.3f ms %7.2fx | %8s %8s\n", "serial", serial.meanMs, serial.p99Ms, 1.0, "-", "-");
+
+    for (uint32_t workers = 1; workers <= maxWorkers; ++workers) {
+        initScene(&scene, objectCount);
+        JobSystem* system = new JobSystem();
+        jobSystemInit(system, workers, false);
+        const Timing timing = timeFrames(&scene, frames, [&] { jobFrame(system, &scene); });
+        uint64_t executed = 0, stolen = 0;
+        for (uint32_t w = 0; w < workers; ++w) {
+            executed += system->queues[w].executed.load();
+            stolen += system->queues[w].stolen.load();
+        }
+        jobSystemShutdown(system);
+        delete system;
+
+        if (timing.visible != serial.visible) {
+            fprintf(stderr, "%u workers: %u visible, serial run had %u\n", workers, timing.visible, serial.visible);
+            return 1;
+        }
+        printf("%7u | %7.3f ms %7.3f ms %7.2fx | %8llu %8llu\n", workers, timing.meanMs, timing.p99Ms,
+               serial.meanMs / timing.meanMs, (unsigned long long)(executed / frames),
+               (unsigned long long)(stolen / frames));
+    }
+    return 0;
+}
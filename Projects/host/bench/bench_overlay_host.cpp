@@ -0,0 +1,293 @@
+//
+// Overlay host vs. one process per panel.
+//
+// For N = 1..maxPanels this runs the same panel workload two ways:
+//   multi-process: N processes, each with its own EGL display/context and a
+//                  3-image "swapchain" it renders its panel into every frame
+//                  (what overlay1/2/3 do today, one APK each).
+//   host:          one process, one context, all N panels packed into a single
+//                  QuadAtlas and rendered through their sub-rects.
+// Each panel's content is the same full-panel quad on both sides, so the GPU
+// work matches and the difference is the per-process overhead. Setup time, CPU
+// per frame and resident memory are reported for both.
+//
+// There is no OpenXR runtime on the build machine, so the XR instance/session
+// cost of every extra process is not included; the numbers are a lower bound
+// for the multi-process setup.
+//
+// Usage: bench_overlay_host [maxPanels=10] [frames=300]
+//
+
+#include <GLES3/gl3.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "host_egl.h"
+#include "quad_atlas.h"
+
+#define SWAPCHAIN_IMAGE_COUNT 3
+
+// Panel resolutions in the order the overlay host lays them out.
+static const uint32_t kPanelSizes[][2] = {
+        {512, 512}, {512, 512}, {1024, 256},
+        {256, 256}, {256, 256}, {256, 256}, {256, 256}, {256, 256}, {256, 256},
+};
+static const uint32_t kPanelSizeCount = sizeof(kPanelSizes) / sizeof(kPanelSizes[0]);
+
+static const char* kVertexShader = R"(#version 300 es
+const vec2 corners[4] = vec2[4](vec2(-1.0, -1.0), vec2(1.0, -1.0), vec2(-1.0, 1.0), vec2(1.0, 1.0));
+out vec2 uv;
+void main() {
+    uv = corners[gl_VertexID] * 0.5 + 0.5;
+    gl_Position = vec4(corners[gl_VertexID], 0.0, 1.0);
+}
+)";
+
+static const char* kFragmentShader = R"(#version 300 es
+precision mediump float;
+uniform vec4 color;
+in vec2 uv;
+out vec4 fragColor;
+void main() {
+    fragColor = vec4(color.rgb * (0.5 + 0.5 * uv.y), color.a);
+}
+)";
+
+struct ProcessCost {
+    int ok = 0;
+    double setupMs = 0.0;
+    double frameCpuMs = 0.0; // CPU time per frame, all threads of the process
+    long rssKb = 0;
+};
+
+static double nowMs() {
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+static double processCpuMs() {
+    rusage usage = {};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_utime.tv_sec * 1e3 + usage.ru_utime.tv_usec / 1e3 +
+           usage.ru_stime.tv_sec * 1e3 + usage.ru_stime.tv_usec / 1e3;
+}
+
+static long maxRssKb() {
+    rusage usage = {};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+static GLuint compileShader(GLenum type, const char* source) {
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+    return shader;
+}
+
+// Program drawing the panel content; also binds the empty VAO it draws from.
+static GLuint createPanelProgram(GLint* colorLocation) {
+    GLuint program = glCreateProgram();
+    GLuint vs = compileShader(GL_VERTEX_SHADER, kVertexShader);
+    GLuint fs = compileShader(GL_FRAGMENT_SHADER, kFragmentShader);
+    glAttachShader(program, vs);
+    glAttachShader(program, fs);
+    glLinkProgram(program);
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+    GLint linked = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    if (!linked) {
+        glDeleteProgram(program);
+        return 0;
+    }
+    GLuint vao = 0;
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+    glUseProgram(program);
+    *colorLocation = glGetUniformLocation(program, "color");
+    return program;
+}
+
+static void drawPanel(GLint colorLocation) {
+    glUniform4f(colorLocation, 0.9f, 0.0f, 0.9f, 0.8f);
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+}
+
+static void createImages(GLuint* textures, uint32_t width, uint32_t height) {
+    glGenTextures(SWAPCHAIN_IMAGE_COUNT, textures);
+    for (uint32_t i = 0; i < SWAPCHAIN_IMAGE_COUNT; ++i) {
+        glBindTexture(GL_TEXTURE_2D, textures[i]);
+        glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, width, height);
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+// One overlay APK: own context, own swapchain, one panel.
+static ProcessCost runSinglePanelProcess(uint32_t panel, uint32_t frames) {
+    ProcessCost cost;
+    const double start = nowMs();
+    HostEgl egl;
+    if (!hostEglInit(&egl)) {
+        return cost;
+    }
+    const uint32_t width = kPanelSizes[panel % kPanelSizeCount][0];
+    const uint32_t height = kPanelSizes[panel % kPanelSizeCount][1];
+    GLuint textures[SWAPCHAIN_IMAGE_COUNT];
+    GLuint framebuffers[SWAPCHAIN_IMAGE_COUNT];
+    createImages(textures, width, height);
+    glGenFramebuffers(SWAPCHAIN_IMAGE_COUNT, framebuffers);
+    for (uint32_t i = 0; i < SWAPCHAIN_IMAGE_COUNT; ++i) {
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffers[i]);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, textures[i], 0);
+    }
+    GLint colorLocation = -1;
+    GLuint program = createPanelProgram(&colorLocation);
+    glFinish();
+    cost.setupMs = nowMs() - start;
+    if (program == 0) {
+        hostEglDestroy(&egl);
+        return cost;
+    }
+
+    const double cpuStart = processCpuMs();
+    for (uint32_t frame = 0; frame < frames; ++frame) {
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffers[frame % SWAPCHAIN_IMAGE_COUNT]);
+        glViewport(0, 0, width, height);
+        drawPanel(colorLocation);
+        glFlush();
+    }
+    glFinish();
+    cost.frameCpuMs = (processCpuMs() - cpuStart) / frames;
+    cost.rssKb = maxRssKb();
+    cost.ok = 1;
+
+    hostEglDestroy(&egl);
+    return cost;
+}
+
+// The overlay host: one context, one atlas swapchain, N panels.
+static ProcessCost runHostProcess(uint32_t panelCount, uint32_t frames) {
+    ProcessCost cost;
+    const double start = nowMs();
+    HostEgl egl;
+    if (!hostEglInit(&egl)) {
+        return cost;
+    }
+    QuadAtlas atlas;
+    quadAtlasInit(&atlas, 2048, 2048);
+    for (uint32_t i = 0; i < panelCount; ++i) {
+        int32_t index = quadAtlasAddPanel(&atlas, kPanelSizes[i % kPanelSizeCount][0],
+                                          kPanelSizes[i % kPanelSizeCount][1]);
+        if (index >= 0) {
+            atlas.panels[index].color[0] = 0.9f;
+            atlas.panels[index].color[2] = 0.9f;
+            atlas.panels[index].color[3] = 0.8f;
+        }
+    }
+    GLuint textures[SWAPCHAIN_IMAGE_COUNT];
+    createImages(textures, atlas.width, atlas.height);
+    quadAtlasAttachImages(&atlas, textures, SWAPCHAIN_IMAGE_COUNT);
+    GLint colorLocation = -1;
+    GLuint program = createPanelProgram(&colorLocation);
+    glFinish();
+    cost.setupMs = nowMs() - start;
+    if (program == 0) {
+        quadAtlasDestroy(&atlas);
+        hostEglDestroy(&egl);
+        return cost;
+    }
+
+    const double cpuStart = processCpuMs();
+    for (uint32_t frame = 0; frame < frames; ++frame) {
+        if (quadAtlasBeginFrame(&atlas)) {
+            for (uint32_t i = 0; i < atlas.panelCount; ++i) {
+                quadAtlasBindPanel(&atlas, i);
+                drawPanel(colorLocation);
+            }
+            quadAtlasEndFrame(&atlas);
+            quadAtlasBuildLayers(&atlas, XR_NULL_HANDLE, XR_COMPOSITION_LAYER_BLEND_TEXTURE_SOURCE_ALPHA_BIT);
+        }
+        glFlush();
+    }
+    glFinish();
+    cost.frameCpuMs = (processCpuMs() - cpuStart) / frames;
+    cost.rssKb = maxRssKb();
+    cost.ok = 1;
+
+    quadAtlasDestroy(&atlas);
+    hostEglDestroy(&egl);
+    return cost;
+}
+
+template <typename Fn>
+static pid_t spawn(int* readFd, Fn fn) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        return -1;
+    }
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        ProcessCost cost = fn();
+        ssize_t written = write(fds[1], &cost, sizeof(cost));
+        _exit(written == sizeof(cost) ? 0 : 1);
+    }
+    close(fds[1]);
+    *readFd = fds[0];
+    return pid;
+}
+
+static ProcessCost collect(pid_t pid, int readFd) {
+    ProcessCost cost;
+    if (read(readFd, &cost, sizeof(cost)) != sizeof(cost)) {
+        cost = ProcessCost{};
+    }
+    close(readFd);
+    waitpid(pid, nullptr, 0);
+    return cost;
+}
+
+int main(int argc, char** argv) {
+    const uint32_t maxPanels = argc > 1 ? static_cast<uint32_t>(atoi(argv[1])) : 10;
+    const uint32_t frames = argc > 2 ? static_cast<uint32_t>(atoi(argv[2])) : 300;
+
+    printf("# %u frames per run; CPU is per frame summed over all processes, RSS summed\n", frames);
+    printf("%6s | %12s %14s %10s | %12s %14s %10s\n", "panels",
+           "multi setup", "multi cpu/frm", "multi rss", "host setup", "host cpu/frm", "host rss");
+
+    for (uint32_t n = 1; n <= maxPanels; ++n) {
+        std::vector<pid_t> pids(n);
+        std::vector<int> fds(n);
+        for (uint32_t i = 0; i < n; ++i) {
+            pids[i] = spawn(&fds[i], [i, frames] { return runSinglePanelProcess(i, frames); });
+        }
+        ProcessCost multi;
+        multi.ok = 1;
+        for (uint32_t i = 0; i < n; ++i) {
+            ProcessCost cost = collect(pids[i], fds[i]);
+            multi.ok &= cost.ok;
+            multi.setupMs += cost.setupMs;
+            multi.frameCpuMs += cost.frameCpuMs;
+            multi.rssKb += cost.rssKb;
+        }
+
+        int hostFd = -1;
+        pid_t hostPid = spawn(&hostFd, [n, frames] { return runHostProcess(n, frames); });
+        ProcessCost host = collect(hostPid, hostFd);
+
+        if (!multi.ok || !host.ok) {
+            fprintf(stderr, "Run with %u panels failed (no surfaceless EGL?)\n", n);
+            return 1;
+        }
+        printf("%6u | %9.2f ms %11.3f ms %7.1f MB | %9.2f ms %11.3f ms %7.1f MB\n", n,
+               multi.setupMs, multi.frameCpuMs, multi.rssKb / 1024.0,
+               host.setupMs, host.frameCpuMs, host.rssKb / 1024.0);
+    }
+    return 0;
+}
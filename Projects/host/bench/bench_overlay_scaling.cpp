@@ -0,0 +1,341 @@
+//
+// Frame cost as overlay sessions are added.
+//
+// MainActivity launches up to four overlay packages (six more are commented out). This runs one
+// base session plus 0..N XR_EXTX_overlay sessions against the mock runtime, each app on its own
+// thread with its own GL context, instance and session, as separate processes would have. Base
+// submits a side-by-side projection layer; each overlay submits one quad, cycling through
+// overlay1/2/3's panel sizes and poses (shifted sideways for each further round of three).
+// Rendering is a clear per swapchain image, which is all the overlays do; base's scene is not
+// modelled.
+//
+// With compositing on (the default) every session's layers are read back at xrEndFrame and the
+// display composes them once per display time with the CPU reference compositor, so the table
+// shows how layer count and composition cost grow with N next to the apps' frame times. The
+// composition runs on the thread of whichever app ends a frame first for a display time, so it
+// shows up in that app's frame time; --no-composite measures the apps alone.
+//
+// Runs on CLOCK_MONOTONIC at 90 Hz; each step takes the warm-up plus the given seconds.
+//
+// Usage: bench_overlay_scaling [max overlays=10] [seconds per step=2] [--no-composite]
+//
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#define XR_USE_PLATFORM_ANDROID
+#define XR_USE_GRAPHICS_API_OPENGL_ES
+#include <jni.h>
+#include <EGL/egl.h>
+#include <GLES3/gl3.h>
+#include <openxr/openxr_platform.h>
+
+#include "frame_stats.h"
+#include "host_egl.h"
+#include "mock_runtime/mock_runtime.h"
+
+#define WARMUP_MS 500
+
+struct PanelProfile {
+    uint32_t width;
+    uint32_t height;
+    XrVector3f position;
+    XrExtent2Df size;
+    float color[4];
+};
+
+// overlay1, overlay2, overlay3 (custom_monado_runtime.cpp).
+static const PanelProfile kPanels[] = {
+        {512, 512, {0.0f, 0.0f, -1.0f}, {0.5f, 0.5f}, {0.9f, 0.0f, 0.9f, 0.8f}},
+        {512, 512, {0.2f, 0.5f, -1.2f}, {0.5f, 0.5f}, {0.0f, 0.9f, 0.0f, 0.8f}},
+        {1024, 256, {0.0f, 0.6f, -1.0f}, {1.0f, 0.2f}, {0.0f, 0.0f, 0.9f, 0.8f}},
+};
+
+struct AppResult {
+    FrameStatsSummary frames = {};
+    uint64_t missedVsyncs = 0;
+    double readbackMsPerFrame = 0.0;
+    bool ok = false;
+};
+
+struct AppThread {
+    int index = 0; // -1 = base, else overlay index
+    bool composite = true;
+    const HostEgl* display = nullptr;
+    const std::atomic<bool>* measuring = nullptr;
+    const std::atomic<bool>* stop = nullptr;
+    FrameStatsRing ring;
+    AppResult result;
+};
+
+static bool createSession(const AppThread& app, const HostEgl& egl, XrInstance* instance, XrSession* session) {
+    const char* extensions[] = {XR_KHR_OPENGL_ES_ENABLE_EXTENSION_NAME, XR_EXTX_OVERLAY_EXTENSION_NAME};
+    XrInstanceCreateInfo instanceInfo = {XR_TYPE_INSTANCE_CREATE_INFO};
+    strcpy(instanceInfo.applicationInfo.applicationName, "bench_overlay_scaling");
+    instanceInfo.applicationInfo.apiVersion = XR_MAKE_VERSION(1, 0, 0);
+    instanceInfo.enabledExtensionCount = 2;
+    instanceInfo.enabledExtensionNames = extensions;
+    if (XR_FAILED(xrCreateInstance(&instanceInfo, instance))) {
+        return false;
+    }
+    XrSystemGetInfo systemInfo = {XR_TYPE_SYSTEM_GET_INFO};
+    systemInfo.formFactor = XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY;
+    XrSystemId systemId = XR_NULL_SYSTEM_ID;
+    xrGetSystem(*instance, &systemInfo, &systemId);
+
+    XrGraphicsBindingOpenGLESAndroidKHR binding = {XR_TYPE_GRAPHICS_BINDING_OPENGL_ES_ANDROID_KHR};
+    binding.display = egl.display;
+    binding.config = egl.config;
+    binding.context = egl.context;
+    XrSessionCreateInfoOverlayEXTX overlayInfo = {XR_TYPE_SESSION_CREATE_INFO_OVERLAY_EXTX};
+    overlayInfo.next = &binding;
+    overlayInfo.sessionLayersPlacement = 1; // XR_SESSION_LAYERS_PLACEMENT_OVERLAY_EXTX, as the apps pass
+    XrSessionCreateInfo sessionInfo = {XR_TYPE_SESSION_CREATE_INFO};
+    sessionInfo.next = app.index >= 0 ? static_cast<const void*>(&overlayInfo) : &binding;
+    sessionInfo.systemId = systemId;
+    if (XR_FAILED(xrCreateSession(*instance, &sessionInfo, session))) {
+        return false;
+    }
+    mockRuntimeSetCompositing(*session, app.composite);
+    XrSessionBeginInfo beginInfo = {XR_TYPE_SESSION_BEGIN_INFO};
+    beginInfo.primaryViewConfigurationType = XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO;
+    return XR_SUCCESS == xrBeginSession(*session, &beginInfo);
+}
+
+static void runApp(AppThread* app) {
+    HostEgl egl;
+    if (!hostEglInitContext(&egl, *app->display)) {
+        return;
+    }
+    XrInstance instance = XR_NULL_HANDLE;
+    XrSession session = XR_NULL_HANDLE;
+    if (!createSession(*app, egl, &instance, &session)) {
+        fprintf(stderr, "mock session failed\n");
+        hostEglDestroyContext(&egl);
+        return;
+    }
+    XrReferenceSpaceCreateInfo spaceInfo = {XR_TYPE_REFERENCE_SPACE_CREATE_INFO};
+    spaceInfo.referenceSpaceType = XR_REFERENCE_SPACE_TYPE_LOCAL;
+    spaceInfo.poseInReferenceSpace.orientation.w = 1.0f;
+    XrSpace space = XR_NULL_HANDLE;
+    xrCreateReferenceSpace(session, &spaceInfo, &space);
+
+    const bool base = app->index < 0;
+    const PanelProfile& panel = kPanels[base ? 0 : app->index % 3];
+    XrSwapchainCreateInfo swapchainInfo = {XR_TYPE_SWAPCHAIN_CREATE_INFO};
+    swapchainInfo.usageFlags = XR_SWAPCHAIN_USAGE_COLOR_ATTACHMENT_BIT;
+    swapchainInfo.format = GL_SRGB8_ALPHA8;
+    swapchainInfo.sampleCount = 1;
+    swapchainInfo.width = base ? MOCK_RUNTIME_VIEW_WIDTH * 2 : panel.width;
+    swapchainInfo.height = base ? MOCK_RUNTIME_VIEW_HEIGHT : panel.height;
+    swapchainInfo.faceCount = 1;
+    swapchainInfo.arraySize = 1;
+    swapchainInfo.mipCount = 1;
+    XrSwapchain swapchain = XR_NULL_HANDLE;
+    xrCreateSwapchain(session, &swapchainInfo, &swapchain);
+    XrSwapchainImageOpenGLESKHR images[MOCK_RUNTIME_IMAGE_COUNT];
+    for (auto& image : images) {
+        image = {XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_ES_KHR};
+    }
+    uint32_t imageCount = 0;
+    xrEnumerateSwapchainImages(swapchain, MOCK_RUNTIME_IMAGE_COUNT, &imageCount,
+                               reinterpret_cast<XrSwapchainImageBaseHeader*>(images));
+    GLuint framebuffer = 0;
+    glGenFramebuffers(1, &framebuffer);
+
+    XrCompositionLayerProjectionView views[2] = {{XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW},
+                                                 {XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW}};
+    XrCompositionLayerProjection projection = {XR_TYPE_COMPOSITION_LAYER_PROJECTION};
+    projection.space = space;
+    projection.viewCount = 2;
+    projection.views = views;
+    XrCompositionLayerQuad quad = {XR_TYPE_COMPOSITION_LAYER_QUAD};
+    quad.layerFlags = XR_COMPOSITION_LAYER_BLEND_TEXTURE_SOURCE_ALPHA_BIT;
+    quad.space = space;
+    quad.eyeVisibility = XR_EYE_VISIBILITY_BOTH;
+    quad.subImage = {swapchain, {{0, 0}, {static_cast<int32_t>(panel.width), static_cast<int32_t>(panel.height)}}};
+    quad.pose.orientation.w = 1.0f;
+    quad.pose.position = panel.position;
+    quad.pose.position.x += 0.3f * static_cast<float>(base ? 0 : app->index / 3);
+    quad.size = panel.size;
+    const XrCompositionLayerBaseHeader* layers[] = {
+            base ? reinterpret_cast<const XrCompositionLayerBaseHeader*>(&projection)
+                 : reinterpret_cast<const XrCompositionLayerBaseHeader*>(&quad)};
+
+    bool measuring = false;
+    MockRuntimeStats startStats;
+    while (!app->stop->load(std::memory_order_relaxed)) {
+        XrEventDataBuffer event = {XR_TYPE_EVENT_DATA_BUFFER};
+        while (xrPollEvent(instance, &event) == XR_SUCCESS) {
+            event = {XR_TYPE_EVENT_DATA_BUFFER};
+        }
+        if (!measuring && app->measuring->load(std::memory_order_relaxed)) {
+            measuring = true;
+            mockRuntimeGetStats(session, &startStats);
+        }
+
+        XrFrameState frameState = {XR_TYPE_FRAME_STATE};
+        xrWaitFrame(session, nullptr, &frameState);
+        const uint64_t beginNs = frameStatsNowNs();
+        xrBeginFrame(session, nullptr);
+        uint32_t layerCount = 0;
+        if (frameState.shouldRender) {
+            XrViewLocateInfo locateInfo = {XR_TYPE_VIEW_LOCATE_INFO};
+            locateInfo.viewConfigurationType = XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO;
+            locateInfo.displayTime = frameState.predictedDisplayTime;
+            locateInfo.space = space;
+            XrViewState viewState = {XR_TYPE_VIEW_STATE};
+            XrView located[2] = {{XR_TYPE_VIEW}, {XR_TYPE_VIEW}};
+            uint32_t viewCount = 0;
+            xrLocateViews(session, &locateInfo, &viewState, 2, &viewCount, located);
+
+            uint32_t index = 0;
+            xrAcquireSwapchainImage(swapchain, nullptr, &index);
+            XrSwapchainImageWaitInfo waitInfo = {XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO};
+            waitInfo.timeout = XR_INFINITE_DURATION;
+            xrWaitSwapchainImage(swapchain, &waitInfo);
+            glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, images[index].image, 0);
+            if (base) {
+                glClearColor(0.1f, 0.1f, 0.2f, 1.0f);
+            } else {
+                glClearColor(panel.color[0], panel.color[1], panel.color[2], panel.color[3]);
+            }
+            glClear(GL_COLOR_BUFFER_BIT);
+            glBindFramebuffer(GL_FRAMEBUFFER, 0);
+            if (!app->composite) {
+                // Nothing reads the image back, so the clear would never run.
+                glFinish();
+            }
+            xrReleaseSwapchainImage(swapchain, nullptr);
+
+            for (uint32_t eye = 0; eye < 2; ++eye) {
+                views[eye].pose = located[eye].pose;
+                views[eye].fov = located[eye].fov;
+                views[eye].subImage = {swapchain, {{static_cast<int32_t>(eye * MOCK_RUNTIME_VIEW_WIDTH), 0},
+                                                   {MOCK_RUNTIME_VIEW_WIDTH, MOCK_RUNTIME_VIEW_HEIGHT}}};
+            }
+            layerCount = 1;
+        }
+        XrFrameEndInfo endInfo = {XR_TYPE_FRAME_END_INFO};
+        endInfo.displayTime = frameState.predictedDisplayTime;
+        endInfo.environmentBlendMode = XR_ENVIRONMENT_BLEND_MODE_OPAQUE;
+        endInfo.layerCount = layerCount;
+        endInfo.layers = layers;
+        xrEndFrame(session, &endInfo);
+        if (measuring) {
+            frameStatsPush(&app->ring, beginNs, frameStatsNowNs(), frameState.predictedDisplayPeriod);
+        }
+    }
+
+    MockRuntimeStats endStats;
+    mockRuntimeGetStats(session, &endStats);
+    if (measuring) {
+        frameStatsSummarize(&app->ring, 0, 0, &app->result.frames);
+        const uint64_t frames = endStats.framesEnded - startStats.framesEnded;
+        app->result.missedVsyncs = endStats.missedVsyncs - startStats.missedVsyncs;
+        app->result.readbackMsPerFrame = frames ? (endStats.readbackNs - startStats.readbackNs) / 1e6 / frames : 0.0;
+        app->result.ok = true;
+    }
+
+    xrRequestExitSession(session);
+    xrEndSession(session);
+    glDeleteFramebuffers(1, &framebuffer);
+    xrDestroySwapchain(swapchain);
+    xrDestroySpace(space);
+    xrDestroySession(session);
+    xrDestroyInstance(instance);
+    hostEglDestroyContext(&egl);
+}
+
+int main(int argc, char** argv) {
+    int maxOverlays = 10;
+    double seconds = 2.0;
+    bool composite = true;
+    int positional = 0;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--no-composite") == 0) {
+            composite = false;
+        } else if (positional++ == 0) {
+            maxOverlays = atoi(argv[i]);
+        } else {
+            seconds = atof(argv[i]);
+        }
+    }
+    if (maxOverlays < 0 || seconds <= 0.0) {
+        fprintf(stderr, "Usage: %s [max overlays] [seconds per step] [--no-composite]\n", argv[0]);
+        return 1;
+    }
+
+    HostEgl egl;
+    if (!hostEglInit(&egl)) {
+        fprintf(stderr, "no EGL context\n");
+        return 1;
+    }
+    DisplayClockConfig clockConfig;
+    clockConfig.refreshHz = 90.0;
+    mockRuntimeSetDisplayClock(&clockConfig);
+
+    printf("base + N overlays, 90 Hz, %.1f s per step, compositing %s\n", seconds, composite ? "on" : "off");
+    printf("%3s %9s %8s | %10s %10s %6s | %10s %6s | %9s %9s %9s\n", "N", "composed", "layers", "base p50",
+           "base p99", "missed", "ovl p99", "missed", "readback", "compose", "max");
+    for (int overlays = 0; overlays <= maxOverlays; ++overlays) {
+        std::atomic<bool> measuring{false};
+        std::atomic<bool> stop{false};
+        std::vector<AppThread> apps(static_cast<size_t>(overlays) + 1);
+        std::vector<std::thread> threads;
+        for (int i = 0; i <= overlays; ++i) {
+            AppThread& app = apps[i];
+            app.index = i - 1;
+            app.composite = composite;
+            app.display = &egl;
+            app.measuring = &measuring;
+            app.stop = &stop;
+            threads.emplace_back(runApp, &app);
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(WARMUP_MS));
+        MockDisplayStats display;
+        mockRuntimeGetDisplayStats(&display, true);
+        measuring = true;
+        std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+        mockRuntimeGetDisplayStats(&display, false);
+        stop = true;
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        const uint64_t composed = display.framesComposed;
+        const double layers = composed ? static_cast<double>(display.layersComposed) / composed : 0.0;
+        const double composeMs = composed ? display.composeNs / 1e6 / composed : 0.0;
+        uint32_t overlayP99Us = 0;
+        uint64_t overlayMissed = 0;
+        double readbackMs = 0.0;
+        bool ok = true;
+        for (const AppThread& app : apps) {
+            ok = ok && app.result.ok;
+            readbackMs += app.result.readbackMsPerFrame;
+            if (app.index >= 0) {
+                overlayP99Us = app.result.frames.cpuP99Us > overlayP99Us ? app.result.frames.cpuP99Us : overlayP99Us;
+                overlayMissed += app.result.missedVsyncs;
+            }
+        }
+        if (!ok) {
+            fprintf(stderr, "N=%d: an app did not run\n", overlays);
+            hostEglDestroy(&egl);
+            return 1;
+        }
+        const AppResult& base = apps[0].result;
+        printf("%3d %9llu %8.1f | %8.2fms %8.2fms %6llu | %8.2fms %6llu | %7.2fms %7.2fms %7.2fms\n", overlays,
+               (unsigned long long) composed, layers, base.frames.cpuP50Us / 1e3, base.frames.cpuP99Us / 1e3,
+               (unsigned long long) base.missedVsyncs, overlayP99Us / 1e3, (unsigned long long) overlayMissed,
+               readbackMs, composeMs, display.maxComposeNs / 1e6);
+    }
+    hostEglDestroy(&egl);
+    return 0;
+}
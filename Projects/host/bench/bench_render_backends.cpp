@@ -0,0 +1,109 @@
+//
+// The demo scene (demo_scene.h) through each render backend (render_backend.h) from one binary.
+//
+// xr runs against the mock runtime with the display clock off (refreshHz 0), so frames are
+// released at once and the number is the OpenXR frame calls plus rendering; offscreen renders
+// the same views at the same size with no runtime. window needs an ANativeWindow, which a build
+// machine doesn't have, so it is reported as unavailable there. Each frame ends with glFinish so
+// the times include the GPU (software Mesa here).
+//
+// Usage: bench_render_backends [frames=300] [backend...]
+//
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "demo_scene.h"
+#include "mock_runtime/mock_runtime.h"
+#include "render_backend.h"
+
+#define XR_START_TIMEOUT_MS 2000
+
+static double nowMs() {
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+static void run(RenderBackendKind kind, uint32_t frames) {
+    RenderBackendConfig config;
+    config.kind = kind;
+    config.width = MOCK_RUNTIME_VIEW_WIDTH;
+    config.height = MOCK_RUNTIME_VIEW_HEIGHT;
+    RenderBackend backend;
+    if (!renderBackendInit(&backend, config)) {
+        printf("%-10s %s\n", renderBackendName(kind), "unavailable");
+        return;
+    }
+    DemoScene scene;
+    demoSceneInit(&scene);
+
+    const double start = nowMs();
+    while (!renderBackendActive(&backend) && nowMs() - start < XR_START_TIMEOUT_MS) {
+        renderBackendPollEvents(&backend);
+    }
+
+    double beginMs = 0.0;
+    double drawMs = 0.0;
+    uint32_t drawn = 0;
+    const double loopStart = nowMs();
+    for (uint32_t frame = 0; frame < frames && renderBackendActive(&backend); ++frame) {
+        renderBackendPollEvents(&backend);
+        const double t0 = nowMs();
+        const uint32_t viewCount = renderBackendBeginFrame(&backend);
+        const double t1 = nowMs();
+        for (uint32_t view = 0; view < viewCount; ++view) {
+            renderBackendBindView(&backend, view);
+            demoSceneDraw(&scene, backend.views[view].viewProj);
+        }
+        renderBackendEndFrame(&backend);
+        glFinish();
+        const double t2 = nowMs();
+        beginMs += t1 - t0;
+        drawMs += t2 - t1;
+        drawn += viewCount > 0 ? 1 : 0;
+    }
+    const double totalMs = nowMs() - loopStart;
+
+    if (drawn == 0) {
+        printf("%-10s %s\n", renderBackendName(kind), "no frames");
+    } else {
+        printf("%-10s %5u %4ux%-4u %7u %10.3f %10.3f %10.3f\n", renderBackendName(kind), backend.viewCount,
+               backend.views[0].width, backend.views[0].height, drawn, beginMs / drawn, drawMs / drawn,
+               totalMs / drawn);
+    }
+    demoSceneDestroy(&scene);
+    renderBackendDestroy(&backend);
+}
+
+int main(int argc, char** argv) {
+    uint32_t frames = 300;
+    std::vector<RenderBackendKind> kinds;
+    for (int i = 1; i < argc; ++i) {
+        RenderBackendKind kind;
+        if (renderBackendParse(argv[i], &kind)) {
+            kinds.push_back(kind);
+        } else if (atoi(argv[i]) > 0) {
+            frames = static_cast<uint32_t>(atoi(argv[i]));
+        } else {
+            fprintf(stderr, "Usage: %s [frames] [xr|window|offscreen...]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (kinds.empty()) {
+        kinds = {RENDER_BACKEND_XR, RENDER_BACKEND_WINDOW, RENDER_BACKEND_OFFSCREEN};
+    }
+    setenv("EGL_PLATFORM", "surfaceless", 0);
+    DisplayClockConfig clock;
+    clock.refreshHz = 0.0;
+    mockRuntimeSetDisplayClock(&clock);
+
+    printf("%u frames\n", frames);
+    printf("%-10s %5s %9s %7s %10s %10s %10s\n", "backend", "views", "size", "frames", "begin ms", "draw ms",
+           "frame ms");
+    for (RenderBackendKind kind : kinds) {
+        run(kind, frames);
+    }
+    return 0;
+}
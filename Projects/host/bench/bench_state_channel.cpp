@@ -0,0 +1,281 @@
+//
+// Base -> overlay state channel, across two processes.
+//
+// The parent is base, writing; a forked child is an overlay, reading a read-only mapping it got
+// over the channel's socket. Reported:
+//   push        messages pushed back to back: writer cost per message, what the reader received
+//               per second and how many it lost to being lapped
+//   publish     snapshots published back to back: writer cost, whole and torn reader copies
+//   latency     one snapshot and one message every `interval`, the reader spinning: publish to
+//               read, in microseconds
+//   socket      the same over a socketpair, one write() per update, the reader blocked in read():
+//               what a per-update system call (the cheapest stand-in for a Binder call) costs
+// Writer allocations are counted (FRAME_ALLOC_COUNTER) and should be zero.
+// Both sides yield while they wait, so on a single CPU they take turns instead of spinning out
+// each other's time slice; the latencies there are mostly the scheduler's.
+//
+// Usage: bench_state_channel [messages=2000000] [samples=20000]
+//
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sched.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+#include "alloc_counter.h"
+#include "state_channel.h"
+
+#define SOCKET_NAME "bench_state_channel"
+// Between latency samples, so each is read before the next.
+#define SAMPLE_INTERVAL_NS 20000
+#define POLL_BATCH 64
+
+enum Phase : int64_t { PHASE_PUSH = 1, PHASE_PUBLISH, PHASE_LATENCY };
+
+struct ReaderResult {
+    uint64_t received = 0;
+    uint64_t lost = 0;
+    uint64_t torn = 0;
+    double seconds = 0;
+    double snapshotP50Us = 0, snapshotP99Us = 0, snapshotMaxUs = 0;
+    double messageP50Us = 0, messageP99Us = 0, messageMaxUs = 0;
+};
+
+static void percentiles(std::vector<uint64_t>& ns, double* p50, double* p99, double* max) {
+    if (ns.empty()) {
+        return;
+    }
+    std::sort(ns.begin(), ns.end());
+    *p50 = ns[ns.size() / 2] / 1e3;
+    *p99 = ns[ns.size() * 99 / 100] / 1e3;
+    *max = ns.back() / 1e3;
+}
+
+// --- Reader (the child) ---
+
+static void readPush(StateChannel* reader, ReaderResult* result) {
+    StateMessage messages[POLL_BATCH];
+    const uint64_t lostBefore = reader->lost;
+    uint64_t startNs = 0;
+    for (bool done = false; !done;) {
+        const uint32_t count = stateChannelPoll(reader, messages, POLL_BATCH);
+        if (count == 0) {
+            sched_yield();
+        }
+        if (count > 0 && startNs == 0) {
+            startNs = stateChannelNowNs();
+        }
+        for (uint32_t i = 0; i < count; ++i) {
+            done |= messages[i].type == STATE_MESSAGE_TEXT;
+        }
+        result->received += count;
+    }
+    result->seconds = (stateChannelNowNs() - startNs) / 1e9;
+    result->lost = reader->lost - lostBefore;
+}
+
+static void readPublish(StateChannel* reader, uint64_t snapshots, ReaderResult* result) {
+    StateSnapshot snapshot;
+    const uint64_t tornBefore = reader->tornSnapshots;
+    uint64_t startNs = 0;
+    for (;;) {
+        if (stateChannelRead(reader, &snapshot) == 0 || snapshot.displayTime != PHASE_PUBLISH) {
+            sched_yield();
+            continue;
+        }
+        if (startNs == 0) {
+            startNs = stateChannelNowNs();
+        }
+        ++result->received;
+        if (snapshot.frame == snapshots) {
+            break;
+        }
+    }
+    result->seconds = (stateChannelNowNs() - startNs) / 1e9;
+    result->torn = reader->tornSnapshots - tornBefore;
+}
+
+static void readLatency(StateChannel* reader, uint64_t samples, ReaderResult* result) {
+    std::vector<uint64_t> snapshotNs;
+    std::vector<uint64_t> messageNs;
+    snapshotNs.reserve(samples);
+    messageNs.reserve(samples);
+    StateSnapshot snapshot;
+    StateMessage messages[POLL_BATCH];
+    uint64_t lastFrame = 0;
+    int64_t lastCounter = 0;
+    // Until the last of each; a snapshot replaced before it was read is simply not sampled.
+    while (lastFrame < samples || lastCounter < static_cast<int64_t>(samples)) {
+        const bool fresh = stateChannelRead(reader, &snapshot) != 0 && snapshot.displayTime == PHASE_LATENCY &&
+                           snapshot.frame != lastFrame;
+        if (fresh) {
+            snapshotNs.push_back(stateChannelNowNs() - snapshot.publishedNs);
+            lastFrame = snapshot.frame;
+        }
+        const uint32_t count = stateChannelPoll(reader, messages, POLL_BATCH);
+        if (!fresh && count == 0) {
+            sched_yield();
+        }
+        const uint64_t nowNs = stateChannelNowNs();
+        for (uint32_t i = 0; i < count; ++i) {
+            messageNs.push_back(nowNs - messages[i].publishedNs);
+            lastCounter = messages[i].value.counter;
+        }
+    }
+    result->received = snapshotNs.size();
+    result->lost = reader->lost;
+    percentiles(snapshotNs, &result->snapshotP50Us, &result->snapshotP99Us, &result->snapshotMaxUs);
+    percentiles(messageNs, &result->messageP50Us, &result->messageP99Us, &result->messageMaxUs);
+}
+
+static void readSocket(int socket, uint64_t samples, ReaderResult* result) {
+    std::vector<uint64_t> latencyNs;
+    latencyNs.reserve(samples);
+    uint64_t sentNs = 0;
+    while (latencyNs.size() < samples && read(socket, &sentNs, sizeof(sentNs)) == sizeof(sentNs)) {
+        latencyNs.push_back(stateChannelNowNs() - sentNs);
+    }
+    result->received = latencyNs.size();
+    percentiles(latencyNs, &result->messageP50Us, &result->messageP99Us, &result->messageMaxUs);
+}
+
+static int readerProcess(int control, uint64_t messages, uint64_t samples) {
+    StateChannel reader;
+    if (!stateChannelConnect(&reader, SOCKET_NAME, 2000)) {
+        return 1;
+    }
+    ReaderResult results[4];
+    const char ready = 1;
+    write(control, &ready, 1);
+    readPush(&reader, &results[0]);
+    write(control, &ready, 1);
+    readPublish(&reader, messages, &results[1]);
+    write(control, &ready, 1);
+    readLatency(&reader, samples, &results[2]);
+    write(control, &ready, 1);
+    readSocket(control, samples, &results[3]);
+    write(control, results, sizeof(results));
+    stateChannelDestroy(&reader);
+    return 0;
+}
+
+// --- Writer (the parent) ---
+
+static bool waitReady(int control) {
+    char ready = 0;
+    return read(control, &ready, 1) == 1;
+}
+
+static void spinUntil(uint64_t ns) {
+    while (stateChannelNowNs() < ns) {
+        sched_yield();
+    }
+}
+
+int main(int argc, char** argv) {
+    const uint64_t messages = argc > 1 ? strtoull(argv[1], nullptr, 10) : 2000000;
+    const uint64_t samples = argc > 2 ? strtoull(argv[2], nullptr, 10) : 20000;
+    if (messages == 0 || samples == 0) {
+        fprintf(stderr, "Usage: %s [messages] [samples]\n", argv[0]);
+        return 1;
+    }
+
+    StateChannel writer;
+    ALooper* looper = ALooper_prepare(0);
+    if (!stateChannelCreate(&writer) || !stateChannelServe(&writer, looper, SOCKET_NAME)) {
+        return 1;
+    }
+    int control[2];
+    socketpair(AF_UNIX, SOCK_STREAM, 0, control);
+    fflush(stdout);
+    const pid_t child = fork();
+    if (child == 0) {
+        close(control[0]);
+        _exit(readerProcess(control[1], messages, samples));
+    }
+    close(control[1]);
+    while (writer.readersServed == 0) {
+        ALooper_pollOnce(100, nullptr, nullptr, nullptr);
+    }
+
+    double pushNs = 0;
+    double publishNs = 0;
+    AllocCounts allocsBefore = allocCounterThread();
+    if (waitReady(control[0])) {
+        const uint64_t startNs = stateChannelNowNs();
+        StateMessage message;
+        message.type = STATE_MESSAGE_COUNTER;
+        for (uint64_t i = 0; i < messages; ++i) {
+            message.value.counter = static_cast<int64_t>(i);
+            stateChannelPush(&writer, message);
+        }
+        pushNs = static_cast<double>(stateChannelNowNs() - startNs) / messages;
+        stateChannelPushText(&writer, STATE_KEY_FRAME_STATS, "end");
+    }
+    if (waitReady(control[0])) {
+        StateSnapshot snapshot;
+        snapshot.displayTime = PHASE_PUBLISH;
+        const uint64_t startNs = stateChannelNowNs();
+        for (uint64_t i = 1; i <= messages; ++i) {
+            snapshot.frame = i;
+            stateChannelPublish(&writer, snapshot);
+        }
+        publishNs = static_cast<double>(stateChannelNowNs() - startNs) / messages;
+    }
+    const AllocCounts allocsAfter = allocCounterThread();
+    if (waitReady(control[0])) {
+        StateSnapshot snapshot;
+        snapshot.displayTime = PHASE_LATENCY;
+        for (uint64_t i = 1; i <= samples; ++i) {
+            spinUntil(stateChannelNowNs() + SAMPLE_INTERVAL_NS);
+            snapshot.frame = i;
+            stateChannelPublish(&writer, snapshot);
+            stateChannelPushCounter(&writer, STATE_KEY_LATE_FRAMES, static_cast<int64_t>(i));
+        }
+    }
+    if (waitReady(control[0])) {
+        for (uint64_t i = 0; i < samples; ++i) {
+            spinUntil(stateChannelNowNs() + SAMPLE_INTERVAL_NS);
+            const uint64_t sentNs = stateChannelNowNs();
+            write(control[0], &sentNs, sizeof(sentNs));
+        }
+    }
+    ReaderResult results[4];
+    const bool readerDone = read(control[0], results, sizeof(results)) == sizeof(results);
+    int status = 0;
+    waitpid(child, &status, 0);
+    stateChannelDestroy(&writer);
+    ALooper_release(looper);
+    if (!readerDone || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        fprintf(stderr, "Reader process failed (status %d)\n", status);
+        return 1;
+    }
+
+    const uint64_t updates = 2 * messages;
+    printf("%llu messages and snapshots, %llu latency samples %d us apart, 2 processes on %ld CPUs\n",
+           (unsigned long long)messages, (unsigned long long)samples, SAMPLE_INTERVAL_NS / 1000,
+           sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%-9s %10s %14s %12s %10s\n", "", "writer ns", "reader /s", "received", "lost/torn");
+    printf("%-9s %10.1f %14.0f %12llu %10llu\n", "push", pushNs, results[0].received / results[0].seconds,
+           (unsigned long long)results[0].received, (unsigned long long)results[0].lost);
+    printf("%-9s %10.1f %14.0f %12llu %10llu\n", "publish", publishNs, results[1].received / results[1].seconds,
+           (unsigned long long)results[1].received, (unsigned long long)results[1].torn);
+    printf("%-9s %10s %10s %10s\n", "latency", "p50 us", "p99 us", "max us");
+    printf("%-9s %10.2f %10.2f %10.2f\n", "snapshot", results[2].snapshotP50Us, results[2].snapshotP99Us,
+           results[2].snapshotMaxUs);
+    printf("%-9s %10.2f %10.2f %10.2f\n", "message", results[2].messageP50Us, results[2].messageP99Us,
+           results[2].messageMaxUs);
+    printf("%-9s %10.2f %10.2f %10.2f\n", "socket", results[3].messageP50Us, results[3].messageP99Us,
+           results[3].messageMaxUs);
+    if (allocCounterEnabled()) {
+        printf("writer allocations: %.3f per update\n",
+               static_cast<double>(allocsAfter.news - allocsBefore.news + allocsAfter.mallocs - allocsBefore.mallocs) /
+                       updates);
+    }
+    return 0;
+}
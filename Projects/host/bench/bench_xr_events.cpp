@@ -0,0 +1,215 @@
+//
+// XR event dispatch cost.
+//
+// Floods the app with synthetic OpenXR events - a stubbed xrPollEvent hands out `burst` events
+// per main loop iteration from a prebuilt mix of session state, reference space, interaction
+// profile, lost-events and an extension event - and reports the cost per event of:
+//   legacy         the old pollEvents: poll, switch on the type, LOGI every state change
+//   legacy, quiet  the same without the log line (stderr is discarded for both)
+//   dispatch       xrEventsPoll: drain into the batch, handler table, no logging
+// The handlers only count, so the numbers are the event plumbing itself.
+//
+// Usage: bench_xr_events [events=1000000] [burst=16]
+//
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <android/log.h>
+
+#include "xr_events.h"
+
+#define TAG "BenchXrEvents"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, TAG, __VA_ARGS__)
+
+#define MIX_SIZE 16
+
+// --- Synthetic runtime ---
+
+static const XrSession kSession = reinterpret_cast<XrSession>(uintptr_t(1));
+static XrEventDataBuffer g_mix[MIX_SIZE];
+static uint64_t g_next = 0;
+static uint64_t g_pendingEnd = 0; // events up to here are "queued"
+
+static void buildMix() {
+    for (uint32_t i = 0; i < MIX_SIZE; ++i) {
+        XrEventDataBuffer& buffer = g_mix[i];
+        memset(&buffer, 0, sizeof(buffer));
+        switch (i % 8) {
+            case 0: case 1: case 2: case 3: {
+                auto* event = reinterpret_cast<XrEventDataSessionStateChanged*>(&buffer);
+                event->type = XR_TYPE_EVENT_DATA_SESSION_STATE_CHANGED;
+                event->session = kSession;
+                event->state = (i & 1) ? XR_SESSION_STATE_VISIBLE : XR_SESSION_STATE_FOCUSED;
+                event->time = i;
+                break;
+            }
+            case 4: {
+                auto* event = reinterpret_cast<XrEventDataReferenceSpaceChangePending*>(&buffer);
+                event->type = XR_TYPE_EVENT_DATA_REFERENCE_SPACE_CHANGE_PENDING;
+                event->session = kSession;
+                event->referenceSpaceType = XR_REFERENCE_SPACE_TYPE_LOCAL;
+                break;
+            }
+            case 5: {
+                auto* event = reinterpret_cast<XrEventDataInteractionProfileChanged*>(&buffer);
+                event->type = XR_TYPE_EVENT_DATA_INTERACTION_PROFILE_CHANGED;
+                event->session = kSession;
+                break;
+            }
+            case 6: {
+                auto* event = reinterpret_cast<XrEventDataEventsLost*>(&buffer);
+                event->type = XR_TYPE_EVENT_DATA_EVENTS_LOST;
+                event->lostEventCount = 1;
+                break;
+            }
+            default: {
+                auto* event = reinterpret_cast<XrEventDataPerfSettingsEXT*>(&buffer);
+                event->type = XR_TYPE_EVENT_DATA_PERF_SETTINGS_EXT;
+                event->domain = XR_PERF_SETTINGS_DOMAIN_GPU_EXT;
+                break;
+            }
+        }
+    }
+}
+
+// Copies only the event's own struct, as a runtime does.
+static size_t eventSize(XrStructureType type) {
+    switch (type) {
+        case XR_TYPE_EVENT_DATA_SESSION_STATE_CHANGED: return sizeof(XrEventDataSessionStateChanged);
+        case XR_TYPE_EVENT_DATA_REFERENCE_SPACE_CHANGE_PENDING: return sizeof(XrEventDataReferenceSpaceChangePending);
+        case XR_TYPE_EVENT_DATA_INTERACTION_PROFILE_CHANGED: return sizeof(XrEventDataInteractionProfileChanged);
+        case XR_TYPE_EVENT_DATA_EVENTS_LOST: return sizeof(XrEventDataEventsLost);
+        default: return sizeof(XrEventDataPerfSettingsEXT);
+    }
+}
+
+extern "C" XrResult xrPollEvent(XrInstance, XrEventDataBuffer* eventData) {
+    if (g_next == g_pendingEnd) {
+        return XR_EVENT_UNAVAILABLE;
+    }
+    const XrEventDataBuffer& source = g_mix[g_next++ % MIX_SIZE];
+    memcpy(eventData, &source, eventSize(source.type));
+    return XR_SUCCESS;
+}
+
+// --- Handlers ---
+
+struct Counters {
+    XrSessionState state = XR_SESSION_STATE_UNKNOWN;
+    uint64_t stateChanges = 0;
+    uint64_t other = 0;
+};
+
+static void onSessionStateChanged(Counters* counters, const XrEventDataSessionStateChanged& event) {
+    if (event.session != kSession) {
+        return;
+    }
+    counters->state = event.state;
+    counters->stateChanges++;
+}
+
+static void onReferenceSpace(Counters* counters, const XrEventDataReferenceSpaceChangePending&) {
+    counters->other++;
+}
+
+static void onInteractionProfile(Counters* counters, const XrEventDataInteractionProfileChanged&) {
+    counters->other++;
+}
+
+static void onEventsLost(Counters* counters, const XrEventDataEventsLost&) {
+    counters->other++;
+}
+
+static void onPerfSettings(void* user, const XrEventDataBuffer*) {
+    static_cast<Counters*>(user)->other++;
+}
+
+// The pre-dispatcher pollEvents, with the handlers above in place of the app's.
+static void legacyPoll(XrInstance instance, Counters* counters, bool log) {
+    XrEventDataBuffer eventData = {XR_TYPE_EVENT_DATA_BUFFER};
+    while (xrPollEvent(instance, &eventData) == XR_SUCCESS) {
+        if (eventData.type == XR_TYPE_EVENT_DATA_SESSION_STATE_CHANGED) {
+            auto stateEvent = *reinterpret_cast<const XrEventDataSessionStateChanged*>(&eventData);
+            counters->state = stateEvent.state;
+            counters->stateChanges++;
+            if (log) {
+                LOGI("Overlay session state changed to: %d", counters->state);
+            }
+        } else {
+            counters->other++;
+        }
+        eventData = {XR_TYPE_EVENT_DATA_BUFFER};
+    }
+}
+
+// --- Runs ---
+
+enum RunKind { RUN_LEGACY, RUN_LEGACY_QUIET, RUN_DISPATCH };
+
+static double run(RunKind kind, uint64_t events, uint32_t burst, Counters* counters) {
+    const XrInstance instance = reinterpret_cast<XrInstance>(uintptr_t(1));
+    static XrEventDispatcher dispatcher;
+    xrEventsInit(&dispatcher, counters);
+    xrEventsOn<onSessionStateChanged>(&dispatcher);
+    xrEventsOn<onReferenceSpace>(&dispatcher);
+    xrEventsOn<onInteractionProfile>(&dispatcher);
+    xrEventsOn<onEventsLost>(&dispatcher);
+    xrEventsSetHandler(&dispatcher, XR_TYPE_EVENT_DATA_PERF_SETTINGS_EXT, onPerfSettings);
+
+    g_next = 0;
+    g_pendingEnd = 0;
+    const auto start = std::chrono::steady_clock::now();
+    while (g_next < events) {
+        g_pendingEnd = g_next + burst < events ? g_next + burst : events;
+        switch (kind) {
+            case RUN_LEGACY: legacyPoll(instance, counters, true); break;
+            case RUN_LEGACY_QUIET: legacyPoll(instance, counters, false); break;
+            case RUN_DISPATCH: xrEventsPoll(&dispatcher, instance); break;
+        }
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return seconds * 1e9 / events;
+}
+
+int main(int argc, char** argv) {
+    const uint64_t events = argc > 1 ? strtoull(argv[1], nullptr, 10) : 1000000;
+    const uint32_t burst = argc > 2 ? (uint32_t)atoi(argv[2]) : 16;
+    if (events == 0 || burst == 0) {
+        fprintf(stderr, "Usage: %s [events] [burst]\n", argv[0]);
+        return 1;
+    }
+    buildMix();
+
+    // The legacy loop logs; keep that cost but not the output.
+    const int savedStderr = dup(STDERR_FILENO);
+    const int devNull = open("/dev/null", O_WRONLY);
+    dup2(devNull, STDERR_FILENO);
+    close(devNull);
+
+    const char* names[] = {"legacy", "legacy, quiet", "dispatch"};
+    double nsPerEvent[3];
+    uint64_t handled[3];
+    for (int kind = RUN_LEGACY; kind <= RUN_DISPATCH; ++kind) {
+        Counters counters;
+        run(static_cast<RunKind>(kind), events / 10 + 1, burst, &counters); // warm-up
+        counters = Counters();
+        nsPerEvent[kind] = run(static_cast<RunKind>(kind), events, burst, &counters);
+        handled[kind] = counters.stateChanges + counters.other;
+    }
+
+    fflush(stderr);
+    dup2(savedStderr, STDERR_FILENO);
+    close(savedStderr);
+
+    printf("%llu events, %u pending per poll\n", (unsigned long long)events, burst);
+    printf("%-14s %10s %10s\n", "", "ns/event", "handled");
+    for (int kind = RUN_LEGACY; kind <= RUN_DISPATCH; ++kind) {
+        printf("%-14s %10.1f %10llu\n", names[kind], nsPerEvent[kind], (unsigned long long)handled[kind]);
+    }
+    return handled[RUN_DISPATCH] == events ? 0 : 1;
+}
@@ -0,0 +1,269 @@
+#include "gl_replay.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+static uint64_t nowNs() {
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static float asFloat(uint32_t word) {
+    float value;
+    memcpy(&value, &word, sizeof(value));
+    return value;
+}
+
+// 0 stays 0 (unbind); unknown names are passed through, as the capturing context saw them.
+static GLuint lookup(const std::unordered_map<uint32_t, GLuint>& names, uint32_t captured) {
+    if (captured == 0) {
+        return 0;
+    }
+    auto it = names.find(captured);
+    return it != names.end() ? it->second : captured;
+}
+
+static GLint uniform(const GlReplay* replay, uint32_t location) {
+    auto it = replay->uniforms.find((static_cast<uint64_t>(replay->program) << 32) | location);
+    return it != replay->uniforms.end() ? it->second : static_cast<GLint>(location);
+}
+
+typedef void (*GenFunction)(GLsizei, GLuint*);
+typedef void (*DeleteFunction)(GLsizei, const GLuint*);
+
+static void gen(std::unordered_map<uint32_t, GLuint>* names, const GlCaptureCall& call, GenFunction function) {
+    std::vector<GLuint> created(call.record.words);
+    function(static_cast<GLsizei>(created.size()), created.data());
+    for (uint16_t i = 0; i < call.record.words; ++i) {
+        (*names)[call.args[i]] = created[i];
+    }
+}
+
+static void remove(std::unordered_map<uint32_t, GLuint>* names, const GlCaptureCall& call, DeleteFunction function) {
+    std::vector<GLuint> deleted;
+    for (uint16_t i = 0; i < call.record.words; ++i) {
+        auto it = names->find(call.args[i]);
+        if (it != names->end()) {
+            deleted.push_back(it->second);
+            names->erase(it);
+        }
+    }
+    function(static_cast<GLsizei>(deleted.size()), deleted.data());
+}
+
+static const void* offset(uint32_t word) {
+    return reinterpret_cast<const void*>(static_cast<uintptr_t>(word));
+}
+
+// Returns false for calls that aren't executed (OpenXR, frame markers).
+static bool execute(GlReplay* replay, const GlCaptureCall& call) {
+    const uint32_t* a = call.args;
+    switch (call.record.op) {
+        case GL_CAPTURE_OP_GEN_BUFFERS: gen(&replay->buffers, call, glGenBuffers); break;
+        case GL_CAPTURE_OP_GEN_VERTEX_ARRAYS: gen(&replay->vertexArrays, call, glGenVertexArrays); break;
+        case GL_CAPTURE_OP_GEN_TEXTURES: gen(&replay->textures, call, glGenTextures); break;
+        case GL_CAPTURE_OP_GEN_FRAMEBUFFERS: gen(&replay->framebuffers, call, glGenFramebuffers); break;
+        case GL_CAPTURE_OP_GEN_RENDERBUFFERS: gen(&replay->renderbuffers, call, glGenRenderbuffers); break;
+        case GL_CAPTURE_OP_DELETE_BUFFERS: remove(&replay->buffers, call, glDeleteBuffers); break;
+        case GL_CAPTURE_OP_DELETE_VERTEX_ARRAYS: remove(&replay->vertexArrays, call, glDeleteVertexArrays); break;
+        case GL_CAPTURE_OP_DELETE_TEXTURES: remove(&replay->textures, call, glDeleteTextures); break;
+        case GL_CAPTURE_OP_DELETE_FRAMEBUFFERS: remove(&replay->framebuffers, call, glDeleteFramebuffers); break;
+        case GL_CAPTURE_OP_DELETE_RENDERBUFFERS: remove(&replay->renderbuffers, call, glDeleteRenderbuffers); break;
+        case GL_CAPTURE_OP_CREATE_SHADER: replay->shaders[a[1]] = glCreateShader(a[0]); break;
+        case GL_CAPTURE_OP_SHADER_SOURCE: {
+            const GLchar* source = reinterpret_cast<const GLchar*>(call.blob);
+            const GLint length = static_cast<GLint>(call.record.blobBytes);
+            glShaderSource(lookup(replay->shaders, a[0]), 1, &source, &length);
+            break;
+        }
+        case GL_CAPTURE_OP_COMPILE_SHADER: glCompileShader(lookup(replay->shaders, a[0])); break;
+        case GL_CAPTURE_OP_DELETE_SHADER:
+            glDeleteShader(lookup(replay->shaders, a[0]));
+            replay->shaders.erase(a[0]);
+            break;
+        case GL_CAPTURE_OP_CREATE_PROGRAM: replay->programs[a[0]] = glCreateProgram(); break;
+        case GL_CAPTURE_OP_ATTACH_SHADER:
+            glAttachShader(lookup(replay->programs, a[0]), lookup(replay->shaders, a[1]));
+            break;
+        case GL_CAPTURE_OP_LINK_PROGRAM: glLinkProgram(lookup(replay->programs, a[0])); break;
+        case GL_CAPTURE_OP_DELETE_PROGRAM:
+            glDeleteProgram(lookup(replay->programs, a[0]));
+            replay->programs.erase(a[0]);
+            break;
+        case GL_CAPTURE_OP_GET_UNIFORM_LOCATION:
+            replay->uniforms[(static_cast<uint64_t>(a[0]) << 32) | a[1]] =
+                    glGetUniformLocation(lookup(replay->programs, a[0]), reinterpret_cast<const GLchar*>(call.blob));
+            break;
+        case GL_CAPTURE_OP_BUFFER_DATA: glBufferData(a[0], a[1], call.blob, a[2]); break;
+        case GL_CAPTURE_OP_BUFFER_SUB_DATA: glBufferSubData(a[0], a[1], a[2], call.blob); break;
+        case GL_CAPTURE_OP_TEX_STORAGE_3D: glTexStorage3D(a[0], a[1], a[2], a[3], a[4], a[5]); break;
+        case GL_CAPTURE_OP_RENDERBUFFER_STORAGE: glRenderbufferStorage(a[0], a[1], a[2], a[3]); break;
+        case GL_CAPTURE_OP_VERTEX_ATTRIB_POINTER:
+            glVertexAttribPointer(a[0], a[1], a[2], static_cast<GLboolean>(a[3]), a[4], offset(a[5]));
+            break;
+        case GL_CAPTURE_OP_ENABLE_VERTEX_ATTRIB_ARRAY: glEnableVertexAttribArray(a[0]); break;
+        case GL_CAPTURE_OP_BIND_BUFFER: glBindBuffer(a[0], lookup(replay->buffers, a[1])); break;
+        case GL_CAPTURE_OP_BIND_VERTEX_ARRAY: glBindVertexArray(lookup(replay->vertexArrays, a[0])); break;
+        case GL_CAPTURE_OP_BIND_TEXTURE: glBindTexture(a[0], lookup(replay->textures, a[1])); break;
+        case GL_CAPTURE_OP_BIND_FRAMEBUFFER: glBindFramebuffer(a[0], lookup(replay->framebuffers, a[1])); break;
+        case GL_CAPTURE_OP_BIND_RENDERBUFFER: glBindRenderbuffer(a[0], lookup(replay->renderbuffers, a[1])); break;
+        case GL_CAPTURE_OP_FRAMEBUFFER_TEXTURE_LAYER:
+            glFramebufferTextureLayer(a[0], a[1], lookup(replay->textures, a[2]), a[3], a[4]);
+            break;
+        case GL_CAPTURE_OP_FRAMEBUFFER_RENDERBUFFER:
+            glFramebufferRenderbuffer(a[0], a[1], a[2], lookup(replay->renderbuffers, a[3]));
+            break;
+        case GL_CAPTURE_OP_USE_PROGRAM:
+            replay->program = a[0];
+            glUseProgram(lookup(replay->programs, a[0]));
+            break;
+        case GL_CAPTURE_OP_VIEWPORT: glViewport(a[0], a[1], a[2], a[3]); break;
+        case GL_CAPTURE_OP_CLEAR_COLOR: glClearColor(asFloat(a[0]), asFloat(a[1]), asFloat(a[2]), asFloat(a[3])); break;
+        case GL_CAPTURE_OP_CLEAR: glClear(a[0]); break;
+        case GL_CAPTURE_OP_ENABLE: glEnable(a[0]); break;
+        case GL_CAPTURE_OP_DISABLE: glDisable(a[0]); break;
+        case GL_CAPTURE_OP_DEPTH_FUNC: glDepthFunc(a[0]); break;
+        case GL_CAPTURE_OP_DEPTH_MASK: glDepthMask(static_cast<GLboolean>(a[0])); break;
+        case GL_CAPTURE_OP_BLEND_FUNC: glBlendFunc(a[0], a[1]); break;
+        case GL_CAPTURE_OP_UNIFORM_1F: glUniform1f(uniform(replay, a[0]), asFloat(a[1])); break;
+        case GL_CAPTURE_OP_UNIFORM_3F:
+            glUniform3f(uniform(replay, a[0]), asFloat(a[1]), asFloat(a[2]), asFloat(a[3]));
+            break;
+        case GL_CAPTURE_OP_UNIFORM_MATRIX_4FV:
+            glUniformMatrix4fv(uniform(replay, a[0]), a[1], static_cast<GLboolean>(a[2]),
+                               reinterpret_cast<const GLfloat*>(call.blob));
+            break;
+        case GL_CAPTURE_OP_DRAW_ELEMENTS: glDrawElements(a[0], a[1], a[2], offset(a[3])); break;
+        case GL_CAPTURE_OP_FLUSH: glFlush(); break;
+        case GL_CAPTURE_OP_FINISH: glFinish(); break;
+        case GL_CAPTURE_OP_XR_SWAPCHAIN_IMAGE: {
+            GLuint texture;
+            glGenTextures(1, &texture);
+            glBindTexture(a[0], texture);
+            if (a[0] == GL_TEXTURE_2D_ARRAY) {
+                glTexStorage3D(GL_TEXTURE_2D_ARRAY, 1, a[2], a[3], a[4], a[5]);
+            } else {
+                glTexStorage2D(GL_TEXTURE_2D, 1, a[2], a[3], a[4]);
+            }
+            glBindTexture(a[0], 0);
+            replay->textures[a[1]] = texture;
+            break;
+        }
+        case GL_CAPTURE_OP_FRAME_BEGIN:
+        case GL_CAPTURE_OP_FRAME_END:
+        case GL_CAPTURE_OP_XR_WAIT_FRAME:
+        case GL_CAPTURE_OP_XR_BEGIN_FRAME:
+        case GL_CAPTURE_OP_XR_ACQUIRE_SWAPCHAIN_IMAGE:
+        case GL_CAPTURE_OP_XR_WAIT_SWAPCHAIN_IMAGE:
+        case GL_CAPTURE_OP_XR_LOCATE_VIEWS:
+        case GL_CAPTURE_OP_XR_RELEASE_SWAPCHAIN_IMAGE:
+        case GL_CAPTURE_OP_XR_END_FRAME:
+            return false;
+        default:
+            ++replay->unknownCalls;
+            return false;
+    }
+    return true;
+}
+
+// Runs calls [begin, end), timing those inside frames.
+static void runRange(GlReplay* replay, const GlCaptureStream& stream, size_t begin, size_t end) {
+    bool inFrame = false;
+    uint64_t frameStart = 0;
+    for (size_t i = begin; i < end; ++i) {
+        const GlCaptureCall& call = stream.calls[i];
+        const uint16_t op = call.record.op;
+        if (op == GL_CAPTURE_OP_FRAME_BEGIN) {
+            inFrame = true;
+            frameStart = nowNs();
+            continue;
+        }
+        if (op == GL_CAPTURE_OP_FRAME_END) {
+            glFinish();
+            replay->frames.push_back({nowNs() - frameStart, call.record.durationNs});
+            inFrame = false;
+            continue;
+        }
+        const uint64_t start = nowNs();
+        const bool executed = execute(replay, call);
+        if (executed && replay->finishEachCall) {
+            glFinish();
+        }
+        const uint64_t elapsed = executed ? nowNs() - start : 0;
+        if (!inFrame) {
+            replay->setupNs += elapsed;
+        } else if (op < GL_CAPTURE_OP_COUNT) {
+            GlReplayOpStats& stats = replay->ops[op];
+            ++stats.calls;
+            stats.hostNs += elapsed;
+            stats.deviceNs += call.record.durationNs;
+        }
+    }
+}
+
+bool glReplayRun(GlReplay* replay, const GlCaptureStream& stream, uint32_t repeat) {
+    // The recorded frames are contiguous; everything before and after them is setup / teardown.
+    size_t firstFrame = stream.calls.size();
+    size_t lastFrameEnd = 0;
+    for (size_t i = 0; i < stream.calls.size(); ++i) {
+        if (stream.calls[i].record.op == GL_CAPTURE_OP_FRAME_BEGIN) {
+            firstFrame = std::min(firstFrame, i);
+        } else if (stream.calls[i].record.op == GL_CAPTURE_OP_FRAME_END) {
+            lastFrameEnd = i + 1;
+        }
+    }
+    if (lastFrameEnd <= firstFrame) {
+        return false;
+    }
+    runRange(replay, stream, 0, firstFrame);
+    for (uint32_t pass = 0; pass < std::max(repeat, 1u); ++pass) {
+        runRange(replay, stream, firstFrame, lastFrameEnd);
+    }
+    glFinish();
+    return true;
+}
+
+GLuint glReplayTexture(const GlReplay* replay, uint32_t capturedName) {
+    auto it = replay->textures.find(capturedName);
+    return it != replay->textures.end() ? it->second : 0;
+}
+
+void glReplayPrint(const GlReplay* replay, FILE* out) {
+    const size_t frameCount = replay->frames.size();
+    if (frameCount == 0) {
+        fprintf(out, "no frames\n");
+        return;
+    }
+    std::vector<uint64_t> host(frameCount);
+    uint64_t hostTotal = 0;
+    uint64_t deviceTotal = 0;
+    for (size_t i = 0; i < frameCount; ++i) {
+        host[i] = replay->frames[i].hostNs;
+        hostTotal += host[i];
+        deviceTotal += replay->frames[i].deviceNs;
+    }
+    std::sort(host.begin(), host.end());
+    fprintf(out, "%zu frames, setup %.3f ms\n", frameCount, replay->setupNs / 1e6);
+    fprintf(out, "frame ms: host mean %.3f p50 %.3f p99 %.3f max %.3f, device mean %.3f\n",
+            hostTotal / 1e6 / frameCount, host[frameCount / 2] / 1e6, host[frameCount * 99 / 100] / 1e6,
+            host.back() / 1e6, deviceTotal / 1e6 / frameCount);
+    fprintf(out, "%-28s %10s %12s %12s %8s\n", "call", "per frame", "host us", "device us", "host %");
+    for (uint16_t op = 0; op < GL_CAPTURE_OP_COUNT; ++op) {
+        const GlReplayOpStats& stats = replay->ops[op];
+        if (stats.calls == 0) {
+            continue;
+        }
+        const bool xr = op >= GL_CAPTURE_OP_XR_SWAPCHAIN_IMAGE;
+        char hostUs[32] = "-";
+        if (!xr) {
+            snprintf(hostUs, sizeof(hostUs), "%.2f", stats.hostNs / 1e3 / stats.calls);
+        }
+        fprintf(out, "%-28s %10.1f %12s %12.2f %7.1f%%\n", glCaptureOpName(op),
+                static_cast<double>(stats.calls) / frameCount, hostUs, stats.deviceNs / 1e3 / stats.calls,
+                hostTotal ? 100.0 * stats.hostNs / hostTotal : 0.0);
+    }
+    if (replay->unknownCalls) {
+        fprintf(out, "%u call(s) of unknown kind skipped\n", replay->unknownCalls);
+    }
+}
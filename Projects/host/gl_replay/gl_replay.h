@@ -0,0 +1,63 @@
+//
+// Replays a GL capture (gl_capture.h) on the calling thread's current GLES3 context, timing
+// every call.
+//
+// GL names and uniform locations are mapped to the ones this context hands out; the runtime's
+// swapchain images become textures of the same shape. The OpenXR frame calls are not executed
+// (there is no runtime): they are counted with their device timing only. Everything outside
+// the recorded frames runs once; the frames then run `repeat` times, each ended with glFinish so
+// its host time includes the GPU. With finishEachCall every call is followed by glFinish, which
+// moves GPU time onto the call that caused it.
+//
+
+#ifndef ANDROIDSAMSUNG_GL_REPLAY_H
+#define ANDROIDSAMSUNG_GL_REPLAY_H
+
+#include <GLES3/gl3.h>
+#include <cstdint>
+#include <cstdio>
+#include <unordered_map>
+#include <vector>
+
+#include "gl_capture.h"
+
+struct GlReplayOpStats {
+    uint64_t calls = 0;
+    uint64_t hostNs = 0;
+    uint64_t deviceNs = 0;
+};
+
+struct GlReplayFrame {
+    uint64_t hostNs = 0;
+    uint64_t deviceNs = 0;
+};
+
+struct GlReplay {
+    bool finishEachCall = false;
+
+    std::unordered_map<uint32_t, GLuint> buffers;
+    std::unordered_map<uint32_t, GLuint> vertexArrays;
+    std::unordered_map<uint32_t, GLuint> textures;
+    std::unordered_map<uint32_t, GLuint> framebuffers;
+    std::unordered_map<uint32_t, GLuint> renderbuffers;
+    std::unordered_map<uint32_t, GLuint> shaders;
+    std::unordered_map<uint32_t, GLuint> programs;
+    // (captured program << 32) | captured location -> location here
+    std::unordered_map<uint64_t, GLint> uniforms;
+    uint32_t program = 0; // captured name of the program in use
+
+    // Frame calls only; setup is not the workload.
+    GlReplayOpStats ops[GL_CAPTURE_OP_COUNT];
+    std::vector<GlReplayFrame> frames;
+    uint64_t setupNs = 0;
+    uint32_t unknownCalls = 0;
+};
+
+// Needs a current GLES3 context. False if the stream has no frames.
+bool glReplayRun(GlReplay* replay, const GlCaptureStream& stream, uint32_t repeat);
+// This context's name for a captured texture (0 if it never existed).
+GLuint glReplayTexture(const GlReplay* replay, uint32_t capturedName);
+// Frame times, and per call kind the count per frame, host and device time.
+void glReplayPrint(const GlReplay* replay, FILE* out);
+
+#endif //ANDROIDSAMSUNG_GL_REPLAY_H
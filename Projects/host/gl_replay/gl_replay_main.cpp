@@ -0,0 +1,87 @@
+//
+// Replays GL captures (common/cpp/gl_capture.h) on the build machine and reports where the
+// frame time goes. Given a second capture, both are replayed the same way and the frame-time
+// change printed, for comparing a change against its baseline:
+//
+//   adb pull /data/data/<package>/files/capture.glc before.glc   (then again after the change)
+//   gl_replay before.glc after.glc --repeat 20
+//
+// Host times are this machine's (software Mesa when there is no GPU); the device column is
+// what the calls took on the device that captured them.
+//
+// Usage: gl_replay <capture.glc> [candidate.glc] [--repeat N=10] [--finish-each]
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "gl_replay.h"
+#include "host_egl.h"
+
+static bool replay(const char* path, uint32_t repeat, bool finishEachCall, double* meanMs) {
+    GlCaptureStream stream;
+    if (!glCaptureLoad(path, &stream)) {
+        fprintf(stderr, "%s: not a GL capture\n", path);
+        return false;
+    }
+    // A context per capture, so one's objects and state can't leak into the other.
+    HostEgl egl;
+    if (!hostEglInit(&egl)) {
+        fprintf(stderr, "No EGL context\n");
+        return false;
+    }
+    GlReplay result;
+    result.finishEachCall = finishEachCall;
+    const bool ok = glReplayRun(&result, stream, repeat);
+    hostEglDestroy(&egl);
+    if (!ok) {
+        fprintf(stderr, "%s: no frames recorded\n", path);
+        return false;
+    }
+
+    printf("== %s (%u frames x %u)\n", path, stream.header.frameCount, repeat);
+    glReplayPrint(&result, stdout);
+    uint64_t total = 0;
+    for (const GlReplayFrame& frame : result.frames) {
+        total += frame.hostNs;
+    }
+    *meanMs = total / 1e6 / result.frames.size();
+    return true;
+}
+
+int main(int argc, char** argv) {
+    const char* paths[2] = {};
+    int pathCount = 0;
+    uint32_t repeat = 10;
+    bool finishEachCall = false;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = static_cast<uint32_t>(atoi(argv[++i]));
+        } else if (strcmp(argv[i], "--finish-each") == 0) {
+            finishEachCall = true;
+        } else if (argv[i][0] != '-' && pathCount < 2) {
+            paths[pathCount++] = argv[i];
+        } else {
+            pathCount = 0;
+            break;
+        }
+    }
+    if (pathCount == 0) {
+        fprintf(stderr, "Usage: %s <capture.glc> [candidate.glc] [--repeat N] [--finish-each]\n", argv[0]);
+        return 2;
+    }
+
+    double meanMs[2] = {};
+    for (int i = 0; i < pathCount; ++i) {
+        if (!replay(paths[i], repeat, finishEachCall, &meanMs[i])) {
+            return 1;
+        }
+        printf("\n");
+    }
+    if (pathCount == 2) {
+        printf("frame mean %.3f -> %.3f ms (%+.1f%%)\n", meanMs[0], meanMs[1],
+               100.0 * (meanMs[1] - meanMs[0]) / meanMs[0]);
+    }
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include "host_egl.h"
+
+#include <android/log.h>
+#include <EGL/eglext.h>
+
+#define TAG "HostEgl"
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+bool hostEglInit(HostEgl* egl) {
+    auto getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+    if (getPlatformDisplay == nullptr) {
+        LOGE("eglGetPlatformDisplayEXT is not available");
+        return false;
+    }
+    egl->display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+    if (egl->display == EGL_NO_DISPLAY || !eglInitialize(egl->display, nullptr, nullptr)) {
+        LOGE("Surfaceless EGL display unavailable: 0x%X", eglGetError());
+        return false;
+    }
+    eglBindAPI(EGL_OPENGL_ES_API);
+
+    // Surfaceless Mesa has no window-surface configs (eglChooseConfig's default); pbuffer ones it has.
+    const EGLint configAttribs[] = { EGL_RENDERABLE_TYPE, EGL_OPENGL_ES3_BIT, EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+                                     EGL_NONE };
+    EGLint numConfigs = 0;
+    if (!eglChooseConfig(egl->display, configAttribs, &egl->config, 1, &numConfigs) || numConfigs == 0) {
+        LOGE("No GLES3 EGL config: 0x%X", eglGetError());
+        eglTerminate(egl->display);
+        egl->display = EGL_NO_DISPLAY;
+        return false;
+    }
+
+    const EGLint contextAttribs[] = { EGL_CONTEXT_CLIENT_VERSION, 3, EGL_NONE };
+    egl->context = eglCreateContext(egl->display, egl->config, EGL_NO_CONTEXT, contextAttribs);
+    if (egl->context == EGL_NO_CONTEXT) {
+        LOGE("eglCreateContext failed: 0x%X", eglGetError());
+        eglTerminate(egl->display);
+        egl->display = EGL_NO_DISPLAY;
+        return false;
+    }
+    eglMakeCurrent(egl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, egl->context);
+    return true;
+}
+
+void hostEglDestroy(HostEgl* egl) {
+    if (egl->display == EGL_NO_DISPLAY) {
+        return;
+    }
+    eglMakeCurrent(egl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (egl->context != EGL_NO_CONTEXT) {
+        eglDestroyContext(egl->display, egl->context);
+    }
+    eglTerminate(egl->display);
+    egl->display = EGL_NO_DISPLAY;
+    egl->context = EGL_NO_CONTEXT;
+}
+
+bool hostEglInitContext(HostEgl* egl, const HostEgl& display) {
+    egl->display = display.display;
+    egl->config = display.config;
+    eglBindAPI(EGL_OPENGL_ES_API);
+    const EGLint contextAttribs[] = { EGL_CONTEXT_CLIENT_VERSION, 3, EGL_NONE };
+    egl->context = eglCreateContext(egl->display, egl->config, EGL_NO_CONTEXT, contextAttribs);
+    if (egl->context == EGL_NO_CONTEXT) {
+        LOGE("eglCreateContext failed: 0x%X", eglGetError());
+        egl->display = EGL_NO_DISPLAY;
+        return false;
+    }
+    eglMakeCurrent(egl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, egl->context);
+    return true;
+}
+
+void hostEglDestroyContext(HostEgl* egl) {
+    if (egl->display == EGL_NO_DISPLAY) {
+        return;
+    }
+    eglMakeCurrent(egl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglDestroyContext(egl->display, egl->context);
+    egl->display = EGL_NO_DISPLAY;
+    egl->context = EGL_NO_CONTEXT;
+}
@@ -0,0 +1,26 @@
+//
+// Surfaceless EGL + GLES3 context for running native code on a build machine
+// (EGL_MESA_platform_surfaceless, software Mesa when there is no GPU).
+//
+
+#ifndef ANDROIDSAMSUNG_HOST_EGL_H
+#define ANDROIDSAMSUNG_HOST_EGL_H
+
+#include <EGL/egl.h>
+
+struct HostEgl {
+    EGLDisplay display = EGL_NO_DISPLAY;
+    EGLConfig config = nullptr;
+    EGLContext context = EGL_NO_CONTEXT;
+};
+
+// Creates a display, a GLES3 context and makes it current on the calling thread.
+bool hostEglInit(HostEgl* egl);
+void hostEglDestroy(HostEgl* egl);
+
+// Another context on `display`'s display, current on the calling thread: one per app thread,
+// as each app has its own. Destroy it with hostEglDestroyContext before the display goes.
+bool hostEglInitContext(HostEgl* egl, const HostEgl& display);
+void hostEglDestroyContext(HostEgl* egl);
+
+#endif //ANDROIDSAMSUNG_HOST_EGL_H
@@ -0,0 +1,131 @@
+#include "display_clock.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <ctime>
+
+#define NO_DISPLAY_PERIOD_NS (1000000000ll / 90)
+
+static uint64_t monotonicNs() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+// splitmix64: a well-mixed 64-bit value per (seed, vsync).
+static uint64_t mix(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ull;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+void displayClockInit(DisplayClock* clock, const DisplayClockConfig& config) {
+    clock->config = config;
+    clock->periodNs = config.refreshHz > 0.0 ? static_cast<XrDuration>(1e9 / config.refreshHz) : 0;
+    const XrDuration maxJitterNs = clock->periodNs / 2 - 1;
+    if (clock->config.jitterNs > maxJitterNs) {
+        clock->config.jitterNs = maxJitterNs > 0 ? maxJitterNs : 0;
+    }
+    clock->virtualNowNs = DISPLAY_CLOCK_VIRTUAL_START_NS;
+    clock->lastVsync = 0;
+    clock->frames = 0;
+    clock->missedVsyncs = 0;
+    clock->stalls = 0;
+}
+
+void displayClockConfigFromEnv(DisplayClockConfig* config) {
+    if (const char* value = getenv("MOCK_XR_DISPLAY_HZ")) {
+        config->refreshHz = atof(value);
+    }
+    if (const char* value = getenv("MOCK_XR_LATENCY_US")) {
+        config->compositorLatencyNs = atoll(value) * 1000;
+    }
+    if (const char* value = getenv("MOCK_XR_JITTER_US")) {
+        config->jitterNs = atoll(value) * 1000;
+    }
+    if (const char* value = getenv("MOCK_XR_STALL_EVERY")) {
+        config->stallInterval = static_cast<uint32_t>(atoi(value));
+    }
+    if (const char* value = getenv("MOCK_XR_STALL_US")) {
+        config->stallNs = atoll(value) * 1000;
+    }
+    if (const char* value = getenv("MOCK_XR_SEED")) {
+        config->seed = strtoull(value, nullptr, 0);
+    }
+    if (const char* value = getenv("MOCK_XR_VIRTUAL_TIME")) {
+        config->virtualTime = atoi(value) != 0;
+    }
+}
+
+uint64_t displayClockNow(const DisplayClock* clock) {
+    return clock->config.virtualTime ? clock->virtualNowNs : monotonicNs();
+}
+
+void displayClockAdvance(DisplayClock* clock, uint64_t ns) {
+    displayClockSleepUntil(clock, displayClockNow(clock) + ns);
+}
+
+void displayClockSleepUntil(DisplayClock* clock, uint64_t ns) {
+    if (clock->config.virtualTime) {
+        if (ns > clock->virtualNowNs) {
+            clock->virtualNowNs = ns;
+        }
+        return;
+    }
+    timespec ts;
+    ts.tv_sec = static_cast<time_t>(ns / 1000000000ull);
+    ts.tv_nsec = static_cast<long>(ns % 1000000000ull);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {
+    }
+}
+
+uint64_t displayClockVsyncNs(const DisplayClock* clock, uint64_t vsync) {
+    const uint64_t idealNs = vsync * static_cast<uint64_t>(clock->periodNs);
+    const XrDuration jitterNs = clock->config.jitterNs;
+    if (jitterNs <= 0 || vsync == 0) {
+        return idealNs;
+    }
+    // Uniform in [-jitter, +jitter].
+    const uint64_t span = 2 * static_cast<uint64_t>(jitterNs) + 1;
+    const int64_t offset = static_cast<int64_t>(mix(clock->config.seed ^ mix(vsync)) % span) - jitterNs;
+    return static_cast<uint64_t>(static_cast<int64_t>(idealNs) + offset);
+}
+
+DisplayClockFrame displayClockNextFrame(DisplayClock* clock, uint64_t nowNs) {
+    DisplayClockFrame frame = {};
+    clock->frames++;
+    if (clock->periodNs <= 0) {
+        frame.vsync = ++clock->lastVsync;
+        frame.wakeNs = nowNs;
+        frame.periodNs = NO_DISPLAY_PERIOD_NS;
+        frame.displayTime = static_cast<XrTime>(nowNs + NO_DISPLAY_PERIOD_NS + clock->config.compositorLatencyNs);
+        return frame;
+    }
+
+    // Vsync nowNs / period - 1 is at least half a period before now, so the search starts one
+    // after it.
+    uint64_t vsync = nowNs / static_cast<uint64_t>(clock->periodNs);
+    while (vsync == 0 || displayClockVsyncNs(clock, vsync) <= nowNs) {
+        ++vsync;
+    }
+    if (vsync <= clock->lastVsync) {
+        vsync = clock->lastVsync + 1;
+    }
+    if (clock->lastVsync != 0) {
+        frame.missedVsyncs = static_cast<uint32_t>(vsync - clock->lastVsync - 1);
+        clock->missedVsyncs += frame.missedVsyncs;
+    }
+    clock->lastVsync = vsync;
+
+    const uint64_t vsyncNs = displayClockVsyncNs(clock, vsync);
+    frame.vsync = vsync;
+    frame.wakeNs = vsyncNs;
+    if (clock->config.stallInterval != 0 && vsync % clock->config.stallInterval == 0) {
+        frame.wakeNs += static_cast<uint64_t>(clock->config.stallNs);
+        clock->stalls++;
+    }
+    frame.periodNs = clock->periodNs;
+    frame.displayTime = static_cast<XrTime>(vsyncNs + clock->periodNs + clock->config.compositorLatencyNs);
+    return frame;
+}
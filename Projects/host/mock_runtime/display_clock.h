@@ -0,0 +1,73 @@
+//
+// Simulated display for the mock runtime.
+//
+// Vsync k of a display at refreshHz lands at k * period (CLOCK_MONOTONIC), moved by up to
+// +-jitterNs. Each vsync's offset is a hash of (seed, k), so a given configuration produces the
+// same vsync times however the frame loop behaves. Every stallInterval-th vsync the compositor
+// releases the app stallNs late, as it does when it misses its own deadline.
+//
+// xrWaitFrame releases a frame on the first vsync after the call, never twice on the same one;
+// vsyncs passed over because the app was late are counted as missed. The frame's
+// predictedDisplayTime is its vsync plus one period to render plus compositorLatencyNs.
+//
+// With virtualTime the clock doesn't follow CLOCK_MONOTONIC: it only moves when xrWaitFrame
+// "blocks" or the app reports simulated work (displayClockAdvance), so whole runs are exactly
+// reproducible and take no wall time.
+//
+
+#ifndef ANDROIDSAMSUNG_DISPLAY_CLOCK_H
+#define ANDROIDSAMSUNG_DISPLAY_CLOCK_H
+
+#include <cstdint>
+
+#include <openxr/openxr.h>
+
+// Virtual time starts here rather than at 0, which is not a valid XrTime.
+#define DISPLAY_CLOCK_VIRTUAL_START_NS 1000000000ull
+
+struct DisplayClockConfig {
+    double refreshHz = 90.0;         // 0 = no display: frames are released at once (reported as 90 Hz)
+    XrDuration compositorLatencyNs = 0;
+    XrDuration jitterNs = 0;         // clamped below half a period so vsyncs stay in order
+    uint32_t stallInterval = 0;      // 0 = no stalls
+    XrDuration stallNs = 0;
+    uint64_t seed = 1;
+    bool virtualTime = false;
+};
+
+struct DisplayClock {
+    DisplayClockConfig config;
+    XrDuration periodNs = 0;
+    uint64_t virtualNowNs = 0;
+    uint64_t lastVsync = 0;          // vsync the last frame was released on, 0 = none yet
+
+    uint64_t frames = 0;
+    uint64_t missedVsyncs = 0;
+    uint64_t stalls = 0;
+};
+
+struct DisplayClockFrame {
+    uint64_t vsync;                  // index
+    uint64_t wakeNs;                 // when xrWaitFrame returns
+    XrTime displayTime;
+    XrDuration periodNs;
+    uint32_t missedVsyncs;           // vsyncs since the previous frame that got no frame
+};
+
+void displayClockInit(DisplayClock* clock, const DisplayClockConfig& config);
+// Overrides `config` fields from MOCK_XR_DISPLAY_HZ, MOCK_XR_LATENCY_US, MOCK_XR_JITTER_US,
+// MOCK_XR_STALL_EVERY, MOCK_XR_STALL_US, MOCK_XR_SEED and MOCK_XR_VIRTUAL_TIME when set.
+void displayClockConfigFromEnv(DisplayClockConfig* config);
+
+uint64_t displayClockNow(const DisplayClock* clock);
+// Simulated work: moves virtual time forward, sleeps for real time.
+void displayClockAdvance(DisplayClock* clock, uint64_t ns);
+uint64_t displayClockVsyncNs(const DisplayClock* clock, uint64_t vsync);
+
+// Picks the vsync the next frame is released on, given the current time. The caller then
+// blocks until wakeNs with displayClockSleepUntil.
+DisplayClockFrame displayClockNextFrame(DisplayClock* clock, uint64_t nowNs);
+// Sleeps until `ns` (CLOCK_MONOTONIC), or moves virtual time there.
+void displayClockSleepUntil(DisplayClock* clock, uint64_t ns);
+
+#endif //ANDROIDSAMSUNG_DISPLAY_CLOCK_H
@@ -0,0 +1,1312 @@
+#include "mock_runtime.h"
+
+#include <EGL/egl.h>
+#include <GLES3/gl3.h>
+#include <jni.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#define XR_USE_PLATFORM_ANDROID
+#define XR_USE_GRAPHICS_API_OPENGL_ES
+#include <openxr/openxr_platform.h>
+
+#include <android/log.h>
+
+#include "reference_compositor.h"
+
+#define TAG "MockRuntime"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+#define MOCK_EXPORT extern "C" __attribute__((visibility("default")))
+
+// --- Loader interface ---
+// From the loader's loader_interfaces.h, which the vendored headers don't include. The layout is
+// fixed by the loader/runtime interface version 1.
+
+enum XrLoaderInterfaceStructs {
+    XR_LOADER_INTERFACE_STRUCT_UNINTIALIZED = 0,
+    XR_LOADER_INTERFACE_STRUCT_LOADER_INFO,
+    XR_LOADER_INTERFACE_STRUCT_API_LAYER_REQUEST,
+    XR_LOADER_INTERFACE_STRUCT_RUNTIME_REQUEST,
+};
+
+#define XR_LOADER_INFO_STRUCT_VERSION 1
+#define XR_RUNTIME_INFO_STRUCT_VERSION 1
+#define XR_CURRENT_LOADER_RUNTIME_VERSION 1
+
+struct XrNegotiateLoaderInfo {
+    XrLoaderInterfaceStructs structType;
+    uint32_t structVersion;
+    size_t structSize;
+    uint32_t minInterfaceVersion;
+    uint32_t maxInterfaceVersion;
+    XrVersion minApiVersion;
+    XrVersion maxApiVersion;
+};
+
+struct XrNegotiateRuntimeRequest {
+    XrLoaderInterfaceStructs structType;
+    uint32_t structVersion;
+    size_t structSize;
+    uint32_t runtimeInterfaceVersion;
+    XrVersion runtimeApiVersion;
+    PFN_xrGetInstanceProcAddr getInstanceProcAddr;
+};
+
+// --- Objects ---
+
+struct MockSession;
+struct MockSwapchain;
+
+// A swapchain image as the compositor sees it, read back once per submitted frame.
+struct MockReadback {
+    const MockSwapchain* swapchain = nullptr;
+    uint32_t arrayIndex = 0;
+    uint64_t frame = 0;
+    CompositorImage image;
+};
+
+// One ended frame's layers, their images read back on the app's context. A deque keeps the
+// images where the layers point while more are read back.
+struct MockSubmission {
+    uint64_t frame = 0;
+    std::deque<MockReadback> readbacks;
+    CompositorLayer layers[MOCK_RUNTIME_MAX_LAYERS];
+    uint32_t layerCount = 0;
+    XrEnvironmentBlendMode blendMode = XR_ENVIRONMENT_BLEND_MODE_OPAQUE;
+};
+
+struct MockInstance {
+    bool overlayEnabled = false;
+    MockSession* session = nullptr; // one at a time, as the spec allows
+
+    std::mutex eventMutex;
+    std::deque<XrEventDataBuffer> events;
+};
+
+struct MockSession {
+    MockInstance* instance = nullptr;
+    bool overlay = false;
+    DisplayClock clock; // under mutex
+
+    std::mutex mutex;
+    std::condition_variable cond;
+    XrSessionState state = XR_SESSION_STATE_UNKNOWN;
+    bool running = false;
+    bool exitRequested = false;
+    bool synchronized = false;
+    bool waitPending = false; // waited, not yet begun
+    bool frameBegun = false;
+    MockRuntimeStats stats;
+
+    // Reference compositing (reference_compositor.h), off by default. xrEndFrame reads the
+    // layers back into `pending` and hands it to the display, which composes from `shown`.
+    bool compositing = false;
+    uint32_t placement = 0; // overlays: sessionLayersPlacement
+    GLuint readFramebuffer = 0;
+    bool warnedNoContext = false;
+    MockSubmission pending;
+    MockSubmission shown; // under g_display.mutex
+};
+
+// The display all sessions' layers end up on. Each display time is composed once, by the first
+// xrEndFrame that targets it, from the latest frame of every compositing session: the main
+// session's layers at the bottom, then the overlays by sessionLayersPlacement and creation order.
+struct MockDisplay {
+    std::mutex mutex;
+    std::vector<MockSession*> sessions; // creation order
+    std::vector<MockSession*> stack;    // scratch: contributing sessions, bottom to top
+    std::string dumpDir;
+    ReferenceCompositor compositor;
+    XrTime composedTime = 0;
+    bool layersDropped = false;
+    MockDisplayStats stats;
+};
+
+struct MockSpace {
+    MockSession* session = nullptr;
+    XrReferenceSpaceType type = XR_REFERENCE_SPACE_TYPE_LOCAL;
+    XrPosef pose = {{0, 0, 0, 1}, {0, 0, 0}};
+};
+
+struct MockSwapchain {
+    MockSession* session = nullptr;
+    GLenum target = GL_TEXTURE_2D;
+    int64_t format = 0;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    GLuint images[MOCK_RUNTIME_IMAGE_COUNT] = {};
+    uint32_t nextIndex = 0;
+    int32_t lastReleased = -1;
+    // Images go out in index order, so the acquired ones are the `acquiredCount` before
+    // nextIndex; the oldest of them is waited and released next.
+    uint32_t acquiredCount = 0;
+    bool frontWaited = false;
+};
+
+static const XrSystemId kSystemId = 1;
+static std::mutex g_clockConfigMutex;
+static DisplayClockConfig g_clockConfig;
+static bool g_clockConfigured = false;
+static MockDisplay g_display;
+static std::atomic<void (*)(XrSession, void*)> g_frameHook{nullptr};
+static void* g_frameHookData = nullptr;
+
+static const char* const kExtensions[] = {
+        XR_KHR_ANDROID_CREATE_INSTANCE_EXTENSION_NAME,
+        XR_KHR_OPENGL_ES_ENABLE_EXTENSION_NAME,
+        XR_EXTX_OVERLAY_EXTENSION_NAME,
+};
+static const uint32_t kExtensionVersions[] = {
+        XR_KHR_android_create_instance_SPEC_VERSION,
+        XR_KHR_opengl_es_enable_SPEC_VERSION,
+        XR_EXTX_overlay_SPEC_VERSION,
+};
+static const XrEnvironmentBlendMode kBlendModes[] = {
+        XR_ENVIRONMENT_BLEND_MODE_OPAQUE,
+        XR_ENVIRONMENT_BLEND_MODE_ADDITIVE,
+        XR_ENVIRONMENT_BLEND_MODE_ALPHA_BLEND,
+};
+static const XrReferenceSpaceType kSpaceTypes[] = {
+        XR_REFERENCE_SPACE_TYPE_VIEW,
+        XR_REFERENCE_SPACE_TYPE_LOCAL,
+        XR_REFERENCE_SPACE_TYPE_STAGE,
+};
+static const int64_t kSwapchainFormats[] = {GL_SRGB8_ALPHA8, GL_RGBA8, GL_DEPTH24_STENCIL8};
+
+// A head that doesn't move, at the space origin; 63 mm IPD, 90 degree square FOV.
+static void mockView(uint32_t eye, XrPosef* pose, XrFovf* fov) {
+    pose->orientation = {0.0f, 0.0f, 0.0f, 1.0f};
+    pose->position = {eye == 0 ? -0.0315f : 0.0315f, 0.0f, 0.0f};
+    *fov = {-0.785398f, 0.785398f, 0.785398f, -0.785398f};
+}
+
+// For sessions created from now on.
+static DisplayClockConfig clockConfig() {
+    std::lock_guard<std::mutex> lock(g_clockConfigMutex);
+    if (!g_clockConfigured) {
+        g_clockConfig.refreshHz = MOCK_RUNTIME_DEFAULT_HZ;
+        displayClockConfigFromEnv(&g_clockConfig);
+        g_clockConfigured = true;
+    }
+    return g_clockConfig;
+}
+
+// Standard two-call idiom.
+template <typename T, typename Fill>
+static XrResult enumerate(uint32_t capacity, uint32_t* countOutput, T* items, uint32_t count, Fill fill) {
+    if (countOutput == nullptr) {
+        return XR_ERROR_VALIDATION_FAILURE;
+    }
+    *countOutput = count;
+    if (capacity == 0) {
+        return XR_SUCCESS;
+    }
+    if (capacity < count) {
+        return XR_ERROR_SIZE_INSUFFICIENT;
+    }
+    if (items == nullptr) {
+        return XR_ERROR_VALIDATION_FAILURE;
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+        fill(&items[i], i);
+    }
+    return XR_SUCCESS;
+}
+
+static const void* findNext(const void* next, XrStructureType type) {
+    for (auto* header = static_cast<const XrBaseInStructure*>(next); header != nullptr; header = header->next) {
+        if (header->type == type) {
+            return header;
+        }
+    }
+    return nullptr;
+}
+
+// --- Events ---
+
+template <typename T>
+static void pushEvent(MockInstance* instance, const T& event) {
+    XrEventDataBuffer buffer = {};
+    static_assert(sizeof(T) <= sizeof(buffer), "event larger than XrEventDataBuffer");
+    memcpy(&buffer, &event, sizeof(T));
+    std::lock_guard<std::mutex> lock(instance->eventMutex);
+    instance->events.push_back(buffer);
+}
+
+// Caller holds session->mutex.
+static void setState(MockSession* session, XrSessionState state) {
+    session->state = state;
+    XrEventDataSessionStateChanged event = {XR_TYPE_EVENT_DATA_SESSION_STATE_CHANGED};
+    event.session = reinterpret_cast<XrSession>(session);
+    event.state = state;
+    event.time = static_cast<XrTime>(displayClockNow(&session->clock));
+    pushEvent(session->instance, event);
+}
+
+// --- Instance and system ---
+
+static XrResult mockEnumerateInstanceExtensionProperties(const char* layerName, uint32_t capacity,
+                                                         uint32_t* countOutput, XrExtensionProperties* properties) {
+    if (layerName != nullptr) {
+        return XR_ERROR_API_LAYER_NOT_PRESENT;
+    }
+    const uint32_t count = sizeof(kExtensions) / sizeof(kExtensions[0]);
+    return enumerate(capacity, countOutput, properties, count, [](XrExtensionProperties* property, uint32_t i) {
+        strncpy(property->extensionName, kExtensions[i], XR_MAX_EXTENSION_NAME_SIZE - 1);
+        property->extensionVersion = kExtensionVersions[i];
+    });
+}
+
+static XrResult mockInitializeLoaderKHR(const XrLoaderInitInfoBaseHeaderKHR*) {
+    return XR_SUCCESS;
+}
+
+static XrResult mockCreateInstance(const XrInstanceCreateInfo* createInfo, XrInstance* instance) {
+    if (createInfo == nullptr || instance == nullptr || createInfo->type != XR_TYPE_INSTANCE_CREATE_INFO) {
+        return XR_ERROR_VALIDATION_FAILURE;
+    }
+    if (createInfo->enabledApiLayerCount > 0) {
+        return XR_ERROR_API_LAYER_NOT_PRESENT;
+    }
+    auto* mock = new MockInstance();
+    for (uint32_t i = 0; i < createInfo->enabledExtensionCount; ++i) {
+        const char* name = createInfo->enabledExtensionNames[i];
+        bool known = false;
+        for (const char* extension : kExtensions) {
+            known = known || strcmp(name, extension) == 0;
+        }
+        if (!known) {
+            LOGE("Extension %s not supported", name);
+            delete mock;
+            return XR_ERROR_EXTENSION_NOT_PRESENT;
+        }
+        mock->overlayEnabled = mock->overlayEnabled || strcmp(name, XR_EXTX_OVERLAY_EXTENSION_NAME) == 0;
+    }
+    *instance = reinterpret_cast<XrInstance>(mock);
+    return XR_SUCCESS;
+}
+
+static XrResult mockDestroyInstance(XrInstance instance) {
+    if (instance == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    delete reinterpret_cast<MockInstance*>(instance);
+    return XR_SUCCESS;
+}
+
+static XrResult mockGetInstanceProperties(XrInstance instance, XrInstanceProperties* properties) {
+    if (instance == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    properties->runtimeVersion = XR_MAKE_VERSION(0, 1, 0);
+    strncpy(properties->runtimeName, "Headless mock runtime", XR_MAX_RUNTIME_NAME_SIZE - 1);
+    return XR_SUCCESS;
+}
+
+static XrResult mockPollEvent(XrInstance instance, XrEventDataBuffer* eventData) {
+    if (instance == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    auto* mock = reinterpret_cast<MockInstance*>(instance);
+    std::lock_guard<std::mutex> lock(mock->eventMutex);
+    if (mock->events.empty()) {
+        return XR_EVENT_UNAVAILABLE;
+    }
+    *eventData = mock->events.front();
+    mock->events.pop_front();
+    return XR_SUCCESS;
+}
+
+static XrResult mockGetSystem(XrInstance instance, const XrSystemGetInfo* getInfo, XrSystemId* systemId) {
+    if (instance == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    if (getInfo->formFactor != XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY) {
+        return XR_ERROR_FORM_FACTOR_UNSUPPORTED;
+    }
+    *systemId = kSystemId;
+    return XR_SUCCESS;
+}
+
+static XrResult mockGetSystemProperties(XrInstance instance, XrSystemId systemId, XrSystemProperties* properties) {
+    if (instance == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    if (systemId != kSystemId) {
+        return XR_ERROR_SYSTEM_INVALID;
+    }
+    properties->systemId = kSystemId;
+    properties->vendorId = 0;
+    strncpy(properties->systemName, "Mock HMD", XR_MAX_SYSTEM_NAME_SIZE - 1);
+    properties->graphicsProperties.maxSwapchainImageWidth = 4096;
+    properties->graphicsProperties.maxSwapchainImageHeight = 4096;
+    properties->graphicsProperties.maxLayerCount = MOCK_RUNTIME_MAX_LAYERS;
+    properties->trackingProperties.orientationTracking = XR_TRUE;
+    properties->trackingProperties.positionTracking = XR_TRUE;
+    return XR_SUCCESS;
+}
+
+static XrResult mockGetOpenGLESGraphicsRequirementsKHR(XrInstance instance, XrSystemId systemId,
+                                                      XrGraphicsRequirementsOpenGLESKHR* requirements) {
+    if (instance == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    if (systemId != kSystemId) {
+        return XR_ERROR_SYSTEM_INVALID;
+    }
+    requirements->minApiVersionSupported = XR_MAKE_VERSION(3, 0, 0);
+    requirements->maxApiVersionSupported = XR_MAKE_VERSION(3, 2, 0);
+    return XR_SUCCESS;
+}
+
+// --- View configurations and blend modes ---
+
+static XrResult mockEnumerateViewConfigurations(XrInstance instance, XrSystemId systemId, uint32_t capacity,
+                                                uint32_t* countOutput, XrViewConfigurationType* types) {
+    if (instance == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    if (systemId != kSystemId) {
+        return XR_ERROR_SYSTEM_INVALID;
+    }
+    return enumerate(capacity, countOutput, types, 1, [](XrViewConfigurationType* type, uint32_t) {
+        *type = XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO;
+    });
+}
+
+static XrResult mockEnumerateViewConfigurationViews(XrInstance instance, XrSystemId systemId,
+                                                    XrViewConfigurationType type, uint32_t capacity,
+                                                    uint32_t* countOutput, XrViewConfigurationView* views) {
+    if (instance == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    if (systemId != kSystemId) {
+        return XR_ERROR_SYSTEM_INVALID;
+    }
+    if (type != XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO) {
+        return XR_ERROR_VIEW_CONFIGURATION_TYPE_UNSUPPORTED;
+    }
+    return enumerate(capacity, countOutput, views, 2, [](XrViewConfigurationView* view, uint32_t) {
+        view->recommendedImageRectWidth = MOCK_RUNTIME_VIEW_WIDTH;
+        view->recommendedImageRectHeight = MOCK_RUNTIME_VIEW_HEIGHT;
+        view->maxImageRectWidth = 4096;
+        view->maxImageRectHeight = 4096;
+        view->recommendedSwapchainSampleCount = 1;
+        view->maxSwapchainSampleCount = 1;
+    });
+}
+
+static XrResult mockEnumerateEnvironmentBlendModes(XrInstance instance, XrSystemId systemId,
+                                                   XrViewConfigurationType type, uint32_t capacity,
+                                                   uint32_t* countOutput, XrEnvironmentBlendMode* modes) {
+    if (instance == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    if (systemId != kSystemId) {
+        return XR_ERROR_SYSTEM_INVALID;
+    }
+    if (type != XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO) {
+        return XR_ERROR_VIEW_CONFIGURATION_TYPE_UNSUPPORTED;
+    }
+    const uint32_t count = sizeof(kBlendModes) / sizeof(kBlendModes[0]);
+    return enumerate(capacity, countOutput, modes, count, [](XrEnvironmentBlendMode* mode, uint32_t i) {
+        *mode = kBlendModes[i];
+    });
+}
+
+// --- Session ---
+
+static XrResult mockCreateSession(XrInstance instance, const XrSessionCreateInfo* createInfo, XrSession* session) {
+    if (instance == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    auto* mock = reinterpret_cast<MockInstance*>(instance);
+    if (createInfo->systemId != kSystemId) {
+        return XR_ERROR_SYSTEM_INVALID;
+    }
+    auto* binding = static_cast<const XrGraphicsBindingOpenGLESAndroidKHR*>(
+            findNext(createInfo->next, XR_TYPE_GRAPHICS_BINDING_OPENGL_ES_ANDROID_KHR));
+    if (binding == nullptr) {
+        return XR_ERROR_GRAPHICS_DEVICE_INVALID;
+    }
+    const bool overlay = findNext(createInfo->next, XR_TYPE_SESSION_CREATE_INFO_OVERLAY_EXTX) != nullptr;
+    if (overlay && !mock->overlayEnabled) {
+        return XR_ERROR_VALIDATION_FAILURE;
+    }
+    if (mock->session != nullptr) {
+        return XR_ERROR_LIMIT_REACHED;
+    }
+
+    auto* mockSession = new MockSession();
+    mockSession->instance = mock;
+    mockSession->overlay = overlay;
+    if (overlay) {
+        auto* overlayInfo = static_cast<const XrSessionCreateInfoOverlayEXTX*>(
+                findNext(createInfo->next, XR_TYPE_SESSION_CREATE_INFO_OVERLAY_EXTX));
+        mockSession->placement = overlayInfo->sessionLayersPlacement;
+    }
+    displayClockInit(&mockSession->clock, clockConfig());
+    if (const char* composite = getenv("MOCK_XR_COMPOSITE")) {
+        mockSession->compositing = atoi(composite) != 0;
+    }
+    const char* dumpDir = getenv("MOCK_XR_COMPOSITE_DUMP");
+    mockSession->compositing = mockSession->compositing || dumpDir != nullptr;
+    {
+        std::lock_guard<std::mutex> lock(g_display.mutex);
+        g_display.sessions.push_back(mockSession);
+        if (dumpDir != nullptr) {
+            g_display.dumpDir = dumpDir;
+        }
+    }
+    mock->session = mockSession;
+    *session = reinterpret_cast<XrSession>(mockSession);
+
+    std::lock_guard<std::mutex> lock(mockSession->mutex);
+    setState(mockSession, XR_SESSION_STATE_IDLE);
+    setState(mockSession, XR_SESSION_STATE_READY);
+    return XR_SUCCESS;
+}
+
+static XrResult mockDestroySession(XrSession session) {
+    if (session == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    auto* mock = reinterpret_cast<MockSession*>(session);
+    {
+        std::lock_guard<std::mutex> lock(g_display.mutex);
+        g_display.sessions.erase(std::find(g_display.sessions.begin(), g_display.sessions.end(), mock));
+        if (g_display.sessions.empty()) {
+            // The last one out: dump what was on the display, and let the next sessions' clocks
+            // (virtual time starts over) compose again.
+            if (!g_display.dumpDir.empty() && g_display.compositor.frames > 0) {
+                for (uint32_t eye = 0; eye < 2; ++eye) {
+                    const std::string path = g_display.dumpDir + "/eye" + std::to_string(eye) + ".pam";
+                    if (!compositorImageWritePam(g_display.compositor.output[eye], path.c_str())) {
+                        LOGE("Could not write %s", path.c_str());
+                    }
+                }
+                char report[1024];
+                referenceCompositorFormat(&g_display.compositor, report, sizeof(report));
+                LOGI("%s", report);
+            }
+            g_display.composedTime = 0;
+        }
+    }
+    if (mock->readFramebuffer != 0 && eglGetCurrentContext() != EGL_NO_CONTEXT) {
+        glDeleteFramebuffers(1, &mock->readFramebuffer);
+    }
+    mock->instance->session = nullptr;
+    delete mock;
+    return XR_SUCCESS;
+}
+
+static XrResult mockBeginSession(XrSession session, const XrSessionBeginInfo* beginInfo) {
+    if (session == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    if (beginInfo->primaryViewConfigurationType != XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO) {
+        return XR_ERROR_VIEW_CONFIGURATION_TYPE_UNSUPPORTED;
+    }
+    auto* mock = reinterpret_cast<MockSession*>(session);
+    std::lock_guard<std::mutex> lock(mock->mutex);
+    if (mock->running) {
+        return XR_ERROR_SESSION_RUNNING;
+    }
+    if (mock->state != XR_SESSION_STATE_READY) {
+        return XR_ERROR_SESSION_NOT_READY;
+    }
+    mock->running = true;
+    mock->synchronized = false;
+    mock->waitPending = false;
+    mock->frameBegun = false;
+    return XR_SUCCESS;
+}
+
+static XrResult mockEndSession(XrSession session) {
+    if (session == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    auto* mock = reinterpret_cast<MockSession*>(session);
+    std::lock_guard<std::mutex> lock(mock->mutex);
+    if (!mock->running) {
+        return XR_ERROR_SESSION_NOT_RUNNING;
+    }
+    if (mock->state != XR_SESSION_STATE_STOPPING) {
+        return XR_ERROR_SESSION_NOT_STOPPING;
+    }
+    mock->running = false;
+    mock->cond.notify_all();
+    setState(mock, XR_SESSION_STATE_IDLE);
+    if (mock->exitRequested) {
+        setState(mock, XR_SESSION_STATE_EXITING);
+    } else {
+        setState(mock, XR_SESSION_STATE_READY);
+    }
+    return XR_SUCCESS;
+}
+
+static XrResult mockRequestExitSession(XrSession session) {
+    if (session == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    auto* mock = reinterpret_cast<MockSession*>(session);
+    std::lock_guard<std::mutex> lock(mock->mutex);
+    if (!mock->running) {
+        return XR_ERROR_SESSION_NOT_RUNNING;
+    }
+    mock->exitRequested = true;
+    if (mock->synchronized && mock->state == XR_SESSION_STATE_FOCUSED) {
+        setState(mock, XR_SESSION_STATE_VISIBLE);
+    }
+    if (mock->synchronized && mock->state == XR_SESSION_STATE_VISIBLE) {
+        setState(mock, XR_SESSION_STATE_SYNCHRONIZED);
+    }
+    if (mock->state != XR_SESSION_STATE_STOPPING) {
+        setState(mock, XR_SESSION_STATE_STOPPING);
+    }
+    return XR_SUCCESS;
+}
+
+// --- Reference spaces ---
+
+static XrResult mockEnumerateReferenceSpaces(XrSession session, uint32_t capacity, uint32_t* countOutput,
+                                             XrReferenceSpaceType* spaces) {
+    if (session == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    const uint32_t count = sizeof(kSpaceTypes) / sizeof(kSpaceTypes[0]);
+    return enumerate(capacity, countOutput, spaces, count, [](XrReferenceSpaceType* space, uint32_t i) {
+        *space = kSpaceTypes[i];
+    });
+}
+
+static XrResult mockCreateReferenceSpace(XrSession session, const XrReferenceSpaceCreateInfo* createInfo,
+                                         XrSpace* space) {
+    if (session == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    bool supported = false;
+    for (XrReferenceSpaceType type : kSpaceTypes) {
+        supported = supported || type == createInfo->referenceSpaceType;
+    }
+    if (!supported) {
+        return XR_ERROR_REFERENCE_SPACE_UNSUPPORTED;
+    }
+    auto* mock = new MockSpace();
+    mock->session = reinterpret_cast<MockSession*>(session);
+    mock->type = createInfo->referenceSpaceType;
+    mock->pose = createInfo->poseInReferenceSpace;
+    *space = reinterpret_cast<XrSpace>(mock);
+    return XR_SUCCESS;
+}
+
+static XrResult mockDestroySpace(XrSpace space) {
+    if (space == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    delete reinterpret_cast<MockSpace*>(space);
+    return XR_SUCCESS;
+}
+
+// --- Swapchains ---
+
+static XrResult mockEnumerateSwapchainFormats(XrSession session, uint32_t capacity, uint32_t* countOutput,
+                                              int64_t* formats) {
+    if (session == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    const uint32_t count = sizeof(kSwapchainFormats) / sizeof(kSwapchainFormats[0]);
+    return enumerate(capacity, countOutput, formats, count, [](int64_t* format, uint32_t i) {
+        *format = kSwapchainFormats[i];
+    });
+}
+
+// Textures live on the app's context, which has to be current (as it is in every app).
+static XrResult mockCreateSwapchain(XrSession session, const XrSwapchainCreateInfo* createInfo,
+                                    XrSwapchain* swapchain) {
+    if (session == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    if (eglGetCurrentContext() == EGL_NO_CONTEXT) {
+        LOGE("xrCreateSwapchain without a current GL context");
+        return XR_ERROR_GRAPHICS_DEVICE_INVALID;
+    }
+    bool supported = false;
+    for (int64_t format : kSwapchainFormats) {
+        supported = supported || format == createInfo->format;
+    }
+    if (!supported) {
+        return XR_ERROR_SWAPCHAIN_FORMAT_UNSUPPORTED;
+    }
+    if (createInfo->width == 0 || createInfo->height == 0 || createInfo->faceCount != 1 ||
+        createInfo->arraySize == 0 || createInfo->mipCount == 0 || createInfo->sampleCount > 1) {
+        return XR_ERROR_FEATURE_UNSUPPORTED;
+    }
+
+    auto* mock = new MockSwapchain();
+    mock->session = reinterpret_cast<MockSession*>(session);
+    mock->format = createInfo->format;
+    mock->width = createInfo->width;
+    mock->height = createInfo->height;
+    mock->target = createInfo->arraySize > 1 ? GL_TEXTURE_2D_ARRAY : GL_TEXTURE_2D;
+    while (glGetError() != GL_NO_ERROR) {
+    }
+    glGenTextures(MOCK_RUNTIME_IMAGE_COUNT, mock->images);
+    for (GLuint image : mock->images) {
+        glBindTexture(mock->target, image);
+        if (mock->target == GL_TEXTURE_2D_ARRAY) {
+            glTexStorage3D(mock->target, createInfo->mipCount, static_cast<GLenum>(createInfo->format),
+                           createInfo->width, createInfo->height, createInfo->arraySize);
+        } else {
+            glTexStorage2D(mock->target, createInfo->mipCount, static_cast<GLenum>(createInfo->format),
+                           createInfo->width, createInfo->height);
+        }
+    }
+    glBindTexture(mock->target, 0);
+    if (glGetError() != GL_NO_ERROR) {
+        glDeleteTextures(MOCK_RUNTIME_IMAGE_COUNT, mock->images);
+        delete mock;
+        return XR_ERROR_RUNTIME_FAILURE;
+    }
+    *swapchain = reinterpret_cast<XrSwapchain>(mock);
+    return XR_SUCCESS;
+}
+
+static XrResult mockDestroySwapchain(XrSwapchain swapchain) {
+    if (swapchain == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    auto* mock = reinterpret_cast<MockSwapchain*>(swapchain);
+    if (eglGetCurrentContext() != EGL_NO_CONTEXT) {
+        glDeleteTextures(MOCK_RUNTIME_IMAGE_COUNT, mock->images);
+    }
+    delete mock;
+    return XR_SUCCESS;
+}
+
+static XrResult mockEnumerateSwapchainImages(XrSwapchain swapchain, uint32_t capacity, uint32_t* countOutput,
+                                             XrSwapchainImageBaseHeader* images) {
+    if (swapchain == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    auto* mock = reinterpret_cast<MockSwapchain*>(swapchain);
+    if (capacity > 0 && images != nullptr && images->type != XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_ES_KHR) {
+        return XR_ERROR_VALIDATION_FAILURE;
+    }
+    auto* glImages = reinterpret_cast<XrSwapchainImageOpenGLESKHR*>(images);
+    return enumerate(capacity, countOutput, glImages, MOCK_RUNTIME_IMAGE_COUNT,
+                     [mock](XrSwapchainImageOpenGLESKHR* image, uint32_t i) { image->image = mock->images[i]; });
+}
+
+static XrResult mockAcquireSwapchainImage(XrSwapchain swapchain, const XrSwapchainImageAcquireInfo*,
+                                          uint32_t* index) {
+    if (swapchain == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    auto* mock = reinterpret_cast<MockSwapchain*>(swapchain);
+    if (mock->acquiredCount == MOCK_RUNTIME_IMAGE_COUNT) {
+        return XR_ERROR_CALL_ORDER_INVALID;
+    }
+    *index = mock->nextIndex;
+    mock->acquiredCount++;
+    mock->nextIndex = (mock->nextIndex + 1) % MOCK_RUNTIME_IMAGE_COUNT;
+    return XR_SUCCESS;
+}
+
+static XrResult mockWaitSwapchainImage(XrSwapchain swapchain, const XrSwapchainImageWaitInfo*) {
+    if (swapchain == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    auto* mock = reinterpret_cast<MockSwapchain*>(swapchain);
+    if (mock->acquiredCount == 0 || mock->frontWaited) {
+        return XR_ERROR_CALL_ORDER_INVALID;
+    }
+    // Nothing reads the images, so they are always free.
+    mock->frontWaited = true;
+    return XR_SUCCESS;
+}
+
+static XrResult mockReleaseSwapchainImage(XrSwapchain swapchain, const XrSwapchainImageReleaseInfo*) {
+    if (swapchain == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    auto* mock = reinterpret_cast<MockSwapchain*>(swapchain);
+    if (!mock->frontWaited) {
+        return XR_ERROR_CALL_ORDER_INVALID;
+    }
+    mock->lastReleased = static_cast<int32_t>(
+            (mock->nextIndex + MOCK_RUNTIME_IMAGE_COUNT - mock->acquiredCount) % MOCK_RUNTIME_IMAGE_COUNT);
+    mock->acquiredCount--;
+    mock->frontWaited = false;
+    return XR_SUCCESS;
+}
+
+// --- Reference compositing ---
+
+// The image the swapchain last released, read back on the app's context into the pending
+// submission. Caller holds the session mutex.
+static const CompositorImage* readBack(MockSession* mock, XrSwapchain handle, uint32_t arrayIndex) {
+    auto* swapchain = reinterpret_cast<MockSwapchain*>(handle);
+    if (swapchain == nullptr || swapchain->lastReleased < 0 || swapchain->format == GL_DEPTH24_STENCIL8) {
+        return nullptr;
+    }
+    MockSubmission& submission = mock->pending;
+    const uint64_t frame = submission.frame;
+    MockReadback* readback = nullptr;
+    for (MockReadback& entry : submission.readbacks) {
+        if (entry.swapchain == swapchain && entry.arrayIndex == arrayIndex) {
+            if (entry.frame == frame) {
+                return &entry.image;
+            }
+            readback = &entry;
+            break;
+        }
+    }
+    if (readback == nullptr) {
+        submission.readbacks.emplace_back();
+        readback = &submission.readbacks.back();
+        readback->swapchain = swapchain;
+        readback->arrayIndex = arrayIndex;
+    }
+    readback->frame = frame;
+    readback->image.width = swapchain->width;
+    readback->image.height = swapchain->height;
+    readback->image.pixels.resize(static_cast<size_t>(swapchain->width) * swapchain->height);
+
+    GLint previous = 0;
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previous);
+    if (mock->readFramebuffer == 0) {
+        glGenFramebuffers(1, &mock->readFramebuffer);
+    }
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, mock->readFramebuffer);
+    const GLuint texture = swapchain->images[swapchain->lastReleased];
+    if (swapchain->target == GL_TEXTURE_2D_ARRAY) {
+        glFramebufferTextureLayer(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, texture, 0, static_cast<GLint>(arrayIndex));
+    } else {
+        glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+    }
+    glReadPixels(0, 0, static_cast<GLsizei>(swapchain->width), static_cast<GLsizei>(swapchain->height), GL_RGBA,
+                 GL_UNSIGNED_BYTE, readback->image.pixels.data());
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, static_cast<GLuint>(previous));
+    return &readback->image;
+}
+
+// Reads the frame's layers back into mock->pending. Caller holds the session mutex.
+static XrResult submitFrame(MockSession* mock, const XrFrameEndInfo* endInfo) {
+    MockSubmission& submission = mock->pending;
+    submission.frame = mock->stats.framesEnded;
+    submission.layerCount = 0;
+    submission.blendMode = endInfo->environmentBlendMode;
+    if (eglGetCurrentContext() == EGL_NO_CONTEXT) {
+        if (!mock->warnedNoContext) {
+            LOGE("xrEndFrame without a current GL context, not compositing");
+            mock->warnedNoContext = true;
+        }
+        return XR_SUCCESS;
+    }
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < endInfo->layerCount; ++i) {
+        CompositorLayer& layer = submission.layers[submission.layerCount];
+        layer = CompositorLayer();
+        layer.flags = endInfo->layers[i]->layerFlags;
+        if (endInfo->layers[i]->type == XR_TYPE_COMPOSITION_LAYER_PROJECTION) {
+            auto* projection = reinterpret_cast<const XrCompositionLayerProjection*>(endInfo->layers[i]);
+            if (projection->viewCount < 2) {
+                continue;
+            }
+            layer.kind = COMPOSITOR_LAYER_PROJECTION;
+            for (uint32_t eye = 0; eye < 2; ++eye) {
+                const XrSwapchainSubImage& subImage = projection->views[eye].subImage;
+                layer.views[eye].image = readBack(mock, subImage.swapchain, subImage.imageArrayIndex);
+                layer.views[eye].rect = subImage.imageRect;
+            }
+        } else if (endInfo->layers[i]->type == XR_TYPE_COMPOSITION_LAYER_QUAD) {
+            auto* quad = reinterpret_cast<const XrCompositionLayerQuad*>(endInfo->layers[i]);
+            auto* space = reinterpret_cast<const MockSpace*>(quad->space);
+            layer.kind = COMPOSITOR_LAYER_QUAD;
+            layer.eyeVisibility = quad->eyeVisibility;
+            layer.views[0].image = readBack(mock, quad->subImage.swapchain, quad->subImage.imageArrayIndex);
+            layer.views[0].rect = quad->subImage.imageRect;
+            // Every space shares the head's origin, offset by its creation pose.
+            layer.pose = space ? compositorPoseMultiply(space->pose, quad->pose) : quad->pose;
+            layer.size = quad->size;
+        } else {
+            return XR_ERROR_LAYER_INVALID;
+        }
+        submission.layerCount++;
+    }
+    const std::chrono::duration<uint64_t, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    mock->stats.readbackNs += elapsed.count();
+    return XR_SUCCESS;
+}
+
+// Caller holds g_display.mutex.
+static void composeDisplay(XrTime displayTime) {
+    MockDisplay& display = g_display;
+    if (displayTime <= display.composedTime) {
+        return;
+    }
+    display.composedTime = displayTime;
+    if (display.compositor.output[0].width == 0) {
+        CompositorEye eyes[2];
+        for (uint32_t eye = 0; eye < 2; ++eye) {
+            mockView(eye, &eyes[eye].pose, &eyes[eye].fov);
+        }
+        referenceCompositorInit(&display.compositor, MOCK_RUNTIME_VIEW_WIDTH, MOCK_RUNTIME_VIEW_HEIGHT, eyes);
+    }
+
+    display.stack.clear();
+    for (MockSession* session : display.sessions) {
+        if (session->shown.layerCount > 0) {
+            display.stack.push_back(session);
+        }
+    }
+    std::stable_sort(display.stack.begin(), display.stack.end(), [](const MockSession* a, const MockSession* b) {
+        return (a->overlay ? 1 + static_cast<uint64_t>(a->placement) : 0) <
+               (b->overlay ? 1 + static_cast<uint64_t>(b->placement) : 0);
+    });
+    CompositorLayer layers[REFERENCE_COMPOSITOR_MAX_LAYERS];
+    uint32_t layerCount = 0;
+    for (const MockSession* session : display.stack) {
+        for (uint32_t i = 0; i < session->shown.layerCount; ++i) {
+            if (layerCount == REFERENCE_COMPOSITOR_MAX_LAYERS) {
+                if (!display.layersDropped) {
+                    LOGE("More than %d layers on the display, composing the bottom ones",
+                         REFERENCE_COMPOSITOR_MAX_LAYERS);
+                    display.layersDropped = true;
+                }
+                break;
+            }
+            layers[layerCount++] = session->shown.layers[i];
+        }
+    }
+    // The main session decides how the display blends with the world.
+    const XrEnvironmentBlendMode blendMode = display.stack.empty() || display.stack[0]->overlay
+                                                    ? XR_ENVIRONMENT_BLEND_MODE_OPAQUE
+                                                    : display.stack[0]->shown.blendMode;
+
+    const auto start = std::chrono::steady_clock::now();
+    referenceCompositorCompose(&display.compositor, layers, layerCount, blendMode);
+    const std::chrono::duration<uint64_t, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    display.stats.framesComposed++;
+    display.stats.layersComposed += layerCount;
+    display.stats.sessionsComposed = static_cast<uint32_t>(display.stack.size());
+    display.stats.composeNs += elapsed.count();
+    display.stats.maxComposeNs = std::max<uint64_t>(display.stats.maxComposeNs, elapsed.count());
+}
+
+// --- Frame loop ---
+
+static XrResult mockWaitFrame(XrSession session, const XrFrameWaitInfo*, XrFrameState* frameState) {
+    if (session == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    if (auto hook = g_frameHook.load()) {
+        hook(session, g_frameHookData);
+    }
+    auto* mock = reinterpret_cast<MockSession*>(session);
+    std::unique_lock<std::mutex> lock(mock->mutex);
+    if (!mock->running) {
+        return XR_ERROR_SESSION_NOT_RUNNING;
+    }
+    // One outstanding wait: a second xrWaitFrame blocks until the first frame is begun.
+    mock->cond.wait(lock, [mock] { return !mock->waitPending || !mock->running; });
+    if (!mock->running) {
+        return XR_ERROR_SESSION_NOT_RUNNING;
+    }
+    mock->waitPending = true;
+
+    // Released on the next vsync of the simulated display (display_clock.h).
+    const uint64_t now = displayClockNow(&mock->clock);
+    const DisplayClockFrame frame = displayClockNextFrame(&mock->clock, now);
+    if (frame.wakeNs > now) {
+        if (mock->clock.config.virtualTime) {
+            displayClockSleepUntil(&mock->clock, frame.wakeNs);
+        } else {
+            lock.unlock();
+            displayClockSleepUntil(&mock->clock, frame.wakeNs);
+            lock.lock();
+        }
+        mock->stats.waitBlockedNs += displayClockNow(&mock->clock) - now;
+    }
+    mock->stats.framesWaited++;
+    mock->stats.missedVsyncs += frame.missedVsyncs;
+
+    frameState->predictedDisplayTime = frame.displayTime;
+    frameState->predictedDisplayPeriod = frame.periodNs;
+    frameState->shouldRender = mock->state == XR_SESSION_STATE_VISIBLE || mock->state == XR_SESSION_STATE_FOCUSED;
+    return XR_SUCCESS;
+}
+
+static XrResult mockBeginFrame(XrSession session, const XrFrameBeginInfo*) {
+    if (session == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    auto* mock = reinterpret_cast<MockSession*>(session);
+    std::lock_guard<std::mutex> lock(mock->mutex);
+    if (!mock->running) {
+        return XR_ERROR_SESSION_NOT_RUNNING;
+    }
+    if (!mock->waitPending) {
+        return XR_ERROR_CALL_ORDER_INVALID;
+    }
+    mock->waitPending = false;
+    mock->cond.notify_all();
+    mock->stats.framesBegun++;
+    if (mock->frameBegun) {
+        // The previous frame is dropped; this one replaces it.
+        mock->stats.framesDiscarded++;
+        return XR_FRAME_DISCARDED;
+    }
+    mock->frameBegun = true;
+    return XR_SUCCESS;
+}
+
+static XrResult mockEndFrame(XrSession session, const XrFrameEndInfo* endInfo) {
+    if (session == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    auto* mock = reinterpret_cast<MockSession*>(session);
+    std::lock_guard<std::mutex> lock(mock->mutex);
+    if (!mock->running) {
+        return XR_ERROR_SESSION_NOT_RUNNING;
+    }
+    if (!mock->frameBegun) {
+        return XR_ERROR_CALL_ORDER_INVALID;
+    }
+    if (endInfo->displayTime <= 0) {
+        return XR_ERROR_TIME_INVALID;
+    }
+    bool blendSupported = false;
+    for (XrEnvironmentBlendMode mode : kBlendModes) {
+        blendSupported = blendSupported || mode == endInfo->environmentBlendMode;
+    }
+    if (!blendSupported) {
+        return XR_ERROR_ENVIRONMENT_BLEND_MODE_UNSUPPORTED;
+    }
+    if (endInfo->layerCount > MOCK_RUNTIME_MAX_LAYERS) {
+        return XR_ERROR_LAYER_LIMIT_EXCEEDED;
+    }
+    for (uint32_t i = 0; i < endInfo->layerCount; ++i) {
+        if (endInfo->layers == nullptr || endInfo->layers[i] == nullptr) {
+            return XR_ERROR_VALIDATION_FAILURE;
+        }
+        const XrStructureType type = endInfo->layers[i]->type;
+        if (type != XR_TYPE_COMPOSITION_LAYER_PROJECTION && type != XR_TYPE_COMPOSITION_LAYER_QUAD) {
+            return XR_ERROR_LAYER_INVALID;
+        }
+    }
+    mock->frameBegun = false;
+    mock->stats.framesEnded++;
+    mock->stats.layersSubmitted += endInfo->layerCount;
+    if (mock->compositing) {
+        const XrResult result = submitFrame(mock, endInfo);
+        if (XR_FAILED(result)) {
+            return result;
+        }
+        std::lock_guard<std::mutex> displayLock(g_display.mutex);
+        std::swap(mock->pending, mock->shown);
+        composeDisplay(endInfo->displayTime);
+    }
+
+    if (!mock->synchronized && !mock->exitRequested) {
+        mock->synchronized = true;
+        setState(mock, XR_SESSION_STATE_SYNCHRONIZED);
+        setState(mock, XR_SESSION_STATE_VISIBLE);
+        if (!mock->overlay) {
+            setState(mock, XR_SESSION_STATE_FOCUSED);
+        }
+    }
+    return XR_SUCCESS;
+}
+
+static XrResult mockLocateViews(XrSession session, const XrViewLocateInfo* locateInfo, XrViewState* viewState,
+                                uint32_t capacity, uint32_t* countOutput, XrView* views) {
+    if (session == XR_NULL_HANDLE || locateInfo->space == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    if (locateInfo->viewConfigurationType != XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO) {
+        return XR_ERROR_VIEW_CONFIGURATION_TYPE_UNSUPPORTED;
+    }
+    if (locateInfo->displayTime <= 0) {
+        return XR_ERROR_TIME_INVALID;
+    }
+    viewState->viewStateFlags = XR_VIEW_STATE_ORIENTATION_VALID_BIT | XR_VIEW_STATE_POSITION_VALID_BIT |
+                                XR_VIEW_STATE_ORIENTATION_TRACKED_BIT | XR_VIEW_STATE_POSITION_TRACKED_BIT;
+    return enumerate(capacity, countOutput, views, 2, [](XrView* view, uint32_t i) {
+        mockView(i, &view->pose, &view->fov);
+    });
+}
+
+// --- Dispatch ---
+
+static XrResult mockGetInstanceProcAddr(XrInstance instance, const char* name, PFN_xrVoidFunction* function);
+
+struct MockFunction {
+    const char* name;
+    PFN_xrVoidFunction function;
+    bool global; // callable with XR_NULL_HANDLE
+};
+
+#define MOCK_FUNCTION(name, global) {"xr" #name, reinterpret_cast<PFN_xrVoidFunction>(mock##name), global}
+
+static const MockFunction kFunctions[] = {
+        MOCK_FUNCTION(GetInstanceProcAddr, true),
+        MOCK_FUNCTION(EnumerateInstanceExtensionProperties, true),
+        MOCK_FUNCTION(CreateInstance, true),
+        MOCK_FUNCTION(InitializeLoaderKHR, true),
+        MOCK_FUNCTION(DestroyInstance, false),
+        MOCK_FUNCTION(GetInstanceProperties, false),
+        MOCK_FUNCTION(PollEvent, false),
+        MOCK_FUNCTION(GetSystem, false),
+        MOCK_FUNCTION(GetSystemProperties, false),
+        MOCK_FUNCTION(GetOpenGLESGraphicsRequirementsKHR, false),
+        MOCK_FUNCTION(EnumerateViewConfigurations, false),
+        MOCK_FUNCTION(EnumerateViewConfigurationViews, false),
+        MOCK_FUNCTION(EnumerateEnvironmentBlendModes, false),
+        MOCK_FUNCTION(CreateSession, false),
+        MOCK_FUNCTION(DestroySession, false),
+        MOCK_FUNCTION(BeginSession, false),
+        MOCK_FUNCTION(EndSession, false),
+        MOCK_FUNCTION(RequestExitSession, false),
+        MOCK_FUNCTION(EnumerateReferenceSpaces, false),
+        MOCK_FUNCTION(CreateReferenceSpace, false),
+        MOCK_FUNCTION(DestroySpace, false),
+        MOCK_FUNCTION(EnumerateSwapchainFormats, false),
+        MOCK_FUNCTION(CreateSwapchain, false),
+        MOCK_FUNCTION(DestroySwapchain, false),
+        MOCK_FUNCTION(EnumerateSwapchainImages, false),
+        MOCK_FUNCTION(AcquireSwapchainImage, false),
+        MOCK_FUNCTION(WaitSwapchainImage, false),
+        MOCK_FUNCTION(ReleaseSwapchainImage, false),
+        MOCK_FUNCTION(WaitFrame, false),
+        MOCK_FUNCTION(BeginFrame, false),
+        MOCK_FUNCTION(EndFrame, false),
+        MOCK_FUNCTION(LocateViews, false),
+};
+
+static XrResult mockGetInstanceProcAddr(XrInstance instance, const char* name, PFN_xrVoidFunction* function) {
+    if (name == nullptr || function == nullptr) {
+        return XR_ERROR_VALIDATION_FAILURE;
+    }
+    for (const MockFunction& entry : kFunctions) {
+        if (strcmp(entry.name, name) == 0) {
+            if (instance == XR_NULL_HANDLE && !entry.global) {
+                break;
+            }
+            *function = entry.function;
+            return XR_SUCCESS;
+        }
+    }
+    *function = nullptr;
+    return instance == XR_NULL_HANDLE ? XR_ERROR_HANDLE_INVALID : XR_ERROR_FUNCTION_UNSUPPORTED;
+}
+
+MOCK_EXPORT XrResult xrNegotiateLoaderRuntimeInterface(const XrNegotiateLoaderInfo* loaderInfo,
+                                                       XrNegotiateRuntimeRequest* runtimeRequest) {
+    if (loaderInfo == nullptr || runtimeRequest == nullptr ||
+        loaderInfo->structType != XR_LOADER_INTERFACE_STRUCT_LOADER_INFO ||
+        loaderInfo->structVersion != XR_LOADER_INFO_STRUCT_VERSION ||
+        loaderInfo->structSize != sizeof(XrNegotiateLoaderInfo) ||
+        runtimeRequest->structType != XR_LOADER_INTERFACE_STRUCT_RUNTIME_REQUEST ||
+        runtimeRequest->structVersion != XR_RUNTIME_INFO_STRUCT_VERSION ||
+        runtimeRequest->structSize != sizeof(XrNegotiateRuntimeRequest) ||
+        loaderInfo->minInterfaceVersion > XR_CURRENT_LOADER_RUNTIME_VERSION ||
+        loaderInfo->maxInterfaceVersion < XR_CURRENT_LOADER_RUNTIME_VERSION ||
+        loaderInfo->minApiVersion > XR_CURRENT_API_VERSION) {
+        return XR_ERROR_INITIALIZATION_FAILED;
+    }
+    runtimeRequest->runtimeInterfaceVersion = XR_CURRENT_LOADER_RUNTIME_VERSION;
+    runtimeRequest->runtimeApiVersion = XR_CURRENT_API_VERSION;
+    runtimeRequest->getInstanceProcAddr = mockGetInstanceProcAddr;
+    return XR_SUCCESS;
+}
+
+// --- Direct entry points (linked in place of the loader) ---
+
+MOCK_EXPORT XrResult xrGetInstanceProcAddr(XrInstance instance, const char* name, PFN_xrVoidFunction* function) {
+    return mockGetInstanceProcAddr(instance, name, function);
+}
+MOCK_EXPORT XrResult xrEnumerateInstanceExtensionProperties(const char* layerName, uint32_t capacity,
+                                                            uint32_t* countOutput, XrExtensionProperties* properties) {
+    return mockEnumerateInstanceExtensionProperties(layerName, capacity, countOutput, properties);
+}
+MOCK_EXPORT XrResult xrCreateInstance(const XrInstanceCreateInfo* createInfo, XrInstance* instance) {
+    return mockCreateInstance(createInfo, instance);
+}
+MOCK_EXPORT XrResult xrDestroyInstance(XrInstance instance) {
+    return mockDestroyInstance(instance);
+}
+MOCK_EXPORT XrResult xrGetInstanceProperties(XrInstance instance, XrInstanceProperties* properties) {
+    return mockGetInstanceProperties(instance, properties);
+}
+MOCK_EXPORT XrResult xrPollEvent(XrInstance instance, XrEventDataBuffer* eventData) {
+    return mockPollEvent(instance, eventData);
+}
+MOCK_EXPORT XrResult xrGetSystem(XrInstance instance, const XrSystemGetInfo* getInfo, XrSystemId* systemId) {
+    return mockGetSystem(instance, getInfo, systemId);
+}
+MOCK_EXPORT XrResult xrGetSystemProperties(XrInstance instance, XrSystemId systemId, XrSystemProperties* properties) {
+    return mockGetSystemProperties(instance, systemId, properties);
+}
+MOCK_EXPORT XrResult xrEnumerateViewConfigurations(XrInstance instance, XrSystemId systemId, uint32_t capacity,
+                                                   uint32_t* countOutput, XrViewConfigurationType* types) {
+    return mockEnumerateViewConfigurations(instance, systemId, capacity, countOutput, types);
+}
+MOCK_EXPORT XrResult xrEnumerateViewConfigurationViews(XrInstance instance, XrSystemId systemId,
+                                                       XrViewConfigurationType type, uint32_t capacity,
+                                                       uint32_t* countOutput, XrViewConfigurationView* views) {
+    return mockEnumerateViewConfigurationViews(instance, systemId, type, capacity, countOutput, views);
+}
+MOCK_EXPORT XrResult xrEnumerateEnvironmentBlendModes(XrInstance instance, XrSystemId systemId,
+                                                      XrViewConfigurationType type, uint32_t capacity,
+                                                      uint32_t* countOutput, XrEnvironmentBlendMode* modes) {
+    return mockEnumerateEnvironmentBlendModes(instance, systemId, type, capacity, countOutput, modes);
+}
+MOCK_EXPORT XrResult xrCreateSession(XrInstance instance, const XrSessionCreateInfo* createInfo, XrSession* session) {
+    return mockCreateSession(instance, createInfo, session);
+}
+MOCK_EXPORT XrResult xrDestroySession(XrSession session) {
+    return mockDestroySession(session);
+}
+MOCK_EXPORT XrResult xrBeginSession(XrSession session, const XrSessionBeginInfo* beginInfo) {
+    return mockBeginSession(session, beginInfo);
+}
+MOCK_EXPORT XrResult xrEndSession(XrSession session) {
+    return mockEndSession(session);
+}
+MOCK_EXPORT XrResult xrRequestExitSession(XrSession session) {
+    return mockRequestExitSession(session);
+}
+MOCK_EXPORT XrResult xrEnumerateReferenceSpaces(XrSession session, uint32_t capacity, uint32_t* countOutput,
+                                                XrReferenceSpaceType* spaces) {
+    return mockEnumerateReferenceSpaces(session, capacity, countOutput, spaces);
+}
+MOCK_EXPORT XrResult xrCreateReferenceSpace(XrSession session, const XrReferenceSpaceCreateInfo* createInfo,
+                                            XrSpace* space) {
+    return mockCreateReferenceSpace(session, createInfo, space);
+}
+MOCK_EXPORT XrResult xrDestroySpace(XrSpace space) {
+    return mockDestroySpace(space);
+}
+MOCK_EXPORT XrResult xrEnumerateSwapchainFormats(XrSession session, uint32_t capacity, uint32_t* countOutput,
+                                                 int64_t* formats) {
+    return mockEnumerateSwapchainFormats(session, capacity, countOutput, formats);
+}
+MOCK_EXPORT XrResult xrCreateSwapchain(XrSession session, const XrSwapchainCreateInfo* createInfo,
+                                       XrSwapchain* swapchain) {
+    return mockCreateSwapchain(session, createInfo, swapchain);
+}
+MOCK_EXPORT XrResult xrDestroySwapchain(XrSwapchain swapchain) {
+    return mockDestroySwapchain(swapchain);
+}
+MOCK_EXPORT XrResult xrEnumerateSwapchainImages(XrSwapchain swapchain, uint32_t capacity, uint32_t* countOutput,
+                                                XrSwapchainImageBaseHeader* images) {
+    return mockEnumerateSwapchainImages(swapchain, capacity, countOutput, images);
+}
+MOCK_EXPORT XrResult xrAcquireSwapchainImage(XrSwapchain swapchain, const XrSwapchainImageAcquireInfo* acquireInfo,
+                                             uint32_t* index) {
+    return mockAcquireSwapchainImage(swapchain, acquireInfo, index);
+}
+MOCK_EXPORT XrResult xrWaitSwapchainImage(XrSwapchain swapchain, const XrSwapchainImageWaitInfo* waitInfo) {
+    return mockWaitSwapchainImage(swapchain, waitInfo);
+}
+MOCK_EXPORT XrResult xrReleaseSwapchainImage(XrSwapchain swapchain, const XrSwapchainImageReleaseInfo* releaseInfo) {
+    return mockReleaseSwapchainImage(swapchain, releaseInfo);
+}
+MOCK_EXPORT XrResult xrWaitFrame(XrSession session, const XrFrameWaitInfo* waitInfo, XrFrameState* frameState) {
+    return mockWaitFrame(session, waitInfo, frameState);
+}
+MOCK_EXPORT XrResult xrBeginFrame(XrSession session, const XrFrameBeginInfo* beginInfo) {
+    return mockBeginFrame(session, beginInfo);
+}
+MOCK_EXPORT XrResult xrEndFrame(XrSession session, const XrFrameEndInfo* endInfo) {
+    return mockEndFrame(session, endInfo);
+}
+MOCK_EXPORT XrResult xrLocateViews(XrSession session, const XrViewLocateInfo* locateInfo, XrViewState* viewState,
+                                   uint32_t capacity, uint32_t* countOutput, XrView* views) {
+    return mockLocateViews(session, locateInfo, viewState, capacity, countOutput, views);
+}
+
+// --- Controls ---
+
+MOCK_EXPORT void mockRuntimeSetDisplayClock(const DisplayClockConfig* config) {
+    std::lock_guard<std::mutex> lock(g_clockConfigMutex);
+    g_clockConfig = *config;
+    g_clockConfigured = true;
+}
+
+MOCK_EXPORT XrTime mockRuntimeNow(XrSession session) {
+    auto* mock = reinterpret_cast<MockSession*>(session);
+    std::lock_guard<std::mutex> lock(mock->mutex);
+    return static_cast<XrTime>(displayClockNow(&mock->clock));
+}
+
+MOCK_EXPORT void mockRuntimeAdvanceTime(XrSession session, XrDuration ns) {
+    auto* mock = reinterpret_cast<MockSession*>(session);
+    if (mock->clock.config.virtualTime) {
+        std::lock_guard<std::mutex> lock(mock->mutex);
+        displayClockAdvance(&mock->clock, static_cast<uint64_t>(ns));
+    } else {
+        displayClockAdvance(&mock->clock, static_cast<uint64_t>(ns));
+    }
+}
+
+MOCK_EXPORT XrResult mockRuntimeRequestExit(XrSession session) {
+    return mockRequestExitSession(session);
+}
+
+MOCK_EXPORT void mockRuntimeSetFrameHook(void (*hook)(XrSession session, void* userData), void* userData) {
+    g_frameHook = nullptr;
+    g_frameHookData = userData;
+    g_frameHook = hook;
+}
+
+MOCK_EXPORT void mockRuntimeSetCompositing(XrSession session, bool enabled) {
+    auto* mock = reinterpret_cast<MockSession*>(session);
+    std::lock_guard<std::mutex> lock(mock->mutex);
+    mock->compositing = enabled;
+    if (!enabled) {
+        std::lock_guard<std::mutex> displayLock(g_display.mutex);
+        mock->shown.layerCount = 0;
+    }
+}
+
+MOCK_EXPORT const CompositorImage* mockRuntimeComposedEye(uint32_t eye) {
+    std::lock_guard<std::mutex> lock(g_display.mutex);
+    return g_display.compositor.frames > 0 && eye < 2 ? &g_display.compositor.output[eye] : nullptr;
+}
+
+MOCK_EXPORT size_t mockRuntimeCompositorReport(char* buffer, size_t capacity) {
+    std::lock_guard<std::mutex> lock(g_display.mutex);
+    return referenceCompositorFormat(&g_display.compositor, buffer, capacity);
+}
+
+MOCK_EXPORT void mockRuntimeGetDisplayStats(MockDisplayStats* stats, bool reset) {
+    std::lock_guard<std::mutex> lock(g_display.mutex);
+    *stats = g_display.stats;
+    if (reset) {
+        g_display.stats = MockDisplayStats();
+    }
+}
+
+MOCK_EXPORT XrResult mockRuntimeGetStats(XrSession session, MockRuntimeStats* stats) {
+    if (session == XR_NULL_HANDLE) {
+        return XR_ERROR_HANDLE_INVALID;
+    }
+    auto* mock = reinterpret_cast<MockSession*>(session);
+    std::lock_guard<std::mutex> lock(mock->mutex);
+    *stats = mock->stats;
+    return XR_SUCCESS;
+}
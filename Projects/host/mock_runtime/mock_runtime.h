@@ -0,0 +1,94 @@
+//
+// Headless mock OpenXR runtime for the build machine.
+//
+// libopenxr_mock_runtime.so implements the subset of OpenXR the apps use - instance and system,
+// view configurations and blend modes, sessions (including XR_EXTX_overlay), reference spaces,
+// swapchains backed by GL textures on the app's context, wait/begin/end frame and
+// xrLocateViews - so their frame loops run without a headset or Monado.
+//
+// Two ways in:
+//   - through an OpenXR loader: XR_RUNTIME_JSON=<build>/openxr_mock_runtime.json, the loader
+//     negotiates with xrNegotiateLoaderRuntimeInterface like with any runtime;
+//   - linked directly: the library also exports the xr* entry points, so host tools link it
+//     in place of libopenxr_loader and can use the controls below.
+//
+// Session states follow a compositor that accepts every session: IDLE and READY on creation,
+// SYNCHRONIZED, VISIBLE and (main sessions only; overlays don't take input focus) FOCUSED once
+// the first frame is ended. xrRequestExitSession or mockRuntimeRequestExit leads to STOPPING,
+// then IDLE and EXITING after xrEndSession; a session that isn't ended stays at STOPPING.
+//
+// xrWaitFrame paces to a simulated display (display_clock.h): refresh rate, compositor latency,
+// vsync jitter and stalls, on CLOCK_MONOTONIC or on virtual time, which is also the XrTime base.
+// It is configured with mockRuntimeSetDisplayClock or the MOCK_XR_* environment variables
+// (default 90 Hz, no jitter). Nothing is displayed.
+//
+// With compositing on (mockRuntimeSetCompositing, MOCK_XR_COMPOSITE=1) xrEndFrame reads back the
+// released swapchain images on the app's context, and the layers of every such session go to
+// one display, resolved into eye images by the CPU reference compositor
+// (reference_compositor.h): the main session at the bottom, overlays above it by
+// sessionLayersPlacement. Each display time is composed once, on the thread of the first
+// xrEndFrame for it, from each session's latest frame. MOCK_XR_COMPOSITE_DUMP=<dir> also turns it
+// on and writes the display's eyes to <dir>/eye0.pam and eye1.pam when the last session is
+// destroyed, with the per-layer cost in the log.
+//
+
+#ifndef ANDROIDSAMSUNG_MOCK_RUNTIME_H
+#define ANDROIDSAMSUNG_MOCK_RUNTIME_H
+
+#include <cstdint>
+
+#include <openxr/openxr.h>
+
+#include "display_clock.h"
+#include "reference_compositor.h"
+
+#define MOCK_RUNTIME_DEFAULT_HZ 90
+#define MOCK_RUNTIME_IMAGE_COUNT 3
+#define MOCK_RUNTIME_MAX_LAYERS 16
+#define MOCK_RUNTIME_VIEW_WIDTH 1024
+#define MOCK_RUNTIME_VIEW_HEIGHT 1024
+
+struct MockRuntimeStats {
+    uint64_t framesWaited = 0;
+    uint64_t framesBegun = 0;
+    uint64_t framesDiscarded = 0; // xrBeginFrame without ending the previous frame
+    uint64_t framesEnded = 0;
+    uint64_t layersSubmitted = 0;
+    uint64_t waitBlockedNs = 0;   // total time xrWaitFrame slept for the display
+    uint64_t missedVsyncs = 0;    // vsyncs that got no frame because the app was late
+    uint64_t readbackNs = 0;      // compositing: reading the layers' images back at xrEndFrame
+};
+
+struct MockDisplayStats {
+    uint64_t framesComposed = 0;
+    uint64_t layersComposed = 0;   // summed over the composed frames
+    uint32_t sessionsComposed = 0; // sessions with layers in the last composed frame
+    uint64_t composeNs = 0;        // reference compositor, summed
+    uint64_t maxComposeNs = 0;
+};
+
+extern "C" {
+// Display for sessions created afterwards, instead of the environment.
+void mockRuntimeSetDisplayClock(const DisplayClockConfig* config);
+// The session's clock, virtual or CLOCK_MONOTONIC.
+XrTime mockRuntimeNow(XrSession session);
+// Simulated app work: moves virtual time forward (sleeps on real time).
+void mockRuntimeAdvanceTime(XrSession session, XrDuration ns);
+// As if the user closed the app: STOPPING now, EXITING after xrEndSession.
+XrResult mockRuntimeRequestExit(XrSession session);
+XrResult mockRuntimeGetStats(XrSession session, MockRuntimeStats* stats);
+// Called at the start of every xrWaitFrame on the app's thread, so everything between two calls
+// is one turn of its frame loop. Null removes it.
+void mockRuntimeSetFrameHook(void (*hook)(XrSession session, void* userData), void* userData);
+
+// Whether the session's layers are read back and put on the display.
+void mockRuntimeSetCompositing(XrSession session, bool enabled);
+// The display's last composed eye image (0 left, 1 right); null before the first one. Valid
+// until the next composed frame.
+const CompositorImage* mockRuntimeComposedEye(uint32_t eye);
+size_t mockRuntimeCompositorReport(char* buffer, size_t capacity);
+// `reset` starts the counters over, for measuring a window.
+void mockRuntimeGetDisplayStats(MockDisplayStats* stats, bool reset);
+}
+
+#endif //ANDROIDSAMSUNG_MOCK_RUNTIME_H
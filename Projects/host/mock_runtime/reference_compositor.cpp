@@ -0,0 +1,544 @@
+#include "reference_compositor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+static uint64_t nowNs() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+// --- Blend kernels ---
+// Pixels are RGBA8 with R in the low byte. All arithmetic is x * y / 255 rounded, done as
+// ((x*y + 128) + ((x*y + 128) >> 8)) >> 8 - exact for 8-bit operands and the same in both paths.
+
+static inline uint32_t div255(uint32_t x) {
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+// Layer without source alpha: replaces the pixel, alpha 1.
+static void opaqueRowScalar(uint32_t* dst, const uint32_t* src, uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) {
+        dst[i] = src[i] | 0xff000000u;
+    }
+}
+
+// Premultiplied "over": dst = src + dst * (1 - src.a), saturated.
+static void overRowScalar(uint32_t* dst, const uint32_t* src, uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) {
+        const uint32_t s = src[i];
+        const uint32_t d = dst[i];
+        const uint32_t inverse = 255 - (s >> 24);
+        uint32_t result = 0;
+        for (uint32_t shift = 0; shift < 32; shift += 8) {
+            uint32_t channel = ((s >> shift) & 0xff) + div255(((d >> shift) & 0xff) * inverse);
+            result |= (channel > 255 ? 255 : channel) << shift;
+        }
+        dst[i] = result;
+    }
+}
+
+static void premultiplyRowScalar(uint32_t* row, uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) {
+        const uint32_t p = row[i];
+        const uint32_t alpha = p >> 24;
+        row[i] = (alpha << 24) | (div255(((p >> 16) & 0xff) * alpha) << 16) |
+                 (div255(((p >> 8) & 0xff) * alpha) << 8) | div255((p & 0xff) * alpha);
+    }
+}
+
+static void opaqueAlphaRowScalar(uint32_t* row, uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) {
+        row[i] |= 0xff000000u;
+    }
+}
+
+#if defined(__SSE2__)
+
+// Four pixels per iteration, two per 16-bit half.
+static inline __m128i div255x8(__m128i x) {
+    const __m128i t = _mm_add_epi16(x, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+static inline __m128i alphaX8(__m128i pixels16) {
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(pixels16, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+static void opaqueRowSse2(uint32_t* dst, const uint32_t* src, uint32_t count) {
+    const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xff000000u));
+    uint32_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_or_si128(s, alpha));
+    }
+    opaqueRowScalar(dst + i, src + i, count - i);
+}
+
+static void overRowSse2(uint32_t* dst, const uint32_t* src, uint32_t count) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i max = _mm_set1_epi16(255);
+    uint32_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        const __m128i sLo = _mm_unpacklo_epi8(s, zero);
+        const __m128i sHi = _mm_unpackhi_epi8(s, zero);
+        const __m128i dLo = _mm_unpacklo_epi8(d, zero);
+        const __m128i dHi = _mm_unpackhi_epi8(d, zero);
+        const __m128i lo = _mm_add_epi16(sLo, div255x8(_mm_mullo_epi16(dLo, _mm_sub_epi16(max, alphaX8(sLo)))));
+        const __m128i hi = _mm_add_epi16(sHi, div255x8(_mm_mullo_epi16(dHi, _mm_sub_epi16(max, alphaX8(sHi)))));
+        // Sums above 255 (texels that aren't valid premultiplied colours) saturate.
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(lo, hi));
+    }
+    overRowScalar(dst + i, src + i, count - i);
+}
+
+static void premultiplyRowSse2(uint32_t* row, uint32_t count) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alphaLanes = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+    uint32_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i));
+        const __m128i pLo = _mm_unpacklo_epi8(p, zero);
+        const __m128i pHi = _mm_unpackhi_epi8(p, zero);
+        __m128i lo = div255x8(_mm_mullo_epi16(pLo, alphaX8(pLo)));
+        __m128i hi = div255x8(_mm_mullo_epi16(pHi, alphaX8(pHi)));
+        lo = _mm_or_si128(_mm_andnot_si128(alphaLanes, lo), _mm_and_si128(alphaLanes, pLo));
+        hi = _mm_or_si128(_mm_andnot_si128(alphaLanes, hi), _mm_and_si128(alphaLanes, pHi));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(row + i), _mm_packus_epi16(lo, hi));
+    }
+    premultiplyRowScalar(row + i, count - i);
+}
+
+static void opaqueAlphaRowSse2(uint32_t* row, uint32_t count) {
+    opaqueRowSse2(row, row, count);
+}
+
+#endif
+
+struct BlendKernels {
+    void (*opaque)(uint32_t* dst, const uint32_t* src, uint32_t count);
+    void (*over)(uint32_t* dst, const uint32_t* src, uint32_t count);
+    void (*premultiply)(uint32_t* row, uint32_t count);
+    void (*opaqueAlpha)(uint32_t* row, uint32_t count);
+};
+
+static const BlendKernels kScalarKernels = {opaqueRowScalar, overRowScalar, premultiplyRowScalar,
+                                            opaqueAlphaRowScalar};
+#if defined(__SSE2__)
+static const BlendKernels kSimdKernels = {opaqueRowSse2, overRowSse2, premultiplyRowSse2, opaqueAlphaRowSse2};
+#else
+static const BlendKernels& kSimdKernels = kScalarKernels;
+#endif
+
+static void blendSpan(const BlendKernels& kernels, XrCompositionLayerFlags flags, uint32_t* dst, uint32_t* src,
+                      uint32_t count) {
+    if ((flags & XR_COMPOSITION_LAYER_BLEND_TEXTURE_SOURCE_ALPHA_BIT) == 0) {
+        kernels.opaque(dst, src, count);
+        return;
+    }
+    if (flags & XR_COMPOSITION_LAYER_UNPREMULTIPLIED_ALPHA_BIT) {
+        kernels.premultiply(src, count);
+    }
+    kernels.over(dst, src, count);
+}
+
+// --- Geometry ---
+
+struct Vec3 {
+    float x, y, z;
+};
+
+static Vec3 toVec3(const XrVector3f& v) { return {v.x, v.y, v.z}; }
+static Vec3 add(Vec3 a, Vec3 b) { return {a.x + b.x, a.y + b.y, a.z + b.z}; }
+static Vec3 sub(Vec3 a, Vec3 b) { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+static Vec3 scale(Vec3 a, float s) { return {a.x * s, a.y * s, a.z * s}; }
+static float dot(Vec3 a, Vec3 b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+static Vec3 cross(Vec3 a, Vec3 b) { return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x}; }
+
+static Vec3 rotate(const XrQuaternionf& q, Vec3 v) {
+    const Vec3 axis = {q.x, q.y, q.z};
+    const Vec3 t = scale(cross(axis, v), 2.0f);
+    return add(add(v, scale(t, q.w)), cross(axis, t));
+}
+
+static XrQuaternionf multiply(const XrQuaternionf& a, const XrQuaternionf& b) {
+    return {a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+            a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+            a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+            a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z};
+}
+
+XrPosef compositorPoseMultiply(const XrPosef& a, const XrPosef& b) {
+    XrPosef result;
+    result.orientation = multiply(a.orientation, b.orientation);
+    const Vec3 position = add(toVec3(a.position), rotate(a.orientation, toVec3(b.position)));
+    result.position = {position.x, position.y, position.z};
+    return result;
+}
+
+static XrPosef inverse(const XrPosef& pose) {
+    XrPosef result;
+    result.orientation = {-pose.orientation.x, -pose.orientation.y, -pose.orientation.z, pose.orientation.w};
+    const Vec3 position = scale(rotate(result.orientation, toVec3(pose.position)), -1.0f);
+    result.position = {position.x, position.y, position.z};
+    return result;
+}
+
+// Eye pixel centres in tangent space; rows from the bottom.
+struct EyeRays {
+    float left, right, up, down;
+    uint32_t width, height;
+
+    float x(uint32_t px) const { return left + (px + 0.5f) * (right - left) / width; }
+    float y(uint32_t py) const { return down + (py + 0.5f) * (up - down) / height; }
+};
+
+static EyeRays eyeRays(const CompositorEye& eye, const CompositorImage& output) {
+    return {tanf(eye.fov.angleLeft), tanf(eye.fov.angleRight), tanf(eye.fov.angleUp), tanf(eye.fov.angleDown),
+            output.width, output.height};
+}
+
+static bool validSource(const CompositorSource& source) {
+    const CompositorImage* image = source.image;
+    return image != nullptr && source.rect.extent.width > 0 && source.rect.extent.height > 0 &&
+           source.rect.offset.x >= 0 && source.rect.offset.y >= 0 &&
+           static_cast<uint32_t>(source.rect.offset.x + source.rect.extent.width) <= image->width &&
+           static_cast<uint32_t>(source.rect.offset.y + source.rect.extent.height) <= image->height;
+}
+
+// --- Layers ---
+
+static void composeProjection(ReferenceCompositor* compositor, const BlendKernels& kernels,
+                              const CompositorLayer& layer, uint32_t eye, CompositorLayerCost* cost) {
+    const CompositorSource& source = layer.views[eye];
+    if (!validSource(source)) {
+        return;
+    }
+    CompositorImage& output = compositor->output[eye];
+    const uint32_t width = output.width;
+    const uint32_t height = output.height;
+    const XrRect2Di& rect = source.rect;
+    uint32_t* row = compositor->row.data();
+    for (uint32_t py = 0; py < height; ++py) {
+        const uint64_t startNs = nowNs();
+        const uint32_t sy = rect.offset.y + static_cast<uint32_t>((2ull * py + 1) * rect.extent.height / (2ull * height));
+        const uint32_t* sourceRow = source.image->pixels.data() + static_cast<size_t>(sy) * source.image->width;
+        // Texel centre (2 px + 1) * extent / (2 width), stepped without a divide per pixel.
+        const uint64_t step = 2ull * rect.extent.width;
+        const uint64_t denominator = 2ull * width;
+        uint64_t numerator = rect.extent.width;
+        uint32_t sx = rect.offset.x;
+        while (numerator >= denominator) {
+            numerator -= denominator;
+            ++sx;
+        }
+        for (uint32_t px = 0; px < width; ++px) {
+            row[px] = sourceRow[sx];
+            numerator += step;
+            while (numerator >= denominator) {
+                numerator -= denominator;
+                ++sx;
+            }
+        }
+        const uint64_t sampledNs = nowNs();
+        blendSpan(kernels, layer.flags, output.pixels.data() + static_cast<size_t>(py) * width, row, width);
+        cost->sampleNs += sampledNs - startNs;
+        cost->blendNs += nowNs() - sampledNs;
+    }
+    cost->pixels += static_cast<uint64_t>(width) * height;
+}
+
+static void composeQuad(ReferenceCompositor* compositor, const BlendKernels& kernels, const CompositorLayer& layer,
+                        uint32_t eye, CompositorLayerCost* cost) {
+    const CompositorSource& source = layer.views[0];
+    if (!validSource(source) || layer.size.width <= 0.0f || layer.size.height <= 0.0f) {
+        return;
+    }
+    CompositorImage& output = compositor->output[eye];
+    const EyeRays rays = eyeRays(compositor->eyes[eye], output);
+
+    // The quad in eye space; rays start at the origin.
+    const XrPosef quad = compositorPoseMultiply(inverse(compositor->eyes[eye].pose), layer.pose);
+    const Vec3 center = toVec3(quad.position);
+    const Vec3 right = rotate(quad.orientation, {1.0f, 0.0f, 0.0f});
+    const Vec3 up = rotate(quad.orientation, {0.0f, 1.0f, 0.0f});
+    const Vec3 normal = rotate(quad.orientation, {0.0f, 0.0f, 1.0f});
+    const float halfWidth = layer.size.width * 0.5f;
+    const float halfHeight = layer.size.height * 0.5f;
+    const float planeDistance = dot(center, normal);
+
+    // Screen bounds from the corners; the whole eye when a corner is behind it.
+    uint32_t x0 = 0, x1 = output.width, y0 = 0, y1 = output.height;
+    bool bounded = true;
+    float minX = INFINITY, maxX = -INFINITY, minY = INFINITY, maxY = -INFINITY;
+    for (int corner = 0; corner < 4; ++corner) {
+        const Vec3 p = add(center, add(scale(right, (corner & 1) ? halfWidth : -halfWidth),
+                                       scale(up, (corner & 2) ? halfHeight : -halfHeight)));
+        if (p.z > -1e-4f) {
+            bounded = false;
+            break;
+        }
+        const float tx = p.x / -p.z;
+        const float ty = p.y / -p.z;
+        minX = fminf(minX, tx);
+        maxX = fmaxf(maxX, tx);
+        minY = fminf(minY, ty);
+        maxY = fmaxf(maxY, ty);
+    }
+    if (bounded) {
+        auto toPixel = [](float t, float lo, float hi, uint32_t size) {
+            const float p = (t - lo) / (hi - lo) * size;
+            return p < 0.0f ? 0.0f : (p > size ? static_cast<float>(size) : p);
+        };
+        x0 = static_cast<uint32_t>(toPixel(minX, rays.left, rays.right, output.width));
+        x1 = static_cast<uint32_t>(ceilf(toPixel(maxX, rays.left, rays.right, output.width)));
+        y0 = static_cast<uint32_t>(toPixel(minY, rays.down, rays.up, output.height));
+        y1 = static_cast<uint32_t>(ceilf(toPixel(maxY, rays.down, rays.up, output.height)));
+        // A pixel of margin for rounding.
+        x0 = x0 > 0 ? x0 - 1 : 0;
+        y0 = y0 > 0 ? y0 - 1 : 0;
+        x1 = x1 < output.width ? x1 + 1 : output.width;
+        y1 = y1 < output.height ? y1 + 1 : output.height;
+    }
+
+    const CompositorImage& image = *source.image;
+    const XrRect2Di& rect = source.rect;
+    uint32_t* row = compositor->row.data();
+    for (uint32_t py = y0; py < y1; ++py) {
+        const uint64_t startNs = nowNs();
+        const float ry = rays.y(py);
+        uint32_t first = x1, last = x0;
+        for (uint32_t px = x0; px < x1; ++px) {
+            const Vec3 direction = {rays.x(px), ry, -1.0f};
+            const float denominator = dot(direction, normal);
+            if (fabsf(denominator) < 1e-8f) {
+                continue;
+            }
+            const float t = planeDistance / denominator;
+            if (t <= 0.0f) {
+                continue;
+            }
+            const Vec3 offset = sub(scale(direction, t), center);
+            const float u = dot(offset, right);
+            const float v = dot(offset, up);
+            if (fabsf(u) > halfWidth || fabsf(v) > halfHeight) {
+                continue;
+            }
+            const int32_t tx = static_cast<int32_t>((u / layer.size.width + 0.5f) * rect.extent.width);
+            const int32_t ty = static_cast<int32_t>((v / layer.size.height + 0.5f) * rect.extent.height);
+            const int32_t sx = rect.offset.x + (tx < rect.extent.width ? tx : rect.extent.width - 1);
+            const int32_t sy = rect.offset.y + (ty < rect.extent.height ? ty : rect.extent.height - 1);
+            row[px] = image.pixels[static_cast<size_t>(sy) * image.width + sx];
+            first = px < first ? px : first;
+            last = px;
+        }
+        const uint64_t sampledNs = nowNs();
+        // Convex, so one span per row.
+        if (first <= last) {
+            const uint32_t count = last - first + 1;
+            blendSpan(kernels, layer.flags, output.pixels.data() + static_cast<size_t>(py) * output.width + first,
+                      row + first, count);
+            cost->pixels += count;
+        }
+        cost->sampleNs += sampledNs - startNs;
+        cost->blendNs += nowNs() - sampledNs;
+    }
+}
+
+void referenceCompositorInit(ReferenceCompositor* compositor, uint32_t width, uint32_t height,
+                             const CompositorEye eyes[2]) {
+    for (uint32_t eye = 0; eye < 2; ++eye) {
+        compositor->eyes[eye] = eyes[eye];
+        compositor->output[eye].width = width;
+        compositor->output[eye].height = height;
+        compositor->output[eye].pixels.assign(static_cast<size_t>(width) * height, 0);
+    }
+    compositor->row.assign(width, 0);
+    compositor->frames = 0;
+    compositor->layerCount = 0;
+    compositor->finishNs = 0;
+}
+
+void referenceCompositorCompose(ReferenceCompositor* compositor, const CompositorLayer* layers, uint32_t layerCount,
+                                XrEnvironmentBlendMode blendMode) {
+    const BlendKernels& kernels = compositor->simd ? kSimdKernels : kScalarKernels;
+    for (auto& output : compositor->output) {
+        std::fill(output.pixels.begin(), output.pixels.end(), 0u);
+    }
+    compositor->layerCount = layerCount < REFERENCE_COMPOSITOR_MAX_LAYERS ? layerCount : REFERENCE_COMPOSITOR_MAX_LAYERS;
+    for (uint32_t i = 0; i < compositor->layerCount; ++i) {
+        const CompositorLayer& layer = layers[i];
+        CompositorLayerCost* cost = &compositor->costs[i];
+        *cost = {layer.kind, 0, 0, 0};
+        for (uint32_t eye = 0; eye < 2; ++eye) {
+            if (layer.kind == COMPOSITOR_LAYER_PROJECTION) {
+                composeProjection(compositor, kernels, layer, eye, cost);
+            } else if (layer.eyeVisibility == XR_EYE_VISIBILITY_BOTH ||
+                       layer.eyeVisibility == (eye == 0 ? XR_EYE_VISIBILITY_LEFT : XR_EYE_VISIBILITY_RIGHT)) {
+                composeQuad(compositor, kernels, layer, eye, cost);
+            }
+        }
+    }
+
+    const uint64_t finishStartNs = nowNs();
+    if (blendMode != XR_ENVIRONMENT_BLEND_MODE_ALPHA_BLEND) {
+        for (auto& output : compositor->output) {
+            kernels.opaqueAlpha(output.pixels.data(), static_cast<uint32_t>(output.pixels.size()));
+        }
+    }
+    compositor->finishNs = nowNs() - finishStartNs;
+    compositor->frames++;
+}
+
+// --- Report ---
+
+struct ReportWriter {
+    char* buffer;
+    size_t capacity;
+    size_t length;
+};
+
+__attribute__((format(printf, 2, 3)))
+static void append(ReportWriter* writer, const char* fmt, ...) {
+    if (writer->length + 1 >= writer->capacity) {
+        return;
+    }
+    va_list args;
+    va_start(args, fmt);
+    const int written = vsnprintf(writer->buffer + writer->length, writer->capacity - writer->length, fmt, args);
+    va_end(args);
+    if (written > 0) {
+        writer->length += static_cast<size_t>(written);
+        if (writer->length >= writer->capacity) {
+            writer->length = writer->capacity - 1;
+        }
+    }
+}
+
+size_t referenceCompositorFormat(const ReferenceCompositor* compositor, char* buffer, size_t capacity) {
+    if (capacity == 0) {
+        return 0;
+    }
+    buffer[0] = '\0';
+    ReportWriter writer = {buffer, capacity, 0};
+    append(&writer, "Composited frame %llu: %ux%u per eye, %u layer(s), %s kernels\n",
+           static_cast<unsigned long long>(compositor->frames), compositor->output[0].width,
+           compositor->output[0].height, compositor->layerCount, compositor->simd ? "SIMD" : "scalar");
+    for (uint32_t i = 0; i < compositor->layerCount; ++i) {
+        const CompositorLayerCost& cost = compositor->costs[i];
+        const double pixels = cost.pixels ? static_cast<double>(cost.pixels) : 1.0;
+        append(&writer, "  layer %u %-10s %9llu px  sample %7.1f us (%.1f ns/px)  blend %7.1f us (%.2f ns/px)\n", i,
+               cost.kind == COMPOSITOR_LAYER_PROJECTION ? "projection" : "quad",
+               static_cast<unsigned long long>(cost.pixels), cost.sampleNs / 1e3, cost.sampleNs / pixels,
+               cost.blendNs / 1e3, cost.blendNs / pixels);
+    }
+    append(&writer, "  environment blend %.1f us\n", compositor->finishNs / 1e3);
+    return writer.length;
+}
+
+// --- Images ---
+
+bool compositorImageWritePam(const CompositorImage& image, const char* path) {
+    FILE* file = fopen(path, "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    fprintf(file, "P7\nWIDTH %u\nHEIGHT %u\nDEPTH 4\nMAXVAL 255\nTUPLTYPE RGB_ALPHA\nENDHDR\n", image.width,
+            image.height);
+    std::vector<uint8_t> bytes(static_cast<size_t>(image.width) * 4);
+    bool ok = true;
+    for (uint32_t y = image.height; y-- > 0 && ok;) {
+        const uint32_t* row = image.pixels.data() + static_cast<size_t>(y) * image.width;
+        for (uint32_t x = 0; x < image.width; ++x) {
+            bytes[x * 4 + 0] = static_cast<uint8_t>(row[x]);
+            bytes[x * 4 + 1] = static_cast<uint8_t>(row[x] >> 8);
+            bytes[x * 4 + 2] = static_cast<uint8_t>(row[x] >> 16);
+            bytes[x * 4 + 3] = static_cast<uint8_t>(row[x] >> 24);
+        }
+        ok = fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+    }
+    return fclose(file) == 0 && ok;
+}
+
+bool compositorImageReadPam(CompositorImage* image, const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    char token[32];
+    unsigned width = 0, height = 0, depth = 0, maxval = 0;
+    bool ok = fscanf(file, "%31s", token) == 1 && strcmp(token, "P7") == 0;
+    while (ok && fscanf(file, "%31s", token) == 1 && strcmp(token, "ENDHDR") != 0) {
+        if (strcmp(token, "WIDTH") == 0) {
+            ok = fscanf(file, "%u", &width) == 1;
+        } else if (strcmp(token, "HEIGHT") == 0) {
+            ok = fscanf(file, "%u", &height) == 1;
+        } else if (strcmp(token, "DEPTH") == 0) {
+            ok = fscanf(file, "%u", &depth) == 1;
+        } else if (strcmp(token, "MAXVAL") == 0) {
+            ok = fscanf(file, "%u", &maxval) == 1;
+        } else if (strcmp(token, "TUPLTYPE") == 0) {
+            ok = fscanf(file, "%31s", token) == 1;
+        }
+    }
+    ok = ok && fgetc(file) == '\n' && depth == 4 && maxval == 255 && width > 0 && height > 0;
+    if (ok) {
+        image->width = width;
+        image->height = height;
+        image->pixels.resize(static_cast<size_t>(width) * height);
+        std::vector<uint8_t> bytes(static_cast<size_t>(width) * 4);
+        for (uint32_t y = height; y-- > 0 && ok;) {
+            ok = fread(bytes.data(), 1, bytes.size(), file) == bytes.size();
+            uint32_t* row = image->pixels.data() + static_cast<size_t>(y) * width;
+            for (uint32_t x = 0; x < width && ok; ++x) {
+                row[x] = bytes[x * 4] | (bytes[x * 4 + 1] << 8) | (bytes[x * 4 + 2] << 16) |
+                         (static_cast<uint32_t>(bytes[x * 4 + 3]) << 24);
+            }
+        }
+    }
+    fclose(file);
+    return ok;
+}
+
+uint32_t compositorImageMaxDiff(const CompositorImage& a, const CompositorImage& b) {
+    if (a.width != b.width || a.height != b.height || a.pixels.size() != b.pixels.size()) {
+        return UINT32_MAX;
+    }
+    uint32_t maxDiff = 0;
+    for (size_t i = 0; i < a.pixels.size(); ++i) {
+        for (uint32_t shift = 0; shift < 32; shift += 8) {
+            const int diff = static_cast<int>((a.pixels[i] >> shift) & 0xff) - static_cast<int>((b.pixels[i] >> shift) & 0xff);
+            const uint32_t magnitude = static_cast<uint32_t>(diff < 0 ? -diff : diff);
+            maxDiff = magnitude > maxDiff ? magnitude : maxDiff;
+        }
+    }
+    return maxDiff;
+}
+
+uint64_t compositorImageHash(const CompositorImage& image) {
+    // FNV-1a over the size and pixels.
+    uint64_t hash = 0xcbf29ce484222325ull;
+    auto feed = [&hash](uint32_t value) {
+        for (uint32_t shift = 0; shift < 32; shift += 8) {
+            hash = (hash ^ ((value >> shift) & 0xff)) * 0x100000001b3ull;
+        }
+    };
+    feed(image.width);
+    feed(image.height);
+    for (uint32_t pixel : image.pixels) {
+        feed(pixel);
+    }
+    return hash;
+}
@@ -0,0 +1,110 @@
+//
+// CPU reference compositor.
+//
+// Resolves a frame's projection and quad layers into the two eye images the way the OpenXR spec
+// describes it, so what the runtime is asked to show (base's projection plus the overlays'
+// quads) can be looked at, diffed against golden images and costed on the build machine.
+//
+//   - Layers are composited in submission order onto transparent black.
+//   - Projection layers: each eye samples its view's sub-image (the view is assumed to have the
+//     eye's pose and FOV; there is no reprojection).
+//   - Quad layers: a ray per eye pixel is intersected with the quad's plane (pose, size,
+//     eyeVisibility); the covered pixels of a row are one span since the quad is convex.
+//   - XR_COMPOSITION_LAYER_BLEND_TEXTURE_SOURCE_ALPHA_BIT: premultiplied "over"; without it the
+//     layer is opaque (alpha taken as 1). XR_COMPOSITION_LAYER_UNPREMULTIPLIED_ALPHA_BIT
+//     premultiplies the texels first.
+//   - environmentBlendMode: OPAQUE and ADDITIVE ignore the final alpha (it is set to 1, the colour
+//     is what is added to black or to the world); ALPHA_BLEND keeps it.
+//
+// Sampling is nearest-texel and works on the stored 8-bit values: sRGB images are blended
+// encoded, not linearised. Sampling fills a row buffer per span and the blend kernels (SSE2 when
+// available, bit-identical scalar otherwise) combine it with the eye image, four pixels at a time.
+//
+// Images are RGBA8 (R in the low byte) in GL row order, row 0 at the bottom, as glReadPixels
+// returns them; the PAM files are written top row first.
+//
+
+#ifndef ANDROIDSAMSUNG_REFERENCE_COMPOSITOR_H
+#define ANDROIDSAMSUNG_REFERENCE_COMPOSITOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <openxr/openxr.h>
+
+#define REFERENCE_COMPOSITOR_MAX_LAYERS 16
+
+struct CompositorImage {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    std::vector<uint32_t> pixels;
+};
+
+enum CompositorLayerKind {
+    COMPOSITOR_LAYER_PROJECTION,
+    COMPOSITOR_LAYER_QUAD,
+};
+
+// A layer's sub-image, already read back from its swapchain.
+struct CompositorSource {
+    const CompositorImage* image = nullptr;
+    XrRect2Di rect = {};
+};
+
+struct CompositorLayer {
+    CompositorLayerKind kind = COMPOSITOR_LAYER_QUAD;
+    XrCompositionLayerFlags flags = 0;
+    XrEyeVisibility eyeVisibility = XR_EYE_VISIBILITY_BOTH;
+    CompositorSource views[2]; // projection: one per eye; quad: views[0]
+    // Quad only, in the eyes' space.
+    XrPosef pose = {{0, 0, 0, 1}, {0, 0, 0}};
+    XrExtent2Df size = {};
+};
+
+struct CompositorEye {
+    XrPosef pose = {{0, 0, 0, 1}, {0, 0, 0}};
+    XrFovf fov = {};
+};
+
+// Summed over both eyes for the last composed frame.
+struct CompositorLayerCost {
+    CompositorLayerKind kind;
+    uint64_t pixels;   // eye pixels the layer covered
+    uint64_t sampleNs; // ray/texel lookups into the row buffer
+    uint64_t blendNs;  // blend kernels
+};
+
+struct ReferenceCompositor {
+    CompositorEye eyes[2];
+    CompositorImage output[2];
+    bool simd = true; // false runs the scalar kernels (same results)
+
+    uint64_t frames = 0;
+    uint32_t layerCount = 0;
+    CompositorLayerCost costs[REFERENCE_COMPOSITOR_MAX_LAYERS] = {};
+    uint64_t finishNs = 0; // environment blend mode pass
+
+    std::vector<uint32_t> row;
+};
+
+void referenceCompositorInit(ReferenceCompositor* compositor, uint32_t width, uint32_t height,
+                             const CompositorEye eyes[2]);
+// Composes `layerCount` layers (at most REFERENCE_COMPOSITOR_MAX_LAYERS) into compositor->output.
+void referenceCompositorCompose(ReferenceCompositor* compositor, const CompositorLayer* layers, uint32_t layerCount,
+                                XrEnvironmentBlendMode blendMode);
+// Per-layer cost of the last frame. Returns the length written (truncated to `capacity` - 1).
+size_t referenceCompositorFormat(const ReferenceCompositor* compositor, char* buffer, size_t capacity);
+
+// `a` then `b`: b's pose expressed in a's parent space.
+XrPosef compositorPoseMultiply(const XrPosef& a, const XrPosef& b);
+
+// --- Images for golden comparisons ---
+// Netpbm PAM, RGB_ALPHA, top row first.
+bool compositorImageWritePam(const CompositorImage& image, const char* path);
+bool compositorImageReadPam(CompositorImage* image, const char* path);
+// Largest per-channel difference; UINT32_MAX when the sizes differ.
+uint32_t compositorImageMaxDiff(const CompositorImage& a, const CompositorImage& b);
+uint64_t compositorImageHash(const CompositorImage& image);
+
+#endif //ANDROIDSAMSUNG_REFERENCE_COMPOSITOR_H
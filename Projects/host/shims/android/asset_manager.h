@@ -0,0 +1,34 @@
+//
+// Host stand-in for the NDK's <android/asset_manager.h>: assets are plain files
+// under a root directory (usually an app's src/main/assets).
+//
+
+#ifndef ANDROIDSAMSUNG_HOST_ANDROID_ASSET_MANAGER_H
+#define ANDROIDSAMSUNG_HOST_ANDROID_ASSET_MANAGER_H
+
+#include <sys/types.h>
+
+struct AAssetManager;
+typedef struct AAssetManager AAssetManager;
+
+struct AAsset;
+typedef struct AAsset AAsset;
+
+enum {
+    AASSET_MODE_UNKNOWN = 0,
+    AASSET_MODE_RANDOM = 1,
+    AASSET_MODE_STREAMING = 2,
+    AASSET_MODE_BUFFER = 3
+};
+
+AAsset* AAssetManager_open(AAssetManager* mgr, const char* filename, int mode);
+const void* AAsset_getBuffer(AAsset* asset);
+int AAsset_read(AAsset* asset, void* buf, size_t count);
+off_t AAsset_getLength(AAsset* asset);
+void AAsset_close(AAsset* asset);
+
+// --- Host only ---
+AAssetManager* hostAssetManagerCreate(const char* rootDir);
+void hostAssetManagerDestroy(AAssetManager* mgr);
+
+#endif //ANDROIDSAMSUNG_HOST_ANDROID_ASSET_MANAGER_H
@@ -0,0 +1,16 @@
+//
+// Host stand-in for the NDK's <android/asset_manager_jni.h>. Without a VM there is no Java
+// AssetManager; the host glue hands out ANativeActivity::assetManager instead.
+//
+
+#ifndef ANDROIDSAMSUNG_HOST_ANDROID_ASSET_MANAGER_JNI_H
+#define ANDROIDSAMSUNG_HOST_ANDROID_ASSET_MANAGER_JNI_H
+
+#include <jni.h>
+#include <android/asset_manager.h>
+
+inline AAssetManager* AAssetManager_fromJava(JNIEnv*, jobject) {
+    return nullptr;
+}
+
+#endif //ANDROIDSAMSUNG_HOST_ANDROID_ASSET_MANAGER_JNI_H
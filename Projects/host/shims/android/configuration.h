@@ -0,0 +1,11 @@
+//
+// Host stand-in for the NDK's <android/configuration.h>: only the opaque type.
+//
+
+#ifndef ANDROIDSAMSUNG_HOST_ANDROID_CONFIGURATION_H
+#define ANDROIDSAMSUNG_HOST_ANDROID_CONFIGURATION_H
+
+struct AConfiguration;
+typedef struct AConfiguration AConfiguration;
+
+#endif //ANDROIDSAMSUNG_HOST_ANDROID_CONFIGURATION_H
@@ -0,0 +1,30 @@
+//
+// Host stand-in for the NDK's <android/input.h>: the motion event calls main.cpp's tap handler
+// makes. No input queue is attached on the host, so no events arrive.
+//
+
+#ifndef ANDROIDSAMSUNG_HOST_ANDROID_INPUT_H
+#define ANDROIDSAMSUNG_HOST_ANDROID_INPUT_H
+
+#include <cstddef>
+#include <cstdint>
+
+struct AInputEvent;
+typedef struct AInputEvent AInputEvent;
+
+enum {
+    AINPUT_EVENT_TYPE_KEY = 1,
+    AINPUT_EVENT_TYPE_MOTION = 2,
+};
+
+enum {
+    AMOTION_EVENT_ACTION_DOWN = 0,
+    AMOTION_EVENT_ACTION_UP = 1,
+};
+
+inline int32_t AInputEvent_getType(const AInputEvent*) { return 0; }
+inline int32_t AMotionEvent_getAction(const AInputEvent*) { return AMOTION_EVENT_ACTION_UP; }
+inline float AMotionEvent_getX(const AInputEvent*, size_t) { return 0.0f; }
+inline float AMotionEvent_getY(const AInputEvent*, size_t) { return 0.0f; }
+
+#endif //ANDROIDSAMSUNG_HOST_ANDROID_INPUT_H
@@ -0,0 +1,35 @@
+//
+// Host stand-in for the NDK's <android/log.h>: logcat priorities map onto stderr.
+//
+
+#ifndef ANDROIDSAMSUNG_HOST_ANDROID_LOG_H
+#define ANDROIDSAMSUNG_HOST_ANDROID_LOG_H
+
+#include <cstdarg>
+#include <cstdio>
+
+typedef enum android_LogPriority {
+    ANDROID_LOG_UNKNOWN = 0,
+    ANDROID_LOG_DEFAULT,
+    ANDROID_LOG_VERBOSE,
+    ANDROID_LOG_DEBUG,
+    ANDROID_LOG_INFO,
+    ANDROID_LOG_WARN,
+    ANDROID_LOG_ERROR,
+    ANDROID_LOG_FATAL,
+    ANDROID_LOG_SILENT,
+} android_LogPriority;
+
+__attribute__((format(printf, 3, 4)))
+inline int __android_log_print(int prio, const char* tag, const char* fmt, ...) {
+    static const char kLevels[] = "??VDIWEFS";
+    fprintf(stderr, "%c/%s: ", kLevels[prio < 0 || prio > ANDROID_LOG_SILENT ? 0 : prio], tag);
+    va_list args;
+    va_start(args, fmt);
+    int written = vfprintf(stderr, fmt, args);
+    va_end(args);
+    fputc('\n', stderr);
+    return written;
+}
+
+#endif //ANDROIDSAMSUNG_HOST_ANDROID_LOG_H
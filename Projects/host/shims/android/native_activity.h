@@ -0,0 +1,47 @@
+//
+// Host stand-in for the NDK's <android/native_activity.h>: the ANativeActivity layout the glue
+// and the apps read (vm, clazz and env stay null, there is no VM), and the opaque window and
+// input types android_native_app_glue.h refers to.
+//
+
+#ifndef ANDROIDSAMSUNG_HOST_ANDROID_NATIVE_ACTIVITY_H
+#define ANDROIDSAMSUNG_HOST_ANDROID_NATIVE_ACTIVITY_H
+
+#include <cstdint>
+
+#include <jni.h>
+#include <android/asset_manager.h>
+
+struct ANativeWindow;
+typedef struct ANativeWindow ANativeWindow;
+struct AInputQueue;
+typedef struct AInputQueue AInputQueue;
+struct AInputEvent;
+typedef struct AInputEvent AInputEvent;
+
+typedef struct ARect {
+    int32_t left;
+    int32_t top;
+    int32_t right;
+    int32_t bottom;
+} ARect;
+
+struct ANativeActivityCallbacks;
+
+typedef struct ANativeActivity {
+    struct ANativeActivityCallbacks* callbacks;
+    JavaVM* vm;
+    JNIEnv* env;
+    jobject clazz;
+    const char* internalDataPath;
+    const char* externalDataPath;
+    int32_t sdkVersion;
+    void* instance;
+    AAssetManager* assetManager;
+    const char* obbPath;
+} ANativeActivity;
+
+// On the host: the activity's pause, stop and destroy, as commands to android_main.
+void ANativeActivity_finish(ANativeActivity* activity);
+
+#endif //ANDROIDSAMSUNG_HOST_ANDROID_NATIVE_ACTIVITY_H
@@ -0,0 +1,16 @@
+//
+// Host stand-in for the NDK's <android/sharedmem.h>: ASharedMemory regions are memfds. Dropping
+// PROT_WRITE with ASharedMemory_setProt seals the memfd against new writable mappings
+// (F_SEAL_FUTURE_WRITE); mappings made before stay writable, as with ashmem.
+//
+
+#ifndef ANDROIDSAMSUNG_HOST_ANDROID_SHAREDMEM_H
+#define ANDROIDSAMSUNG_HOST_ANDROID_SHAREDMEM_H
+
+#include <cstddef>
+
+int ASharedMemory_create(const char* name, size_t size);
+size_t ASharedMemory_getSize(int fd);
+int ASharedMemory_setProt(int fd, int prot);
+
+#endif //ANDROIDSAMSUNG_HOST_ANDROID_SHAREDMEM_H
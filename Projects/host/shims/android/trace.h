@@ -0,0 +1,31 @@
+//
+// Host stand-in for the NDK's <android/trace.h>. Sections are buffered in memory and written as
+// Chrome trace JSON (chrome://tracing, ui.perfetto.dev) when the process exits, to the file named
+// by debug.openxr_overlay.trace, i.e. DEBUG_OPENXR_OVERLAY_TRACE. Unset, every call is a no-op.
+// Timestamps are CLOCK_MONOTONIC, like the mock runtime's display clock and the
+// XrApiLayer_overlay_timing trace, so those line up with it.
+//
+
+#ifndef ANDROIDSAMSUNG_HOST_ANDROID_TRACE_H
+#define ANDROIDSAMSUNG_HOST_ANDROID_TRACE_H
+
+#include <cstdint>
+
+#define HOST_TRACE_PROPERTY "debug.openxr_overlay.trace"
+// Sections past this many are dropped (and counted); the buffer is allocated up front.
+#define HOST_TRACE_MAX_EVENTS (1u << 18)
+// Deeper nesting on one thread is dropped.
+#define HOST_TRACE_MAX_DEPTH 32
+#define HOST_TRACE_MAX_NAME 48
+
+bool ATrace_isEnabled();
+void ATrace_beginSection(const char* sectionName);
+void ATrace_endSection();
+
+// Host only: start buffering for `path` without the property (tests), and write what is buffered
+// now instead of at exit, which also stops buffering. Returns the number of sections written, or
+// -1 if the file can't be.
+void hostTraceStart(const char* path);
+int64_t hostTraceFlush();
+
+#endif //ANDROIDSAMSUNG_HOST_ANDROID_TRACE_H
@@ -0,0 +1,12 @@
+//
+// Host android_native_app_glue.h: the NDK's own header, as vendored with the apps, over the
+// shims in this directory, so the shared modules and the apps agree on struct android_app.
+// native_app_glue.cpp stands in for the NDK's android_native_app_glue.c.
+//
+
+#ifndef ANDROIDSAMSUNG_HOST_ANDROID_NATIVE_APP_GLUE_H
+#define ANDROIDSAMSUNG_HOST_ANDROID_NATIVE_APP_GLUE_H
+
+#include "../../base/app/src/main/cpp/android_native_app_glue.h"
+
+#endif //ANDROIDSAMSUNG_HOST_ANDROID_NATIVE_APP_GLUE_H
@@ -0,0 +1,66 @@
+#include <android/asset_manager.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+struct AAssetManager {
+    char root[512];
+};
+
+struct AAsset {
+    char* data;
+    off_t length;
+    off_t offset;
+};
+
+AAssetManager* hostAssetManagerCreate(const char* rootDir) {
+    auto* mgr = new AAssetManager;
+    snprintf(mgr->root, sizeof(mgr->root), "%s", rootDir);
+    return mgr;
+}
+
+void hostAssetManagerDestroy(AAssetManager* mgr) {
+    delete mgr;
+}
+
+// Every mode reads the whole file, which is what AASSET_MODE_BUFFER gets on
+// device for uncompressed assets anyway.
+AAsset* AAssetManager_open(AAssetManager* mgr, const char* filename, int /*mode*/) {
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/%s", mgr->root, filename);
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return nullptr;
+    }
+    fseek(file, 0, SEEK_END);
+    const long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    auto* asset = new AAsset{static_cast<char*>(malloc(length > 0 ? length : 1)), length > 0 ? length : 0, 0};
+    if (asset->length > 0 && fread(asset->data, 1, asset->length, file) != static_cast<size_t>(asset->length)) {
+        asset->length = 0;
+    }
+    fclose(file);
+    return asset;
+}
+
+const void* AAsset_getBuffer(AAsset* asset) {
+    return asset->data;
+}
+
+int AAsset_read(AAsset* asset, void* buf, size_t count) {
+    const size_t remaining = static_cast<size_t>(asset->length - asset->offset);
+    const size_t n = count < remaining ? count : remaining;
+    memcpy(buf, asset->data + asset->offset, n);
+    asset->offset += static_cast<off_t>(n);
+    return static_cast<int>(n);
+}
+
+off_t AAsset_getLength(AAsset* asset) {
+    return asset->length;
+}
+
+void AAsset_close(AAsset* asset) {
+    free(asset->data);
+    delete asset;
+}
@@ -0,0 +1,57 @@
+//
+// Host stand-in for <jni.h>: the types openxr_platform.h (XR_USE_PLATFORM_ANDROID) and the apps'
+// JNI entry points refer to. There is no VM on the host (ANativeActivity::vm is null): the entry
+// points and the calls into Java compile, nothing calls them, and the JNIEnv methods they use
+// return null.
+//
+
+#ifndef ANDROIDSAMSUNG_HOST_JNI_H
+#define ANDROIDSAMSUNG_HOST_JNI_H
+
+#include <cstdint>
+
+#define JNIEXPORT __attribute__((visibility("default")))
+#define JNICALL
+#define JNI_OK 0
+#define JNI_ERR (-1)
+
+typedef void* jobject;
+typedef jobject jclass;
+typedef jobject jstring;
+typedef jobject jarray;
+typedef jarray jlongArray;
+typedef jarray jfloatArray;
+typedef int32_t jint;
+typedef int64_t jlong;
+typedef float jfloat;
+typedef uint8_t jboolean;
+typedef jint jsize;
+
+struct _jmethodID;
+typedef _jmethodID* jmethodID;
+
+struct _JNIEnv;
+typedef _JNIEnv JNIEnv;
+
+struct _JavaVM {
+    jint AttachCurrentThread(JNIEnv**, void*) { return JNI_ERR; }
+    jint DetachCurrentThread() { return JNI_ERR; }
+};
+typedef _JavaVM JavaVM;
+
+struct _JNIEnv {
+    jclass GetObjectClass(jobject) { return nullptr; }
+    jmethodID GetMethodID(jclass, const char*, const char*) { return nullptr; }
+    void CallVoidMethod(jobject, jmethodID, ...) {}
+    void DeleteLocalRef(jobject) {}
+    jboolean ExceptionCheck() { return 0; }
+    void ExceptionDescribe() {}
+    void ExceptionClear() {}
+    jstring NewStringUTF(const char*) { return nullptr; }
+    jlongArray NewLongArray(jsize) { return nullptr; }
+    jfloatArray NewFloatArray(jsize) { return nullptr; }
+    void SetLongArrayRegion(jlongArray, jsize, jsize, const jlong*) {}
+    void SetFloatArrayRegion(jfloatArray, jsize, jsize, const jfloat*) {}
+};
+
+#endif //ANDROIDSAMSUNG_HOST_JNI_H
@@ -0,0 +1,149 @@
+#include <android/looper.h>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+struct LooperFd {
+    int ident;
+    int events;
+    ALooper_callbackFunc callback;
+    void* data;
+};
+
+struct ALooper {
+    int epollFd = -1;
+    int wakeFd = -1;
+    std::atomic<int> refs{1};
+    std::mutex mutex;
+    std::unordered_map<int, LooperFd> fds;
+};
+
+static thread_local ALooper* t_looper = nullptr;
+
+static uint32_t toEpollEvents(int events) {
+    uint32_t epollEvents = 0;
+    if (events & ALOOPER_EVENT_INPUT) epollEvents |= EPOLLIN;
+    if (events & ALOOPER_EVENT_OUTPUT) epollEvents |= EPOLLOUT;
+    return epollEvents;
+}
+
+static int fromEpollEvents(uint32_t epollEvents) {
+    int events = 0;
+    if (epollEvents & EPOLLIN) events |= ALOOPER_EVENT_INPUT;
+    if (epollEvents & EPOLLOUT) events |= ALOOPER_EVENT_OUTPUT;
+    if (epollEvents & EPOLLERR) events |= ALOOPER_EVENT_ERROR;
+    if (epollEvents & EPOLLHUP) events |= ALOOPER_EVENT_HANGUP;
+    return events;
+}
+
+ALooper* ALooper_forThread() {
+    return t_looper;
+}
+
+ALooper* ALooper_prepare(int /*opts*/) {
+    if (!t_looper) {
+        auto* looper = new ALooper;
+        looper->epollFd = epoll_create1(EPOLL_CLOEXEC);
+        looper->wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.fd = looper->wakeFd;
+        epoll_ctl(looper->epollFd, EPOLL_CTL_ADD, looper->wakeFd, &event);
+        t_looper = looper;
+    }
+    return t_looper;
+}
+
+void ALooper_acquire(ALooper* looper) {
+    looper->refs.fetch_add(1);
+}
+
+void ALooper_release(ALooper* looper) {
+    if (looper->refs.fetch_sub(1) == 1) {
+        close(looper->epollFd);
+        close(looper->wakeFd);
+        if (t_looper == looper) {
+            t_looper = nullptr;
+        }
+        delete looper;
+    }
+}
+
+// Returns one ready fd per call, like the device looper with a single event per poll.
+int ALooper_pollOnce(int timeoutMillis, int* outFd, int* outEvents, void** outData) {
+    ALooper* looper = t_looper;
+    if (!looper) {
+        return ALOOPER_POLL_ERROR;
+    }
+    for (;;) {
+        epoll_event event = {};
+        int count = epoll_wait(looper->epollFd, &event, 1, timeoutMillis);
+        if (count < 0) {
+            return ALOOPER_POLL_ERROR;
+        }
+        if (count == 0) {
+            return ALOOPER_POLL_TIMEOUT;
+        }
+        const int fd = event.data.fd;
+        if (fd == looper->wakeFd) {
+            uint64_t value;
+            while (read(looper->wakeFd, &value, sizeof(value)) > 0) {
+            }
+            return ALOOPER_POLL_WAKE;
+        }
+
+        LooperFd entry;
+        {
+            std::lock_guard<std::mutex> lock(looper->mutex);
+            auto it = looper->fds.find(fd);
+            if (it == looper->fds.end()) {
+                continue;
+            }
+            entry = it->second;
+        }
+        const int events = fromEpollEvents(event.events);
+        if (entry.callback) {
+            if (entry.callback(fd, events, entry.data) == 0) {
+                ALooper_removeFd(looper, fd);
+            }
+            return ALOOPER_POLL_CALLBACK;
+        }
+        if (outFd) *outFd = fd;
+        if (outEvents) *outEvents = events;
+        if (outData) *outData = entry.data;
+        return entry.ident;
+    }
+}
+
+void ALooper_wake(ALooper* looper) {
+    const uint64_t one = 1;
+    ssize_t written = write(looper->wakeFd, &one, sizeof(one));
+    (void)written;
+}
+
+int ALooper_addFd(ALooper* looper, int fd, int ident, int events, ALooper_callbackFunc callback, void* data) {
+    std::lock_guard<std::mutex> lock(looper->mutex);
+    epoll_event event = {};
+    event.events = toEpollEvents(events);
+    event.data.fd = fd;
+    const bool exists = looper->fds.count(fd) != 0;
+    if (epoll_ctl(looper->epollFd, exists ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, fd, &event) != 0) {
+        return -1;
+    }
+    looper->fds[fd] = {callback ? ALOOPER_POLL_CALLBACK : ident, events, callback, data};
+    return 1;
+}
+
+int ALooper_removeFd(ALooper* looper, int fd) {
+    std::lock_guard<std::mutex> lock(looper->mutex);
+    if (looper->fds.erase(fd) == 0) {
+        return 0;
+    }
+    epoll_ctl(looper->epollFd, EPOLL_CTL_DEL, fd, nullptr);
+    return 1;
+}
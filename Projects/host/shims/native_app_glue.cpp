@@ -0,0 +1,230 @@
+//
+// Host stand-in for the NDK's android_native_app_glue.c, plus the process entry point the
+// activity would be: runs an app's android_main on the main thread against a looper with the
+// glue's command pipe, its assets (HOST_APP_ASSET_DIR) behind the asset manager shim, and EGL
+// on Mesa's surfaceless platform. The app is started, resumed and focused up front and
+// finished after the given number of seconds.
+//
+// Built with FRAME_ALLOC_COUNTER it also checks the app's frame loop: after a warm-up, no turn
+// of it (from one xrWaitFrame to the next, as the mock runtime reports them) may call operator
+// new or, outside the GL driver, malloc, or the process fails. The activity is finished once
+// FRAME_ALLOC_MEASURED_FRAMES turns have been measured; the seconds are then only a timeout.
+//
+// Usage: host_<app> [seconds=5]
+//
+
+#include "android_native_app_glue.h"
+
+#include <android/asset_manager.h>
+#include <android/log.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+
+#if defined(FRAME_ALLOC_COUNTER)
+#include "alloc_counter.h"
+#include "mock_runtime/mock_runtime.h"
+#endif
+
+#define TAG "HostAppGlue"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+#ifndef HOST_APP_ASSET_DIR
+#define HOST_APP_ASSET_DIR "."
+#endif
+
+static std::atomic<bool> g_finishing{false};
+
+static void writeCmd(struct android_app* app, int8_t cmd) {
+    if (write(app->msgwrite, &cmd, sizeof(cmd)) != sizeof(cmd)) {
+        LOGE("Failure writing app cmd %d", cmd);
+    }
+}
+
+// --- android_native_app_glue.h ---
+
+int8_t android_app_read_cmd(struct android_app* app) {
+    int8_t cmd;
+    if (read(app->msgread, &cmd, sizeof(cmd)) != sizeof(cmd)) {
+        LOGE("No data on command pipe");
+        return -1;
+    }
+    return cmd;
+}
+
+void android_app_pre_exec_cmd(struct android_app* app, int8_t cmd) {
+    switch (cmd) {
+        case APP_CMD_START:
+        case APP_CMD_RESUME:
+        case APP_CMD_PAUSE:
+        case APP_CMD_STOP:
+            app->activityState = cmd;
+            break;
+    }
+}
+
+void android_app_post_exec_cmd(struct android_app* app, int8_t cmd) {
+    if (cmd == APP_CMD_DESTROY) {
+        app->destroyRequested = 1;
+    }
+}
+
+void app_dummy() {}
+
+static void processCmd(struct android_app* app, struct android_poll_source*) {
+    const int8_t cmd = android_app_read_cmd(app);
+    if (cmd < 0) {
+        return;
+    }
+    android_app_pre_exec_cmd(app, cmd);
+    if (app->onAppCmd) {
+        app->onAppCmd(app, cmd);
+    }
+    android_app_post_exec_cmd(app, cmd);
+}
+
+// --- android/native_activity.h ---
+
+void ANativeActivity_finish(ANativeActivity* activity) {
+    if (g_finishing.exchange(true)) {
+        return;
+    }
+    auto* app = static_cast<struct android_app*>(activity->instance);
+    writeCmd(app, APP_CMD_LOST_FOCUS);
+    writeCmd(app, APP_CMD_PAUSE);
+    writeCmd(app, APP_CMD_STOP);
+    writeCmd(app, APP_CMD_DESTROY);
+}
+
+// --- Frame allocations ---
+
+#if defined(FRAME_ALLOC_COUNTER)
+#define FRAME_ALLOC_WARMUP_FRAMES 30
+#define FRAME_ALLOC_MEASURED_FRAMES 60
+
+struct FrameAllocs {
+    ANativeActivity* activity = nullptr;
+    uint64_t turns = 0;
+    AllocCounts atTurn;
+    uint64_t measured = 0;   // turns after the warm-up
+    uint64_t allocating = 0; // of those, turns that allocated
+    AllocCounts allocs;      // summed over the measured turns
+};
+
+static void countFrameAllocs(XrSession, void* userData) {
+    auto* frames = static_cast<FrameAllocs*>(userData);
+    const AllocCounts now = allocCounterThread();
+    if (frames->turns++ >= FRAME_ALLOC_WARMUP_FRAMES && !g_finishing) {
+        const uint64_t news = now.news - frames->atTurn.news;
+        const uint64_t ownMallocs = now.ownMallocs - frames->atTurn.ownMallocs;
+        frames->measured++;
+        frames->allocating += news + ownMallocs > 0;
+        frames->allocs.news += news;
+        frames->allocs.mallocs += now.mallocs - frames->atTurn.mallocs;
+        frames->allocs.ownMallocs += ownMallocs;
+        if (frames->measured == FRAME_ALLOC_MEASURED_FRAMES) {
+            ANativeActivity_finish(frames->activity);
+        }
+    }
+    frames->atTurn = now;
+}
+#endif
+
+// --- Entry point ---
+
+int main(int argc, char** argv) {
+    const double seconds = argc > 1 ? atof(argv[1]) : 5.0;
+    if (seconds <= 0.0) {
+        fprintf(stderr, "Usage: %s [seconds]\n", argv[0]);
+        return 1;
+    }
+    // The apps call eglGetDisplay(EGL_DEFAULT_DISPLAY); Mesa picks the platform from here.
+    setenv("EGL_PLATFORM", "surfaceless", 0);
+
+    int msgpipe[2];
+    if (pipe2(msgpipe, O_CLOEXEC) != 0) {
+        LOGE("Could not create the command pipe");
+        return 1;
+    }
+
+    ANativeActivity activity = {};
+    activity.internalDataPath = "/tmp";
+    activity.externalDataPath = "/tmp";
+    activity.assetManager = hostAssetManagerCreate(HOST_APP_ASSET_DIR);
+
+    struct android_app app = {};
+    app.activity = &activity;
+    app.msgread = msgpipe[0];
+    app.msgwrite = msgpipe[1];
+    app.cmdPollSource.id = LOOPER_ID_MAIN;
+    app.cmdPollSource.app = &app;
+    app.cmdPollSource.process = processCmd;
+    activity.instance = &app;
+
+    app.looper = ALooper_prepare(ALOOPER_PREPARE_ALLOW_NON_CALLBACKS);
+    ALooper_addFd(app.looper, app.msgread, LOOPER_ID_MAIN, ALOOPER_EVENT_INPUT, nullptr, &app.cmdPollSource);
+    app.running = 1;
+
+    // What the activity would deliver before the first frame; there is no window.
+    writeCmd(&app, APP_CMD_START);
+    writeCmd(&app, APP_CMD_RESUME);
+    writeCmd(&app, APP_CMD_GAINED_FOCUS);
+
+    std::mutex mutex;
+    std::condition_variable done;
+    bool returned = false;
+    std::thread timer([&] {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (!done.wait_for(lock, std::chrono::duration<double>(seconds), [&] { return returned; })) {
+            LOGI("%.1f s up, finishing", seconds);
+            ANativeActivity_finish(&activity);
+        }
+    });
+
+#if defined(FRAME_ALLOC_COUNTER)
+    FrameAllocs frameAllocs;
+    frameAllocs.activity = &activity;
+    mockRuntimeSetFrameHook(countFrameAllocs, &frameAllocs);
+#endif
+    android_main(&app);
+#if defined(FRAME_ALLOC_COUNTER)
+    mockRuntimeSetFrameHook(nullptr, nullptr);
+#endif
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        returned = true;
+    }
+    done.notify_one();
+    timer.join();
+
+    ALooper_removeFd(app.looper, app.msgread);
+    ALooper_release(app.looper);
+    close(msgpipe[0]);
+    close(msgpipe[1]);
+    hostAssetManagerDestroy(activity.assetManager);
+    LOGI("android_main returned%s", app.destroyRequested ? "" : " before APP_CMD_DESTROY");
+#if defined(FRAME_ALLOC_COUNTER)
+    LOGI("%llu frames after the warm-up, %llu of them allocated: %llu new, %llu malloc outside the GL driver "
+         "(%llu inside it)",
+         (unsigned long long)frameAllocs.measured, (unsigned long long)frameAllocs.allocating,
+         (unsigned long long)frameAllocs.allocs.news, (unsigned long long)frameAllocs.allocs.ownMallocs,
+         (unsigned long long)(frameAllocs.allocs.mallocs - frameAllocs.allocs.ownMallocs));
+    if (frameAllocs.allocating > 0) {
+        LOGE("Frame loop allocates");
+        return 1;
+    }
+    if (frameAllocs.measured < FRAME_ALLOC_MEASURED_FRAMES) {
+        LOGE("Only %llu of %d frames measured in %.1f s", (unsigned long long)frameAllocs.measured,
+             FRAME_ALLOC_MEASURED_FRAMES, seconds);
+        return 1;
+    }
+#endif
+    return app.destroyRequested ? 0 : 1;
+}
@@ -0,0 +1,35 @@
+#include <android/sharedmem.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifndef F_SEAL_FUTURE_WRITE
+#define F_SEAL_FUTURE_WRITE 0x0010
+#endif
+
+int ASharedMemory_create(const char* name, size_t size) {
+    const int fd = memfd_create(name ? name : "ASharedMemory", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (fd < 0) {
+        return -1;
+    }
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+size_t ASharedMemory_getSize(int fd) {
+    struct stat st;
+    return fstat(fd, &st) == 0 ? static_cast<size_t>(st.st_size) : 0;
+}
+
+int ASharedMemory_setProt(int fd, int prot) {
+    if (prot & PROT_WRITE) {
+        // Like ashmem, protection can only be taken away.
+        return (fcntl(fd, F_GET_SEALS) & F_SEAL_FUTURE_WRITE) ? -1 : 0;
+    }
+    return fcntl(fd, F_ADD_SEALS, F_SEAL_FUTURE_WRITE | F_SEAL_SHRINK | F_SEAL_GROW);
+}
@@ -0,0 +1,32 @@
+//
+// Host stand-in for the NDK's <sys/system_properties.h>: a property is read from the
+// environment, upper-cased with '.' as '_' (debug.openxr_overlay.backend is
+// DEBUG_OPENXR_OVERLAY_BACKEND).
+//
+
+#ifndef ANDROIDSAMSUNG_HOST_SYS_SYSTEM_PROPERTIES_H
+#define ANDROIDSAMSUNG_HOST_SYS_SYSTEM_PROPERTIES_H
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#define PROP_NAME_MAX 32
+#define PROP_VALUE_MAX 92
+
+inline int __system_property_get(const char* name, char* value) {
+    char variable[PROP_NAME_MAX * 2] = {};
+    for (size_t i = 0; name[i] && i + 1 < sizeof(variable); ++i) {
+        variable[i] = name[i] == '.' ? '_' : static_cast<char>(toupper(static_cast<unsigned char>(name[i])));
+    }
+    const char* env = getenv(variable);
+    value[0] = '\0';
+    if (!env) {
+        return 0;
+    }
+    snprintf(value, PROP_VALUE_MAX, "%s", env);
+    return static_cast<int>(strlen(value));
+}
+
+#endif //ANDROIDSAMSUNG_HOST_SYS_SYSTEM_PROPERTIES_H
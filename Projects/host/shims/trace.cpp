@@ -0,0 +1,153 @@
+#include <android/trace.h>
+
+#include <android/log.h>
+#include <sys/syscall.h>
+#include <sys/system_properties.h>
+#include <time.h>
+#include <unistd.h>
+#include <atomic>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#define TAG "HostTrace"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+struct HostTraceEvent {
+    char name[HOST_TRACE_MAX_NAME];
+    uint32_t tid;
+    uint64_t startNs;
+    uint64_t durationNs;
+};
+
+struct HostTraceOpen {
+    char name[HOST_TRACE_MAX_NAME];
+    uint64_t startNs;
+};
+
+// Sections this thread has begun and not ended; past HOST_TRACE_MAX_DEPTH only counted.
+struct HostTraceThread {
+    HostTraceOpen open[HOST_TRACE_MAX_DEPTH];
+    uint32_t depth = 0;
+    uint32_t tid = static_cast<uint32_t>(syscall(SYS_gettid));
+};
+
+struct HostTrace {
+    std::atomic<bool> enabled{false};
+    std::mutex mutex;
+    std::string path;
+    std::vector<HostTraceEvent> events;
+    uint64_t dropped = 0;
+
+    HostTrace() {
+        char value[PROP_VALUE_MAX] = {};
+        if (__system_property_get(HOST_TRACE_PROPERTY, value) > 0) {
+            hostTraceStart(value);
+        }
+    }
+    // At exit: whatever is still buffered.
+    ~HostTrace() { hostTraceFlush(); }
+};
+
+static HostTrace g_trace;
+static thread_local HostTraceThread t_sections;
+
+static uint64_t nowNs() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + ts.tv_nsec;
+}
+
+bool ATrace_isEnabled() {
+    return g_trace.enabled.load(std::memory_order_relaxed);
+}
+
+void ATrace_beginSection(const char* sectionName) {
+    if (!ATrace_isEnabled()) {
+        return;
+    }
+    HostTraceThread& thread = t_sections;
+    if (thread.depth < HOST_TRACE_MAX_DEPTH) {
+        HostTraceOpen& open = thread.open[thread.depth];
+        snprintf(open.name, sizeof(open.name), "%s", sectionName);
+        open.startNs = nowNs();
+    }
+    ++thread.depth;
+}
+
+void ATrace_endSection() {
+    HostTraceThread& thread = t_sections;
+    if (!ATrace_isEnabled() || thread.depth == 0) {
+        return;
+    }
+    --thread.depth;
+    if (thread.depth >= HOST_TRACE_MAX_DEPTH) {
+        return;
+    }
+    const HostTraceOpen& open = thread.open[thread.depth];
+    const uint64_t endNs = nowNs();
+    std::lock_guard<std::mutex> lock(g_trace.mutex);
+    if (g_trace.events.size() == g_trace.events.capacity()) {
+        ++g_trace.dropped;
+        return;
+    }
+    HostTraceEvent event;
+    memcpy(event.name, open.name, sizeof(event.name));
+    event.tid = thread.tid;
+    event.startNs = open.startNs;
+    event.durationNs = endNs - open.startNs;
+    g_trace.events.push_back(event);
+}
+
+void hostTraceStart(const char* path) {
+    std::lock_guard<std::mutex> lock(g_trace.mutex);
+    g_trace.path = path;
+    g_trace.events.clear();
+    g_trace.events.reserve(HOST_TRACE_MAX_EVENTS);
+    g_trace.dropped = 0;
+    g_trace.enabled.store(true, std::memory_order_relaxed);
+}
+
+// Section names come from the code, but keep the file valid whatever they hold.
+static void writeName(FILE* out, const char* name) {
+    for (const char* c = name; *c; ++c) {
+        if (*c == '"' || *c == '\\') {
+            fputc('\\', out);
+            fputc(*c, out);
+        } else if (static_cast<unsigned char>(*c) >= 0x20) {
+            fputc(*c, out);
+        }
+    }
+}
+
+int64_t hostTraceFlush() {
+    std::lock_guard<std::mutex> lock(g_trace.mutex);
+    if (!g_trace.enabled.load(std::memory_order_relaxed)) {
+        return 0;
+    }
+    g_trace.enabled.store(false, std::memory_order_relaxed);
+    FILE* out = fopen(g_trace.path.c_str(), "w");
+    if (!out) {
+        LOGE("Cannot write %s", g_trace.path.c_str());
+        return -1;
+    }
+    const int pid = getpid();
+    fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    for (size_t i = 0; i < g_trace.events.size(); ++i) {
+        const HostTraceEvent& event = g_trace.events[i];
+        fprintf(out, "%s\n{\"name\":\"", i == 0 ? "" : ",");
+        writeName(out, event.name);
+        fprintf(out, "\",\"cat\":\"app\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%u}",
+                event.startNs / 1e3, event.durationNs / 1e3, pid, event.tid);
+    }
+    fprintf(out, "\n]}\n");
+    const bool written = fclose(out) == 0;
+    const int64_t count = static_cast<int64_t>(g_trace.events.size());
+    LOGI("%" PRId64 " sections written to %s, %" PRIu64 " dropped", count, g_trace.path.c_str(), g_trace.dropped);
+    std::vector<HostTraceEvent>().swap(g_trace.events);
+    return written ? count : -1;
+}
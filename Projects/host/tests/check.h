@@ -0,0 +1,33 @@
+//
+// The host tests' checks: CHECK(cond, fmt, ...) reports a failed condition with its location and
+// carries on, so one run lists every failure. main() ends with `return checkResult();`.
+//
+
+#ifndef ANDROIDSAMSUNG_CHECK_H
+#define ANDROIDSAMSUNG_CHECK_H
+
+#include <cstdio>
+
+static int g_failures = 0;
+
+#define CHECK(cond, ...)                                                  \
+    do {                                                                  \
+        if (!(cond)) {                                                    \
+            fprintf(stderr, "FAIL %s:%d: %s: ", __FILE__, __LINE__, #cond); \
+            fprintf(stderr, __VA_ARGS__);                                 \
+            fputc('\n', stderr);                                          \
+            ++g_failures;                                                 \
+        }                                                                 \
+    } while (0)
+
+// Prints the number of failed checks, or OK; returns the exit status.
+static inline int checkResult() {
+    if (g_failures) {
+        fprintf(stderr, "%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    printf("OK\n");
+    return 0;
+}
+
+#endif //ANDROIDSAMSUNG_CHECK_H
@@ -0,0 +1,145 @@
+//
+// Simulated display clock on virtual time: vsync spacing at each refresh rate, missed vsyncs
+// when the app is late, jitter bounds and reproducibility per seed, stalls, compositor
+// latency and the environment overrides.
+//
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "check.h"
+#include "mock_runtime/display_clock.h"
+
+// One app frame: wait for the display, then `workNs` of simulated work.
+static DisplayClockFrame frame(DisplayClock* clock, uint64_t workNs) {
+    const DisplayClockFrame next = displayClockNextFrame(clock, displayClockNow(clock));
+    displayClockSleepUntil(clock, next.wakeNs);
+    displayClockAdvance(clock, workNs);
+    return next;
+}
+
+static DisplayClockConfig virtualConfig(double hz) {
+    DisplayClockConfig config;
+    config.refreshHz = hz;
+    config.virtualTime = true;
+    return config;
+}
+
+int main() {
+    // --- Refresh rates: one frame per vsync when the app keeps up ---
+    const double rates[] = {60.0, 72.0, 90.0, 120.0};
+    for (double hz : rates) {
+        DisplayClock clock;
+        displayClockInit(&clock, virtualConfig(hz));
+        const XrDuration period = static_cast<XrDuration>(1e9 / hz);
+        CHECK(clock.periodNs == period, "%.0f Hz period %lld", hz, (long long) clock.periodNs);
+
+        DisplayClockFrame previous = frame(&clock, period / 2);
+        CHECK(previous.wakeNs == displayClockVsyncNs(&clock, previous.vsync), "wake off vsync");
+        CHECK(previous.displayTime == static_cast<XrTime>(previous.wakeNs + period), "display time");
+        for (int i = 0; i < 100; ++i) {
+            const DisplayClockFrame next = frame(&clock, period / 2);
+            CHECK(next.vsync == previous.vsync + 1 && next.missedVsyncs == 0, "%.0f Hz frame %d skipped", hz, i);
+            CHECK(next.displayTime - previous.displayTime == period, "%.0f Hz spacing", hz);
+            previous = next;
+        }
+        CHECK(clock.missedVsyncs == 0 && clock.frames == 101, "%.0f Hz counters", hz);
+    }
+
+    // --- Late app: 1.5 periods of work misses every other vsync ---
+    {
+        DisplayClock clock;
+        displayClockInit(&clock, virtualConfig(90.0));
+        frame(&clock, clock.periodNs * 3 / 2);
+        for (int i = 0; i < 10; ++i) {
+            const DisplayClockFrame next = frame(&clock, clock.periodNs * 3 / 2);
+            CHECK(next.missedVsyncs == 1, "frame %d missed %u", i, next.missedVsyncs);
+        }
+        CHECK(clock.missedVsyncs == 10, "missed %llu", (unsigned long long) clock.missedVsyncs);
+    }
+
+    // --- Jitter: bounded, ordered, reproducible per seed ---
+    {
+        DisplayClockConfig config = virtualConfig(90.0);
+        config.jitterNs = 1000000;
+        DisplayClock a, b, c;
+        displayClockInit(&a, config);
+        displayClockInit(&b, config);
+        config.seed = 2;
+        displayClockInit(&c, config);
+
+        int moved = 0, differs = 0;
+        for (uint64_t vsync = 1; vsync < 1000; ++vsync) {
+            const int64_t offset = static_cast<int64_t>(displayClockVsyncNs(&a, vsync)) - vsync * a.periodNs;
+            CHECK(offset >= -config.jitterNs && offset <= config.jitterNs, "vsync %llu offset %lld",
+                  (unsigned long long) vsync, (long long) offset);
+            CHECK(displayClockVsyncNs(&a, vsync) > displayClockVsyncNs(&a, vsync - 1), "out of order");
+            CHECK(displayClockVsyncNs(&a, vsync) == displayClockVsyncNs(&b, vsync), "same seed differs");
+            moved += offset != 0;
+            differs += displayClockVsyncNs(&a, vsync) != displayClockVsyncNs(&c, vsync);
+        }
+        CHECK(moved > 900 && differs > 900, "jitter moved %d, seeds differ %d", moved, differs);
+
+        // A frame loop on the same seed sees the same frames.
+        for (int i = 0; i < 50; ++i) {
+            const uint64_t work = static_cast<uint64_t>(i % 7) * 2000000;
+            const DisplayClockFrame fa = frame(&a, work);
+            const DisplayClockFrame fb = frame(&b, work);
+            CHECK(fa.vsync == fb.vsync && fa.displayTime == fb.displayTime, "run %d diverged", i);
+        }
+
+        config.jitterNs = a.periodNs;
+        displayClockInit(&a, config);
+        CHECK(a.config.jitterNs < a.periodNs / 2, "jitter not clamped");
+    }
+
+    // --- Stalls and compositor latency ---
+    {
+        DisplayClockConfig config = virtualConfig(90.0);
+        config.stallInterval = 4;
+        config.stallNs = 15000000; // longer than a period: the app misses the next vsync
+        config.compositorLatencyNs = 3000000;
+        DisplayClock clock;
+        displayClockInit(&clock, config);
+        for (int i = 0; i < 40; ++i) {
+            const DisplayClockFrame next = frame(&clock, 1000000);
+            const uint64_t vsyncNs = displayClockVsyncNs(&clock, next.vsync);
+            const bool stalled = next.vsync % 4 == 0;
+            CHECK(next.wakeNs == vsyncNs + (stalled ? config.stallNs : 0), "vsync %llu wake",
+                  (unsigned long long) next.vsync);
+            CHECK(next.displayTime == static_cast<XrTime>(vsyncNs + clock.periodNs + config.compositorLatencyNs),
+                  "latency");
+        }
+        CHECK(clock.stalls > 0 && clock.missedVsyncs == clock.stalls, "stalls %llu missed %llu",
+              (unsigned long long) clock.stalls, (unsigned long long) clock.missedVsyncs);
+    }
+
+    // --- No display: released at once ---
+    {
+        DisplayClock clock;
+        displayClockInit(&clock, virtualConfig(0.0));
+        const uint64_t start = displayClockNow(&clock);
+        for (int i = 0; i < 5; ++i) {
+            frame(&clock, 0);
+        }
+        CHECK(displayClockNow(&clock) == start && clock.lastVsync == 5, "no-display frames blocked");
+    }
+
+    // --- Environment ---
+    {
+        setenv("MOCK_XR_DISPLAY_HZ", "72", 1);
+        setenv("MOCK_XR_JITTER_US", "500", 1);
+        setenv("MOCK_XR_STALL_EVERY", "30", 1);
+        setenv("MOCK_XR_STALL_US", "20000", 1);
+        setenv("MOCK_XR_LATENCY_US", "4000", 1);
+        setenv("MOCK_XR_SEED", "0x2a", 1);
+        setenv("MOCK_XR_VIRTUAL_TIME", "1", 1);
+        DisplayClockConfig config;
+        displayClockConfigFromEnv(&config);
+        CHECK(config.refreshHz == 72.0 && config.jitterNs == 500000 && config.stallInterval == 30 &&
+              config.stallNs == 20000000 && config.compositorLatencyNs == 4000000 && config.seed == 42 &&
+              config.virtualTime, "environment not applied");
+    }
+
+    return checkResult();
+}
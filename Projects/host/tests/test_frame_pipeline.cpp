@@ -0,0 +1,179 @@
+//
+// Two-thread frame loop against the mock runtime: frames are handed over in order and each is
+// waited, begun and ended exactly once; acquire times out while the render thread holds a frame;
+// frames ended out of order are refused; and stopping with a frame held and the next one already
+// waited for leaves the session clean enough to start the pipeline again.
+//
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+#include <jni.h>
+#include <EGL/egl.h>
+
+#define XR_USE_PLATFORM_ANDROID
+#define XR_USE_GRAPHICS_API_OPENGL_ES
+#include <openxr/openxr_platform.h>
+
+#include "check.h"
+#include "frame_pipeline.h"
+#include "host_egl.h"
+#include "mock_runtime/mock_runtime.h"
+
+#define PERIOD_NS 5000000 // 200 Hz keeps the test short
+#define ACQUIRE_TIMEOUT_MS 1000
+#define SHORT_TIMEOUT_MS 50
+
+static MockRuntimeStats statsOf(XrSession session) {
+    MockRuntimeStats stats;
+    mockRuntimeGetStats(session, &stats);
+    return stats;
+}
+
+// Every frame the runtime handed out was begun and ended once, none replaced another.
+static void checkBalanced(XrSession session, const char* when) {
+    const MockRuntimeStats stats = statsOf(session);
+    CHECK(stats.framesWaited == stats.framesBegun && stats.framesBegun == stats.framesEnded &&
+          stats.framesDiscarded == 0, "%s: %llu waited, %llu begun, %llu ended, %llu discarded", when,
+          (unsigned long long)stats.framesWaited, (unsigned long long)stats.framesBegun,
+          (unsigned long long)stats.framesEnded, (unsigned long long)stats.framesDiscarded);
+}
+
+static XrResult endFrame(FramePipeline* pipeline, uint64_t frameId, const XrFrameState& frameState) {
+    XrFrameEndInfo endInfo = {XR_TYPE_FRAME_END_INFO};
+    endInfo.displayTime = frameState.predictedDisplayTime;
+    endInfo.environmentBlendMode = XR_ENVIRONMENT_BLEND_MODE_OPAQUE;
+    return framePipelineEndFrame(pipeline, frameId, &endInfo);
+}
+
+// Acquires and ends `frames` frames; they have to come numbered from `firstId`, later each time.
+static void runFrames(FramePipeline* pipeline, uint32_t frames, uint64_t firstId) {
+    XrTime previous = 0;
+    for (uint32_t i = 0; i < frames; ++i) {
+        XrFrameState frameState = {XR_TYPE_FRAME_STATE};
+        uint64_t frameId = 0;
+        if (!framePipelineAcquire(pipeline, &frameState, &frameId, ACQUIRE_TIMEOUT_MS)) {
+            CHECK(false, "frame %u not handed over", i);
+            return;
+        }
+        CHECK(frameId == firstId + i, "frame id %llu, expected %llu", (unsigned long long)frameId,
+              (unsigned long long)(firstId + i));
+        CHECK(frameState.predictedDisplayTime > previous, "display time went back");
+        previous = frameState.predictedDisplayTime;
+        CHECK(endFrame(pipeline, frameId, frameState) == XR_SUCCESS, "frame %llu not ended",
+              (unsigned long long)frameId);
+    }
+}
+
+int main() {
+    HostEgl egl;
+    if (!hostEglInit(&egl)) {
+        fprintf(stderr, "no EGL context\n");
+        return 1;
+    }
+    DisplayClockConfig clockConfig;
+    clockConfig.refreshHz = 1e9 / PERIOD_NS;
+    mockRuntimeSetDisplayClock(&clockConfig);
+
+    XrInstanceCreateInfo instanceInfo = {XR_TYPE_INSTANCE_CREATE_INFO};
+    const char* extensions[] = {XR_KHR_OPENGL_ES_ENABLE_EXTENSION_NAME};
+    strcpy(instanceInfo.applicationInfo.applicationName, "test_frame_pipeline");
+    instanceInfo.applicationInfo.apiVersion = XR_MAKE_VERSION(1, 0, 0);
+    instanceInfo.enabledExtensionCount = 1;
+    instanceInfo.enabledExtensionNames = extensions;
+    XrInstance instance = XR_NULL_HANDLE;
+    CHECK(xrCreateInstance(&instanceInfo, &instance) == XR_SUCCESS, "instance");
+    XrSystemGetInfo systemInfo = {XR_TYPE_SYSTEM_GET_INFO};
+    systemInfo.formFactor = XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY;
+    XrSystemId systemId = XR_NULL_SYSTEM_ID;
+    xrGetSystem(instance, &systemInfo, &systemId);
+    XrGraphicsBindingOpenGLESAndroidKHR binding = {XR_TYPE_GRAPHICS_BINDING_OPENGL_ES_ANDROID_KHR};
+    binding.display = egl.display;
+    binding.config = egl.config;
+    binding.context = egl.context;
+    XrSessionCreateInfo sessionInfo = {XR_TYPE_SESSION_CREATE_INFO};
+    sessionInfo.next = &binding;
+    sessionInfo.systemId = systemId;
+    XrSession session = XR_NULL_HANDLE;
+    CHECK(xrCreateSession(instance, &sessionInfo, &session) == XR_SUCCESS, "session");
+    XrSessionBeginInfo beginInfo = {XR_TYPE_SESSION_BEGIN_INFO};
+    beginInfo.primaryViewConfigurationType = XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO;
+    CHECK(xrBeginSession(session, &beginInfo) == XR_SUCCESS, "begin session");
+    if (g_failures) {
+        return checkResult();
+    }
+
+    auto* pipeline = new FramePipeline();
+    CHECK(framePipelineStart(pipeline, session, XR_ENVIRONMENT_BLEND_MODE_OPAQUE), "start");
+
+    // --- In order, one frame at a time ---
+    runFrames(pipeline, 30, 1);
+    CHECK(statsOf(session).framesDiscarded == 0, "a frame was begun over another");
+
+    // --- Acquire timeout and out-of-order ends ---
+    {
+        XrFrameState frameState = {XR_TYPE_FRAME_STATE};
+        uint64_t frameId = 0;
+        CHECK(framePipelineAcquire(pipeline, &frameState, &frameId, ACQUIRE_TIMEOUT_MS) && frameId == 31,
+              "frame %llu", (unsigned long long)frameId);
+
+        // The next frame can't be begun while this one is held.
+        XrFrameState next = {XR_TYPE_FRAME_STATE};
+        uint64_t nextId = 0;
+        const auto start = std::chrono::steady_clock::now();
+        CHECK(!framePipelineAcquire(pipeline, &next, &nextId, SHORT_TIMEOUT_MS), "second frame handed over");
+        const auto waited = std::chrono::steady_clock::now() - start;
+        CHECK(waited >= std::chrono::milliseconds(SHORT_TIMEOUT_MS), "acquire gave up after %lld us",
+              (long long)std::chrono::duration_cast<std::chrono::microseconds>(waited).count());
+
+        CHECK(endFrame(pipeline, frameId + 1, frameState) == XR_ERROR_CALL_ORDER_INVALID, "future frame ended");
+        CHECK(endFrame(pipeline, frameId - 1, frameState) == XR_ERROR_CALL_ORDER_INVALID, "past frame ended");
+        CHECK(endFrame(pipeline, frameId, frameState) == XR_SUCCESS, "frame not ended");
+        CHECK(endFrame(pipeline, frameId, frameState) == XR_ERROR_CALL_ORDER_INVALID, "frame ended twice");
+
+        // Begun but not acquired yet: nothing to end either.
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(ACQUIRE_TIMEOUT_MS);
+        while (statsOf(session).framesBegun == statsOf(session).framesEnded &&
+               std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        CHECK(endFrame(pipeline, frameId + 1, frameState) == XR_ERROR_CALL_ORDER_INVALID,
+              "frame ended before it was acquired");
+        runFrames(pipeline, 1, frameId + 1);
+    }
+
+    // --- Stop holding a frame, with the next one waited for ---
+    {
+        XrFrameState frameState = {XR_TYPE_FRAME_STATE};
+        uint64_t frameId = 0;
+        CHECK(framePipelineAcquire(pipeline, &frameState, &frameId, ACQUIRE_TIMEOUT_MS), "frame before stop");
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(ACQUIRE_TIMEOUT_MS);
+        while (statsOf(session).framesWaited == statsOf(session).framesBegun &&
+               std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        const MockRuntimeStats before = statsOf(session);
+        CHECK(before.framesWaited == before.framesBegun + 1, "next frame not waited for");
+        framePipelineStop(pipeline);
+        checkBalanced(session, "after stop");
+        CHECK(!pipeline->running && !pipeline->frameBegun && !pipeline->frameWaited, "frames left open");
+        CHECK(!framePipelineAcquire(pipeline, &frameState, &frameId, SHORT_TIMEOUT_MS), "frame after stop");
+    }
+
+    // --- Restart on the same session ---
+    CHECK(framePipelineStart(pipeline, session, XR_ENVIRONMENT_BLEND_MODE_OPAQUE), "restart");
+    runFrames(pipeline, 10, 1);
+    framePipelineStop(pipeline);
+    checkBalanced(session, "after restart");
+    framePipelineStop(pipeline);
+
+    delete pipeline;
+    mockRuntimeRequestExit(session);
+    CHECK(xrEndSession(session) == XR_SUCCESS, "end session");
+    xrDestroySession(session);
+    xrDestroyInstance(instance);
+    hostEglDestroy(&egl);
+    return checkResult();
+}
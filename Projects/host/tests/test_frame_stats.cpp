@@ -0,0 +1,178 @@
+//
+// Frame stats ring: percentiles, budget counts, fps and the window on known data; the copy when
+// the ring has wrapped; and a reader copying and summarizing while the producer pushes as fast
+// as it can, which must only ever see whole records in order.
+//
+
+#include <atomic>
+#include <cstdio>
+#include <thread>
+
+#include "check.h"
+#include "frame_stats.h"
+
+#define PERIOD_NS 10000000 // 10 ms
+#define KNOWN_FRAMES 100
+#define CONCURRENT_FRAMES 2000000
+
+// --- Known data ---
+
+// Frame i ends 10 ms after the previous one, 20 ms after it for every tenth frame, and takes
+// (i + 1) * 150 us of CPU.
+static void pushKnown(FrameStatsRing* ring, uint32_t frames) {
+    uint64_t endNs = 1000000000;
+    for (uint32_t i = 0; i < frames; ++i) {
+        endNs += i > 0 && i % 10 == 0 ? 2 * PERIOD_NS : PERIOD_NS;
+        frameStatsPush(ring, endNs - (i + 1) * 150000ull, endNs, PERIOD_NS);
+    }
+}
+
+static void testKnownData() {
+    auto* ring = new FrameStatsRing();
+    FrameStatsSummary summary;
+    frameStatsSummarize(ring, 0, 0, &summary);
+    CHECK(summary.count == 0 && summary.fps == 0.0f, "empty ring summarized to %u records", summary.count);
+
+    pushKnown(ring, KNOWN_FRAMES);
+
+    // Budget from the newest record's display period: 10 ms.
+    frameStatsSummarize(ring, 0, 0, &summary);
+    CHECK(summary.count == KNOWN_FRAMES && summary.budgetUs == 10000, "count %u, budget %u", summary.count,
+          summary.budgetUs);
+    CHECK(summary.cpuP50Us == 7500 && summary.cpuP90Us == 13500 && summary.cpuP99Us == 14850,
+          "cpu p50/p90/p99 %u/%u/%u", summary.cpuP50Us, summary.cpuP90Us, summary.cpuP99Us);
+    // 99 intervals (the first frame has none): 90 of 10 ms, 9 of 20 ms.
+    CHECK(summary.intervalP50Us == 10000 && summary.intervalP90Us == 10000 && summary.intervalP99Us == 20000,
+          "interval p50/p90/p99 %u/%u/%u", summary.intervalP50Us, summary.intervalP90Us, summary.intervalP99Us);
+    CHECK(summary.overBudget == 34 && summary.late == 9, "over budget %u, late %u", summary.overBudget,
+          summary.late);
+    // 99 intervals over 1.08 s.
+    CHECK(summary.fps > 91.66f && summary.fps < 91.67f, "fps %.3f", summary.fps);
+
+    // An explicit budget: 12 ms, late past 18 ms.
+    frameStatsSummarize(ring, 0, 12000, &summary);
+    CHECK(summary.budgetUs == 12000 && summary.overBudget == 20 && summary.late == 9, "over budget %u, late %u",
+          summary.overBudget, summary.late);
+
+    // The last ten frames only: CPU 13650..15000 us, one 20 ms interval.
+    frameStatsSummarize(ring, 10, 0, &summary);
+    CHECK(summary.count == 10 && summary.cpuP50Us == 14250 && summary.cpuP99Us == 15000 && summary.late == 1,
+          "window of 10: count %u, cpu p50 %u p99 %u, late %u", summary.count, summary.cpuP50Us, summary.cpuP99Us,
+          summary.late);
+
+    FrameStatsRecord records[FRAME_STATS_CAPACITY];
+    uint32_t count = frameStatsCopyRecent(ring, records, 3);
+    CHECK(count == 3 && records[0].cpuUs == 14700 && records[2].cpuUs == 15000, "copy of 3: %u records", count);
+
+    // A restart leaves the next frame without an interval.
+    frameStatsRestart(ring);
+    frameStatsPush(ring, 5000000000ull, 5000001000ull, PERIOD_NS);
+    count = frameStatsCopyRecent(ring, records, 1);
+    CHECK(count == 1 && records[0].intervalUs == 0 && records[0].cpuUs == 1, "interval across a restart");
+
+    // Wrapped: the oldest records are gone, and the slot the producer would write next is never
+    // trusted, so a full ring gives one record less than it holds.
+    delete ring;
+    ring = new FrameStatsRing();
+    pushKnown(ring, FRAME_STATS_CAPACITY + 88);
+    count = frameStatsCopyRecent(ring, records, FRAME_STATS_CAPACITY);
+    CHECK(count == FRAME_STATS_CAPACITY - 1, "%u records from a wrapped ring", count);
+    CHECK(records[count - 1].cpuUs == (FRAME_STATS_CAPACITY + 88) * 150u && records[0].cpuUs == 90 * 150u,
+          "wrapped copy is %u..%u us", records[0].cpuUs, records[count - 1].cpuUs);
+    frameStatsSummarize(ring, FRAME_STATS_CAPACITY * 4, 0, &summary);
+    CHECK(summary.count == FRAME_STATS_CAPACITY - 1, "window past the capacity: %u records", summary.count);
+    delete ring;
+}
+
+// --- Concurrent producer ---
+
+// Every field of record i derives from i, so a record mixed from two pushes shows.
+static uint64_t endOf(uint64_t i) {
+    return (i + 1) * 1000;
+}
+
+static bool whole(const FrameStatsRecord& record, uint64_t* index) {
+    if (record.endNs == 0 || record.endNs % 1000 != 0) {
+        return false;
+    }
+    const uint64_t i = record.endNs / 1000 - 1;
+    *index = i;
+    return record.cpuUs == i % 1000 + 1 && record.periodUs == i % 500 + 1 && record.intervalUs == (i ? 1u : 0u);
+}
+
+static void testConcurrent() {
+    auto* ring = new FrameStatsRing();
+    std::atomic<bool> done{false};
+    std::thread producer([ring, &done] {
+        for (uint64_t i = 0; i < CONCURRENT_FRAMES; ++i) {
+            const uint64_t endNs = endOf(i);
+            frameStatsPush(ring, endNs - (i % 1000 + 1) * 1000, endNs, static_cast<int64_t>(i % 500 + 1) * 1000);
+            if (i % 4096 == 0) {
+                std::this_thread::yield(); // lets the reader in on a single CPU
+            }
+        }
+        done.store(true);
+    });
+
+    static FrameStatsRecord records[FRAME_STATS_CAPACITY];
+    uint64_t copies = 0;
+    uint64_t summaries = 0;
+    uint64_t torn = 0;
+    uint64_t gaps = 0;
+    uint64_t oversized = 0;
+    uint64_t badSummaries = 0;
+    uint64_t lastNewest = 0;
+    uint64_t wentBack = 0;
+    for (uint32_t pass = 0; !done.load(); ++pass) {
+        const uint32_t window = pass % 3 == 0 ? FRAME_STATS_CAPACITY : 1 + pass % 97;
+        if (pass % 2) {
+            const uint32_t count = frameStatsCopyRecent(ring, records, window);
+            ++copies;
+            oversized += count > window;
+            uint64_t previous = 0;
+            for (uint32_t i = 0; i < count && i < window; ++i) {
+                uint64_t index = 0;
+                if (!whole(records[i], &index)) {
+                    ++torn;
+                } else if (i > 0 && index != previous + 1) {
+                    ++gaps;
+                }
+                previous = index;
+            }
+            if (count > 0) {
+                wentBack += previous < lastNewest;
+                lastNewest = previous;
+            }
+        } else {
+            FrameStatsSummary summary;
+            frameStatsSummarize(ring, window, 0, &summary);
+            ++summaries;
+            // Every cpu is 1..1000 us, every period 1..500 us, every interval 1 us.
+            badSummaries += summary.count > window || summary.budgetUs > 500 || summary.cpuP50Us > 1000 ||
+                            summary.cpuP99Us < summary.cpuP50Us ||
+                            (summary.count > 1 && summary.intervalP99Us != 1);
+        }
+    }
+    producer.join();
+
+    printf("%llu copies and %llu summaries during %d pushes\n", (unsigned long long)copies,
+           (unsigned long long)summaries, CONCURRENT_FRAMES);
+    CHECK(copies > 0 && summaries > 0, "reader never ran alongside the producer");
+    CHECK(torn == 0, "%llu torn records", (unsigned long long)torn);
+    CHECK(gaps == 0, "%llu copies with records missing or out of order", (unsigned long long)gaps);
+    CHECK(oversized == 0, "%llu copies larger than asked for", (unsigned long long)oversized);
+    CHECK(wentBack == 0, "newest record went back %llu times", (unsigned long long)wentBack);
+    CHECK(badSummaries == 0, "%llu summaries of torn data", (unsigned long long)badSummaries);
+
+    // Quiet again: the last records, whole.
+    const uint32_t count = frameStatsCopyRecent(ring, records, 10);
+    uint64_t index = 0;
+    CHECK(count == 10 && whole(records[9], &index) && index == CONCURRENT_FRAMES - 1, "final copy");
+    delete ring;
+}
+
+int main() {
+    testKnownData();
+    testConcurrent();
+    return checkResult();
+}
@@ -0,0 +1,110 @@
+//
+// GL capture and replay: the offscreen backend drawing the demo scene is captured (one frame
+// skipped, two recorded), the stream read back and checked, then replayed in a fresh context
+// and its colour texture compared with what the capturing context drew.
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "check.h"
+#include "demo_scene.h"
+#include "gl_capture.h"
+#include "gl_replay/gl_replay.h"
+#include "host_egl.h"
+#include "render_backend.h"
+
+#define VIEW_SIZE 64
+#define CAPTURE_PATH "test_gl_capture.glc"
+
+// The pixel at (x, y) of layer 0 of a 2D array texture.
+static uint32_t readPixel(GLuint texture, int x, int y) {
+    GLuint framebuffer;
+    glGenFramebuffers(1, &framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, texture, 0, 0);
+    uint32_t pixel = 0;
+    glReadPixels(x, y, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, &pixel);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glDeleteFramebuffers(1, &framebuffer);
+    return pixel;
+}
+
+int main() {
+    // The backend's own display, as on a build machine there is no other.
+    setenv("EGL_PLATFORM", "surfaceless", 0);
+    CHECK(glCaptureStart(CAPTURE_PATH, 1, 2), "capture did not start");
+    CHECK(!glCaptureStart(CAPTURE_PATH, 1, 2), "second capture started");
+
+    RenderBackendConfig config;
+    config.kind = RENDER_BACKEND_OFFSCREEN;
+    config.width = VIEW_SIZE;
+    config.height = VIEW_SIZE;
+    RenderBackend backend;
+    if (!renderBackendInit(&backend, config)) {
+        fprintf(stderr, "No offscreen backend\n");
+        return 1;
+    }
+    DemoScene scene;
+    CHECK(demoSceneInit(&scene), "scene init");
+    for (int frame = 0; frame < 4; ++frame) {
+        glCaptureFrameBegin();
+        const uint32_t viewCount = renderBackendBeginFrame(&backend);
+        for (uint32_t view = 0; view < viewCount; ++view) {
+            renderBackendBindView(&backend, view);
+            demoSceneDraw(&scene, backend.views[view].viewProj);
+        }
+        renderBackendEndFrame(&backend);
+        glCaptureFrameEnd();
+    }
+    CHECK(!glCaptureActive(), "capture still active after its frames");
+
+    const GLuint capturedTexture = backend.colorTexture;
+    const uint32_t expected = readPixel(capturedTexture, VIEW_SIZE / 2, VIEW_SIZE / 2);
+    const uint32_t clear = readPixel(capturedTexture, 0, 0);
+    CHECK(expected != clear, "centre pixel %08x is the clear colour", expected);
+    demoSceneDestroy(&scene);
+    renderBackendDestroy(&backend);
+
+    GlCaptureStream stream;
+    CHECK(glCaptureLoad(CAPTURE_PATH, &stream), "capture did not load");
+    CHECK(stream.header.frameCount == 2, "%u frames", stream.header.frameCount);
+    uint32_t frames = 0;
+    uint32_t draws = 0;
+    uint32_t shaderSources = 0;
+    for (const GlCaptureCall& call : stream.calls) {
+        frames += call.record.op == GL_CAPTURE_OP_FRAME_BEGIN;
+        draws += call.record.op == GL_CAPTURE_OP_DRAW_ELEMENTS;
+        shaderSources += call.record.op == GL_CAPTURE_OP_SHADER_SOURCE;
+    }
+    CHECK(frames == 2, "%u frame markers", frames);
+    // Two frames of two views of three quads; the setup before them is recorded too.
+    CHECK(draws == 12, "%u draws", draws);
+    CHECK(shaderSources == 4, "%u shader sources", shaderSources);
+    CHECK(strcmp(glCaptureOpName(GL_CAPTURE_OP_DRAW_ELEMENTS), "glDrawElements") == 0, "%s",
+          glCaptureOpName(GL_CAPTURE_OP_DRAW_ELEMENTS));
+
+    HostEgl egl;
+    if (!hostEglInit(&egl)) {
+        fprintf(stderr, "No EGL context\n");
+        return 1;
+    }
+    GlReplay replay;
+    CHECK(glReplayRun(&replay, stream, 3), "replay failed");
+    CHECK(replay.frames.size() == 6, "%zu frames replayed", replay.frames.size());
+    CHECK(replay.ops[GL_CAPTURE_OP_DRAW_ELEMENTS].calls == 36, "%llu draws replayed",
+          static_cast<unsigned long long>(replay.ops[GL_CAPTURE_OP_DRAW_ELEMENTS].calls));
+    CHECK(replay.unknownCalls == 0, "%u unknown calls", replay.unknownCalls);
+    const GLuint texture = glReplayTexture(&replay, capturedTexture);
+    CHECK(texture != 0, "colour texture not replayed");
+    if (texture) {
+        const uint32_t actual = readPixel(texture, VIEW_SIZE / 2, VIEW_SIZE / 2);
+        CHECK(actual == expected, "replayed %08x, captured %08x", actual, expected);
+    }
+    CHECK(glGetError() == GL_NO_ERROR, "GL error after replay");
+    hostEglDestroy(&egl);
+    remove(CAPTURE_PATH);
+
+    return checkResult();
+}
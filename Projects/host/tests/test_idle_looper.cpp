@@ -0,0 +1,156 @@
+//
+// Idle main loop vs. the old busy-poll loop: CPU time and wakeups per second while there is
+// nothing to render, plus wake latency for the wake fd and for app commands.
+//
+
+#include <time.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+#include "check.h"
+#include "idle_looper.h"
+
+#define MEASURE_MS 1000
+
+static double threadCpuMs() {
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static double nowMs() {
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Stand-in for the glue's command pipe: one byte per command.
+struct FakeApp {
+    android_app app = {};
+    android_poll_source cmdSource = {};
+    int cmdPipe[2] = {-1, -1};
+    int commands = 0;
+};
+
+static void processCommand(android_app* app, android_poll_source*) {
+    auto* fake = static_cast<FakeApp*>(app->userData);
+    char cmd;
+    if (read(fake->cmdPipe[0], &cmd, 1) == 1) {
+        ++fake->commands;
+    }
+}
+
+static void fakeAppInit(FakeApp* fake, ALooper* looper) {
+    fake->app.userData = fake;
+    fake->app.looper = looper;
+    fake->cmdSource.id = LOOPER_ID_MAIN;
+    fake->cmdSource.app = &fake->app;
+    fake->cmdSource.process = processCommand;
+    if (pipe(fake->cmdPipe) == 0) {
+        ALooper_addFd(looper, fake->cmdPipe[0], LOOPER_ID_MAIN, ALOOPER_EVENT_INPUT, nullptr, &fake->cmdSource);
+    }
+}
+
+struct LoopCost {
+    double cpuPercent = 0.0;
+    double wakeupsPerSecond = 0.0;
+};
+
+// The loop as it was: ALooper_pollOnce(0) back to back.
+static LoopCost measureBusyLoop(FakeApp* fake) {
+    uint64_t iterations = 0;
+    const double cpuStart = threadCpuMs();
+    const double start = nowMs();
+    while (nowMs() - start < MEASURE_MS) {
+        android_poll_source* source;
+        while (ALooper_pollOnce(0, nullptr, nullptr, (void**)&source) >= 0) {
+            if (source) source->process(&fake->app, source);
+        }
+        ++iterations;
+    }
+    const double elapsed = nowMs() - start;
+    return {100.0 * (threadCpuMs() - cpuStart) / elapsed, iterations * 1000.0 / elapsed};
+}
+
+static LoopCost measureIdleLoop(FakeApp* fake, IdleLooper* idle, XrSessionState state) {
+    idle->wakeups = 0;
+    const double cpuStart = threadCpuMs();
+    const double start = nowMs();
+    while (nowMs() - start < MEASURE_MS) {
+        idleLooperPump(idle, &fake->app, idleLooperTimeoutMs(state, false));
+    }
+    const double elapsed = nowMs() - start;
+    return {100.0 * (threadCpuMs() - cpuStart) / elapsed, idle->wakeups * 1000.0 / elapsed};
+}
+
+int main() {
+    ALooper* looper = ALooper_prepare(ALOOPER_PREPARE_ALLOW_NON_CALLBACKS);
+    FakeApp fake;
+    fakeAppInit(&fake, looper);
+    IdleLooper idle;
+    CHECK(idleLooperInit(&idle, looper), "wake fd registration failed");
+
+    // --- Timeout policy ---
+    CHECK(idleLooperTimeoutMs(XR_SESSION_STATE_FOCUSED, true) == 0, "rendering must not block");
+    CHECK(idleLooperTimeoutMs(XR_SESSION_STATE_IDLE, false) == IDLE_LOOPER_SESSION_IDLE_MS, "idle timeout");
+    CHECK(idleLooperTimeoutMs(XR_SESSION_STATE_FOCUSED, false) == IDLE_LOOPER_PAUSED_MS, "paused timeout");
+    CHECK(idleLooperTimeoutMs(XR_SESSION_STATE_EXITING, false) == IDLE_LOOPER_ENDING_MS, "ending timeout");
+
+    // --- CPU and wakeups with nothing to render ---
+    const LoopCost busy = measureBusyLoop(&fake);
+    const LoopCost sessionIdle = measureIdleLoop(&fake, &idle, XR_SESSION_STATE_IDLE);
+    const LoopCost paused = measureIdleLoop(&fake, &idle, XR_SESSION_STATE_FOCUSED);
+    printf("%-22s %8s %12s\n", "loop", "cpu %", "wakeups/s");
+    printf("%-22s %8.2f %12.0f\n", "busy poll", busy.cpuPercent, busy.wakeupsPerSecond);
+    printf("%-22s %8.2f %12.1f\n", "idle (session idle)", sessionIdle.cpuPercent, sessionIdle.wakeupsPerSecond);
+    printf("%-22s %8.2f %12.1f\n", "idle (paused)", paused.cpuPercent, paused.wakeupsPerSecond);
+
+    CHECK(sessionIdle.cpuPercent < 5.0, "idle loop used %.2f%% CPU", sessionIdle.cpuPercent);
+    CHECK(paused.cpuPercent < 5.0, "paused loop used %.2f%% CPU", paused.cpuPercent);
+    CHECK(sessionIdle.wakeupsPerSecond <= 1000.0 / IDLE_LOOPER_SESSION_IDLE_MS + 2,
+          "idle loop woke %.1f times/s", sessionIdle.wakeupsPerSecond);
+    CHECK(paused.wakeupsPerSecond <= 1000.0 / IDLE_LOOPER_PAUSED_MS + 2,
+          "paused loop woke %.1f times/s", paused.wakeupsPerSecond);
+
+    // --- Wake fd interrupts a long block ---
+    {
+        std::thread waker([&idle] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            idleLooperWake(&idle);
+        });
+        const uint64_t signals = idle.wakeSignals;
+        const double start = nowMs();
+        idleLooperPump(&idle, &fake.app, 5000);
+        const double latency = nowMs() - start;
+        waker.join();
+        printf("wake fd latency: %.1f ms\n", latency);
+        CHECK(idle.wakeSignals == signals + 1, "wake signal not consumed");
+        CHECK(latency < 1000.0, "wake took %.1f ms", latency);
+    }
+
+    // --- App commands still wake the loop ---
+    {
+        std::thread sender([&fake] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            ssize_t written = write(fake.cmdPipe[1], "r", 1);
+            (void)written;
+        });
+        const int commands = fake.commands;
+        const double start = nowMs();
+        idleLooperPump(&idle, &fake.app, 5000);
+        const double latency = nowMs() - start;
+        sender.join();
+        printf("app command latency: %.1f ms\n", latency);
+        CHECK(fake.commands == commands + 1, "command not processed");
+        CHECK(latency < 1000.0, "command took %.1f ms", latency);
+    }
+
+    idleLooperDestroy(&idle);
+    ALooper_removeFd(looper, fake.cmdPipe[0]);
+    close(fake.cmdPipe[0]);
+    close(fake.cmdPipe[1]);
+    ALooper_release(looper);
+
+    return checkResult();
+}
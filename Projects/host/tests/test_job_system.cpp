@@ -0,0 +1,240 @@
+//
+// Job system: dependent stages only start once the stage before has finished, idle workers
+// steal queued jobs, more jobs than the ring holds in flight run inline instead of overwriting
+// one that hasn't run, and shutdown runs everything still queued or held.
+//
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+#include "check.h"
+#include "job_system.h"
+
+#define WORKERS 4
+#define ITEMS 4096
+#define GRAIN 64
+
+static uint64_t executedJobs(JobSystem* system) {
+    uint64_t executed = 0;
+    for (auto& queue : system->queues) {
+        executed += queue.executed.load();
+    }
+    return executed;
+}
+
+static void increment(void* data, uint32_t, uint32_t) {
+    (*static_cast<std::atomic<uint32_t>*>(data))++;
+}
+
+// --- Dependencies ---
+
+struct Stages {
+    uint32_t input[ITEMS];
+    uint32_t doubled[ITEMS];
+    uint32_t summed[ITEMS / GRAIN];
+    std::atomic<uint32_t> early{0};
+    std::atomic<uint64_t> total{0};
+};
+
+static void fill(void* data, uint32_t begin, uint32_t end) {
+    auto* stages = static_cast<Stages*>(data);
+    for (uint32_t i = begin; i < end; ++i) {
+        stages->input[i] = i;
+    }
+}
+
+static void doubleItems(void* data, uint32_t begin, uint32_t end) {
+    auto* stages = static_cast<Stages*>(data);
+    for (uint32_t i = begin; i < end; ++i) {
+        if (stages->input[i] != i) {
+            stages->early++;
+        }
+        stages->doubled[i] = stages->input[i] * 2;
+    }
+}
+
+static void sumChunk(void* data, uint32_t begin, uint32_t end) {
+    auto* stages = static_cast<Stages*>(data);
+    uint32_t sum = 0;
+    for (uint32_t i = begin; i < end; ++i) {
+        if (stages->doubled[i] != i * 2) {
+            stages->early++;
+        }
+        sum += stages->doubled[i];
+    }
+    stages->summed[begin / GRAIN] = sum;
+}
+
+static void total(void* data, uint32_t, uint32_t) {
+    auto* stages = static_cast<Stages*>(data);
+    uint64_t sum = 0;
+    for (uint32_t chunk : stages->summed) {
+        sum += chunk;
+    }
+    stages->total = sum;
+}
+
+static void testDependencies(JobSystem* system) {
+    for (uint32_t round = 0; round < 20; ++round) {
+        auto* stages = new Stages();
+        JobCounter filled, doubled, summed, done;
+        // The workers start on each stage while the next is still being submitted; only the
+        // counters keep the stages apart.
+        jobSystemParallelFor(system, fill, stages, ITEMS, GRAIN * 2, &filled);
+        jobSystemParallelFor(system, doubleItems, stages, ITEMS, GRAIN / 2, &doubled, &filled);
+        jobSystemParallelFor(system, sumChunk, stages, ITEMS, GRAIN, &summed, &doubled);
+        jobSystemSubmit(system, total, stages, &done, &summed);
+        jobSystemWait(system, &done);
+        const uint64_t expected = static_cast<uint64_t>(ITEMS) * (ITEMS - 1);
+        CHECK(stages->early == 0, "round %u: %u chunks ran before their inputs", round, stages->early.load());
+        CHECK(stages->total == expected, "round %u: total %llu, expected %llu", round,
+              (unsigned long long)stages->total.load(), (unsigned long long)expected);
+        delete stages;
+    }
+
+    // A counter already at zero holds nothing back.
+    std::atomic<uint32_t> ran{0};
+    JobCounter idle, done;
+    jobSystemSubmit(system, increment, &ran, &done, &idle);
+    jobSystemWait(system, &done);
+    CHECK(ran == 1, "job after an idle counter didn't run");
+}
+
+// --- Stealing ---
+
+struct Steal {
+    std::atomic<uint32_t> ranOnOwner{0};
+    std::atomic<uint32_t> ranElsewhere{0};
+    std::thread::id owner;
+};
+
+static void slowJob(void* data, uint32_t, uint32_t) {
+    auto* steal = static_cast<Steal*>(data);
+    // Blocks rather than spins, so the workers get the CPU even on a single core.
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    if (std::this_thread::get_id() == steal->owner) {
+        steal->ranOnOwner++;
+    } else {
+        steal->ranElsewhere++;
+    }
+}
+
+static void testStealing(JobSystem* system) {
+    Steal steal;
+    steal.owner = std::this_thread::get_id();
+    uint64_t stolenBefore = 0;
+    for (uint32_t w = 0; w < system->workerCount; ++w) {
+        stolenBefore += system->queues[w].stolen.load();
+    }
+    // Everything goes onto worker 0's queue; the others only get work by stealing it.
+    JobCounter done;
+    jobSystemParallelFor(system, slowJob, &steal, 64, 1, &done);
+    jobSystemWait(system, &done);
+    uint64_t stolen = 0;
+    for (uint32_t w = 0; w < system->workerCount; ++w) {
+        stolen += system->queues[w].stolen.load();
+    }
+    stolen -= stolenBefore;
+    printf("stealing: %u jobs on the submitting thread, %u on other workers, %llu steals\n",
+           steal.ranOnOwner.load(), steal.ranElsewhere.load(), (unsigned long long)stolen);
+    const uint32_t ran = steal.ranOnOwner + steal.ranElsewhere;
+    CHECK(ran == 64, "%u of 64 jobs ran", ran);
+    CHECK(steal.ranElsewhere > 0 && stolen >= steal.ranElsewhere, "%u jobs on other workers, %llu steals",
+          steal.ranElsewhere.load(), (unsigned long long)stolen);
+}
+
+// --- More jobs in flight than the ring holds ---
+
+#define OVERFLOW_JOBS (JOB_SYSTEM_MAX_JOBS + 500)
+
+struct Overflow {
+    std::atomic<bool> gateOpen{false};
+    std::atomic<uint32_t> beforeGate{0};
+    std::atomic<uint8_t> runs[OVERFLOW_JOBS];
+};
+
+static void gateJob(void* data, uint32_t, uint32_t) {
+    static_cast<Overflow*>(data)->gateOpen = true;
+}
+
+static void heldJob(void* data, uint32_t begin, uint32_t) {
+    auto* overflow = static_cast<Overflow*>(data);
+    if (!overflow->gateOpen) {
+        overflow->beforeGate++;
+    }
+    overflow->runs[begin]++;
+}
+
+static void testRingFull() {
+    // One worker, so nothing runs until the submitting thread waits.
+    auto* system = new JobSystem();
+    jobSystemInit(system, 1, false);
+    auto* overflow = new Overflow();
+    for (auto& runs : overflow->runs) {
+        runs = 0;
+    }
+    JobCounter gate, done;
+    jobSystemSubmit(system, gateJob, overflow, &gate);
+    // Every job is held on the gate; past the ring's size they can't all be in flight.
+    jobSystemParallelFor(system, heldJob, overflow, OVERFLOW_JOBS, 1, &done, &gate);
+    jobSystemWait(system, &done);
+
+    uint32_t missing = 0, repeated = 0;
+    for (auto& runs : overflow->runs) {
+        missing += runs == 0;
+        repeated += runs > 1;
+    }
+    CHECK(missing == 0 && repeated == 0, "%u jobs never ran, %u ran more than once", missing, repeated);
+    CHECK(overflow->beforeGate == 0, "%u jobs ran before the job they were held on", overflow->beforeGate.load());
+    CHECK(system->ringFullJobs > 0, "ring never filled");
+    CHECK(executedJobs(system) == OVERFLOW_JOBS + 1, "%llu jobs executed",
+          (unsigned long long)executedJobs(system));
+
+    // Once they have run the ring is usable again.
+    std::atomic<uint32_t> ran{0};
+    const uint64_t ringFull = system->ringFullJobs;
+    JobCounter again;
+    jobSystemParallelFor(system, increment, &ran, 100, 1, &again);
+    jobSystemWait(system, &again);
+    CHECK(ran == 100 && system->ringFullJobs == ringFull, "ring still full after the jobs ran");
+
+    jobSystemShutdown(system);
+    delete overflow;
+    delete system;
+}
+
+// --- Shutdown drains ---
+
+static void countJob(void* data, uint32_t begin, uint32_t end) {
+    *static_cast<std::atomic<uint32_t>*>(data) += end > begin ? end - begin : 1;
+}
+
+static void testShutdownDrain() {
+    auto* system = new JobSystem();
+    jobSystemInit(system, WORKERS, false);
+    std::atomic<uint32_t> count{0};
+    JobCounter first, second;
+    // Three dependent stages, queued or held when shutdown starts; nobody waits on them.
+    jobSystemParallelFor(system, countJob, &count, 1000, 10, &first);
+    jobSystemParallelFor(system, countJob, &count, 1000, 10, &second, &first);
+    jobSystemParallelFor(system, countJob, &count, 1000, 10, nullptr, &second);
+    jobSystemShutdown(system);
+    CHECK(count == 3000, "%u of 3000 items ran before shutdown returned", count.load());
+    CHECK(system->workerCount == 0, "workers left");
+    delete system;
+}
+
+int main() {
+    auto* system = new JobSystem();
+    CHECK(jobSystemInit(system, WORKERS, false) && system->workerCount == WORKERS, "init");
+    testDependencies(system);
+    testStealing(system);
+    jobSystemShutdown(system);
+    delete system;
+
+    testRingFull();
+    testShutdownDrain();
+    return checkResult();
+}
@@ -0,0 +1,354 @@
+//
+// Mock runtime end to end: loader negotiation, then the apps' own session handling (event
+// dispatcher and session lifecycle) driving a main session and an overlay session through
+// their frame loops on a surfaceless context, display pacing, the exit sequence, and the
+// overlay's quad read back and composed by the reference compositor, alone and over a main
+// session's.
+//
+
+#include <cstdio>
+#include <cstring>
+
+#include <jni.h>
+#include <EGL/egl.h>
+#include <GLES3/gl3.h>
+
+#define XR_USE_PLATFORM_ANDROID
+#define XR_USE_GRAPHICS_API_OPENGL_ES
+#include <openxr/openxr_platform.h>
+
+#include "check.h"
+#include "host_egl.h"
+#include "mock_runtime/mock_runtime.h"
+#include "session_lifecycle.h"
+#include "xr_events.h"
+
+#define PERIOD_NS 5000000 // 200 Hz keeps the test short
+
+// Loader side of the negotiation; see mock_runtime.cpp.
+struct NegotiateLoaderInfo {
+    int structType;
+    uint32_t structVersion;
+    size_t structSize;
+    uint32_t minInterfaceVersion;
+    uint32_t maxInterfaceVersion;
+    XrVersion minApiVersion;
+    XrVersion maxApiVersion;
+};
+
+struct NegotiateRuntimeRequest {
+    int structType;
+    uint32_t structVersion;
+    size_t structSize;
+    uint32_t runtimeInterfaceVersion;
+    XrVersion runtimeApiVersion;
+    PFN_xrGetInstanceProcAddr getInstanceProcAddr;
+};
+
+extern "C" XrResult xrNegotiateLoaderRuntimeInterface(const NegotiateLoaderInfo*, NegotiateRuntimeRequest*);
+
+struct App {
+    XrInstance instance = XR_NULL_HANDLE;
+    XrSession session = XR_NULL_HANDLE;
+    XrSpace space = XR_NULL_HANDLE;
+    XrSwapchain swapchain = XR_NULL_HANDLE;
+    XrSwapchainImageOpenGLESKHR images[4];
+    GLuint framebuffer = 0;
+    float clear[4] = {0.0f, 1.0f, 0.0f, 1.0f}; // opaque green, like the overlays' clear
+    float quadSize = 1.0f;
+    XrEventDispatcher events;
+    SessionLifecycle lifecycle;
+    bool exiting = false;
+};
+
+static void onSessionStateChanged(App* app, const XrEventDataSessionStateChanged& event) {
+    sessionLifecycleHandleState(&app->lifecycle, event);
+}
+
+static void onExiting(void* user) {
+    static_cast<App*>(user)->exiting = true;
+}
+
+static bool createApp(App* app, const HostEgl& egl, bool overlay) {
+    const char* extensions[] = {XR_KHR_OPENGL_ES_ENABLE_EXTENSION_NAME, XR_EXTX_OVERLAY_EXTENSION_NAME};
+    XrInstanceCreateInfo instanceInfo = {XR_TYPE_INSTANCE_CREATE_INFO};
+    strcpy(instanceInfo.applicationInfo.applicationName, "test_mock_runtime");
+    instanceInfo.applicationInfo.apiVersion = XR_MAKE_VERSION(1, 0, 0);
+    instanceInfo.enabledExtensionCount = overlay ? 2 : 1;
+    instanceInfo.enabledExtensionNames = extensions;
+    if (XR_FAILED(xrCreateInstance(&instanceInfo, &app->instance))) {
+        return false;
+    }
+
+    XrSystemGetInfo systemInfo = {XR_TYPE_SYSTEM_GET_INFO};
+    systemInfo.formFactor = XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY;
+    XrSystemId systemId = XR_NULL_SYSTEM_ID;
+    xrGetSystem(app->instance, &systemInfo, &systemId);
+
+    XrGraphicsBindingOpenGLESAndroidKHR binding = {XR_TYPE_GRAPHICS_BINDING_OPENGL_ES_ANDROID_KHR};
+    binding.display = egl.display;
+    binding.config = egl.config;
+    binding.context = egl.context;
+    XrSessionCreateInfoOverlayEXTX overlayInfo = {XR_TYPE_SESSION_CREATE_INFO_OVERLAY_EXTX};
+    overlayInfo.next = &binding;
+    XrSessionCreateInfo sessionInfo = {XR_TYPE_SESSION_CREATE_INFO};
+    sessionInfo.next = overlay ? static_cast<const void*>(&overlayInfo) : &binding;
+    sessionInfo.systemId = systemId;
+    if (XR_FAILED(xrCreateSession(app->instance, &sessionInfo, &app->session))) {
+        return false;
+    }
+
+    XrReferenceSpaceCreateInfo spaceInfo = {XR_TYPE_REFERENCE_SPACE_CREATE_INFO};
+    spaceInfo.referenceSpaceType = XR_REFERENCE_SPACE_TYPE_LOCAL;
+    spaceInfo.poseInReferenceSpace.orientation.w = 1.0f;
+    xrCreateReferenceSpace(app->session, &spaceInfo, &app->space);
+
+    XrSwapchainCreateInfo swapchainInfo = {XR_TYPE_SWAPCHAIN_CREATE_INFO};
+    swapchainInfo.usageFlags = XR_SWAPCHAIN_USAGE_COLOR_ATTACHMENT_BIT;
+    swapchainInfo.format = GL_SRGB8_ALPHA8;
+    swapchainInfo.sampleCount = 1;
+    swapchainInfo.width = 256;
+    swapchainInfo.height = 256;
+    swapchainInfo.faceCount = 1;
+    swapchainInfo.arraySize = 1;
+    swapchainInfo.mipCount = 1;
+    if (XR_FAILED(xrCreateSwapchain(app->session, &swapchainInfo, &app->swapchain))) {
+        return false;
+    }
+    uint32_t imageCount = 0;
+    for (auto& image : app->images) {
+        image = {XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_ES_KHR};
+    }
+    xrEnumerateSwapchainImages(app->swapchain, 4, &imageCount,
+                               reinterpret_cast<XrSwapchainImageBaseHeader*>(app->images));
+    glGenFramebuffers(1, &app->framebuffer);
+
+    xrEventsInit(&app->events, app);
+    xrEventsOn<onSessionStateChanged>(&app->events);
+    SessionCallbacks callbacks;
+    callbacks.user = app;
+    callbacks.exiting = onExiting;
+    // The spec flow for both: the runtime waits at STOPPING for xrEndSession.
+    sessionLifecycleInit(&app->lifecycle, app->session, XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO,
+                         SESSION_END_ON_STOPPING, callbacks, "MockTest");
+    return true;
+}
+
+static void destroyApp(App* app) {
+    glDeleteFramebuffers(1, &app->framebuffer);
+    xrDestroySwapchain(app->swapchain);
+    xrDestroySpace(app->space);
+    xrDestroySession(app->session);
+    xrDestroyInstance(app->instance);
+}
+
+// One iteration of the apps' loop; returns the frame's predicted display time (0 if not run).
+static XrTime runFrame(App* app) {
+    xrEventsPoll(&app->events, app->instance);
+    if (!app->lifecycle.running) {
+        return 0;
+    }
+    XrFrameState frameState = {XR_TYPE_FRAME_STATE};
+    CHECK(xrWaitFrame(app->session, nullptr, &frameState) == XR_SUCCESS, "xrWaitFrame");
+    CHECK(xrBeginFrame(app->session, nullptr) == XR_SUCCESS, "xrBeginFrame");
+
+    XrCompositionLayerQuad quad = {XR_TYPE_COMPOSITION_LAYER_QUAD};
+    const XrCompositionLayerBaseHeader* layers[] = {reinterpret_cast<XrCompositionLayerBaseHeader*>(&quad)};
+    uint32_t layerCount = 0;
+    if (frameState.shouldRender) {
+        XrViewLocateInfo locateInfo = {XR_TYPE_VIEW_LOCATE_INFO};
+        locateInfo.viewConfigurationType = XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO;
+        locateInfo.displayTime = frameState.predictedDisplayTime;
+        locateInfo.space = app->space;
+        XrViewState viewState = {XR_TYPE_VIEW_STATE};
+        XrView views[2] = {{XR_TYPE_VIEW}, {XR_TYPE_VIEW}};
+        uint32_t viewCount = 0;
+        CHECK(xrLocateViews(app->session, &locateInfo, &viewState, 2, &viewCount, views) == XR_SUCCESS &&
+              viewCount == 2 && views[0].pose.position.x < views[1].pose.position.x, "xrLocateViews");
+
+        uint32_t index = 0;
+        CHECK(xrAcquireSwapchainImage(app->swapchain, nullptr, &index) == XR_SUCCESS, "acquire");
+        XrSwapchainImageWaitInfo waitInfo = {XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO};
+        waitInfo.timeout = XR_INFINITE_DURATION;
+        CHECK(xrWaitSwapchainImage(app->swapchain, &waitInfo) == XR_SUCCESS, "wait image");
+        glBindFramebuffer(GL_FRAMEBUFFER, app->framebuffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, app->images[index].image, 0);
+        glClearColor(app->clear[0], app->clear[1], app->clear[2], app->clear[3]);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        CHECK(xrReleaseSwapchainImage(app->swapchain, nullptr) == XR_SUCCESS, "release");
+
+        quad.space = app->space;
+        quad.subImage.swapchain = app->swapchain;
+        quad.subImage.imageRect.extent = {256, 256};
+        quad.pose.orientation.w = 1.0f;
+        quad.pose.position.z = -1.5f;
+        quad.size = {app->quadSize, app->quadSize};
+        layerCount = 1;
+    }
+    XrFrameEndInfo endInfo = {XR_TYPE_FRAME_END_INFO};
+    endInfo.displayTime = frameState.predictedDisplayTime;
+    endInfo.environmentBlendMode = XR_ENVIRONMENT_BLEND_MODE_OPAQUE;
+    endInfo.layerCount = layerCount;
+    endInfo.layers = layers;
+    CHECK(xrEndFrame(app->session, &endInfo) == XR_SUCCESS, "xrEndFrame");
+    sessionLifecycleFrameEnded(&app->lifecycle, layerCount);
+    return frameState.predictedDisplayTime;
+}
+
+int main() {
+    // --- Loader negotiation ---
+    {
+        NegotiateLoaderInfo loaderInfo = {1, 1, sizeof(NegotiateLoaderInfo), 1, 1, XR_MAKE_VERSION(1, 0, 0),
+                                          XR_CURRENT_API_VERSION};
+        NegotiateRuntimeRequest request = {3, 1, sizeof(NegotiateRuntimeRequest)};
+        CHECK(xrNegotiateLoaderRuntimeInterface(&loaderInfo, &request) == XR_SUCCESS, "negotiation");
+        CHECK(request.runtimeInterfaceVersion == 1 && request.getInstanceProcAddr != nullptr, "runtime request");
+
+        PFN_xrVoidFunction function = nullptr;
+        CHECK(request.getInstanceProcAddr(XR_NULL_HANDLE, "xrInitializeLoaderKHR", &function) == XR_SUCCESS &&
+              function != nullptr, "xrInitializeLoaderKHR");
+        CHECK(request.getInstanceProcAddr(XR_NULL_HANDLE, "xrWaitFrame", &function) == XR_ERROR_HANDLE_INVALID,
+              "instance function without an instance");
+
+        loaderInfo.minInterfaceVersion = 2;
+        loaderInfo.maxInterfaceVersion = 2;
+        CHECK(xrNegotiateLoaderRuntimeInterface(&loaderInfo, &request) == XR_ERROR_INITIALIZATION_FAILED,
+              "unsupported interface accepted");
+    }
+
+    HostEgl egl;
+    if (!hostEglInit(&egl)) {
+        fprintf(stderr, "no EGL context\n");
+        return 1;
+    }
+    DisplayClockConfig clockConfig;
+    clockConfig.refreshHz = 1e9 / PERIOD_NS;
+    mockRuntimeSetDisplayClock(&clockConfig);
+
+    // --- Unknown extension ---
+    {
+        const char* extensions[] = {"XR_FB_not_a_mock_extension"};
+        XrInstanceCreateInfo instanceInfo = {XR_TYPE_INSTANCE_CREATE_INFO};
+        instanceInfo.enabledExtensionCount = 1;
+        instanceInfo.enabledExtensionNames = extensions;
+        XrInstance instance = XR_NULL_HANDLE;
+        CHECK(xrCreateInstance(&instanceInfo, &instance) == XR_ERROR_EXTENSION_NOT_PRESENT, "extension accepted");
+    }
+
+    // --- Main session: up to FOCUSED, paced, then exit ---
+    {
+        App app;
+        CHECK(createApp(&app, egl, false), "main app");
+        XrTime previous = 0;
+        int paced = 0;
+        for (int frame = 0; frame < 20; ++frame) {
+            const XrTime displayTime = runFrame(&app);
+            if (previous != 0 && displayTime - previous >= PERIOD_NS) {
+                ++paced;
+            }
+            previous = displayTime;
+        }
+        CHECK(paced == 19, "%d of 19 frame intervals paced", paced);
+        CHECK(app.lifecycle.state == XR_SESSION_STATE_FOCUSED, "state %d", app.lifecycle.state);
+        CHECK(sessionLifecycleLatencyNs(&app.lifecycle, SESSION_MILESTONE_READY, SESSION_MILESTONE_FOCUSED) > 0,
+              "milestones");
+
+        MockRuntimeStats stats;
+        mockRuntimeGetStats(app.session, &stats);
+        CHECK(stats.framesWaited == 20 && stats.framesEnded == 20 && stats.framesDiscarded == 0, "frames %llu/%llu",
+              (unsigned long long) stats.framesWaited, (unsigned long long) stats.framesEnded);
+        CHECK(stats.waitBlockedNs > 0, "xrWaitFrame never blocked");
+
+        // Frame-loop misuse.
+        CHECK(xrBeginFrame(app.session, nullptr) == XR_ERROR_CALL_ORDER_INVALID, "begin without wait");
+
+        CHECK(mockRuntimeRequestExit(app.session) == XR_SUCCESS, "request exit");
+        for (int frame = 0; frame < 4 && !app.exiting; ++frame) {
+            runFrame(&app);
+        }
+        CHECK(app.exiting && !app.lifecycle.running && !app.lifecycle.begun, "exit sequence");
+        destroyApp(&app);
+    }
+
+    // --- Overlay session: visible, never focused ---
+    {
+        App app;
+        CHECK(createApp(&app, egl, true), "overlay app");
+        for (int frame = 0; frame < 6; ++frame) {
+            runFrame(&app);
+        }
+        xrEventsPoll(&app.events, app.instance);
+        CHECK(app.lifecycle.state == XR_SESSION_STATE_VISIBLE, "overlay state %d", app.lifecycle.state);
+        CHECK(app.lifecycle.milestoneNs[SESSION_MILESTONE_FOCUSED].load() == 0, "overlay focused");
+
+        // What the overlay's quad looks like on the display.
+        mockRuntimeSetCompositing(app.session, true);
+        runFrame(&app);
+        for (uint32_t eye = 0; eye < 2; ++eye) {
+            const CompositorImage* image = mockRuntimeComposedEye(eye);
+            CHECK(image != nullptr && image->width > 0, "eye %u not composed", eye);
+            if (image != nullptr && image->width > 0) {
+                const uint32_t centre = image->pixels[(image->height / 2) * image->width + image->width / 2];
+                CHECK(centre == 0xff00ff00u, "eye %u centre %08x", eye, centre);
+                CHECK(image->pixels[0] == 0xff000000u, "eye %u corner %08x", eye, image->pixels[0]);
+            }
+        }
+        char report[512];
+        CHECK(mockRuntimeCompositorReport(report, sizeof(report)) > 0 && strstr(report, "quad"),
+              "report: %s", report);
+        mockRuntimeSetCompositing(app.session, false);
+
+        CHECK(xrRequestExitSession(app.session) == XR_SUCCESS, "request exit");
+        for (int frame = 0; frame < 4 && !app.exiting; ++frame) {
+            runFrame(&app);
+        }
+        CHECK(app.exiting, "overlay did not exit");
+        destroyApp(&app);
+    }
+
+    // --- One display: the overlay's layers over the main session's ---
+    {
+        App main, overlay;
+        CHECK(createApp(&overlay, egl, true), "overlay app"); // created first, still on top
+        CHECK(createApp(&main, egl, false), "main app");
+        main.clear[0] = 1.0f;
+        main.clear[1] = 0.0f;
+        overlay.quadSize = 0.5f;
+        mockRuntimeSetCompositing(main.session, true);
+        mockRuntimeSetCompositing(overlay.session, true);
+        MockDisplayStats stats;
+        mockRuntimeGetDisplayStats(&stats, true);
+        for (int frame = 0; frame < 4; ++frame) {
+            runFrame(&main);
+            runFrame(&overlay);
+        }
+        // At most once per display time, with what both sessions last ended.
+        runFrame(&main);
+        mockRuntimeGetDisplayStats(&stats, false);
+        CHECK(stats.framesComposed >= 1 && stats.framesComposed <= 9 && stats.sessionsComposed == 2,
+              "composed %llu frames from %u sessions", (unsigned long long) stats.framesComposed,
+              stats.sessionsComposed);
+        const CompositorImage* image = mockRuntimeComposedEye(0);
+        CHECK(image != nullptr, "nothing composed");
+        if (image != nullptr) {
+            const uint32_t y = image->height / 2;
+            const uint32_t centre = image->pixels[y * image->width + image->width / 2];
+            const uint32_t side = image->pixels[y * image->width + image->width / 2 - image->width / 8];
+            CHECK(centre == 0xff00ff00u, "centre %08x, overlay not on top", centre);
+            CHECK(side == 0xff0000ffu, "side %08x, main quad missing", side);
+        }
+
+        for (App* app : {&main, &overlay}) {
+            mockRuntimeSetCompositing(app->session, false);
+            CHECK(xrRequestExitSession(app->session) == XR_SUCCESS, "request exit");
+            for (int frame = 0; frame < 4 && !app->exiting; ++frame) {
+                runFrame(app);
+            }
+            destroyApp(app);
+        }
+    }
+
+    hostEglDestroy(&egl);
+    return checkResult();
+}
@@ -0,0 +1,133 @@
+//
+// Overlay layout parser: every field, defaults, unknown keys skipped, disabled panels taking no
+// slot, the panel limit, and malformed layouts refused with the offset of the error. Also parses
+// the layout asset every app ships.
+//
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include <android/asset_manager.h>
+
+#include "check.h"
+#include "overlay_layout.h"
+
+static bool parse(const std::string& text, OverlayLayout* layout) {
+    return overlayLayoutParse(text.data(), text.size(), layout);
+}
+
+// Fails the parse and checks why and where.
+static void checkError(const std::string& text, const char* error, size_t offset) {
+    OverlayLayout layout;
+    const bool ok = parse(text, &layout);
+    CHECK(!ok, "'%s' parsed", text.c_str());
+    CHECK(layout.panelCount == 0, "'%s' left %u panels", text.c_str(), layout.panelCount);
+    CHECK(layout.error && strcmp(layout.error, error) == 0, "'%s': error '%s', expected '%s'", text.c_str(),
+          layout.error ? layout.error : "(none)", error);
+    CHECK(layout.errorOffset == offset, "'%s': error at byte %u, expected %zu", text.c_str(), layout.errorOffset,
+          offset);
+}
+
+static std::string panels(uint32_t enabled, uint32_t disabled) {
+    std::string text = "{\"panels\": [";
+    for (uint32_t i = 0; i < enabled + disabled; ++i) {
+        text += i ? ", " : "";
+        text += i < enabled ? "{\"width\": 64}" : "{\"enabled\": false}";
+    }
+    return text + "]}";
+}
+
+int main() {
+    // --- Every field, unknown keys skipped ---
+    {
+        const std::string text = R"({
+            "version": {"major": 1, "tags": ["a", {"b": null}], "ok": true},
+            "panels": [
+                { "name": "Green", "width": 1024, "height": 256,
+                  "color": [0.1, 0.8, 0.2, 0.8], "position": [0.2, -0.5, -1.2e0],
+                  "orientation": [0, 0, 0.5, 1], "size": [0.75, 0.25], "enabled": true,
+                  "comment": "unknown \"key\"", "a_key_longer_than_the_key_buffer": [1, [2, [3]]] },
+                {}
+            ],
+            "trailing": -1.5E-2
+        })";
+        OverlayLayout layout;
+        CHECK(parse(text, &layout), "valid layout refused: %s", layout.error);
+        CHECK(layout.panelCount == 2 && layout.error == nullptr, "%u panels", layout.panelCount);
+        const OverlayPanelDesc& green = layout.panels[0];
+        CHECK(strcmp(green.name, "Green") == 0 && green.width == 1024 && green.height == 256, "panel 0 %s %ux%u",
+              green.name, green.width, green.height);
+        CHECK(green.color[1] == 0.8f && green.color[3] == 0.8f, "color");
+        CHECK(green.pose.position.x == 0.2f && green.pose.position.y == -0.5f && green.pose.position.z == -1.2f,
+              "position");
+        CHECK(green.pose.orientation.z == 0.5f && green.pose.orientation.w == 1.0f, "orientation");
+        CHECK(green.size.width == 0.75f && green.size.height == 0.25f, "size");
+
+        const OverlayPanelDesc defaults;
+        const OverlayPanelDesc& empty = layout.panels[1];
+        CHECK(empty.name[0] == '\0' && empty.width == defaults.width && empty.height == defaults.height &&
+              empty.pose.position.z == defaults.pose.position.z && empty.size.width == defaults.size.width,
+              "empty panel doesn't get the defaults");
+    }
+
+    // --- Disabled panels take no slot ---
+    {
+        OverlayLayout layout;
+        CHECK(parse(R"({"panels": [{"name": "A"}, {"name": "B", "width": 8, "enabled": false}, {"name": "C"}]})",
+                    &layout),
+              "disabled panel refused");
+        CHECK(layout.panelCount == 2 && strcmp(layout.panels[0].name, "A") == 0 &&
+              strcmp(layout.panels[1].name, "C") == 0, "%u panels", layout.panelCount);
+        CHECK(layout.panels[1].width == OverlayPanelDesc().width, "disabled panel's width leaked into the next");
+    }
+
+    // --- The panel limit ---
+    {
+        OverlayLayout layout;
+        CHECK(parse(panels(OVERLAY_LAYOUT_MAX_PANELS, 0), &layout) && layout.panelCount == OVERLAY_LAYOUT_MAX_PANELS,
+              "%d panels refused", OVERLAY_LAYOUT_MAX_PANELS);
+        CHECK(parse(panels(OVERLAY_LAYOUT_MAX_PANELS, 4), &layout) && layout.panelCount == OVERLAY_LAYOUT_MAX_PANELS,
+              "disabled panels past the limit refused");
+        const std::string tooMany = panels(OVERLAY_LAYOUT_MAX_PANELS + 1, 0);
+        checkError(tooMany, "too many panels", tooMany.rfind('{'));
+    }
+
+    // --- Malformed ---
+    checkError("", "unexpected character", 0);
+    checkError("{} x", "trailing characters", 3);
+    checkError("{}{}", "trailing characters", 2);
+    checkError(R"({"panels": [{"width": 0}]})", "expected a resolution between 1 and 16384", 22);
+    checkError(R"({"panels": [{"height": 16385}]})", "expected a resolution between 1 and 16384", 23);
+    checkError(R"({"panels": [{"width": 1.5}]})", "expected a resolution between 1 and 16384", 22);
+    checkError(R"({"panels": [{"width": -4}]})", "expected a resolution between 1 and 16384", 22);
+    checkError(R"({"panels": [{"name": "A" "width": 1}]})", "unexpected character", 25);
+    checkError(R"({"panels": [{"color": [1, 1, 1]}]})", "unexpected character", 30);
+    checkError(R"({"panels": [{"enabled": yes}]})", "unexpected literal", 24);
+    checkError(R"({"panels": [{"name": "\u0041"}]})", "\\u escapes are not supported", 24);
+    checkError(R"({"panels": [{"name": "A)", "unterminated string", 23);
+    checkError(R"({"panels": [{"size": [x, 1]}]})", "expected a number", 22);
+    checkError(R"({"deep": [[[[[[[[[[[[[[[[[[1]]]]]]]]]]]]]]]]]]})", "nested too deep", 26);
+    checkError(R"({"panels": [{"name": "A"},)", "unexpected character", 26);
+
+    // A failed parse leaves nothing behind from an earlier good one.
+    {
+        OverlayLayout layout;
+        parse(panels(3, 0), &layout);
+        CHECK(!parse("{", &layout) && layout.panelCount == 0, "panels kept after a failed parse");
+        CHECK(parse("{}", &layout) && layout.error == nullptr, "error kept after a good parse");
+    }
+
+    // --- The apps' assets ---
+    for (const char* app : {"overlay1", "overlay2", "overlay3", "overlayhost"}) {
+        const std::string assets = std::string(PROJECTS_DIR "/") + app + "/app/src/main/assets";
+        AAssetManager* assetManager = hostAssetManagerCreate(assets.c_str());
+        OverlayLayout layout;
+        CHECK(overlayLayoutLoadAsset(assetManager, "overlay_layout.json", &layout) && layout.panelCount > 0,
+              "%s: overlay_layout.json", app);
+        CHECK(!overlayLayoutLoadAsset(assetManager, "missing.json", &layout), "%s: missing asset loaded", app);
+        hostAssetManagerDestroy(assetManager);
+    }
+
+    return checkResult();
+}
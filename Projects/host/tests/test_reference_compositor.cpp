@@ -0,0 +1,200 @@
+//
+// CPU reference compositor: projection and quad placement, eye visibility, the blend flags and
+// environment blend modes against hand-computed pixels, SIMD kernels matching the scalar ones
+// bit for bit, per-layer pixel counts, and PAM round trips for golden images.
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "check.h"
+#include "mock_runtime/reference_compositor.h"
+
+#define EYE_SIZE 64
+
+static uint32_t rgba(uint32_t r, uint32_t g, uint32_t b, uint32_t a) {
+    return r | (g << 8) | (b << 16) | (a << 24);
+}
+
+static CompositorImage solid(uint32_t width, uint32_t height, uint32_t pixel) {
+    CompositorImage image;
+    image.width = width;
+    image.height = height;
+    image.pixels.assign(static_cast<size_t>(width) * height, pixel);
+    return image;
+}
+
+static uint32_t at(const CompositorImage& image, uint32_t x, uint32_t y) {
+    return image.pixels[static_cast<size_t>(y) * image.width + x];
+}
+
+static void init(ReferenceCompositor* compositor) {
+    CompositorEye eyes[2];
+    for (uint32_t eye = 0; eye < 2; ++eye) {
+        eyes[eye].pose.position = {eye == 0 ? -0.0315f : 0.0315f, 0.0f, 0.0f};
+        eyes[eye].fov = {-0.785398f, 0.785398f, 0.785398f, -0.785398f};
+    }
+    referenceCompositorInit(compositor, EYE_SIZE, EYE_SIZE, eyes);
+}
+
+static CompositorLayer projection(const CompositorImage* left, const CompositorImage* right) {
+    CompositorLayer layer;
+    layer.kind = COMPOSITOR_LAYER_PROJECTION;
+    layer.views[0] = {left, {{0, 0}, {static_cast<int32_t>(left->width), static_cast<int32_t>(left->height)}}};
+    layer.views[1] = {right, {{0, 0}, {static_cast<int32_t>(right->width), static_cast<int32_t>(right->height)}}};
+    return layer;
+}
+
+static CompositorLayer quad(const CompositorImage* image, XrCompositionLayerFlags flags, float z, float size) {
+    CompositorLayer layer;
+    layer.kind = COMPOSITOR_LAYER_QUAD;
+    layer.flags = flags;
+    layer.views[0] = {image, {{0, 0}, {static_cast<int32_t>(image->width), static_cast<int32_t>(image->height)}}};
+    layer.pose.position = {0.0f, 0.0f, z};
+    layer.size = {size, size};
+    return layer;
+}
+
+int main() {
+    const XrCompositionLayerFlags sourceAlpha = XR_COMPOSITION_LAYER_BLEND_TEXTURE_SOURCE_ALPHA_BIT;
+    const CompositorImage red = solid(32, 32, rgba(255, 0, 0, 255));
+    const CompositorImage blue = solid(16, 16, rgba(0, 0, 255, 255));
+    const CompositorImage halfGreen = solid(8, 8, rgba(0, 128, 0, 128)); // premultiplied 50% green
+
+    // --- Projection: each eye gets its view, scaled ---
+    {
+        ReferenceCompositor compositor;
+        init(&compositor);
+        CompositorImage gradient = solid(EYE_SIZE * 2, EYE_SIZE, 0);
+        for (uint32_t y = 0; y < gradient.height; ++y) {
+            for (uint32_t x = 0; x < gradient.width; ++x) {
+                gradient.pixels[y * gradient.width + x] = rgba(x, y, 7, 255);
+            }
+        }
+        CompositorLayer layer = projection(&gradient, &blue);
+        referenceCompositorCompose(&compositor, &layer, 1, XR_ENVIRONMENT_BLEND_MODE_OPAQUE);
+        CHECK(at(compositor.output[0], 10, 20) == rgba(21, 20, 7, 255), "left %08x", at(compositor.output[0], 10, 20));
+        CHECK(at(compositor.output[1], 63, 0) == rgba(0, 0, 255, 255), "right %08x", at(compositor.output[1], 63, 0));
+        CHECK(compositor.costs[0].pixels == 2u * EYE_SIZE * EYE_SIZE, "pixels %llu",
+              (unsigned long long) compositor.costs[0].pixels);
+    }
+
+    // --- Quad placement and visibility ---
+    {
+        ReferenceCompositor compositor;
+        init(&compositor);
+        // 0.5 m at 1 m with a 90 degree FOV covers the middle quarter of each axis.
+        CompositorLayer layer = quad(&red, 0, -1.0f, 0.5f);
+        referenceCompositorCompose(&compositor, &layer, 1, XR_ENVIRONMENT_BLEND_MODE_ALPHA_BLEND);
+        for (uint32_t eye = 0; eye < 2; ++eye) {
+            CHECK(at(compositor.output[eye], 32, 32) == rgba(255, 0, 0, 255), "eye %u centre", eye);
+            CHECK(at(compositor.output[eye], 2, 2) == 0, "eye %u corner covered", eye);
+            CHECK(at(compositor.output[eye], 32, 45) == 0 && at(compositor.output[eye], 32, 19) == 0,
+                  "eye %u quad too tall", eye);
+        }
+        // Parallax: the quad sits right of centre in the left eye.
+        uint32_t leftEdge[2] = {};
+        for (uint32_t eye = 0; eye < 2; ++eye) {
+            while (leftEdge[eye] < EYE_SIZE && at(compositor.output[eye], leftEdge[eye], 32) == 0) {
+                ++leftEdge[eye];
+            }
+        }
+        CHECK(leftEdge[0] > leftEdge[1], "no parallax: %u vs %u", leftEdge[0], leftEdge[1]);
+        const uint64_t expected = 2ull * 16 * 16;
+        CHECK(compositor.costs[0].pixels > expected * 8 / 10 && compositor.costs[0].pixels < expected * 12 / 10,
+              "quad pixels %llu", (unsigned long long) compositor.costs[0].pixels);
+
+        layer.eyeVisibility = XR_EYE_VISIBILITY_RIGHT;
+        referenceCompositorCompose(&compositor, &layer, 1, XR_ENVIRONMENT_BLEND_MODE_ALPHA_BLEND);
+        CHECK(at(compositor.output[0], 32, 32) == 0 && at(compositor.output[1], 32, 32) != 0, "right eye only");
+
+        // Behind the viewer: nothing.
+        layer = quad(&red, 0, 1.0f, 0.5f);
+        referenceCompositorCompose(&compositor, &layer, 1, XR_ENVIRONMENT_BLEND_MODE_ALPHA_BLEND);
+        CHECK(compositor.costs[0].pixels == 0, "quad behind the eye drawn");
+    }
+
+    // --- Blend flags and environment blend modes ---
+    {
+        ReferenceCompositor compositor;
+        init(&compositor);
+        CompositorLayer layers[2] = {projection(&blue, &blue), quad(&halfGreen, sourceAlpha, -1.0f, 0.5f)};
+
+        referenceCompositorCompose(&compositor, layers, 2, XR_ENVIRONMENT_BLEND_MODE_OPAQUE);
+        CHECK(at(compositor.output[0], 32, 32) == rgba(0, 128, 127, 255), "over %08x", at(compositor.output[0], 32, 32));
+
+        // Same texels read as straight alpha: premultiplied first.
+        layers[1].flags = sourceAlpha | XR_COMPOSITION_LAYER_UNPREMULTIPLIED_ALPHA_BIT;
+        referenceCompositorCompose(&compositor, layers, 2, XR_ENVIRONMENT_BLEND_MODE_OPAQUE);
+        CHECK(at(compositor.output[0], 32, 32) == rgba(0, 64, 127, 255), "unpremultiplied %08x",
+              at(compositor.output[0], 32, 32));
+
+        // Without source alpha the quad is opaque.
+        layers[1].flags = 0;
+        referenceCompositorCompose(&compositor, layers, 2, XR_ENVIRONMENT_BLEND_MODE_OPAQUE);
+        CHECK(at(compositor.output[0], 32, 32) == rgba(0, 128, 0, 255), "opaque %08x", at(compositor.output[0], 32, 32));
+
+        // Quad alone: ALPHA_BLEND keeps the coverage, OPAQUE and ADDITIVE drop it.
+        layers[1].flags = sourceAlpha;
+        referenceCompositorCompose(&compositor, &layers[1], 1, XR_ENVIRONMENT_BLEND_MODE_ALPHA_BLEND);
+        CHECK(at(compositor.output[0], 32, 32) == rgba(0, 128, 0, 128) && at(compositor.output[0], 1, 1) == 0,
+              "alpha blend %08x", at(compositor.output[0], 32, 32));
+        referenceCompositorCompose(&compositor, &layers[1], 1, XR_ENVIRONMENT_BLEND_MODE_ADDITIVE);
+        CHECK(at(compositor.output[0], 32, 32) == rgba(0, 128, 0, 255) && at(compositor.output[0], 1, 1) == rgba(0, 0, 0, 255),
+              "additive %08x", at(compositor.output[0], 32, 32));
+    }
+
+    // --- SIMD kernels match scalar ---
+    {
+        CompositorImage noise[3];
+        uint32_t state = 12345;
+        for (auto& image : noise) {
+            image = solid(37, 29, 0);
+            for (auto& pixel : image.pixels) {
+                state = state * 1664525u + 1013904223u;
+                const uint32_t alpha = state >> 24;
+                // Valid premultiplied texels (channels <= alpha) and some that aren't.
+                pixel = (state & 0x00ffffffu) & ((state & 1) ? 0x00ffffffu : alpha * 0x010101u);
+                pixel |= alpha << 24;
+            }
+        }
+        CompositorLayer layers[4] = {projection(&noise[0], &noise[1]), quad(&noise[1], sourceAlpha, -1.5f, 1.3f),
+                                     quad(&noise[2], sourceAlpha | XR_COMPOSITION_LAYER_UNPREMULTIPLIED_ALPHA_BIT, -0.8f, 0.4f),
+                                     quad(&noise[0], 0, -2.0f, 0.3f)};
+        layers[1].pose.orientation = {0.0f, 0.3826834f, 0.0f, 0.9238795f}; // 45 degrees about Y
+        ReferenceCompositor scalar, simd;
+        init(&scalar);
+        init(&simd);
+        scalar.simd = false;
+        referenceCompositorCompose(&scalar, layers, 4, XR_ENVIRONMENT_BLEND_MODE_ALPHA_BLEND);
+        referenceCompositorCompose(&simd, layers, 4, XR_ENVIRONMENT_BLEND_MODE_ALPHA_BLEND);
+        for (uint32_t eye = 0; eye < 2; ++eye) {
+            CHECK(compositorImageMaxDiff(scalar.output[eye], simd.output[eye]) == 0, "eye %u differs", eye);
+            CHECK(compositorImageHash(scalar.output[eye]) == compositorImageHash(simd.output[eye]), "hash");
+        }
+
+        char report[1024];
+        referenceCompositorFormat(&simd, report, sizeof(report));
+        printf("%s", report);
+        CHECK(simd.layerCount == 4 && simd.costs[1].pixels > 0 && simd.costs[3].pixels > 0, "costs");
+    }
+
+    // --- PAM round trip ---
+    {
+        ReferenceCompositor compositor;
+        init(&compositor);
+        CompositorLayer layers[2] = {projection(&blue, &red), quad(&halfGreen, sourceAlpha, -1.0f, 0.5f)};
+        referenceCompositorCompose(&compositor, layers, 2, XR_ENVIRONMENT_BLEND_MODE_ALPHA_BLEND);
+        const char* tmp = getenv("TMPDIR");
+        const std::string path = std::string(tmp ? tmp : "/tmp") + "/test_reference_compositor.pam";
+        CHECK(compositorImageWritePam(compositor.output[1], path.c_str()), "write %s", path.c_str());
+        CompositorImage loaded;
+        CHECK(compositorImageReadPam(&loaded, path.c_str()), "read %s", path.c_str());
+        CHECK(compositorImageMaxDiff(loaded, compositor.output[1]) == 0, "round trip differs");
+        CHECK(compositorImageMaxDiff(loaded, compositor.output[0]) > 0, "eyes identical");
+        remove(path.c_str());
+    }
+
+    return checkResult();
+}
@@ -0,0 +1,196 @@
+//
+// Session lifecycle state machine: both end policies, callback order, instance loss, and that
+// every milestone of a run is stamped once and in order; the FOCUSED callback and time to visible
+// from base's FOCUSED.
+//
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include "check.h"
+#include "session_lifecycle.h"
+
+// --- Runtime stubs: record the calls ---
+
+static std::string g_calls;
+static XrResult g_beginResult = XR_SUCCESS;
+
+extern "C" XrResult xrBeginSession(XrSession, const XrSessionBeginInfo* beginInfo) {
+    g_calls += beginInfo->primaryViewConfigurationType == XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO ? "B" : "b?";
+    return g_beginResult;
+}
+
+extern "C" XrResult xrEndSession(XrSession) {
+    g_calls += "E";
+    return XR_SUCCESS;
+}
+
+static void onBegun(void*) { g_calls += "[begun]"; }
+static void onStopped(void*) { g_calls += "[stopped]"; }
+static void onExiting(void*) { g_calls += "[exiting]"; }
+static void onFocused(void* user) {
+    auto* lifecycle = static_cast<SessionLifecycle*>(user);
+    g_calls += lifecycle->milestoneNs[SESSION_MILESTONE_FOCUSED].load() != 0 ? "[focused]" : "[focused?]";
+}
+
+static const XrSession kSession = reinterpret_cast<XrSession>(uintptr_t(7));
+
+static void feed(SessionLifecycle* lifecycle, XrSessionState state, XrSession session = kSession) {
+    XrEventDataSessionStateChanged event = {XR_TYPE_EVENT_DATA_SESSION_STATE_CHANGED};
+    event.session = session;
+    event.state = state;
+    sessionLifecycleHandleState(lifecycle, event);
+    // Distinct timestamps between steps.
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+}
+
+static void init(SessionLifecycle* lifecycle, SessionEndPolicy policy) {
+    SessionCallbacks callbacks;
+    callbacks.begun = onBegun;
+    callbacks.stopped = onStopped;
+    callbacks.exiting = onExiting;
+    sessionLifecycleInit(lifecycle, kSession, XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO, policy, callbacks, "Test");
+    g_calls.clear();
+}
+
+static void runToFocused(SessionLifecycle* lifecycle) {
+    feed(lifecycle, XR_SESSION_STATE_IDLE);
+    feed(lifecycle, XR_SESSION_STATE_READY);
+    sessionLifecycleFrameEnded(lifecycle, 0); // no layers: not the first frame yet
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+    sessionLifecycleFrameEnded(lifecycle, 1);
+    sessionLifecycleFrameEnded(lifecycle, 1);
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+    feed(lifecycle, XR_SESSION_STATE_SYNCHRONIZED);
+    feed(lifecycle, XR_SESSION_STATE_VISIBLE);
+    feed(lifecycle, XR_SESSION_STATE_FOCUSED);
+}
+
+int main() {
+    // --- Overlay policy: end on STOPPING ---
+    {
+        SessionLifecycle lifecycle;
+        init(&lifecycle, SESSION_END_ON_STOPPING);
+        runToFocused(&lifecycle);
+        CHECK(lifecycle.running && lifecycle.begun, "not running after READY");
+        CHECK(g_calls == "B[begun]", "calls %s", g_calls.c_str());
+
+        for (uint32_t i = 1; i <= SESSION_MILESTONE_FOCUSED; ++i) {
+            const auto from = static_cast<SessionMilestone>(i - 1);
+            const auto to = static_cast<SessionMilestone>(i);
+            CHECK(sessionLifecycleLatencyNs(&lifecycle, from, to) > 0, "%s -> %s not stamped in order",
+                  sessionMilestoneName(from), sessionMilestoneName(to));
+        }
+        const uint64_t visibleNs = lifecycle.milestoneNs[SESSION_MILESTONE_VISIBLE].load();
+
+        // Back down and up again within the run: stamps keep the first time.
+        feed(&lifecycle, XR_SESSION_STATE_VISIBLE);
+        feed(&lifecycle, XR_SESSION_STATE_FOCUSED);
+        CHECK(lifecycle.milestoneNs[SESSION_MILESTONE_VISIBLE].load() == visibleNs, "VISIBLE restamped");
+
+        // Another session's events are ignored.
+        feed(&lifecycle, XR_SESSION_STATE_STOPPING, reinterpret_cast<XrSession>(uintptr_t(8)));
+        CHECK(lifecycle.state == XR_SESSION_STATE_FOCUSED && lifecycle.running, "foreign event applied");
+
+        char report[512];
+        sessionLifecycleFormat(&lifecycle, report, sizeof(report));
+        printf("%s\n", report);
+        CHECK(strstr(report, "first frame") != nullptr && strstr(report, "focused") != nullptr, "report: %s", report);
+
+        feed(&lifecycle, XR_SESSION_STATE_VISIBLE);
+        feed(&lifecycle, XR_SESSION_STATE_SYNCHRONIZED);
+        feed(&lifecycle, XR_SESSION_STATE_STOPPING);
+        CHECK(!lifecycle.running && !lifecycle.begun, "still running after STOPPING");
+        CHECK(g_calls == "B[begun][stopped]E", "calls %s", g_calls.c_str());
+
+        // IDLE starts a new run.
+        feed(&lifecycle, XR_SESSION_STATE_IDLE);
+        CHECK(lifecycle.milestoneNs[SESSION_MILESTONE_FOCUSED].load() == 0, "old run kept");
+        CHECK(lifecycle.milestoneNs[SESSION_MILESTONE_IDLE].load() != 0, "IDLE not stamped");
+        feed(&lifecycle, XR_SESSION_STATE_READY);
+        CHECK(lifecycle.runs == 2 && !lifecycle.frameSubmitted, "second run");
+        feed(&lifecycle, XR_SESSION_STATE_EXITING);
+        CHECK(g_calls == "B[begun][stopped]EB[begun][stopped]E[exiting]", "calls %s", g_calls.c_str());
+    }
+
+    // --- Base policy: keep the session across STOPPING ---
+    {
+        SessionLifecycle lifecycle;
+        init(&lifecycle, SESSION_END_ON_EXITING);
+        runToFocused(&lifecycle);
+        feed(&lifecycle, XR_SESSION_STATE_STOPPING);
+        CHECK(!lifecycle.running && lifecycle.begun, "session ended on STOPPING");
+        CHECK(g_calls == "B[begun][stopped]", "calls %s", g_calls.c_str());
+
+        // Still begun, so READY resumes without another xrBeginSession.
+        feed(&lifecycle, XR_SESSION_STATE_IDLE);
+        feed(&lifecycle, XR_SESSION_STATE_READY);
+        CHECK(lifecycle.running, "not resumed");
+        CHECK(g_calls == "B[begun][stopped][begun]", "calls %s", g_calls.c_str());
+
+        feed(&lifecycle, XR_SESSION_STATE_EXITING);
+        CHECK(!lifecycle.running && !lifecycle.begun, "not ended on EXITING");
+        CHECK(g_calls == "B[begun][stopped][begun][stopped]E[exiting]", "calls %s", g_calls.c_str());
+    }
+
+    // --- Failures and instance loss ---
+    {
+        SessionLifecycle lifecycle;
+        init(&lifecycle, SESSION_END_ON_STOPPING);
+        g_beginResult = XR_ERROR_RUNTIME_FAILURE;
+        feed(&lifecycle, XR_SESSION_STATE_IDLE);
+        feed(&lifecycle, XR_SESSION_STATE_READY);
+        CHECK(!lifecycle.running && !lifecycle.begun, "running after a failed begin");
+        CHECK(lifecycle.milestoneNs[SESSION_MILESTONE_BEGUN].load() == 0, "BEGUN stamped on failure");
+        g_beginResult = XR_SUCCESS;
+
+        init(&lifecycle, SESSION_END_ON_STOPPING);
+        runToFocused(&lifecycle);
+        sessionLifecycleStop(&lifecycle, false);
+        CHECK(!lifecycle.running && lifecycle.begun, "instance loss stop");
+        CHECK(g_calls == "B[begun][stopped]", "calls %s", g_calls.c_str());
+        feed(&lifecycle, XR_SESSION_STATE_LOSS_PENDING);
+        CHECK(g_calls == "B[begun][stopped]E[exiting]", "calls %s", g_calls.c_str());
+    }
+
+    // --- Base's FOCUSED callback, overlay time to visible ---
+    {
+        SessionLifecycle base;
+        SessionCallbacks callbacks;
+        callbacks.user = &base;
+        callbacks.focused = onFocused;
+        sessionLifecycleInit(&base, kSession, XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO, SESSION_END_ON_EXITING,
+                             callbacks, "Base");
+        g_calls.clear();
+        runToFocused(&base);
+        // Every entry, not only the first of the run: MainActivity then retries the overlays whose
+        // launch failed. The ones it did launch aren't launched again.
+        feed(&base, XR_SESSION_STATE_VISIBLE);
+        feed(&base, XR_SESSION_STATE_FOCUSED);
+        CHECK(g_calls == "B[focused][focused]", "calls %s", g_calls.c_str());
+
+        char report[512];
+        sessionLifecycleFormat(&base, report, sizeof(report));
+        CHECK(strstr(report, "after base focused") == nullptr, "no reference yet: %s", report);
+
+        // The overlay's own run starts after base's FOCUSED.
+        sessionLifecycleSetLaunchReference(base.milestoneNs[SESSION_MILESTONE_FOCUSED].load());
+        SessionLifecycle overlay;
+        init(&overlay, SESSION_END_ON_STOPPING);
+        runToFocused(&overlay);
+        sessionLifecycleFormat(&overlay, report, sizeof(report));
+        printf("%s\n", report);
+        double afterMs = 0;
+        const char* after = strstr(report, ", visible ");
+        CHECK(after && sscanf(after, ", visible %lfms after base focused", &afterMs) == 1 && afterMs > 0,
+              "report: %s", report);
+
+        sessionLifecycleSetLaunchReference(0);
+        sessionLifecycleFormat(&overlay, report, sizeof(report));
+        CHECK(strstr(report, "after base focused") == nullptr, "reference kept: %s", report);
+    }
+
+    return checkResult();
+}
@@ -0,0 +1,169 @@
+//
+// Base -> overlay state channel: snapshots and messages arrive whole and in order, a lapped reader
+// counts what it lost, readers can't write the region, a foreign region is refused, and the fd
+// reaches another process over the socket, which then sees only consistent snapshots while the
+// writer publishes as fast as it can.
+//
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstring>
+
+#include <android/sharedmem.h>
+
+#include "check.h"
+#include "state_channel.h"
+
+#define SOCKET_NAME "test_state_channel"
+// The writer's last frame in the cross-process run.
+#define LAST_FRAME 200000ull
+
+// Every field derived from the frame, so a torn copy shows.
+static StateSnapshot snapshotFor(uint64_t frame) {
+    StateSnapshot snapshot;
+    snapshot.frame = frame;
+    snapshot.displayTime = static_cast<int64_t>(frame) * 11;
+    snapshot.headPosition[0] = static_cast<float>(frame % 1000);
+    snapshot.flags = STATE_SNAPSHOT_HEAD_VALID;
+    snprintf(snapshot.text, sizeof(snapshot.text), "frame %llu", static_cast<unsigned long long>(frame));
+    return snapshot;
+}
+
+static bool consistent(const StateSnapshot& snapshot) {
+    const StateSnapshot expected = snapshotFor(snapshot.frame);
+    return snapshot.displayTime == expected.displayTime && snapshot.headPosition[0] == expected.headPosition[0] &&
+           snapshot.flags == expected.flags && strcmp(snapshot.text, expected.text) == 0;
+}
+
+static int readerProcess() {
+    StateChannel reader;
+    if (!stateChannelConnect(&reader, SOCKET_NAME, 2000)) {
+        fprintf(stderr, "child: connect failed\n");
+        return 2;
+    }
+    StateSnapshot snapshot;
+    uint64_t lastFrame = 0;
+    uint64_t reads = 0;
+    while (lastFrame < LAST_FRAME) {
+        if (stateChannelRead(&reader, &snapshot) == 0) {
+            continue;
+        }
+        ++reads;
+        if (!consistent(snapshot) || snapshot.frame < lastFrame) {
+            fprintf(stderr, "child: bad snapshot frame %llu after %llu\n",
+                    static_cast<unsigned long long>(snapshot.frame), static_cast<unsigned long long>(lastFrame));
+            return 3;
+        }
+        lastFrame = snapshot.frame;
+    }
+    StateMessage messages[64];
+    const uint32_t count = stateChannelPoll(&reader, messages, 64);
+    if (count != 1 || messages[0].type != STATE_MESSAGE_TEXT || strcmp(messages[0].value.text, "done") != 0) {
+        fprintf(stderr, "child: %u messages\n", count);
+        return 4;
+    }
+    printf("child: %llu consistent reads, %llu torn\n", static_cast<unsigned long long>(reads),
+           static_cast<unsigned long long>(reader.tornSnapshots));
+    fflush(stdout);
+    stateChannelDestroy(&reader);
+    return 0;
+}
+
+int main() {
+    StateChannel writer;
+    CHECK(stateChannelCreate(&writer), "create");
+
+    // --- Same process, a second mapping ---
+    {
+        StateChannel reader;
+        CHECK(stateChannelMap(&reader, dup(writer.fd)), "map");
+        StateSnapshot snapshot;
+        CHECK(stateChannelRead(&reader, &snapshot) == 0, "snapshot before any was published");
+
+        stateChannelPublish(&writer, snapshotFor(1));
+        stateChannelPublish(&writer, snapshotFor(2));
+        CHECK(stateChannelRead(&reader, &snapshot) == 2, "publish count");
+        CHECK(snapshot.frame == 2 && consistent(snapshot) && snapshot.publishedNs != 0, "snapshot frame %llu",
+              static_cast<unsigned long long>(snapshot.frame));
+
+        stateChannelPushCounter(&writer, STATE_KEY_LATE_FRAMES, 3);
+        stateChannelPushText(&writer, STATE_KEY_FRAME_STATS, "a frame stats line far longer than one message has room for");
+        StateMessage messages[4];
+        uint32_t count = stateChannelPoll(&reader, messages, 4);
+        CHECK(count == 2, "%u messages", count);
+        CHECK(messages[0].type == STATE_MESSAGE_COUNTER && messages[0].key == STATE_KEY_LATE_FRAMES &&
+              messages[0].value.counter == 3, "counter");
+        CHECK(messages[1].type == STATE_MESSAGE_TEXT &&
+              strlen(messages[1].value.text) == STATE_MESSAGE_TEXT_MAX - 1, "text '%s'", messages[1].value.text);
+        CHECK(stateChannelPoll(&reader, messages, 4) == 0, "messages read twice");
+
+        // Lapped: the oldest are lost, the rest still come in order.
+        const uint32_t pushed = STATE_CHANNEL_RING_CAPACITY + 10;
+        for (uint32_t i = 0; i < pushed; ++i) {
+            stateChannelPushCounter(&writer, STATE_KEY_LATE_FRAMES, i);
+        }
+        int64_t expected = 10;
+        uint32_t received = 0;
+        bool ordered = true;
+        while ((count = stateChannelPoll(&reader, messages, 4)) > 0) {
+            for (uint32_t i = 0; i < count; ++i) {
+                ordered &= messages[i].value.counter == expected++;
+            }
+            received += count;
+        }
+        CHECK(reader.lost == 10 && received == STATE_CHANNEL_RING_CAPACITY && ordered, "lost %llu, received %u",
+              static_cast<unsigned long long>(reader.lost), received);
+
+        // Readers get the region read-only, and the fd no longer maps writable.
+        void* writable = mmap(nullptr, reader.size, PROT_READ | PROT_WRITE, MAP_SHARED, writer.fd, 0);
+        CHECK(writable == MAP_FAILED, "writable mapping from the shared fd");
+        if (writable != MAP_FAILED) {
+            munmap(writable, reader.size);
+        }
+        stateChannelDestroy(&reader);
+
+        // A region of the right size that isn't one.
+        const int foreign = ASharedMemory_create("foreign", sizeof(StateChannelRegion));
+        CHECK(!stateChannelMap(&reader, foreign), "foreign region mapped");
+    }
+
+    // --- Another process, through the socket ---
+    ALooper* looper = ALooper_prepare(0);
+    CHECK(stateChannelServe(&writer, looper, SOCKET_NAME), "serve");
+    CHECK(!stateChannelServe(&writer, looper, SOCKET_NAME), "served twice");
+    fflush(stdout);
+    const pid_t child = fork();
+    if (child == 0) {
+        _exit(readerProcess());
+    }
+    for (int i = 0; i < 100 && writer.readersServed == 0; ++i) {
+        ALooper_pollOnce(50, nullptr, nullptr, nullptr);
+    }
+    CHECK(writer.readersServed == 1, "%llu readers served", static_cast<unsigned long long>(writer.readersServed));
+    if (writer.readersServed == 1) {
+        for (uint64_t frame = 1; frame <= LAST_FRAME; ++frame) {
+            if (frame == LAST_FRAME) {
+                stateChannelPushText(&writer, STATE_KEY_FRAME_STATS, "done");
+            }
+            stateChannelPublish(&writer, snapshotFor(frame));
+        }
+    } else {
+        kill(child, SIGKILL);
+    }
+    int status = 0;
+    waitpid(child, &status, 0);
+    CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0, "reader process status %d", status);
+
+    stateChannelDestroy(&writer);
+    ALooper_release(looper);
+
+    // Nobody serving: the reader gives up at once.
+    StateChannel reader;
+    CHECK(!stateChannelConnect(&reader, SOCKET_NAME, 100), "connected to nothing");
+
+    return checkResult();
+}
@@ -0,0 +1,132 @@
+//
+// Trace markers through the host <android/trace.h>: nested sections end up in the Chrome trace
+// JSON with the outer one enclosing the inner, per thread, with overlong names cut and nesting
+// past HOST_TRACE_MAX_DEPTH dropped rather than mismatched. Nothing is recorded before
+// hostTraceStart or after hostTraceFlush, and with TRACE_MARKERS=0 nothing at all.
+//
+
+#include <unistd.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <android/trace.h>
+
+#include "check.h"
+#include "trace.h"
+
+struct Section {
+    std::string name;
+    double startUs;
+    double durationUs;
+    unsigned tid;
+};
+
+static std::vector<Section> readTrace(const char* path) {
+    std::vector<Section> sections;
+    FILE* in = fopen(path, "r");
+    if (!in) {
+        return sections;
+    }
+    char line[512];
+    while (fgets(line, sizeof(line), in)) {
+        char name[HOST_TRACE_MAX_NAME + 1] = {};
+        Section section;
+        int pid = 0;
+        if (sscanf(line, "{\"name\":\"%48[^\"]\",\"cat\":\"app\",\"ph\":\"X\",\"ts\":%lf,\"dur\":%lf,\"pid\":%d,\"tid\":%u}",
+                   name, &section.startUs, &section.durationUs, &pid, &section.tid) == 5) {
+            section.name = name;
+            sections.push_back(section);
+        }
+    }
+    fclose(in);
+    return sections;
+}
+
+static const Section* find(const std::vector<Section>& sections, const char* name) {
+    for (const Section& section : sections) {
+        if (section.name == name) {
+            return &section;
+        }
+    }
+    return nullptr;
+}
+
+static void emitFrame() {
+    TRACE_SCOPE("renderFrame");
+    for (uint32_t view = 0; view < 2; ++view) {
+        TRACE_SCOPE(traceViewSection(view));
+        usleep(100);
+    }
+}
+
+int main() {
+    char path[] = "/tmp/test_trace_XXXXXX";
+    const int fd = mkstemp(path);
+    CHECK(fd >= 0, "mkstemp");
+    close(fd);
+
+    TRACE_SCOPE("before start");
+    hostTraceStart(path);
+    CHECK(ATrace_isEnabled(), "not enabled");
+    emitFrame();
+    std::thread worker([] {
+        TRACE_BEGIN("worker");
+        usleep(100);
+        TRACE_END();
+        // Nothing open: ignored.
+        TRACE_END();
+    });
+    worker.join();
+    // Past the depth limit the extra sections are dropped, the rest still pair up.
+    const int deep = HOST_TRACE_MAX_DEPTH + 8;
+    for (int i = 0; i < deep; ++i) {
+        TRACE_BEGIN("deep");
+    }
+    for (int i = 0; i < deep; ++i) {
+        TRACE_END();
+    }
+    {
+        TRACE_SCOPE("a section name far longer than the host trace keeps of it");
+    }
+
+    const int64_t written = hostTraceFlush();
+    const int64_t expected = TRACE_MARKERS ? 3 + 1 + HOST_TRACE_MAX_DEPTH + 1 : 0;
+    CHECK(written == expected, "%lld sections written, expected %lld", static_cast<long long>(written),
+          static_cast<long long>(expected));
+    CHECK(!ATrace_isEnabled(), "still enabled after the flush");
+    emitFrame();
+
+    const std::vector<Section> sections = readTrace(path);
+    CHECK(static_cast<int64_t>(sections.size()) == expected, "%zu sections read", sections.size());
+    CHECK(!find(sections, "before start"), "section begun before the start");
+    if (TRACE_MARKERS) {
+        const Section* frame = find(sections, "renderFrame");
+        const Section* view0 = find(sections, "render view 0");
+        const Section* view1 = find(sections, "render view 1");
+        const Section* worker = find(sections, "worker");
+        CHECK(frame && view0 && view1 && worker, "sections missing");
+        if (frame && view0 && view1 && worker) {
+            CHECK(view0->startUs >= frame->startUs && view1->startUs + view1->durationUs <= frame->startUs + frame->durationUs,
+                  "views outside the frame");
+            CHECK(view1->startUs >= view0->startUs + view0->durationUs, "views overlap");
+            CHECK(view0->durationUs >= 100 && view1->durationUs >= 100, "views too short: %.3f %.3f us",
+                  view0->durationUs, view1->durationUs);
+            CHECK(frame->tid == view0->tid && worker->tid != frame->tid, "tids %u %u", frame->tid, worker->tid);
+        }
+        size_t deepCount = 0;
+        bool longCut = false;
+        for (const Section& section : sections) {
+            deepCount += section.name == "deep";
+            longCut |= section.name.compare(0, 14, "a section name") == 0 &&
+                       section.name.size() == HOST_TRACE_MAX_NAME - 1;
+        }
+        CHECK(deepCount == HOST_TRACE_MAX_DEPTH, "%zu deep sections", deepCount);
+        CHECK(longCut, "long name not cut to %d", HOST_TRACE_MAX_NAME - 1);
+    }
+    unlink(path);
+
+    return checkResult();
+}
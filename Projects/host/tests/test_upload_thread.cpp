@@ -0,0 +1,225 @@
+//
+// Upload thread on a shared surfaceless context: a buffer and a texture, both several chunks,
+// become READY through uploadRequestReady and read back what was uploaded; `release` gets each
+// uploaded request's data once; a failed upload leaves no GL object behind; a request still in
+// flight can't be submitted again; a full queue and a stopped thread fail requests instead of
+// queueing them, and stopping fails what is still queued.
+//
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "check.h"
+#include "host_egl.h"
+#include "upload_thread.h"
+
+#define READY_TIMEOUT_MS 5000
+// 2.5 chunks, so the last one is partial.
+#define BUFFER_BYTES (UPLOAD_CHUNK_BYTES * 5 / 2)
+// 2400-byte rows: bands of 436 rows, three of them.
+#define TEXTURE_WIDTH 600
+#define TEXTURE_HEIGHT 1000
+
+static std::atomic<uint32_t> g_released{0};
+static std::atomic<const void*> g_lastReleased{nullptr};
+
+static void release(const void* data) {
+    g_lastReleased = data;
+    g_released++;
+}
+
+// Holds the upload thread inside `release` until `g_unblock`.
+static std::atomic<bool> g_blocking{false};
+static std::atomic<bool> g_unblock{false};
+
+static void blockingRelease(const void* data) {
+    g_blocking = true;
+    while (!g_unblock) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    release(data);
+}
+
+// Polls like the render thread does, once per "frame".
+static bool waitReady(UploadRequest* request) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(READY_TIMEOUT_MS);
+    while (!uploadRequestReady(request)) {
+        if (request->state == UPLOAD_FAILED || std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+static uint8_t bufferByte(size_t i) {
+    return static_cast<uint8_t>(i * 7 + i / 251);
+}
+
+static uint32_t texel(uint32_t x, uint32_t y) {
+    return (x & 0xFFu) | (y & 0xFFu) << 8 | ((x ^ y) & 0xFFu) << 16 | (0x80u + (y >> 8)) << 24;
+}
+
+static void testUploads(UploadThread* uploader) {
+    std::vector<uint8_t> bytes(BUFFER_BYTES);
+    for (size_t i = 0; i < bytes.size(); ++i) {
+        bytes[i] = bufferByte(i);
+    }
+    std::vector<uint32_t> pixels(TEXTURE_WIDTH * TEXTURE_HEIGHT);
+    for (uint32_t y = 0; y < TEXTURE_HEIGHT; ++y) {
+        for (uint32_t x = 0; x < TEXTURE_WIDTH; ++x) {
+            pixels[y * TEXTURE_WIDTH + x] = texel(x, y);
+        }
+    }
+
+    auto* buffer = new UploadRequest();
+    buffer->target = GL_ARRAY_BUFFER;
+    buffer->data = bytes.data();
+    buffer->size = bytes.size();
+    buffer->release = release;
+    auto* texture = new UploadRequest();
+    texture->target = GL_TEXTURE_2D;
+    texture->data = pixels.data();
+    texture->width = TEXTURE_WIDTH;
+    texture->height = TEXTURE_HEIGHT;
+    texture->release = release;
+
+    const uint32_t releasedBefore = g_released;
+    CHECK(uploadThreadSubmit(uploader, buffer) && uploadThreadSubmit(uploader, texture), "submit");
+    CHECK(waitReady(buffer), "buffer state %u", buffer->state.load());
+    CHECK(waitReady(texture), "texture state %u", texture->state.load());
+    CHECK(buffer->name != 0 && texture->name != 0 && buffer->fence == nullptr && texture->fence == nullptr,
+          "names %u/%u", buffer->name, texture->name);
+    CHECK(uploadRequestReady(buffer) && buffer->state == UPLOAD_READY, "READY isn't sticky");
+    CHECK(g_released == releasedBefore + 2 && g_lastReleased == pixels.data(), "released %u times",
+          g_released - releasedBefore);
+    CHECK(uploader->uploadedBytes >= BUFFER_BYTES + TEXTURE_WIDTH * TEXTURE_HEIGHT * 4ull, "%llu bytes uploaded",
+          (unsigned long long)uploader->uploadedBytes.load());
+
+    // The buffer, read back on the render context.
+    glBindBuffer(GL_ARRAY_BUFFER, buffer->name);
+    const auto* mapped =
+        static_cast<const uint8_t*>(glMapBufferRange(GL_ARRAY_BUFFER, 0, BUFFER_BYTES, GL_MAP_READ_BIT));
+    CHECK(mapped != nullptr, "map failed: 0x%X", glGetError());
+    if (mapped) {
+        size_t firstWrong = BUFFER_BYTES;
+        for (size_t i = 0; i < BUFFER_BYTES && firstWrong == BUFFER_BYTES; ++i) {
+            if (mapped[i] != bufferByte(i)) {
+                firstWrong = i;
+            }
+        }
+        CHECK(firstWrong == BUFFER_BYTES, "buffer differs at byte %zu", firstWrong);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // The texture, through an FBO.
+    GLuint framebuffer = 0;
+    glGenFramebuffers(1, &framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture->name, 0);
+    CHECK(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE, "texture not renderable");
+    std::vector<uint32_t> readback(TEXTURE_WIDTH * TEXTURE_HEIGHT);
+    glReadPixels(0, 0, TEXTURE_WIDTH, TEXTURE_HEIGHT, GL_RGBA, GL_UNSIGNED_BYTE, readback.data());
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glDeleteFramebuffers(1, &framebuffer);
+    uint32_t wrong = 0;
+    for (size_t i = 0; i < readback.size(); ++i) {
+        wrong += readback[i] != pixels[i];
+    }
+    CHECK(wrong == 0, "%u texels differ, first row %08x %08x", wrong, readback[0], readback[1]);
+
+    glDeleteBuffers(1, &buffer->name);
+    glDeleteTextures(1, &texture->name);
+    delete buffer;
+    delete texture;
+}
+
+// A zero-sized texture storage is a GL error after the texture name was generated.
+static void testFailedUpload(UploadThread* uploader) {
+    static uint32_t pixel;
+    auto* texture = new UploadRequest();
+    texture->target = GL_TEXTURE_2D;
+    texture->data = &pixel;
+    CHECK(uploadThreadSubmit(uploader, texture), "submit");
+    CHECK(!waitReady(texture) && texture->state == UPLOAD_FAILED, "state %u", texture->state.load());
+    CHECK(texture->name == 0, "failed upload kept texture %u", texture->name);
+    delete texture;
+}
+
+// The upload thread is held in one request while the queue fills up, then stopped.
+static void testQueueFullAndStop(UploadThread* uploader) {
+    static uint8_t data[256];
+    auto* blocker = new UploadRequest();
+    blocker->data = data;
+    blocker->size = sizeof(data);
+    blocker->release = blockingRelease;
+    auto* queued = new UploadRequest[UPLOAD_QUEUE_SIZE];
+    auto* overflow = new UploadRequest();
+
+    const uint32_t releasedBefore = g_released;
+    CHECK(uploadThreadSubmit(uploader, blocker), "blocker");
+    while (!g_blocking) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    CHECK(!uploadThreadSubmit(uploader, blocker) && blocker->state == UPLOAD_PENDING, "in-flight request resubmitted");
+    bool allQueued = true;
+    for (uint32_t i = 0; i < UPLOAD_QUEUE_SIZE; ++i) {
+        queued[i].data = data;
+        queued[i].size = sizeof(data);
+        queued[i].release = release;
+        allQueued &= uploadThreadSubmit(uploader, &queued[i]);
+    }
+    CHECK(allQueued, "queue took fewer than %d", UPLOAD_QUEUE_SIZE);
+    overflow->data = data;
+    overflow->size = sizeof(data);
+    CHECK(!uploadThreadSubmit(uploader, overflow) && overflow->state == UPLOAD_FAILED, "full queue took another");
+
+    // Stop while the blocker is still being uploaded; it finishes, the rest never start.
+    std::thread stopper(uploadThreadStop, uploader);
+    for (bool stopping = false; !stopping;) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        std::lock_guard<std::mutex> lock(uploader->mutex);
+        stopping = uploader->stopRequested;
+    }
+    g_unblock = true;
+    stopper.join();
+
+    CHECK(blocker->state == UPLOAD_FENCED, "blocker state %u", blocker->state.load());
+    CHECK(waitReady(blocker), "blocker not ready after stop");
+    uint32_t failed = 0;
+    for (uint32_t i = 0; i < UPLOAD_QUEUE_SIZE; ++i) {
+        failed += queued[i].state == UPLOAD_FAILED && !uploadRequestReady(&queued[i]);
+    }
+    CHECK(failed == UPLOAD_QUEUE_SIZE, "%u of %d queued requests failed on stop", failed, UPLOAD_QUEUE_SIZE);
+    CHECK(g_released == releasedBefore + 1 && g_lastReleased == data, "released %u times",
+          g_released - releasedBefore);
+
+    CHECK(!uploadThreadSubmit(uploader, overflow) && overflow->state == UPLOAD_FAILED, "stopped thread took one");
+    glDeleteBuffers(1, &blocker->name);
+    delete blocker;
+    delete[] queued;
+    delete overflow;
+}
+
+int main() {
+    HostEgl egl;
+    if (!hostEglInit(&egl)) {
+        fprintf(stderr, "no EGL context\n");
+        return 1;
+    }
+    auto* uploader = new UploadThread();
+    CHECK(uploadThreadStart(uploader, egl.display, egl.config, egl.context), "start");
+    if (uploader->running) {
+        testUploads(uploader);
+        testFailedUpload(uploader);
+        testQueueFullAndStop(uploader);
+    }
+    uploadThreadStop(uploader);
+    delete uploader;
+    hostEglDestroy(&egl);
+    return checkResult();
+}
@@ -0,0 +1,254 @@
+//
+// OpenXR timing layer in front of the mock runtime: negotiation, the instance created down the
+// chain, the frame-loop calls going through the layer's wrappers (and everything else straight
+// to the runtime), then the Chrome trace written at xrDestroyInstance with one event per call,
+// the result codes including a failed call, and the histograms; a wrapped call after
+// xrDestroyInstance fails.
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <jni.h>
+#include <EGL/egl.h>
+#include <GLES3/gl3.h>
+
+#define XR_USE_PLATFORM_ANDROID
+#define XR_USE_GRAPHICS_API_OPENGL_ES
+#include <openxr/openxr_platform.h>
+
+#include "check.h"
+#include "host_egl.h"
+#include "mock_runtime/mock_runtime.h"
+#include "xr_timing_layer.h"
+
+#define FRAMES 20
+#define TRACE_PATH "test_xr_timing_layer.json"
+
+// Loader side of the layer interface; see xr_timing_layer.cpp.
+struct NegotiateLoaderInfo {
+    int structType;
+    uint32_t structVersion;
+    size_t structSize;
+    uint32_t minInterfaceVersion;
+    uint32_t maxInterfaceVersion;
+    XrVersion minApiVersion;
+    XrVersion maxApiVersion;
+};
+
+struct ApiLayerCreateInfo;
+typedef XrResult (*CreateApiLayerInstance)(const XrInstanceCreateInfo*, const ApiLayerCreateInfo*, XrInstance*);
+
+struct NegotiateApiLayerRequest {
+    int structType;
+    uint32_t structVersion;
+    size_t structSize;
+    uint32_t layerInterfaceVersion;
+    XrVersion layerApiVersion;
+    PFN_xrGetInstanceProcAddr getInstanceProcAddr;
+    CreateApiLayerInstance createApiLayerInstance;
+};
+
+struct ApiLayerNextInfo {
+    int structType;
+    uint32_t structVersion;
+    size_t structSize;
+    char layerName[XR_MAX_API_LAYER_NAME_SIZE];
+    PFN_xrGetInstanceProcAddr nextGetInstanceProcAddr;
+    CreateApiLayerInstance nextCreateApiLayerInstance;
+    ApiLayerNextInfo* next;
+};
+
+struct ApiLayerCreateInfo {
+    int structType;
+    uint32_t structVersion;
+    size_t structSize;
+    void* loaderInstance;
+    char settingsFileLocation[512];
+    ApiLayerNextInfo* nextInfo;
+};
+
+extern "C" XrResult xrNegotiateLoaderApiLayerInterface(const NegotiateLoaderInfo*, const char*,
+                                                       NegotiateApiLayerRequest*);
+
+// The loader's end of the chain: the runtime.
+static XrResult createRuntimeInstance(const XrInstanceCreateInfo* info, const ApiLayerCreateInfo*,
+                                      XrInstance* instance) {
+    return xrCreateInstance(info, instance);
+}
+
+static size_t countOf(const std::string& text, const std::string& needle) {
+    size_t count = 0;
+    for (size_t at = text.find(needle); at != std::string::npos; at = text.find(needle, at + 1)) {
+        ++count;
+    }
+    return count;
+}
+
+template <typename Function>
+static Function get(PFN_xrGetInstanceProcAddr getProcAddr, XrInstance instance, const char* name) {
+    PFN_xrVoidFunction function = nullptr;
+    getProcAddr(instance, name, &function);
+    return reinterpret_cast<Function>(function);
+}
+
+int main() {
+    setenv("EGL_PLATFORM", "surfaceless", 0);
+    setenv("DEBUG_OPENXR_OVERLAY_XR_TIMING", TRACE_PATH, 1);
+    DisplayClockConfig clock;
+    clock.refreshHz = 0.0;
+    mockRuntimeSetDisplayClock(&clock);
+
+    NegotiateLoaderInfo loaderInfo = {1, 1, sizeof(NegotiateLoaderInfo), 1, 1, XR_MAKE_VERSION(1, 0, 0),
+                                      XR_CURRENT_API_VERSION};
+    NegotiateApiLayerRequest request = {2, 1, sizeof(NegotiateApiLayerRequest)};
+    CHECK(XR_FAILED(xrNegotiateLoaderApiLayerInterface(&loaderInfo, "XR_APILAYER_other", &request)),
+          "negotiated under another name");
+    CHECK(XR_SUCCEEDED(xrNegotiateLoaderApiLayerInterface(&loaderInfo, XR_TIMING_LAYER_NAME, &request)),
+          "negotiation failed");
+    CHECK(request.getInstanceProcAddr && request.createApiLayerInstance, "no entry points");
+    if (g_failures) {
+        return 1;
+    }
+    const PFN_xrGetInstanceProcAddr layer = request.getInstanceProcAddr;
+
+    ApiLayerNextInfo nextInfo = {5, 1, sizeof(ApiLayerNextInfo)};
+    strcpy(nextInfo.layerName, XR_TIMING_LAYER_NAME);
+    nextInfo.nextGetInstanceProcAddr = xrGetInstanceProcAddr;
+    nextInfo.nextCreateApiLayerInstance = createRuntimeInstance;
+    ApiLayerCreateInfo layerInfo = {4, 1, sizeof(ApiLayerCreateInfo)};
+    layerInfo.nextInfo = &nextInfo;
+
+    const char* extensions[] = {XR_KHR_OPENGL_ES_ENABLE_EXTENSION_NAME};
+    XrInstanceCreateInfo instanceInfo = {XR_TYPE_INSTANCE_CREATE_INFO};
+    strcpy(instanceInfo.applicationInfo.applicationName, "test_xr_timing_layer");
+    instanceInfo.applicationInfo.apiVersion = XR_MAKE_VERSION(1, 0, 0);
+    instanceInfo.enabledExtensionCount = 1;
+    instanceInfo.enabledExtensionNames = extensions;
+    XrInstance instance = XR_NULL_HANDLE;
+    CHECK(XR_SUCCEEDED(request.createApiLayerInstance(&instanceInfo, &layerInfo, &instance)), "no instance");
+    XrInstance second = XR_NULL_HANDLE;
+    CHECK(request.createApiLayerInstance(&instanceInfo, &layerInfo, &second) == XR_ERROR_LIMIT_REACHED,
+          "second instance timed");
+
+    // Wrapped, and passed through to the runtime.
+    auto waitFrame = get<PFN_xrWaitFrame>(layer, instance, "xrWaitFrame");
+    CHECK(waitFrame && reinterpret_cast<void*>(waitFrame) != reinterpret_cast<void*>(xrWaitFrame), "not wrapped");
+    auto createSession = get<PFN_xrCreateSession>(layer, instance, "xrCreateSession");
+    CHECK(createSession == get<PFN_xrCreateSession>(xrGetInstanceProcAddr, instance, "xrCreateSession"),
+          "not passed through");
+    auto beginFrame = get<PFN_xrBeginFrame>(layer, instance, "xrBeginFrame");
+    auto acquire = get<PFN_xrAcquireSwapchainImage>(layer, instance, "xrAcquireSwapchainImage");
+    auto waitImage = get<PFN_xrWaitSwapchainImage>(layer, instance, "xrWaitSwapchainImage");
+    auto release = get<PFN_xrReleaseSwapchainImage>(layer, instance, "xrReleaseSwapchainImage");
+    auto locateViews = get<PFN_xrLocateViews>(layer, instance, "xrLocateViews");
+    auto endFrame = get<PFN_xrEndFrame>(layer, instance, "xrEndFrame");
+    auto destroyInstance = get<PFN_xrDestroyInstance>(layer, instance, "xrDestroyInstance");
+
+    HostEgl egl;
+    if (!hostEglInit(&egl)) {
+        fprintf(stderr, "No EGL context\n");
+        return 1;
+    }
+    XrSystemGetInfo systemInfo = {XR_TYPE_SYSTEM_GET_INFO};
+    systemInfo.formFactor = XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY;
+    XrSystemId systemId = XR_NULL_SYSTEM_ID;
+    xrGetSystem(instance, &systemInfo, &systemId);
+    XrGraphicsBindingOpenGLESAndroidKHR binding = {XR_TYPE_GRAPHICS_BINDING_OPENGL_ES_ANDROID_KHR};
+    binding.display = egl.display;
+    binding.config = egl.config;
+    binding.context = egl.context;
+    XrSessionCreateInfo sessionInfo = {XR_TYPE_SESSION_CREATE_INFO};
+    sessionInfo.next = &binding;
+    sessionInfo.systemId = systemId;
+    XrSession session = XR_NULL_HANDLE;
+    CHECK(XR_SUCCEEDED(createSession(instance, &sessionInfo, &session)), "no session");
+    XrReferenceSpaceCreateInfo spaceInfo = {XR_TYPE_REFERENCE_SPACE_CREATE_INFO};
+    spaceInfo.referenceSpaceType = XR_REFERENCE_SPACE_TYPE_LOCAL;
+    spaceInfo.poseInReferenceSpace.orientation.w = 1.0f;
+    XrSpace space = XR_NULL_HANDLE;
+    xrCreateReferenceSpace(session, &spaceInfo, &space);
+    XrSwapchainCreateInfo swapchainInfo = {XR_TYPE_SWAPCHAIN_CREATE_INFO};
+    swapchainInfo.usageFlags = XR_SWAPCHAIN_USAGE_COLOR_ATTACHMENT_BIT;
+    swapchainInfo.format = GL_SRGB8_ALPHA8;
+    swapchainInfo.sampleCount = 1;
+    swapchainInfo.width = 64;
+    swapchainInfo.height = 64;
+    swapchainInfo.faceCount = 1;
+    swapchainInfo.arraySize = 1;
+    swapchainInfo.mipCount = 1;
+    XrSwapchain swapchain = XR_NULL_HANDLE;
+    CHECK(XR_SUCCEEDED(xrCreateSwapchain(session, &swapchainInfo, &swapchain)), "no swapchain");
+    XrSessionBeginInfo beginInfo = {XR_TYPE_SESSION_BEGIN_INFO};
+    beginInfo.primaryViewConfigurationType = XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO;
+    CHECK(XR_SUCCEEDED(xrBeginSession(session, &beginInfo)), "session did not begin");
+
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        XrFrameState frameState = {XR_TYPE_FRAME_STATE};
+        waitFrame(session, nullptr, &frameState);
+        beginFrame(session, nullptr);
+        uint32_t index = 0;
+        acquire(swapchain, nullptr, &index);
+        XrSwapchainImageWaitInfo imageWaitInfo = {XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO};
+        imageWaitInfo.timeout = XR_INFINITE_DURATION;
+        waitImage(swapchain, &imageWaitInfo);
+        XrViewLocateInfo locateInfo = {XR_TYPE_VIEW_LOCATE_INFO};
+        locateInfo.viewConfigurationType = XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO;
+        locateInfo.displayTime = frameState.predictedDisplayTime;
+        locateInfo.space = space;
+        XrViewState viewState = {XR_TYPE_VIEW_STATE};
+        XrView views[2] = {{XR_TYPE_VIEW}, {XR_TYPE_VIEW}};
+        uint32_t viewCount = 0;
+        locateViews(session, &locateInfo, &viewState, 2, &viewCount, views);
+        release(swapchain, nullptr);
+        XrFrameEndInfo endInfo = {XR_TYPE_FRAME_END_INFO};
+        endInfo.displayTime = frameState.predictedDisplayTime;
+        endInfo.environmentBlendMode = XR_ENVIRONMENT_BLEND_MODE_OPAQUE;
+        endFrame(session, &endInfo);
+    }
+    // A failing call is timed too, with its result.
+    XrFrameState frameState = {XR_TYPE_FRAME_STATE};
+    CHECK(waitFrame(XR_NULL_HANDLE, nullptr, &frameState) == XR_ERROR_HANDLE_INVALID, "bad session accepted");
+
+    xrDestroySwapchain(swapchain);
+    xrDestroySpace(space);
+    xrRequestExitSession(session);
+    xrEndSession(session);
+    xrDestroySession(session);
+    CHECK(XR_SUCCEEDED(destroyInstance(instance)), "instance not destroyed");
+    // The wrappers outlive the layer; a late call fails instead of reaching for it.
+    CHECK(endFrame(session, nullptr) == XR_ERROR_HANDLE_INVALID, "call after xrDestroyInstance accepted");
+    hostEglDestroy(&egl);
+
+    FILE* file = fopen(TRACE_PATH, "r");
+    CHECK(file != nullptr, "no trace written");
+    std::string trace;
+    if (file) {
+        char chunk[4096];
+        for (size_t read; (read = fread(chunk, 1, sizeof(chunk), file)) > 0;) {
+            trace.append(chunk, read);
+        }
+        fclose(file);
+    }
+    remove(TRACE_PATH);
+    CHECK(trace.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[") == 0, "not a trace");
+    const char* perFrame[] = {"xrBeginFrame", "xrAcquireSwapchainImage", "xrWaitSwapchainImage",
+                              "xrLocateViews", "xrReleaseSwapchainImage", "xrEndFrame"};
+    for (const char* name : perFrame) {
+        const size_t events = countOf(trace, std::string("{\"name\":\"") + name + "\"");
+        CHECK(events == FRAMES, "%zu %s events", events, name);
+        CHECK(trace.find(std::string("\"") + name + "\":{\"calls\":" + std::to_string(FRAMES) + ",") !=
+                      std::string::npos,
+              "no %s histogram", name);
+    }
+    const size_t waits = countOf(trace, "{\"name\":\"xrWaitFrame\"");
+    CHECK(waits == FRAMES + 1, "%zu xrWaitFrame events", waits);
+    CHECK(countOf(trace, "\"result\":\"XR_ERROR_HANDLE_INVALID\"") == 1, "failed call not traced");
+    CHECK(trace.find("\"results\":{\"XR_SUCCESS\":20,\"XR_ERROR_HANDLE_INVALID\":1}") != std::string::npos,
+          "xrWaitFrame results not counted");
+    CHECK(countOf(trace, "\"ph\":\"X\"") == FRAMES * 7 + 1, "%zu events", countOf(trace, "\"ph\":\"X\""));
+
+    return checkResult();
+}
@@ -11,6 +11,24 @@
 #include <openxr/openxr.h>
 #include <openxr/openxr_platform.h>
 
+#include "idle_looper.h"
+#include "overlay_layout.h"
+#include "quad_atlas.h"
+#include "session_lifecycle.h"
+#include "trace.h"
+#include "xr_events.h"
+
+// =================================================================================================
+// --- Quad Atlas Switch ---
+// Define this to render the panel into a sub-rect of a shared atlas swapchain (quad_atlas.h)
+// instead of a swapchain of its own. Acquire/wait/release then happen once per frame for all panels.
+//#define QUAD_ATLAS_MODE
+// =================================================================================================
+
+// Panel color, placement and resolution (see overlay_layout.h). The first panel in this asset
+// replaces the defaults in AppState::panel, so the panel moves without a rebuild.
+#define PANEL_LAYOUT_ASSET "overlay_layout.json"
+
 #define TAG "OverlayApp"
 #define LOGI(...) __android_log_print(ANDROID_LOG_INFO, TAG, __VA_ARGS__)
 #define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
@@ -38,35 +56,70 @@ struct AppState {
     XrInstance instance = XR_NULL_HANDLE;
     XrSystemId systemId = XR_NULL_SYSTEM_ID;
     XrSession session = XR_NULL_HANDLE;
-    XrSessionState sessionState = XR_SESSION_STATE_UNKNOWN;
+    // State machine and transition timestamps, see session_lifecycle.h.
+    SessionLifecycle lifecycle;
     XrSpace appSpace = XR_NULL_HANDLE;
-    bool sessionRunning = false;
     XrViewConfigurationType viewConfigType;
     XrEnvironmentBlendMode blendMode = XR_ENVIRONMENT_BLEND_MODE_OPAQUE;
 
     XrSwapchain swapchain = XR_NULL_HANDLE;
     uint32_t swapchainImageCount = 0;
     std::vector<GLuint> framebuffers;
-    uint32_t width = 512;
-    uint32_t height = 512;
+    OverlayPanelDesc panel = {"Magenta", 512, 512, {0.9f, 0.0f, 0.9f, 0.8f}, {{0,0,0,1}, {0.0f, 0.0f, -1.0f}}, {0.5f, 0.5f}};
+
+#if defined(QUAD_ATLAS_MODE)
+    QuadAtlas atlas;
+#endif
+
+    // Main loop pacing; other threads can wake it with idleLooperWake.
+    IdleLooper idleLooper;
+
+    // OpenXR event handlers, see xr_events.h.
+    XrEventDispatcher events;
 };
 
-void pollEvents(AppState* appState);
+static void onSessionStateChanged(AppState* appState, const XrEventDataSessionStateChanged& event);
+static void onInstanceLossPending(AppState* appState, const XrEventDataInstanceLossPending& event);
 void renderFrame(AppState* appState);
 
+// MainActivity.onCreate: base's FOCUSED time from the launch intent, 0 if base didn't launch us.
+extern "C" JNIEXPORT void JNICALL
+Java_com_example_addr_MainActivity_setLaunchReference(JNIEnv* env, jclass clazz, jlong baseFocusedNs) {
+    sessionLifecycleSetLaunchReference(static_cast<uint64_t>(baseFocusedNs));
+}
+
 void android_main(struct android_app* app) {
     LOGI("Overlay app starting up.");
+    // Left open by the early returns below, which end the app anyway.
+    TRACE_BEGIN("startup");
 
     EGLDisplay display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
     eglInitialize(display, nullptr, nullptr);
-    EGLConfig config;
+    EGLConfig config = nullptr;
+    // Rendering goes to swapchain images, so the config needs no window surfaces, only pbuffers
+    // (the default is window surfaces, which surfaceless EGL has none of).
     const EGLint configAttribs[] = {
             EGL_RENDERABLE_TYPE, EGL_OPENGL_ES3_BIT,
+            EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
             EGL_ALPHA_SIZE, 8,
             EGL_NONE
     };
-    EGLint numConfigs;
+    EGLint numConfigs = 0;
     eglChooseConfig(display, configAttribs, &config, 1, &numConfigs);
+    if (numConfigs == 0) {
+        // The swapchain images carry the alpha, not this config; any GLES3 config will do.
+        const EGLint anyConfigAttribs[] = {
+                EGL_RENDERABLE_TYPE, EGL_OPENGL_ES3_BIT,
+                EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+                EGL_NONE
+        };
+        LOGI("No EGL config with 8-bit alpha, taking any GLES3 config");
+        eglChooseConfig(display, anyConfigAttribs, &config, 1, &numConfigs);
+    }
+    if (numConfigs == 0) {
+        LOGE("No GLES3 EGL config: 0x%X", eglGetError());
+        return;
+    }
     const EGLint contextAttribs[] = {EGL_CONTEXT_CLIENT_VERSION, 3, EGL_NONE};
     EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
     eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context);
@@ -204,11 +257,28 @@ void android_main(struct android_app* app) {
     spaceCreateInfo.poseInReferenceSpace = {{0,0,0,1}, {0,0,0}};
     xrCreateReferenceSpace(appState.session, &spaceCreateInfo, &appState.appSpace);
 
+    OverlayLayout layout;
+    if (overlayLayoutLoadAsset(app->activity->assetManager, PANEL_LAYOUT_ASSET, &layout) && layout.panelCount > 0) {
+        appState.panel = layout.panels[0];
+    }
+
+#if defined(QUAD_ATLAS_MODE)
+    quadAtlasInit(&appState.atlas, 2048, 2048);
+    int32_t panelIndex = quadAtlasAddPanel(&appState.atlas, appState.panel.width, appState.panel.height);
+    if (panelIndex < 0 || !quadAtlasCreateSwapchain(&appState.atlas, appState.session, GL_SRGB8_ALPHA8)) {
+        LOGE("Atlas swapchain creation failed!");
+        return;
+    }
+    AtlasPanel& atlasPanel = appState.atlas.panels[panelIndex];
+    memcpy(atlasPanel.color, appState.panel.color, sizeof(atlasPanel.color));
+    atlasPanel.pose = appState.panel.pose;
+    atlasPanel.size = appState.panel.size;
+#else
     XrSwapchainCreateInfo swapchainCreateInfo = {XR_TYPE_SWAPCHAIN_CREATE_INFO};
     swapchainCreateInfo.usageFlags = XR_SWAPCHAIN_USAGE_COLOR_ATTACHMENT_BIT;
     swapchainCreateInfo.format = GL_SRGB8_ALPHA8;
-    swapchainCreateInfo.width = appState.width;
-    swapchainCreateInfo.height = appState.height;
+    swapchainCreateInfo.width = appState.panel.width;
+    swapchainCreateInfo.height = appState.panel.height;
     swapchainCreateInfo.sampleCount = 1;
     swapchainCreateInfo.faceCount = 1;
     swapchainCreateInfo.arraySize = 1;
@@ -225,62 +295,75 @@ void android_main(struct android_app* app) {
         glBindFramebuffer(GL_FRAMEBUFFER, appState.framebuffers[i]);
         glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, images[i].image, 0);
     }
+#endif
 
+    TRACE_END();
     LOGI("Overlay App initialized successfully");
 
+    // Blocks on the looper while nothing is rendered instead of spinning (idle_looper.h).
+    idleLooperInit(&appState.idleLooper, app->looper);
+    sessionLifecycleInit(&appState.lifecycle, appState.session, appState.viewConfigType, SESSION_END_ON_STOPPING,
+                         SessionCallbacks(), TAG);
+    xrEventsInit(&appState.events, &appState);
+    xrEventsOn<onSessionStateChanged>(&appState.events);
+    xrEventsOn<onInstanceLossPending>(&appState.events);
     while (!app->destroyRequested) {
-        struct android_poll_source* source;
-        while (ALooper_pollOnce(0, nullptr, nullptr, (void**)&source) >= 0) {
-            if (source) source->process(app, source);
-        }
-        pollEvents(&appState);
+        const bool rendering = appState.lifecycle.running && appState.resumed;
+        idleLooperPump(&appState.idleLooper, app, idleLooperTimeoutMs(appState.lifecycle.state, rendering));
+        xrEventsPoll(&appState.events, appState.instance);
         renderFrame(&appState);
     }
+    idleLooperDestroy(&appState.idleLooper);
 }
 
-void pollEvents(AppState* appState) {
-    XrEventDataBuffer eventData = {XR_TYPE_EVENT_DATA_BUFFER};
-    while (xrPollEvent(appState->instance, &eventData) == XR_SUCCESS) {
-        if (eventData.type == XR_TYPE_EVENT_DATA_SESSION_STATE_CHANGED) {
-            auto stateEvent = *reinterpret_cast<const XrEventDataSessionStateChanged*>(&eventData);
-            appState->sessionState = stateEvent.state;
-            LOGI("Overlay session state changed to: %d", appState->sessionState);
-
-            if (appState->sessionState == XR_SESSION_STATE_READY) {
-                XrSessionBeginInfo beginInfo = {XR_TYPE_SESSION_BEGIN_INFO};
-                beginInfo.primaryViewConfigurationType = appState->viewConfigType;
-                if (XR_SUCCEEDED(xrBeginSession(appState->session, &beginInfo))) {
-                    appState->sessionRunning = true;
-                    LOGI("Overlay session started successfully");
-                }
-            } else if (appState->sessionState == XR_SESSION_STATE_STOPPING) {
-                appState->sessionRunning = false;
-                xrEndSession(appState->session);
-                LOGI("Overlay session ended");
-            }
-        }
-        eventData = {XR_TYPE_EVENT_DATA_BUFFER};
-    }
+static void onSessionStateChanged(AppState* appState, const XrEventDataSessionStateChanged& event) {
+    sessionLifecycleHandleState(&appState->lifecycle, event);
+}
+
+static void onInstanceLossPending(AppState* appState, const XrEventDataInstanceLossPending&) {
+    LOGE("Overlay instance is about to be lost, exiting");
+    sessionLifecycleStop(&appState->lifecycle, false);
+    ANativeActivity_finish(appState->app->activity);
 }
 
 void renderFrame(AppState* appState) {
-    if (!appState->sessionRunning || !appState->resumed) return;
+    if (!appState->lifecycle.running || !appState->resumed) return;
+    TRACE_SCOPE("renderFrame");
 
     XrFrameState frameState = {XR_TYPE_FRAME_STATE};
+    TRACE_BEGIN("xrWaitFrame");
     xrWaitFrame(appState->session, nullptr, &frameState);
+    TRACE_END();
+    TRACE_BEGIN("xrBeginFrame");
     xrBeginFrame(appState->session, nullptr);
+    TRACE_END();
 
     const XrCompositionLayerBaseHeader* layerPtr = nullptr;
     static XrCompositionLayerQuad compositionLayer;
 
+    uint32_t layerCount = 0;
+    const XrCompositionLayerBaseHeader* const* layers = nullptr;
+
     if (frameState.shouldRender) {
+#if defined(QUAD_ATLAS_MODE)
+        if (quadAtlasBeginFrame(&appState->atlas)) {
+            quadAtlasClearPanels(&appState->atlas);
+            quadAtlasEndFrame(&appState->atlas);
+            layerCount = quadAtlasBuildLayers(&appState->atlas, appState->appSpace,
+                                              XR_COMPOSITION_LAYER_BLEND_TEXTURE_SOURCE_ALPHA_BIT);
+            layers = appState->atlas.layerPtrs;
+        }
+#else
         uint32_t imageIndex;
+        TRACE_BEGIN("xrAcquireSwapchainImage");
         xrAcquireSwapchainImage(appState->swapchain, nullptr, &imageIndex);
         XrSwapchainImageWaitInfo waitInfo = {XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO, nullptr, XR_INFINITE_DURATION};
         xrWaitSwapchainImage(appState->swapchain, &waitInfo);
+        TRACE_END();
 
+        TRACE_BEGIN("render panel");
         glBindFramebuffer(GL_FRAMEBUFFER, appState->framebuffers[imageIndex]);
-        glViewport(0, 0, appState->width, appState->height);
+        glViewport(0, 0, appState->panel.width, appState->panel.height);
 
         glEnable(GL_BLEND);
         if (appState->blendMode == XR_ENVIRONMENT_BLEND_MODE_ADDITIVE) {
@@ -293,26 +376,35 @@ void renderFrame(AppState* appState) {
         glClear(GL_COLOR_BUFFER_BIT);
 
         glBindFramebuffer(GL_FRAMEBUFFER, appState->framebuffers[imageIndex]);
-        // Changed from red to magenta
-        glClearColor(0.9f, 0.0f, 0.9f, 0.8f);
+        const float* color = appState->panel.color;
+        glClearColor(color[0], color[1], color[2], color[3]);
         glClear(GL_COLOR_BUFFER_BIT);
+        TRACE_END();
 
+        TRACE_BEGIN("xrReleaseSwapchainImage");
         xrReleaseSwapchainImage(appState->swapchain, nullptr);
+        TRACE_END();
 
         compositionLayer = {XR_TYPE_COMPOSITION_LAYER_QUAD};
         compositionLayer.layerFlags = XR_COMPOSITION_LAYER_BLEND_TEXTURE_SOURCE_ALPHA_BIT;
         compositionLayer.space = appState->appSpace;
-        compositionLayer.subImage = {{appState->swapchain}, {{0,0}, {(int32_t)appState->width, (int32_t)appState->height}}};
-        compositionLayer.pose = {{0,0,0,1}, {0.0f, 0.0f, -1.0f}};
-        compositionLayer.size = {0.5f, 0.5f};
+        compositionLayer.subImage = {{appState->swapchain}, {{0,0}, {(int32_t)appState->panel.width, (int32_t)appState->panel.height}}};
+        compositionLayer.pose = appState->panel.pose;
+        compositionLayer.size = appState->panel.size;
 
         layerPtr = reinterpret_cast<const XrCompositionLayerBaseHeader*>(&compositionLayer);
+        layerCount = 1;
+        layers = &layerPtr;
+#endif
     }
 
     XrFrameEndInfo endInfo = {XR_TYPE_FRAME_END_INFO};
     endInfo.displayTime = frameState.predictedDisplayTime;
     endInfo.environmentBlendMode = appState->blendMode;
-    endInfo.layerCount = (layerPtr ? 1 : 0);
-    endInfo.layers = (layerPtr ? &layerPtr : nullptr);
+    endInfo.layerCount = layerCount;
+    endInfo.layers = layers;
+    TRACE_BEGIN("xrEndFrame");
     xrEndFrame(appState->session, &endInfo);
+    TRACE_END();
+    sessionLifecycleFrameEnded(&appState->lifecycle, endInfo.layerCount);
 }
\ No newline at end of file
@@ -8,6 +8,11 @@ import android.view.WindowManager;
 public class MainActivity extends NativeActivity {
     private static final String TAG = "OverlayAppBlue";
 
+    // Set by base when it launches this overlay: its FOCUSED time, see session_lifecycle.h.
+    private static final String EXTRA_BASE_FOCUSED_NS = "com.example.androidsamsung.BASE_FOCUSED_NS";
+
+    private static native void setLaunchReference(long baseFocusedNs);
+
     static {
         System.loadLibrary("overlay_app_cpp");
     }
@@ -15,6 +20,7 @@ public class MainActivity extends NativeActivity {
     @Override
     protected void onCreate(Bundle savedInstanceState) {
         super.onCreate(savedInstanceState);
+        setLaunchReference(getIntent().getLongExtra(EXTRA_BASE_FOCUSED_NS, 0));
         Log.i(TAG, "Blue OverlayApp onCreate started");
 
         getWindow().addFlags(WindowManager.LayoutParams.FLAG_NOT_FOCUSABLE |
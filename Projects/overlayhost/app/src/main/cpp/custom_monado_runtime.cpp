@@ -0,0 +1,395 @@
+#include <android/log.h>
+#include "android_native_app_glue.h"
+#include <EGL/egl.h>
+#include <GLES3/gl3.h>
+#include <memory>
+#include <vector>
+#include <cstring>
+#include <ctime>
+
+#define XR_USE_PLATFORM_ANDROID
+#define XR_USE_GRAPHICS_API_OPENGL_ES
+#include <openxr/openxr.h>
+#include <openxr/openxr_platform.h>
+
+#include "idle_looper.h"
+#include "overlay_layout.h"
+#include "quad_atlas.h"
+#include "session_lifecycle.h"
+#include "state_channel.h"
+#include "trace.h"
+#include "xr_events.h"
+
+#define TAG "OverlayHost"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, TAG, __VA_ARGS__)
+
+// Define overlay extension structures directly to ensure they are available.
+#define XR_EXTX_OVERLAY_EXTENSION_NAME "XR_EXTX_overlay"
+#define XR_TYPE_SESSION_CREATE_INFO_OVERLAY_EXTX ((XrStructureType) 1000033000)
+
+typedef enum XrSessionLayersPlacementEXTX {
+    XR_SESSION_LAYERS_PLACEMENT_OVERLAY_EXTX = 1,
+    XR_SESSION_LAYERS_PLACEMENT_MAX_ENUM_EXTX = 0x7FFFFFFF
+} XrSessionLayersPlacementEXTX;
+
+typedef struct XrSessionCreateInfoOverlayEXTX {
+    XrStructureType type;
+    const void* XR_MAY_ALIAS next;
+    XrSessionCreateFlags createFlags;
+    XrSessionLayersPlacementEXTX sessionLayersPlacement;
+} XrSessionCreateInfoOverlayEXTX;
+
+// =================================================================================================
+// --- Panels ---
+// Every panel used to be its own overlay APK with its own process, EGL context, XrInstance and
+// session. Here they all share one overlay session and one atlas swapchain. Which panels exist,
+// and where, comes from this asset (see overlay_layout.h), so panels change without a rebuild.
+// =================================================================================================
+#define PANEL_LAYOUT_ASSET "overlay_layout.json"
+
+// Frame cost is logged as an average over this many frames.
+#define FRAME_COST_WINDOW 300
+
+// How long startup waits for base to hand over its state channel.
+#define BASE_STATE_CONNECT_TIMEOUT_MS 100
+#define BASE_STATE_POLL_BATCH 16
+
+struct AppState {
+    struct android_app* app;
+    bool resumed = false;
+    XrInstance instance = XR_NULL_HANDLE;
+    XrSystemId systemId = XR_NULL_SYSTEM_ID;
+    XrSession session = XR_NULL_HANDLE;
+    // State machine and transition timestamps, see session_lifecycle.h.
+    SessionLifecycle lifecycle;
+    XrSpace appSpace = XR_NULL_HANDLE;
+    XrViewConfigurationType viewConfigType;
+    XrEnvironmentBlendMode blendMode = XR_ENVIRONMENT_BLEND_MODE_OPAQUE;
+
+    // All panels live in one swapchain and go out as one quad layer each.
+    QuadAtlas atlas;
+
+    // CPU cost of renderFrame on this thread, to compare against one process per panel.
+    uint64_t frameCpuNs = 0;
+    uint32_t frameCostFrames = 0;
+
+    // Main loop pacing; other threads can wake it with idleLooperWake.
+    IdleLooper idleLooper;
+
+    // OpenXR event handlers, see xr_events.h.
+    XrEventDispatcher events;
+
+    // Base's live state (state_channel.h), read every frame; logged with the frame cost.
+    StateChannel baseState;
+    StateSnapshot baseSnapshot;
+    uint64_t baseSnapshotAgeMaxNs = 0;
+    char baseStatus[STATE_MESSAGE_TEXT_MAX] = {};
+};
+
+static void onSessionStateChanged(AppState* appState, const XrEventDataSessionStateChanged& event);
+static void onInstanceLossPending(AppState* appState, const XrEventDataInstanceLossPending& event);
+void renderFrame(AppState* appState);
+
+// MainActivity.onCreate: base's FOCUSED time from the launch intent, 0 if base didn't launch us.
+extern "C" JNIEXPORT void JNICALL
+Java_com_example_overlayhost_MainActivity_setLaunchReference(JNIEnv* env, jclass clazz, jlong baseFocusedNs) {
+    sessionLifecycleSetLaunchReference(static_cast<uint64_t>(baseFocusedNs));
+}
+
+static uint64_t threadCpuTimeNs() {
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+void android_main(struct android_app* app) {
+    LOGI("Overlay host starting up.");
+    // Left open by the early returns below, which end the app anyway.
+    TRACE_BEGIN("startup");
+
+    EGLDisplay display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    eglInitialize(display, nullptr, nullptr);
+    EGLConfig config = nullptr;
+    // Rendering goes to swapchain images, so the config needs no window surfaces, only pbuffers
+    // (the default is window surfaces, which surfaceless EGL has none of).
+    const EGLint configAttribs[] = {
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_ES3_BIT,
+            EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+            EGL_ALPHA_SIZE, 8,
+            EGL_NONE
+    };
+    EGLint numConfigs = 0;
+    eglChooseConfig(display, configAttribs, &config, 1, &numConfigs);
+    if (numConfigs == 0) {
+        // The swapchain images carry the alpha, not this config; any GLES3 config will do.
+        const EGLint anyConfigAttribs[] = {
+                EGL_RENDERABLE_TYPE, EGL_OPENGL_ES3_BIT,
+                EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+                EGL_NONE
+        };
+        LOGI("No EGL config with 8-bit alpha, taking any GLES3 config");
+        eglChooseConfig(display, anyConfigAttribs, &config, 1, &numConfigs);
+    }
+    if (numConfigs == 0) {
+        LOGE("No GLES3 EGL config: 0x%X", eglGetError());
+        return;
+    }
+    const EGLint contextAttribs[] = {EGL_CONTEXT_CLIENT_VERSION, 3, EGL_NONE};
+    EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+    eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context);
+
+    AppState appState = {};
+    appState.app = app;
+    app->userData = &appState;
+    app->onAppCmd = [](struct android_app* app, int32_t cmd) {
+        auto* state = (AppState*)app->userData;
+        if (cmd == APP_CMD_RESUME) state->resumed = true;
+        if (cmd == APP_CMD_PAUSE) state->resumed = false;
+    };
+
+    PFN_xrInitializeLoaderKHR xrInitializeLoaderKHR;
+    xrGetInstanceProcAddr(XR_NULL_HANDLE, "xrInitializeLoaderKHR", (PFN_xrVoidFunction*)&xrInitializeLoaderKHR);
+    XrLoaderInitInfoAndroidKHR loaderInitInfo = {XR_TYPE_LOADER_INIT_INFO_ANDROID_KHR};
+    loaderInitInfo.applicationVM = app->activity->vm;
+    loaderInitInfo.applicationContext = app->activity->clazz;
+    xrInitializeLoaderKHR((const XrLoaderInitInfoBaseHeaderKHR*)&loaderInitInfo);
+
+    uint32_t extensionCount = 0;
+    xrEnumerateInstanceExtensionProperties(nullptr, 0, &extensionCount, nullptr);
+    std::vector<XrExtensionProperties> extensions(extensionCount, {XR_TYPE_EXTENSION_PROPERTIES});
+    xrEnumerateInstanceExtensionProperties(nullptr, extensionCount, &extensionCount, extensions.data());
+
+    bool overlaySupported = false;
+    for (const auto& ext : extensions) {
+        if (strcmp(ext.extensionName, XR_EXTX_OVERLAY_EXTENSION_NAME) == 0) {
+            overlaySupported = true;
+            break;
+        }
+    }
+
+    if (!overlaySupported) {
+        LOGE("XR_EXTX_overlay extension is NOT SUPPORTED by the runtime!");
+        return;
+    }
+    LOGI("XR_EXTX_overlay extension is supported.");
+
+    std::vector<const char*> instanceExtensions = {
+            XR_KHR_ANDROID_CREATE_INSTANCE_EXTENSION_NAME,
+            XR_KHR_OPENGL_ES_ENABLE_EXTENSION_NAME,
+            XR_EXTX_OVERLAY_EXTENSION_NAME
+    };
+
+    XrApplicationInfo appInfo = {};
+    strcpy(appInfo.applicationName, "OverlayHost");
+    appInfo.apiVersion = XR_CURRENT_API_VERSION;
+
+    XrInstanceCreateInfoAndroidKHR instanceCreateInfoAndroid = {XR_TYPE_INSTANCE_CREATE_INFO_ANDROID_KHR};
+    instanceCreateInfoAndroid.applicationVM = app->activity->vm;
+    instanceCreateInfoAndroid.applicationActivity = app->activity->clazz;
+
+    XrInstanceCreateInfo instanceCreateInfo = {XR_TYPE_INSTANCE_CREATE_INFO};
+    instanceCreateInfo.next = &instanceCreateInfoAndroid;
+    instanceCreateInfo.applicationInfo = appInfo;
+    instanceCreateInfo.enabledExtensionCount = static_cast<uint32_t>(instanceExtensions.size());
+    instanceCreateInfo.enabledExtensionNames = instanceExtensions.data();
+
+    if (XR_FAILED(xrCreateInstance(&instanceCreateInfo, &appState.instance))) {
+        LOGE("xrCreateInstance failed");
+        return;
+    }
+
+    XrSystemGetInfo systemGetInfo = {XR_TYPE_SYSTEM_GET_INFO, nullptr, XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY};
+    if (XR_FAILED(xrGetSystem(appState.instance, &systemGetInfo, &appState.systemId))) {
+        LOGE("xrGetSystem failed");
+        return;
+    }
+
+    uint32_t viewConfigCount;
+    xrEnumerateViewConfigurations(appState.instance, appState.systemId, 0, &viewConfigCount, nullptr);
+    std::vector<XrViewConfigurationType> viewConfigs(viewConfigCount);
+    xrEnumerateViewConfigurations(appState.instance, appState.systemId, viewConfigCount, &viewConfigCount, viewConfigs.data());
+    appState.viewConfigType = viewConfigs[0];
+
+    uint32_t blendModeCount;
+    xrEnumerateEnvironmentBlendModes(appState.instance, appState.systemId, appState.viewConfigType, 0, &blendModeCount, nullptr);
+    std::vector<XrEnvironmentBlendMode> blendModes(blendModeCount);
+    xrEnumerateEnvironmentBlendModes(appState.instance, appState.systemId, appState.viewConfigType, blendModeCount, &blendModeCount, blendModes.data());
+
+    bool blendModeSet = false;
+    for (XrEnvironmentBlendMode mode : blendModes) {
+        if (mode == XR_ENVIRONMENT_BLEND_MODE_ALPHA_BLEND) {
+            appState.blendMode = XR_ENVIRONMENT_BLEND_MODE_ALPHA_BLEND;
+            LOGI("ALPHA_BLEND mode is supported and will be used.");
+            blendModeSet = true;
+            break;
+        }
+    }
+    if (!blendModeSet) {
+        for (XrEnvironmentBlendMode mode : blendModes) {
+            if (mode == XR_ENVIRONMENT_BLEND_MODE_ADDITIVE) {
+                appState.blendMode = XR_ENVIRONMENT_BLEND_MODE_ADDITIVE;
+                LOGI("ALPHA_BLEND not supported. Falling back to ADDITIVE blend mode.");
+                blendModeSet = true;
+                break;
+            }
+        }
+    }
+    if (!blendModeSet) {
+        LOGE("Neither ALPHA_BLEND nor ADDITIVE blend modes are supported! Overlay will be opaque.");
+        appState.blendMode = XR_ENVIRONMENT_BLEND_MODE_OPAQUE;
+    }
+
+    PFN_xrGetOpenGLESGraphicsRequirementsKHR pfnGetReqs;
+    xrGetInstanceProcAddr(appState.instance, "xrGetOpenGLESGraphicsRequirementsKHR", (PFN_xrVoidFunction*)&pfnGetReqs);
+    XrGraphicsRequirementsOpenGLESKHR graphicsRequirements = {XR_TYPE_GRAPHICS_REQUIREMENTS_OPENGL_ES_KHR};
+    pfnGetReqs(appState.instance, appState.systemId, &graphicsRequirements);
+
+    XrGraphicsBindingOpenGLESAndroidKHR graphicsBinding = {XR_TYPE_GRAPHICS_BINDING_OPENGL_ES_ANDROID_KHR};
+    graphicsBinding.display = eglGetCurrentDisplay();
+    graphicsBinding.context = eglGetCurrentContext();
+
+    XrSessionCreateInfoOverlayEXTX overlayInfo = {XR_TYPE_SESSION_CREATE_INFO_OVERLAY_EXTX};
+    overlayInfo.next = &graphicsBinding;
+    overlayInfo.createFlags = 0;
+    overlayInfo.sessionLayersPlacement = XR_SESSION_LAYERS_PLACEMENT_OVERLAY_EXTX;
+
+    XrSessionCreateInfo sessionCreateInfo = {XR_TYPE_SESSION_CREATE_INFO};
+    sessionCreateInfo.next = &overlayInfo;
+    sessionCreateInfo.systemId = appState.systemId;
+
+    if (XR_FAILED(xrCreateSession(appState.instance, &sessionCreateInfo, &appState.session))) {
+        LOGE("Overlay session creation failed!");
+        return;
+    }
+    LOGI("Overlay session created successfully.");
+
+    XrReferenceSpaceCreateInfo spaceCreateInfo = {XR_TYPE_REFERENCE_SPACE_CREATE_INFO};
+    spaceCreateInfo.referenceSpaceType = XR_REFERENCE_SPACE_TYPE_LOCAL;
+    spaceCreateInfo.poseInReferenceSpace = {{0,0,0,1}, {0,0,0}};
+    xrCreateReferenceSpace(appState.session, &spaceCreateInfo, &appState.appSpace);
+
+    // --- Pack every panel into one atlas swapchain ---
+    OverlayLayout layout;
+    if (!overlayLayoutLoadAsset(app->activity->assetManager, PANEL_LAYOUT_ASSET, &layout)) {
+        LOGE("No usable panel layout in '%s'!", PANEL_LAYOUT_ASSET);
+        return;
+    }
+    quadAtlasInit(&appState.atlas, 2048, 2048);
+    for (uint32_t i = 0; i < layout.panelCount; ++i) {
+        const OverlayPanelDesc& desc = layout.panels[i];
+        int32_t index = quadAtlasAddPanel(&appState.atlas, desc.width, desc.height);
+        if (index < 0) {
+            LOGE("Panel '%s' does not fit in the atlas, skipping it", desc.name);
+            continue;
+        }
+        AtlasPanel& panel = appState.atlas.panels[index];
+        memcpy(panel.color, desc.color, sizeof(panel.color));
+        panel.pose = desc.pose;
+        panel.size = desc.size;
+    }
+    if (!quadAtlasCreateSwapchain(&appState.atlas, appState.session, GL_SRGB8_ALPHA8)) {
+        LOGE("Atlas swapchain creation failed!");
+        return;
+    }
+
+    TRACE_END();
+    LOGI("Overlay host initialized successfully with %u panels", appState.atlas.panelCount);
+
+    // Blocks on the looper while nothing is rendered instead of spinning (idle_looper.h).
+    idleLooperInit(&appState.idleLooper, app->looper);
+    // Without base (or without being let in) the panels just don't get its state.
+    stateChannelConnect(&appState.baseState, STATE_CHANNEL_SOCKET, BASE_STATE_CONNECT_TIMEOUT_MS);
+    sessionLifecycleInit(&appState.lifecycle, appState.session, appState.viewConfigType, SESSION_END_ON_STOPPING,
+                         SessionCallbacks(), TAG);
+    xrEventsInit(&appState.events, &appState);
+    xrEventsOn<onSessionStateChanged>(&appState.events);
+    xrEventsOn<onInstanceLossPending>(&appState.events);
+    while (!app->destroyRequested) {
+        const bool rendering = appState.lifecycle.running && appState.resumed;
+        idleLooperPump(&appState.idleLooper, app, idleLooperTimeoutMs(appState.lifecycle.state, rendering));
+        xrEventsPoll(&appState.events, appState.instance);
+        renderFrame(&appState);
+    }
+    stateChannelDestroy(&appState.baseState);
+    idleLooperDestroy(&appState.idleLooper);
+
+    quadAtlasDestroy(&appState.atlas);
+}
+
+static void onSessionStateChanged(AppState* appState, const XrEventDataSessionStateChanged& event) {
+    sessionLifecycleHandleState(&appState->lifecycle, event);
+}
+
+static void onInstanceLossPending(AppState* appState, const XrEventDataInstanceLossPending&) {
+    LOGE("Overlay host instance is about to be lost, exiting");
+    sessionLifecycleStop(&appState->lifecycle, false);
+    ANativeActivity_finish(appState->app->activity);
+}
+
+// Base's latest snapshot and whatever it sent since the last frame; no waiting, no system calls.
+static void readBaseState(AppState* appState) {
+    if (stateChannelRead(&appState->baseState, &appState->baseSnapshot) != 0) {
+        const uint64_t ageNs = stateChannelNowNs() - appState->baseSnapshot.publishedNs;
+        if (ageNs > appState->baseSnapshotAgeMaxNs) {
+            appState->baseSnapshotAgeMaxNs = ageNs;
+        }
+    }
+    StateMessage messages[BASE_STATE_POLL_BATCH];
+    const uint32_t count = stateChannelPoll(&appState->baseState, messages, BASE_STATE_POLL_BATCH);
+    for (uint32_t i = 0; i < count; ++i) {
+        if (messages[i].type == STATE_MESSAGE_TEXT && messages[i].key == STATE_KEY_FRAME_STATS) {
+            memcpy(appState->baseStatus, messages[i].value.text, sizeof(appState->baseStatus));
+        }
+    }
+}
+
+void renderFrame(AppState* appState) {
+    if (!appState->lifecycle.running || !appState->resumed) return;
+    TRACE_SCOPE("renderFrame");
+
+    XrFrameState frameState = {XR_TYPE_FRAME_STATE};
+    TRACE_BEGIN("xrWaitFrame");
+    xrWaitFrame(appState->session, nullptr, &frameState);
+    TRACE_END();
+    const uint64_t cpuStart = threadCpuTimeNs();
+    TRACE_BEGIN("xrBeginFrame");
+    xrBeginFrame(appState->session, nullptr);
+    TRACE_END();
+    readBaseState(appState);
+
+    uint32_t layerCount = 0;
+    if (frameState.shouldRender && quadAtlasBeginFrame(&appState->atlas)) {
+        quadAtlasClearPanels(&appState->atlas);
+        quadAtlasEndFrame(&appState->atlas);
+        layerCount = quadAtlasBuildLayers(&appState->atlas, appState->appSpace,
+                                          XR_COMPOSITION_LAYER_BLEND_TEXTURE_SOURCE_ALPHA_BIT);
+    }
+
+    XrFrameEndInfo endInfo = {XR_TYPE_FRAME_END_INFO};
+    endInfo.displayTime = frameState.predictedDisplayTime;
+    endInfo.environmentBlendMode = appState->blendMode;
+    endInfo.layerCount = layerCount;
+    endInfo.layers = (layerCount > 0 ? appState->atlas.layerPtrs : nullptr);
+    TRACE_BEGIN("xrEndFrame");
+    xrEndFrame(appState->session, &endInfo);
+    TRACE_END();
+    sessionLifecycleFrameEnded(&appState->lifecycle, endInfo.layerCount);
+
+    // --- Frame cost (CPU time on this thread, excluding the xrWaitFrame block) ---
+    appState->frameCpuNs += threadCpuTimeNs() - cpuStart;
+    if (++appState->frameCostFrames == FRAME_COST_WINDOW) {
+        const double frameMs = static_cast<double>(appState->frameCpuNs) / FRAME_COST_WINDOW / 1e6;
+        const uint32_t panels = appState->atlas.panelCount > 0 ? appState->atlas.panelCount : 1;
+        LOGI("Frame CPU: %.3f ms (%.3f ms/panel, %u panels)", frameMs, frameMs / panels,
+             appState->atlas.panelCount);
+        if (appState->baseState.region) {
+            LOGI("Base state: frame %llu, up to %.2f ms old, %llu messages lost, \"%s\"",
+                 (unsigned long long)appState->baseSnapshot.frame, appState->baseSnapshotAgeMaxNs / 1e6,
+                 (unsigned long long)appState->baseState.lost, appState->baseStatus);
+            appState->baseSnapshotAgeMaxNs = 0;
+        }
+        appState->frameCpuNs = 0;
+        appState->frameCostFrames = 0;
+    }
+}
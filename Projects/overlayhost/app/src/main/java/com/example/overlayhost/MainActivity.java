@@ -0,0 +1,49 @@
+package com.example.overlayhost;
+
+import android.app.NativeActivity;
+import android.os.Bundle;
+import android.util.Log;
+import android.view.WindowManager;
+
+public class MainActivity extends NativeActivity {
+    private static final String TAG = "OverlayHost";
+
+    // Set by base when it launches this overlay: its FOCUSED time, see session_lifecycle.h.
+    private static final String EXTRA_BASE_FOCUSED_NS = "com.example.androidsamsung.BASE_FOCUSED_NS";
+
+    private static native void setLaunchReference(long baseFocusedNs);
+
+    static {
+        System.loadLibrary("overlay_host_cpp");
+    }
+
+    @Override
+    protected void onCreate(Bundle savedInstanceState) {
+        super.onCreate(savedInstanceState);
+        setLaunchReference(getIntent().getLongExtra(EXTRA_BASE_FOCUSED_NS, 0));
+        Log.i(TAG, "OverlayHost onCreate started");
+
+        // *** THIS IS THE MOST IMPORTANT FIX ***
+        // Set window flags to prevent this activity from taking focus from the base app.
+        // FLAG_NOT_FOCUSABLE: This window won't ever get key input focus.
+        // FLAG_NOT_TOUCH_MODAL: Events outside this window are sent to the window behind it.
+        // FLAG_NOT_TOUCHABLE: This window can never receive touch events, ensuring focus stays behind.
+        getWindow().addFlags(WindowManager.LayoutParams.FLAG_NOT_FOCUSABLE |
+                WindowManager.LayoutParams.FLAG_NOT_TOUCH_MODAL |
+                WindowManager.LayoutParams.FLAG_NOT_TOUCHABLE);
+
+        Log.i(TAG, "Set FLAG_NOT_FOCUSABLE and FLAG_NOT_TOUCHABLE on overlay window.");
+    }
+
+    @Override
+    protected void onResume() {
+        super.onResume();
+        Log.i(TAG, "OverlayHost onResume");
+    }
+
+    @Override
+    protected void onPause() {
+        super.onPause();
+        Log.i(TAG, "OverlayHost onPause");
+    }
+}
\ No newline at end of file